@@ -21,6 +21,8 @@
 
 // #define DEBUG_AMBASSADOR
 
+std::atomic<std::uint64_t> Ambassador::structure_generation{1};
+
 Ambassador::Ambassador(const std::string& modelname, const std::string& name)
     : Property(name, true),
       modelname(modelname),
@@ -29,6 +31,7 @@ Ambassador::Ambassador(const std::string& modelname, const std::string& name)
 }
 
 Ambassador::~Ambassador() {
+  changeStructure();
   removePropertyChangeListener(this);
 }
 
@@ -40,15 +43,18 @@ void Ambassador::store(PersistentManager* persistentmanager, const std::string&
 }
 
 void Ambassador::load(PersistentManager* persistentmanager, const std::string& keynamespace) {
+  // the subscribers hear about every loaded property once, after all of them are loaded
+  EventTransaction transaction;
   std::string ambassadorkeynamespace = keynamespace + getName() + ".";
   for (const auto &property : getProperties()) {
-    std::cout << "loading property " << ambassadorkeynamespace << property->getName() << std::endl;
+#ifdef DEBUG_AMBASSADOR
+    std::cerr << " (DD) loading property " << ambassadorkeynamespace << property->getName() << std::endl;
+#endif
     property->load(persistentmanager, ambassadorkeynamespace);
     if (property->makesDirty()) {
       setDirty(true);
     }
     notifyPropertyChange(property.get());
-    std::cout << "        with value " << property->toString() << std::endl;
   }
   if (isDirty()) clean();
 }
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <set>
 #include <string>
 #include <vector>
@@ -26,6 +28,9 @@
 
 class PersistentManager;
 
+template <typename T>
+class PropertyHandle;
+
 /**
  * @brief      The Ambassador listens on controls and delegates the
  *             changes to the model so that it can update it's data.
@@ -34,7 +39,7 @@ class PersistentManager;
 class Ambassador : public Property, public PropertyChangeListener, public ValueTypeInterface<Ambassador> {
 
   public:
-    static constexpr std::string_view EVENT_DOM_CHANGE{"dom_change"};
+    static constexpr EventId EVENT_DOM_CHANGE{"dom_change"};
 
     /**
     * @param modelname The name of the model.
@@ -157,6 +162,29 @@ class Ambassador : public Property, public PropertyChangeListener, public ValueT
 
     bool hasProperty(const std::string& path) const;
 
+    /**
+     * @brief Resolves a path once for repeated access to its value.
+     *
+     * @param path The path as for traversePath().
+     * @return PropertyHandle<T> A handle, valid as long as this ambassador.
+     *
+     * @throws runtime_error if the path does not lead to a property of type T
+     */
+    template <typename T>
+    PropertyHandle<T> compilePath(const std::string& path) const;
+
+    /**
+     * @brief Increased on every change of the structure of any ambassador,
+     * which invalidates the resolved paths of all PropertyHandles.
+     */
+    static std::uint64_t getStructureGeneration() {
+      return structure_generation.load(std::memory_order_acquire);
+    }
+
+    static void changeStructure() {
+      structure_generation.fetch_add(1, std::memory_order_acq_rel);
+    }
+
     const std::vector<std::unique_ptr<Property>>& getProperties() const {
       return properties;
     }
@@ -314,6 +342,10 @@ class Ambassador : public Property, public PropertyChangeListener, public ValueT
     friend Property;
     template <typename TVTI>
     friend class PropertyVTI;
+    template <typename T>
+    friend class PropertyHandle;
+
+    static std::atomic<std::uint64_t> structure_generation;
 
     int suspend_count{};
 
@@ -335,3 +367,5 @@ class Ambassador : public Property, public PropertyChangeListener, public ValueT
 
     bool is_dirty;
 };
+
+#include "propertyhandle.h"
@@ -83,6 +83,19 @@ static inline void ColorMap_setColorMode(ColorMap* colormap, int colormode) {
 
 unsigned char* ColorMap_getColorNormalized(ColorMap* colormap, unsigned char color[3], REAL value);
 
+/** @brief Maps many values at once, with the same colors as ColorMap_getColorNormalized.
+  *        Values before the table of a colorfile are black, like the ones after it.
+  * @param colors     count packed colors of channels bytes each
+  * @param channels   3 for RGB or 4 for RGBA, the alpha is always 255
+  */
+void ColorMap_getColorsNormalized(ColorMap* colormap, unsigned char* colors, int channels, const REAL* values, long count);
+
+/** @brief Maps many values at once, with the same colors as ColorMap_getColor.
+  * @param colors     count packed colors of channels bytes each
+  * @param channels   3 for RGB or 4 for RGBA, the alpha is always 255
+  */
+void ColorMap_getColors(ColorMap* colormap, unsigned char* colors, int channels, const REAL* values, long count, REAL min, REAL max);
+
 static inline unsigned char* ColorMap_getColor(ColorMap* colormap, unsigned char color[3], REAL value, REAL min, REAL max) {
   REAL scaledval;
 
@@ -26,3 +26,9 @@ Property* LinkedProperty::getProperty() const {
   }
   return property;
 }
+
+void LinkedProperty::fromString(const std::string& str) {
+  path = str;
+  // compiled paths may lead through this link
+  Ambassador::changeStructure();
+}
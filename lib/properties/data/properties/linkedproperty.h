@@ -40,9 +40,7 @@ class LinkedProperty : public Property, public AbstractValueTypeInterface {
       return getProperty()->getValueTypeInterface();
     }
 
-    void fromString(const std::string& str) override {
-      path = str;
-    }
+    void fromString(const std::string& str) override;
 
     std::string toString() const override {
       return path;
@@ -0,0 +1,270 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include <array>
+#include <filesystem>
+#include <system_error>
+#include <vector>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "binarypersistentmanager.h"
+
+namespace {
+
+const char HEADER[8] = {'K', 'S', 'P', 'R', 'O', 'P', 0, 1};
+
+const std::array<uint32_t, 256> CRC_TABLE = [] {
+  std::array<uint32_t, 256> table {};
+  for (uint32_t i = 0; i < 256; i++) {
+    uint32_t crc = i;
+    for (int bit = 0; bit < 8; bit++) {
+      crc = (crc & 1) ? (0xEDB88320u ^ (crc >> 1)) : (crc >> 1);
+    }
+    table[i] = crc;
+  }
+  return table;
+}();
+
+uint32_t crc32(const char* data, size_t size, uint32_t crc = 0) {
+  crc = ~crc;
+  for (size_t i = 0; i < size; i++) {
+    crc = CRC_TABLE[(crc ^ static_cast<uint8_t>(data[i])) & 0xFF] ^ (crc >> 8);
+  }
+  return ~crc;
+}
+
+void appendU32(std::string& buffer, uint32_t value) {
+  for (int i = 0; i < 4; i++) {
+    buffer += static_cast<char>((value >> (8 * i)) & 0xFF);
+  }
+}
+
+uint32_t readU32(const char* data) {
+  uint32_t value = 0;
+  for (int i = 0; i < 4; i++) {
+    value |= static_cast<uint32_t>(static_cast<uint8_t>(data[i])) << (8 * i);
+  }
+  return value;
+}
+
+bool syncFile(std::FILE* file) {
+  if (std::fflush(file) != 0) {
+    return false;
+  }
+#ifdef _WIN32
+  return _commit(_fileno(file)) == 0;
+#else
+  return fsync(fileno(file)) == 0;
+#endif
+}
+
+}
+
+BinaryPersistentManager::~BinaryPersistentManager() {
+  if (file) {
+    closeFileToSave(path);
+  }
+}
+
+bool BinaryPersistentManager::openFileToSave(const std::string& pathToFile) {
+  if (file) {
+    closeFileToSave(path);
+  }
+  std::error_code error;
+  // a compaction which did not finish, the file itself is still intact
+  std::filesystem::remove(pathToFile + ".compact", error);
+
+  uint64_t valid = 0;
+  if (std::filesystem::exists(pathToFile, error) && std::filesystem::file_size(pathToFile, error) > 0) {
+    valid = replay(pathToFile);
+    if (valid == 0) {
+      return false;
+    }
+    if (valid != std::filesystem::file_size(pathToFile, error)) {
+      std::filesystem::resize_file(pathToFile, valid, error);
+      if (error) {
+        return false;
+      }
+    }
+  } else {
+    values.clear();
+    records = 0;
+  }
+
+  file = std::fopen(pathToFile.c_str(), valid == 0 ? "wb" : "ab");
+  if (!file) {
+    return false;
+  }
+  path = pathToFile;
+  if (valid == 0 && std::fwrite(HEADER, 1, sizeof(HEADER), file) != sizeof(HEADER)) {
+    closeFileToSave(path);
+    return false;
+  }
+  return true;
+}
+
+void BinaryPersistentManager::closeFileToSave(const std::string& pathToFile) {
+  if (!file || pathToFile != path) {
+    return;
+  }
+  syncFile(file);
+  std::fclose(file);
+  file = nullptr;
+
+  if (records >= COMPACTION_MIN_RECORDS && records > COMPACTION_RATIO * values.size()) {
+    compact();
+  }
+}
+
+bool BinaryPersistentManager::loadFile(const std::string& pathToFile) {
+  return replay(pathToFile) != 0;
+}
+
+bool BinaryPersistentManager::removeNamespace(const std::string& keynamespace, const std::string& pathToFile) {
+  if (file && pathToFile == path) {
+    eraseNamespace(keynamespace);
+    return writeRecord(file, REMOVE_NAMESPACE, keynamespace, "");
+  }
+
+  BinaryPersistentManager other;
+  if (!other.openFileToSave(pathToFile)) {
+    return false;
+  }
+  other.eraseNamespace(keynamespace);
+  bool written = other.writeRecord(other.file, REMOVE_NAMESPACE, keynamespace, "");
+  other.closeFileToSave(pathToFile);
+  return written;
+}
+
+bool BinaryPersistentManager::compact() {
+  if (path.empty()) {
+    return false;
+  }
+  const bool reopen = (file != nullptr);
+  if (file) {
+    syncFile(file);
+    std::fclose(file);
+    file = nullptr;
+  }
+
+  const std::string compactpath = path + ".compact";
+  std::FILE *target = std::fopen(compactpath.c_str(), "wb");
+  bool written = target && std::fwrite(HEADER, 1, sizeof(HEADER), target) == sizeof(HEADER);
+  size_t compactrecords = 0;
+  for (auto iter = values.begin(); written && iter != values.end(); ++iter) {
+    written = writeRecord(target, STORE, iter->first, iter->second);
+    compactrecords++;
+  }
+  if (target) {
+    written = syncFile(target) && written;
+    std::fclose(target);
+  }
+
+  std::error_code error;
+  if (written) {
+    std::filesystem::rename(compactpath, path, error);
+    written = !error;
+  }
+  if (!written) {
+    std::filesystem::remove(compactpath, error);
+  } else {
+    records = compactrecords;
+  }
+
+  if (reopen) {
+    file = std::fopen(path.c_str(), "ab");
+  }
+  return written;
+}
+
+size_t BinaryPersistentManager::getRecordCount() const {
+  return records;
+}
+
+void BinaryPersistentManager::storeValue(const std::string& key, const std::string& value) {
+  KeyValuePersistentManager::storeValue(key, value);
+  if (file) {
+    writeRecord(file, STORE, key, value);
+  }
+}
+
+uint64_t BinaryPersistentManager::replay(const std::string& pathToFile) {
+  values.clear();
+  records = 0;
+
+  std::FILE *source = std::fopen(pathToFile.c_str(), "rb");
+  if (!source) {
+    return 0;
+  }
+  std::vector<char> content;
+  char chunk[1 << 16];
+  size_t read;
+  while ((read = std::fread(chunk, 1, sizeof(chunk), source)) > 0) {
+    content.insert(content.end(), chunk, chunk + read);
+  }
+  std::fclose(source);
+
+  if (content.size() < sizeof(HEADER) || !std::equal(HEADER, HEADER + sizeof(HEADER), content.begin())) {
+    return 0;
+  }
+
+  const size_t HEAD = 1 + 4 + 4;
+  size_t offset = sizeof(HEADER);
+  while (content.size() - offset >= HEAD + 4) {
+    const char *record = content.data() + offset;
+    const uint32_t keysize = readU32(record + 1);
+    const uint32_t valuesize = readU32(record + 5);
+    const uint64_t size = HEAD + static_cast<uint64_t>(keysize) + valuesize;
+    if (size + 4 > content.size() - offset || crc32(record, size) != readU32(record + size)) {
+      break;
+    }
+
+    std::string key(record + HEAD, keysize);
+    if (record[0] == STORE) {
+      values[std::move(key)].assign(record + HEAD + keysize, valuesize);
+    } else if (record[0] == REMOVE_NAMESPACE) {
+      eraseNamespace(key);
+    } else {
+      break;
+    }
+    records++;
+    offset += size + 4;
+  }
+  return offset;
+}
+
+bool BinaryPersistentManager::writeRecord(std::FILE* target, RecordType type, const std::string& key, const std::string& value) {
+  std::string record;
+  record.reserve(1 + 4 + 4 + key.size() + value.size() + 4);
+  record += static_cast<char>(type);
+  appendU32(record, static_cast<uint32_t>(key.size()));
+  appendU32(record, static_cast<uint32_t>(value.size()));
+  record += key;
+  record += value;
+  appendU32(record, crc32(record.data(), record.size()));
+
+  if (std::fwrite(record.data(), 1, record.size(), target) != record.size()) {
+    return false;
+  }
+  if (target == file) {
+    records++;
+  }
+  return true;
+}
@@ -0,0 +1,87 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include "keyvaluepersistentmanager.h"
+
+
+/**
+ * @brief      Stores the properties in a compact, append-only binary file.
+ * @ingroup    persistence
+ *
+ * The file starts with a header and continues with records, each
+ * followed by the CRC-32 of the record:
+ *
+ *   STORE            u8 1, u32 key size, u32 value size, key, value, u32 crc
+ *   REMOVE_NAMESPACE u8 2, u32 key size, u32 0, keynamespace, u32 crc
+ *
+ * Storing a property only appends a record if its value changed. Loading
+ * replays the records and stops at the first one which is incomplete or
+ * does not match its checksum, which is what a crash while appending
+ * leaves behind. openFileToSave() cuts such a tail off.
+ *
+ * When the file holds more than COMPACTION_RATIO times as many records as
+ * keys, closeFileToSave() rewrites it with one record per key. The new
+ * file is written next to the old one, synced and renamed over it, so a
+ * crash leaves either the old or the new file.
+ */
+class BinaryPersistentManager : public KeyValuePersistentManager {
+  public:
+    BinaryPersistentManager() = default;
+    ~BinaryPersistentManager() override;
+
+    bool openFileToSave(const std::string& pathToFile) override;
+    void closeFileToSave(const std::string& pathToFile) override;
+    bool loadFile(const std::string& pathToFile) override;
+    bool removeNamespace(const std::string& keynamespace, const std::string& pathToFile) override;
+
+    /**
+     * @brief      Rewrites the file opened to save with one record per key.
+     */
+    bool compact();
+
+    /**
+     * @brief      The number of records in the file opened or loaded last.
+     */
+    size_t getRecordCount() const;
+
+    static constexpr size_t COMPACTION_RATIO = 2;
+    static constexpr size_t COMPACTION_MIN_RECORDS = 256;
+
+  protected:
+    void storeValue(const std::string& key, const std::string& value) override;
+
+  private:
+    enum RecordType : uint8_t {
+      STORE = 1,
+      REMOVE_NAMESPACE = 2,
+    };
+
+    /**
+     * @return     The offset behind the last valid record, 0 if the file
+     *             could not be read
+     */
+    uint64_t replay(const std::string& pathToFile);
+    bool writeRecord(std::FILE* target, RecordType type, const std::string& key, const std::string& value);
+
+    std::FILE *file = nullptr;
+    std::string path;
+    size_t records = 0;
+};
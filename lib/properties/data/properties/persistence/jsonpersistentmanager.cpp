@@ -0,0 +1,264 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <system_error>
+
+#include "jsonpersistentmanager.h"
+
+namespace {
+
+void appendJsonString(std::string& json, const std::string& value) {
+  static const char HEX[] = "0123456789abcdef";
+  json += '"';
+  for (char c : value) {
+    switch (c) {
+      case '"':  json += "\\\""; break;
+      case '\\': json += "\\\\"; break;
+      case '\n': json += "\\n"; break;
+      case '\r': json += "\\r"; break;
+      case '\t': json += "\\t"; break;
+      case '\b': json += "\\b"; break;
+      case '\f': json += "\\f"; break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          json += "\\u00";
+          json += HEX[(c >> 4) & 0xF];
+          json += HEX[c & 0xF];
+        } else {
+          json += c;
+        }
+    }
+  }
+  json += '"';
+}
+
+void appendUtf8(std::string& text, uint32_t codepoint) {
+  if (codepoint < 0x80) {
+    text += static_cast<char>(codepoint);
+  } else if (codepoint < 0x800) {
+    text += static_cast<char>(0xC0 | (codepoint >> 6));
+    text += static_cast<char>(0x80 | (codepoint & 0x3F));
+  } else if (codepoint < 0x10000) {
+    text += static_cast<char>(0xE0 | (codepoint >> 12));
+    text += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+    text += static_cast<char>(0x80 | (codepoint & 0x3F));
+  } else {
+    text += static_cast<char>(0xF0 | (codepoint >> 18));
+    text += static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+    text += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+    text += static_cast<char>(0x80 | (codepoint & 0x3F));
+  }
+}
+
+/// reads the JSON subset written by appendJsonString, an object of strings
+class JsonReader {
+  public:
+    explicit JsonReader(std::string_view json) : json(json) {}
+
+    bool readObject(std::map<std::string, std::string>& members) {
+      skipSpace();
+      if (!consume('{')) return false;
+      skipSpace();
+      if (consume('}')) return atEnd();
+      while (true) {
+        std::string key, value;
+        skipSpace();
+        if (!readString(key)) return false;
+        skipSpace();
+        if (!consume(':')) return false;
+        skipSpace();
+        if (!readString(value)) return false;
+        members[std::move(key)] = std::move(value);
+        skipSpace();
+        if (consume('}')) return atEnd();
+        if (!consume(',')) return false;
+      }
+    }
+
+  private:
+    bool readString(std::string& text) {
+      if (!consume('"')) return false;
+      while (position < json.size()) {
+        char c = json[position++];
+        if (c == '"') return true;
+        if (static_cast<unsigned char>(c) < 0x20) return false;
+        if (c != '\\') {
+          text += c;
+          continue;
+        }
+        if (position == json.size()) return false;
+        switch (json[position++]) {
+          case '"':  text += '"'; break;
+          case '\\': text += '\\'; break;
+          case '/':  text += '/'; break;
+          case 'n':  text += '\n'; break;
+          case 'r':  text += '\r'; break;
+          case 't':  text += '\t'; break;
+          case 'b':  text += '\b'; break;
+          case 'f':  text += '\f'; break;
+          case 'u': {
+            uint32_t codepoint;
+            if (!readHex(codepoint)) return false;
+            if (codepoint >= 0xD800 && codepoint < 0xDC00) {
+              uint32_t low;
+              if (!consume('\\') || !consume('u') || !readHex(low) || low < 0xDC00 || low >= 0xE000) return false;
+              codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+            }
+            appendUtf8(text, codepoint);
+            break;
+          }
+          default:
+            return false;
+        }
+      }
+      return false;
+    }
+
+    bool readHex(uint32_t& value) {
+      if (json.size() - position < 4) return false;
+      value = 0;
+      for (int i = 0; i < 4; i++) {
+        char c = json[position++];
+        value <<= 4;
+        if (c >= '0' && c <= '9') value |= c - '0';
+        else if (c >= 'a' && c <= 'f') value |= c - 'a' + 10;
+        else if (c >= 'A' && c <= 'F') value |= c - 'A' + 10;
+        else return false;
+      }
+      return true;
+    }
+
+    bool consume(char expected) {
+      if (position < json.size() && json[position] == expected) {
+        position++;
+        return true;
+      }
+      return false;
+    }
+
+    void skipSpace() {
+      while (position < json.size() && (json[position] == ' ' || json[position] == '\n' || json[position] == '\r' || json[position] == '\t')) {
+        position++;
+      }
+    }
+
+    bool atEnd() {
+      skipSpace();
+      return position == json.size();
+    }
+
+    std::string_view json;
+    size_t position = 0;
+};
+
+bool readFile(const std::string& pathToFile, std::string& content) {
+  std::ifstream stream(pathToFile, std::ios::binary);
+  if (!stream) {
+    return false;
+  }
+  std::ostringstream buffer;
+  buffer << stream.rdbuf();
+  content = buffer.str();
+  return true;
+}
+
+}
+
+bool JsonPersistentManager::openFileToSave(const std::string& pathToFile) {
+  std::error_code error;
+  if (std::filesystem::exists(pathToFile, error)) {
+    if (!loadFile(pathToFile)) {
+      return false;
+    }
+  } else {
+    values.clear();
+  }
+  path = pathToFile;
+  return true;
+}
+
+void JsonPersistentManager::closeFileToSave(const std::string& pathToFile) {
+  if (pathToFile != path) {
+    return;
+  }
+  if (!write(pathToFile)) {
+    std::cerr << "  (WW) Could not write " << pathToFile << std::endl;
+  }
+  path.clear();
+}
+
+bool JsonPersistentManager::loadFile(const std::string& pathToFile) {
+  std::string content;
+  return readFile(pathToFile, content) && fromJson(content);
+}
+
+bool JsonPersistentManager::removeNamespace(const std::string& keynamespace, const std::string& pathToFile) {
+  if (pathToFile == path) {
+    eraseNamespace(keynamespace);
+    return true;
+  }
+  JsonPersistentManager other;
+  if (!other.loadFile(pathToFile)) {
+    return false;
+  }
+  other.eraseNamespace(keynamespace);
+  return other.write(pathToFile);
+}
+
+std::string JsonPersistentManager::toJson() const {
+  std::string json = "{";
+  bool first = true;
+  for (const auto& [key, value] : values) {
+    json += first ? "\n  " : ",\n  ";
+    appendJsonString(json, key);
+    json += ": ";
+    appendJsonString(json, value);
+    first = false;
+  }
+  json += values.empty() ? "}\n" : "\n}\n";
+  return json;
+}
+
+bool JsonPersistentManager::fromJson(std::string_view json) {
+  std::map<std::string, std::string> members;
+  if (!JsonReader(json).readObject(members)) {
+    return false;
+  }
+  values = std::move(members);
+  return true;
+}
+
+bool JsonPersistentManager::write(const std::string& pathToFile) const {
+  const std::string temporarypath = pathToFile + ".tmp";
+  {
+    std::ofstream stream(temporarypath, std::ios::binary | std::ios::trunc);
+    if (!stream) {
+      return false;
+    }
+    stream << toJson();
+    stream.flush();
+    if (!stream) {
+      return false;
+    }
+  }
+  std::error_code error;
+  std::filesystem::rename(temporarypath, pathToFile, error);
+  return !error;
+}
@@ -0,0 +1,59 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include "keyvaluepersistentmanager.h"
+
+
+/**
+ * @brief      Stores the properties in a human readable JSON file, one
+ *             member per key, sorted by key:
+ *
+ *               {
+ *                 "session.model.color": "(255,0,0)",
+ *                 "session.model.name": "sample"
+ *               }
+ *
+ *             openFileToSave() reads the file if it exists, so other
+ *             namespaces in it are kept. closeFileToSave() writes the
+ *             whole file next to the old one and renames it over it.
+ * @ingroup    persistence
+ */
+class JsonPersistentManager : public KeyValuePersistentManager {
+  public:
+    bool openFileToSave(const std::string& pathToFile) override;
+    void closeFileToSave(const std::string& pathToFile) override;
+    bool loadFile(const std::string& pathToFile) override;
+    bool removeNamespace(const std::string& keynamespace, const std::string& pathToFile) override;
+
+    std::string toJson() const;
+
+    /**
+     * @brief      Replaces all values with the members of a JSON object
+     *             of strings.
+     * @return     False if the text is no such object, the values are
+     *             left unchanged then.
+     */
+    bool fromJson(std::string_view json);
+
+  private:
+    bool write(const std::string& pathToFile) const;
+
+    std::string path;
+};
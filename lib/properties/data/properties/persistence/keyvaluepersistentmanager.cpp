@@ -0,0 +1,87 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include <iostream>
+#include <stdexcept>
+
+#include "../../property.h"
+#include "keyvaluepersistentmanager.h"
+
+
+void KeyValuePersistentManager::storeProperty(const Property* property, const std::string& keynamespace) {
+  std::string value;
+  try {
+    value = property->toString();
+  } catch (const std::runtime_error&) {
+    // property not applicable for toString operation
+    return;
+  }
+
+  const std::string key = keynamespace + property->getName();
+  auto iter = values.find(key);
+  if (iter != values.end() && iter->second == value) {
+    return;
+  }
+  storeValue(key, value);
+}
+
+void KeyValuePersistentManager::loadProperty(Property* property, const std::string& keynamespace) {
+  auto iter = values.find(keynamespace + property->getName());
+  if (iter == values.end()) {
+    return;
+  }
+  try {
+    property->fromString(iter->second);
+  } catch (const std::exception& error) {
+    std::cerr << "  (WW) Could not load " << iter->first << ": " << error.what() << std::endl;
+  }
+}
+
+bool KeyValuePersistentManager::getValue(const std::string& key, std::string& value) const {
+  auto iter = values.find(key);
+  if (iter == values.end()) {
+    return false;
+  }
+  value = iter->second;
+  return true;
+}
+
+size_t KeyValuePersistentManager::getSize() const {
+  return values.size();
+}
+
+bool KeyValuePersistentManager::isInNamespace(const std::string& key, const std::string& keynamespace) {
+  if (key.compare(0, keynamespace.size(), keynamespace) != 0) {
+    return false;
+  }
+  return keynamespace.empty() || keynamespace.back() == '.' || key.size() == keynamespace.size() || key[keynamespace.size()] == '.';
+}
+
+void KeyValuePersistentManager::storeValue(const std::string& key, const std::string& value) {
+  values[key] = value;
+}
+
+size_t KeyValuePersistentManager::eraseNamespace(const std::string& keynamespace) {
+  size_t erased = 0;
+  for (auto iter = values.lower_bound(keynamespace); iter != values.end() && iter->first.compare(0, keynamespace.size(), keynamespace) == 0;) {
+    if (isInNamespace(iter->first, keynamespace)) {
+      iter = values.erase(iter);
+      erased++;
+    } else {
+      ++iter;
+    }
+  }
+  return erased;
+}
@@ -0,0 +1,57 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#pragma once
+
+#include <map>
+#include <string>
+
+#include "persistentmanager.h"
+
+
+/**
+ * @brief      Base of the PersistentManagers which keep the textual value
+ *             of each property under its key, the keynamespace followed by
+ *             the name of the property, e.g. "session.model.value".
+ * @ingroup    persistence
+ */
+class KeyValuePersistentManager : public PersistentManager {
+  public:
+    void storeProperty(const Property* property, const std::string& keynamespace) override;
+    void loadProperty(Property* property, const std::string& keynamespace) override;
+
+    bool getValue(const std::string& key, std::string& value) const;
+    size_t getSize() const;
+
+    /**
+     * @brief      True if key is keynamespace itself or lies below it.
+     *             A keynamespace ending with '.' matches all keys it prefixes.
+     */
+    static bool isInNamespace(const std::string& key, const std::string& keynamespace);
+
+  protected:
+    /**
+     * @brief      Called by storeProperty() for every value differing from
+     *             the one already stored under that key.
+     */
+    virtual void storeValue(const std::string& key, const std::string& value);
+
+    /**
+     * @return     The number of removed keys
+     */
+    size_t eraseNamespace(const std::string& keynamespace);
+
+    std::map<std::string, std::string> values;
+};
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <string>
+
 class Property;
 
 
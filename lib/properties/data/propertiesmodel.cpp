@@ -33,6 +33,7 @@ Property* PropertiesModel::addProperty(Property* const property) {
   }
 
   properties.emplace_back(property);
+  changeStructure();
 
   if (property->makesDirty()) {
     setDirty(true);
@@ -89,5 +90,6 @@ void PropertiesModel::removeProperty(const std::string& name) {
 
   if (iter != properties.end()) {
     properties.erase(iter);
+    changeStructure();
   }
 }
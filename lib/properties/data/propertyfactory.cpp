@@ -17,6 +17,7 @@
 #include "property.h"
 #include "properties.h"
 #include "propertyfactory.h"
+#include "valuetypeinterface/numerictext.h"
 
 #include "wrapper.h"
 extern "C" {
@@ -157,9 +158,14 @@ Property* PropertyFactory::createProperty(const std::string& name, Keytype* keyt
   }
 
   if (!default_value.empty()) {
-    property->fromString(default_value);
-    ValueTypeInterfaceHint *hint = property->updateHint();
-    hint->setEntry("default", default_value);
+    // defaults come from tool descriptions, workflows and settings, a malformed one must not prevent the property
+    try {
+      property->fromString(default_value);
+      ValueTypeInterfaceHint *hint = property->updateHint();
+      hint->setEntry("default", default_value);
+    } catch (const NumericTextError& error) {
+      std::cerr << "Ignoring the default '" << default_value << "' of key '" << name << "': " << error.what() << std::endl;
+    }
   }
 
   return property;
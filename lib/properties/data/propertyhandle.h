@@ -0,0 +1,109 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "ambassador.h"
+
+/**
+ * @brief      A property path of an Ambassador resolved to its typed
+ *             value type interface.
+ *
+ *             The path is split once and only traversed again after the
+ *             structure of any ambassador changed, otherwise an access
+ *             is a comparison and a pointer dereference. A handle must
+ *             not outlive the ambassador it was compiled for.
+ *
+ * @tparam     T     The value type of the property.
+ * @ingroup    data
+ */
+template <typename T>
+class PropertyHandle {
+
+  public:
+    PropertyHandle()
+        : ambassador(nullptr), vti(nullptr), property(nullptr), generation(0) {
+    }
+
+    PropertyHandle(const Ambassador* ambassador, const std::string& path)
+        : ambassador(ambassador), vti(nullptr), property(nullptr), generation(0) {
+      if (!path.empty() && path.front() == '/') {
+        this->ambassador = ambassador->getRootAmbassador();
+      }
+      segments = cpputils::split(path, "/");
+      resolve();
+    }
+
+    const T& getValue() const {
+      return getVTI()->getValue();
+    }
+
+    void getValue(T& value) const {
+      getVTI()->getValue(value);
+    }
+
+    void setValue(const T& value) const {
+      getVTI()->setValue(value);
+    }
+
+    Property* getProperty() const {
+      getVTI();
+      return property;
+    }
+
+    /**
+     * @throws     runtime_error if the path does not lead to a property of
+     *             type T (anymore).
+     */
+    ValueTypeInterface<T>* getVTI() const {
+      if (generation != Ambassador::getStructureGeneration()) {
+        resolve();
+      }
+      return vti;
+    }
+
+    bool isValid() const {
+      return ambassador != nullptr;
+    }
+
+  private:
+    void resolve() const {
+      if (!ambassador) {
+        throw std::runtime_error("PropertyHandle is not bound to an ambassador");
+      }
+      const std::uint64_t current = Ambassador::getStructureGeneration();
+      property = ambassador->traversePath(segments);
+      if (property == nullptr) {
+        throw std::runtime_error("Property path does not lead to a property.");
+      }
+      vti = ambassador->getVTI<T>(property);
+      generation = current;
+    }
+
+    const Ambassador *ambassador;
+    std::vector<std::string> segments;
+    mutable ValueTypeInterface<T> *vti;
+    mutable Property *property;
+    mutable std::uint64_t generation;
+};
+
+template <typename T>
+PropertyHandle<T> Ambassador::compilePath(const std::string& path) const {
+  return PropertyHandle<T>(this, path);
+}
@@ -29,13 +29,13 @@
 class AbstractValueTypeInterface : public GlobalClassMap {
 
   public:
-    static constexpr std::string_view EVENT_AVTI_CHANGED{"avti_changed"};
-    static constexpr std::string_view EVENT_DESTROYED{"destroyed"};
+    static constexpr EventId EVENT_AVTI_CHANGED{"avti_changed"};
+    static constexpr EventId EVENT_DESTROYED{"destroyed"};
 
     AbstractValueTypeInterface() = default;
 
     virtual ~AbstractValueTypeInterface() {
-      event_bus.publish(EVENT_DESTROYED, nullptr);
+      event_bus.publishNow(EVENT_DESTROYED);
     }
 
     bool isDerivedFromBaseClass(const std::type_info& base_info) const {
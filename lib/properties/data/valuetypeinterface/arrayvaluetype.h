@@ -17,6 +17,7 @@
 #include <array>
 #include <regex>
 
+#include "elementaccessor.h"
 #include "valuetypeinterface.h"
 #include "valuetypeinterfacecontainer.h"
 #include "valuetypeinterfaceiterator.h"
@@ -122,6 +123,14 @@ class ArrayValueType : public ValueTypeInterface<std::array<T, N>>, public Abstr
       return element_type_interface;
     }
 
+    AbstractValueTypeInterface* getElement(size_t key) override {
+      return elements.get(value, key, AbstractValueTypeInterface::updateHint());
+    }
+
+    void forEachElement(const std::function<void(AbstractValueTypeInterface*)>& function) override {
+      elements.forEach(value, AbstractValueTypeInterface::updateHint(), function);
+    }
+
     void fromString(const std::string& str) override {
       fromStringInternal(str, value);
       notify(getValue());
@@ -166,6 +175,11 @@ class ArrayValueType : public ValueTypeInterface<std::array<T, N>>, public Abstr
 
     value_type value;
 
+    // the storage of an array never moves, so the interfaces need no rebind
+    ElementAccessor<array_t, ElementTypeInterface<array_t, T>> elements {[this] {
+      notify(getValue());
+    }};
+
   private:
     static value_type initializer_default(const T& defaultvalue) {
       array_t value;
@@ -93,6 +93,7 @@ class DynamicValueType : public VectorValueType<AbstractValueTypeInterface*>, pu
       }
       value.clear();
       value = std::move(v);
+      elements.rebind(value);
     }
 
 };
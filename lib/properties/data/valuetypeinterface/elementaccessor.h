@@ -0,0 +1,117 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+class ValueTypeInterfaceHint;
+
+/**
+ * @brief      Owns the element interfaces of a vector, array or matrix.
+ * @ingroup    valuetypeinterface
+ *
+ * getElementVTI() creates a new ElementTypeInterface on each call which
+ * subscribes to its own change event to notify the container. The
+ * accessor instead keeps one interface per key, created on first access
+ * and reused afterwards, and all of them call the same changed callback
+ * of the container.
+ *
+ * The interfaces stay valid as long as their key is in range, the
+ * container has to call rebind() whenever the size or the storage of
+ * its value changes. Interfaces of keys out of range are destroyed,
+ * which emits their destroyed event, VTIWidgets of them disable
+ * themselves on it.
+ *
+ * forEach() visits all elements with a single interface pointed to one
+ * element after the other, which does not allocate at all.
+ */
+template <typename containerT, typename ElementT>
+class ElementAccessor {
+  public:
+    explicit ElementAccessor(std::function<void()> changed)
+        : changed(std::move(changed)) {
+    }
+
+    ElementAccessor(const ElementAccessor&) = delete;
+    ElementAccessor& operator=(const ElementAccessor&) = delete;
+
+    ElementT* get(containerT& container, size_t key, ValueTypeInterfaceHint* hint) {
+      if (key >= container.size()) {
+        return nullptr;
+      }
+      if (key >= elements.size()) {
+        elements.resize(key + 1);
+      }
+      std::unique_ptr<ElementT>& element = elements[key];
+      if (!element) {
+        element = create(container, key, hint);
+      }
+      return element.get();
+    }
+
+    template <typename F>
+    void forEach(containerT& container, ValueTypeInterfaceHint* hint, F&& function) {
+      if (container.empty()) {
+        return;
+      }
+      if (!cursor) {
+        cursor = create(container, 0, hint);
+      }
+      for (size_t key = 0; key < container.size(); key++) {
+        cursor->rebind(container, key);
+        function(cursor.get());
+      }
+    }
+
+    /**
+     * @brief      Points all interfaces to the current storage of the
+     *             container and drops the ones out of range.
+     */
+    void rebind(containerT& container) {
+      if (elements.size() > container.size()) {
+        elements.resize(container.size());
+      }
+      for (size_t key = 0; key < elements.size(); key++) {
+        if (elements[key]) {
+          elements[key]->rebind(container, key);
+        }
+      }
+    }
+
+    /**
+     * @brief      The number of interfaces created so far.
+     */
+    size_t getPoolSize() const {
+      size_t count = 0;
+      for (const auto& element : elements) {
+        if (element) count++;
+      }
+      return count;
+    }
+
+  private:
+    std::unique_ptr<ElementT> create(containerT& container, size_t key, ValueTypeInterfaceHint* hint) {
+      auto element = std::make_unique<ElementT>(container, key, hint);
+      element->forwardChanges(&changed);
+      return element;
+    }
+
+    std::function<void()> changed;
+    std::vector<std::unique_ptr<ElementT>> elements;
+    std::unique_ptr<ElementT> cursor;
+};
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <functional>
 #include <sstream>
 
 #include "../../utils/traits.h"
@@ -38,7 +39,7 @@ class ElementTypeInterface : public ValueTypeInterface<T> {
 
   public:
     explicit ElementTypeInterface(T& value, ValueTypeInterfaceHint* hint)
-        : ValueTypeInterface<T>(), value(value), hint(hint) {
+        : ValueTypeInterface<T>(), element(&value), hint(hint) {
       AbstractValueTypeInterface::StateDerivation<ValueTypeInterface<T>>();
     }
     explicit ElementTypeInterface(containerT& container, size_t key, ValueTypeInterfaceHint* hint)
@@ -46,12 +47,36 @@ class ElementTypeInterface : public ValueTypeInterface<T> {
     }
 
     const_reference getValue() const override {
-      return value;
+      return *element;
     }
 
     using ValueTypeInterface<T>::setValue;
     using ValueTypeInterface<T>::getValue;
 
+    /**
+     * @brief      Points the interface to another element, used by
+     *             ElementAccessor to reuse its interfaces.
+     */
+    void rebind(containerT& container, size_t key) {
+      element = &container[key];
+    }
+
+    /**
+     * @brief      Points the interface to another element, used by
+     *             containers which keep their interfaces by key.
+     */
+    void rebind(T& value) {
+      element = &value;
+    }
+
+    /**
+     * @brief      Calls changed after each change of the element, all
+     *             interfaces of an ElementAccessor share the same callback.
+     */
+    void forwardChanges(const std::function<void()>* changed) {
+      forward = changed;
+    }
+
     void fromString(const std::string& str) override {
       value_type value;
       fromStringInternal(str, value);
@@ -78,6 +103,11 @@ class ElementTypeInterface : public ValueTypeInterface<T> {
   protected:
     void setValueRaw(value_type v) override {
       setValueRawInternal(v);
+      forwardChange();
+    }
+
+    void forwardChange() const {
+      if (forward) (*forward)();
     }
 
     template<typename P = T>
@@ -89,14 +119,14 @@ class ElementTypeInterface : public ValueTypeInterface<T> {
     template<typename P = T>
     typename std::enable_if<!std::is_same<P, const std::remove_const_t<P>>::value && std::is_base_of<AbstractValueTypeInterface, std::remove_pointer_t<P>>::value, void>::type
     setValueRawInternal(const T& v) {
-      delete value;
-      value = v;
+      delete *element;
+      *element = v;
     }
 
     template<typename P = T>
     typename std::enable_if<!std::is_same<P, const std::remove_const_t<P>>::value && !std::is_base_of<AbstractValueTypeInterface, std::remove_pointer_t<P>>::value, void>::type
     setValueRawInternal(const T& value) {
-      this->value = value;
+      *element = value;
     }
 
     // T is pointing to a class deriving from AbstractValueTypeInterface
@@ -159,16 +189,26 @@ class ElementTypeInterface : public ValueTypeInterface<T> {
       return "";
     };
 
-    T &value;
+    T *element;
 
     ValueTypeInterfaceHint *hint;
+    const std::function<void()> *forward = nullptr;
 };
 
 template <typename containerT>
 class ElementTypeInterface<containerT, bool> : public ValueType<bool> {
   public:
     explicit ElementTypeInterface(containerT& container, size_t key, ValueTypeInterfaceHint* hint)
-        : ValueType<bool>(container[key]), container(container), key(key), hint(hint) {
+        : ValueType<bool>(container[key]), container(&container), key(key), hint(hint) {
+    }
+
+    void rebind(containerT& container, size_t key) {
+      this->container = &container;
+      this->key = key;
+    }
+
+    void forwardChanges(const std::function<void()>* changed) {
+      forward = changed;
     }
 
     virtual const ValueTypeInterfaceHint* getHint() const override {
@@ -182,22 +222,24 @@ class ElementTypeInterface<containerT, bool> : public ValueType<bool> {
       // we need to make sure that the shadow variable is syncronized with the value of the vector
       // as this can not be a reference in the case of bool
       // if this does not work in all cases we could use a mutal bool value and try to use that here
-      *const_cast<bool*>(&(ValueType<bool>::value)) = container[key];
+      *const_cast<bool*>(&(ValueType<bool>::value)) = (*container)[key];
       return ValueType<bool>::getValue();
     }
 
   private:
     void setValueRaw(bool v) override {
       ValueType<bool>::setValueRaw(v);
-      container[key] = v;
+      (*container)[key] = v;
+      if (forward) (*forward)();
     }
 
   protected:
 
-    containerT &container;
+    containerT *container;
     size_t      key;
 
     ValueTypeInterfaceHint *hint;
+    const std::function<void()> *forward = nullptr;
 };
 
 template <typename containerT>
@@ -207,6 +249,10 @@ class ElementTypeInterface<containerT, const bool> : public ElementTypeInterface
         : ElementTypeInterface<std::remove_const_t<containerT>, bool>::ElementTypeInterface(*const_cast<std::remove_const_t<containerT>*>(&container), key, hint) {
     }
 
+    void rebind(containerT& container, size_t key) {
+      ElementTypeInterface<std::remove_const_t<containerT>, bool>::rebind(*const_cast<std::remove_const_t<containerT>*>(&container), key);
+    }
+
     void fromString(const std::string& /*str*/) override {
       throw std::runtime_error("ElementTypeInterface::fromString can not write to constant value for type '" + std::string(typeid(const bool).name()) + "'.");
     }
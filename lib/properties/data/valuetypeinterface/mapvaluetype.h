@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <functional>
+#include <memory>
 #include <unordered_map>
 #include <regex>
 
@@ -95,8 +97,22 @@ class MapValueType : public ValueTypeInterface<std::unordered_map<Key, T>>, publ
       return getElementVTI(key);
     }
 
+    AbstractValueTypeInterface* getElement(size_t index) override {
+      if (index >= value.size()) {
+        return nullptr;
+      }
+      const Key &key = indexToKey(getValue(), index);
+      std::unique_ptr<ElementTypeInterface<map_t, T>>& element = elements[key];
+      if (!element) {
+        element = std::make_unique<ElementTypeInterface<map_t, T>>(value[key], AbstractValueTypeInterface::updateHint());
+        element->forwardChanges(&changed);
+      }
+      return element.get();
+    }
+
     void fromString(const std::string& str) override {
       fromStringInternal(str, value);
+      rebindElements();
       notify(getValue());
     }
 
@@ -152,11 +168,13 @@ class MapValueType : public ValueTypeInterface<std::unordered_map<Key, T>>, publ
 
     void remove(const Key& toerase) {
       value.erase(toerase);
+      elements.erase(toerase);
       notify(value);
     }
 
     void clear() noexcept {
       value.clear();
+      elements.clear();
       notify(value);
     }
 
@@ -187,6 +205,23 @@ class MapValueType : public ValueTypeInterface<std::unordered_map<Key, T>>, publ
     void setValueRaw(map_t rawmap) override {
       value.clear();
       value = std::move(rawmap);
+      rebindElements();
+    }
+
+    /**
+     * @brief      Points the interfaces to the entries of the current map
+     *             and destroys the ones whose key is gone.
+     */
+    void rebindElements() {
+      for (auto iter = elements.begin(); iter != elements.end();) {
+        auto entry = value.find(iter->first);
+        if (entry == value.end()) {
+          iter = elements.erase(iter);
+        } else {
+          iter->second->rebind(entry->second);
+          ++iter;
+        }
+      }
     }
 
     const Key& indexToKey(const_reference value, unsigned int index) const {
@@ -218,4 +253,10 @@ class MapValueType : public ValueTypeInterface<std::unordered_map<Key, T>>, publ
     }
 
     map_t value;
+
+    // the interfaces are kept by key, an index moves to another key whenever the map changes
+    std::function<void()> changed {[this] {
+      notify(getValue());
+    }};
+    std::unordered_map<Key, std::unique_ptr<ElementTypeInterface<map_t, T>>> elements;
 };
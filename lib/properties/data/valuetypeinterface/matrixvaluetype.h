@@ -14,9 +14,10 @@
 
 #pragma once
 
-#include <regex>
 #include <vector>
 
+#include "elementaccessor.h"
+#include "numerictext.h"
 #include "vectorvaluetype.h"
 #include "valuetypeinterfaceiterator.h"
 #include "valuetypeinterface.h"
@@ -42,19 +43,32 @@ class ElementVectorTypeInterface : public ElementTypeInterface<containerT, vecto
     }
 
     AbstractValueTypeInterface* getElementVTI(size_t key) override {
-      if (key >= value.size()) {
+      if (key >= element->size()) {
         return nullptr;
       }
-      auto element_type_interface = new ElementTypeInterface<vectorT, T>(value, key, updateHint());
+      auto element_type_interface = new ElementTypeInterface<vectorT, T>(*element, key, updateHint());
 
       element_type_interface->onValueChange([this](const T&) {
         // if the element changes, call the signal_function of the whole ContainerVTI with the current value
-        notify(value);
+        notify(*element);
       }).release();
 
       return element_type_interface;
     }
 
+    AbstractValueTypeInterface* getElement(size_t key) override {
+      return elements.get(*element, key, updateHint());
+    }
+
+    void forEachElement(const std::function<void(AbstractValueTypeInterface*)>& function) override {
+      elements.forEach(*element, updateHint(), function);
+    }
+
+    void rebind(containerT& container, size_t key) {
+      ElementTypeInterface<containerT, vectorT>::rebind(container, key);
+      elements.rebind(*element);
+    }
+
     using ElementTypeInterface<containerT, vectorT>::setValue;
     using ElementTypeInterface<containerT, vectorT>::getValue;
 
@@ -70,7 +84,11 @@ class ElementVectorTypeInterface : public ElementTypeInterface<containerT, vecto
 
     bool compareToString(const std::string& cmp_string) const override {
       std::remove_const_t<vectorT> value;
-      fromStringInternal(cmp_string, value);
+      try {
+        fromStringInternal(cmp_string, value);
+      } catch (const NumericTextError&) {
+        return false;
+      }
       return (value == getValue());
     }
 
@@ -79,12 +97,19 @@ class ElementVectorTypeInterface : public ElementTypeInterface<containerT, vecto
     }
 
     ValueTypeInterfaceContainer::iterator end() override {
-      return ValueTypeInterfaceContainer::iterator(value.size(), this);
+      return ValueTypeInterfaceContainer::iterator(element->size(), this);
     }
 
     using ElementTypeInterface<containerT, vectorT>::getHint;
     using ElementTypeInterface<containerT, vectorT>::updateHint;
 
+  protected:
+    void setValueRaw(std::remove_const_t<vectorT> v) override {
+      this->setValueRawInternal(std::move(v));
+      elements.rebind(*element);
+      this->forwardChange();
+    }
+
   private:
 
     template<typename P = vectorT>
@@ -96,24 +121,24 @@ class ElementVectorTypeInterface : public ElementTypeInterface<containerT, vecto
     template<typename P = vectorT>
     typename std::enable_if<!std::is_same<P, const std::remove_const_t<P>>::value, void>::type
     fromStringInternal(const std::string& str, std::remove_const_t<P>& value) const {
-      static const std::regex regex("(?:\\(|,)([^,)]*)(?:\\)|)");
-      std::sregex_iterator iter(str.begin(), str.end(), regex);
-
-      size_t columncount = std::distance(iter, std::sregex_iterator());
-      // size_t columncount = value.size();
-      value.resize(columncount);
-
-      size_t actualcolumn = 0;
-      for (; iter != std::sregex_iterator(); ++iter) {
-        std::string token = *(++((*iter).begin())); // first is the total match, so we want the second match
-        auto element_type_interface = ElementTypeInterface<vectorT, T>(value, actualcolumn, nullptr);
-        element_type_interface.fromString(token);
-        actualcolumn++;
+      if constexpr (NumericText::is_numeric<T>) {
+        NumericText::parseVector(str, value);
+      } else {
+        value.clear();
+        size_t position = NumericText::splitVector(str, 0, [&str, &value](size_t begin, size_t end) {
+          value.emplace_back();
+          auto element_type_interface = ElementTypeInterface<vectorT, T>(value, value.size() - 1, nullptr);
+          element_type_interface.fromString(str.substr(begin, end - begin));
+        });
+        NumericText::expectEnd(str, position);
       }
     }
 
     template<typename P = vectorT>
     std::string toStringInternal(const P& value) const {
+      if constexpr (NumericText::is_numeric<T>) {
+        return NumericText::formatVector(value);
+      }
       std::string result = "(";
       for (size_t i = 0; i < value.size(); i++) {
         ElementTypeInterface<const vectorT, const T> element_type_interface(value, i, nullptr);
@@ -125,7 +150,13 @@ class ElementVectorTypeInterface : public ElementTypeInterface<containerT, vecto
     }
 
     using ElementTypeInterface<containerT, vectorT>::notify;
-    using ElementTypeInterface<containerT, vectorT>::value;
+    using ElementTypeInterface<containerT, vectorT>::element;
+
+    ElementAccessor<vectorT, ElementTypeInterface<vectorT, T>> elements {[this] {
+      // a changed element changes the row and with it the matrix
+      notify(*element);
+      this->forwardChange();
+    }};
 };
 
 
@@ -205,12 +236,31 @@ class MatrixValueType : public ValueTypeInterface<std::vector<std::vector<T>>>,
       return element_type_interface;
     }
 
+    AbstractValueTypeInterface* getElement(size_t key) override {
+      return rows.get(value, key, AbstractValueTypeInterface::updateHint());
+    }
+
+    AbstractValueTypeInterface* getElement(size_t row, size_t column) {
+      auto row_type_interface = rows.get(value, row, AbstractValueTypeInterface::updateHint());
+      return row_type_interface ? row_type_interface->getElement(column) : nullptr;
+    }
+
+    void forEachElement(const std::function<void(AbstractValueTypeInterface*)>& function) override {
+      rows.forEach(value, AbstractValueTypeInterface::updateHint(), function);
+    }
+
     void fromString(const std::string& str) override {
-      fromStringInternal(str, value);
+      matrix_t parsed;
+      fromStringInternal(str, parsed);
+      value = std::move(parsed);
+      rows.rebind(value);
       notify(getValue());
     }
 
     std::string toString() const override {
+      if constexpr (NumericText::is_numeric<T>) {
+        return NumericText::formatMatrix(value);
+      }
       std::string result = "[";
       for (unsigned int i = 0; i < value.size(); i++) {
         auto element_type_interface = ElementVectorTypeInterface<const matrix_t, const vector_t, const T>(value, i, nullptr);
@@ -223,7 +273,11 @@ class MatrixValueType : public ValueTypeInterface<std::vector<std::vector<T>>>,
 
     bool compareToString(const std::string& cmp_string) const override {
       std::remove_const_t<matrix_t> cmp_value;
-      fromStringInternal(cmp_string, cmp_value);
+      try {
+        fromStringInternal(cmp_string, cmp_value);
+      } catch (const NumericTextError&) {
+        return false;
+      }
 
       if (cmp_value.size() != getValue().size()) return false;
       for (size_t i = 0; i < cmp_value.size(); i++) {
@@ -261,12 +315,14 @@ class MatrixValueType : public ValueTypeInterface<std::vector<std::vector<T>>>,
 
     void addRow(const vector_t& val) {
       value.push_back(val);
+      rows.rebind(value);
       checkEqualRowSize(value);
       notify(value);
     }
 
     void clear() noexcept {
       value.clear();
+      rows.rebind(value);
       notify(value);
     }
 
@@ -292,6 +348,7 @@ class MatrixValueType : public ValueTypeInterface<std::vector<std::vector<T>>>,
   private:
     void setValueRaw(matrix_t matrix) override {
       value = std::move(matrix);
+      rows.rebind(value);
     }
 
     bool keyInBounds(const std::pair<size_t, size_t>& key) const {
@@ -318,22 +375,26 @@ class MatrixValueType : public ValueTypeInterface<std::vector<std::vector<T>>>,
     }
 
     void fromStringInternal(const std::string& str, typename ValueTypeInterface<matrix_t>::reference value) const {
-      static const std::regex regex("(?:\\[|,)(\\([^)]*\\))*(?:|\\])");
-      std::sregex_iterator iter(str.begin(), str.end(), regex);
-
-      unsigned int rowcount = std::distance(iter, std::sregex_iterator());
-      // const int rowcount = value.size();
-      value.resize(rowcount);
-
-      size_t actualrow = 0;
-      for (; iter != std::sregex_iterator(); ++iter) {
-        std::string token = *(++((*iter).begin())); // first is the total match, so we want the second match
-        ElementVectorTypeInterface<matrix_t, vector_t, T> element_type_interface(value, actualrow, nullptr);
-        element_type_interface.fromString(token);
-        actualrow++;
+      if constexpr (NumericText::is_numeric<T>) {
+        NumericText::parseMatrix(str, value);
+      } else {
+        value.clear();
+        size_t position = NumericText::splitMatrix(str, 0, [&str, &value](size_t begin) {
+          vector_t& row = value.emplace_back();
+          return NumericText::splitVector(str, begin, [&str, &row](size_t begin, size_t end) {
+            row.emplace_back();
+            ElementTypeInterface<vector_t, T> element_type_interface(row, row.size() - 1, nullptr);
+            element_type_interface.fromString(str.substr(begin, end - begin));
+          });
+        });
+        NumericText::expectEnd(str, position);
       }
     }
 
     using ValueTypeInterface<std::vector<std::vector<T>>>::notify;
     matrix_t value;
+
+    ElementAccessor<matrix_t, ElementVectorTypeInterface<matrix_t, vector_t, T>> rows {[this] {
+      notify(getValue());
+    }};
 };
@@ -0,0 +1,282 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#pragma once
+
+#include <charconv>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief      Error thrown by NumericText when the text of a vector or
+ *             matrix is malformed, knows the offset of the offending
+ *             character in the parsed text.
+ * @ingroup    valuetypeinterface
+ */
+class NumericTextError : public std::invalid_argument {
+  public:
+    NumericTextError(const std::string& message, size_t position)
+        : std::invalid_argument(message + " at position " + std::to_string(position)),
+          position(position) {
+    }
+
+    size_t getPosition() const {
+      return position;
+    }
+
+  private:
+    size_t position;
+};
+
+/**
+ * @brief      Parser and formatter for the textual representation of
+ *             vectors "(1,2,3)" and matrices "[(1,2),(3,4)]".
+ *
+ *             Numbers are read with std::from_chars and written with
+ *             std::to_chars, without a stream or a temporary string per
+ *             element. The output is the same as the one of operator<<,
+ *             floating point values use the general format with six
+ *             significant digits.
+ *
+ *             Whitespace around numbers and brackets is skipped, an
+ *             empty element is read as T{} like the stream based parser
+ *             did. Everything else which is not a number throws a
+ *             NumericTextError pointing to it.
+ *
+ *             Element types which are not numbers are split at the same
+ *             delimiters and handed to a callback token by token.
+ * @ingroup    valuetypeinterface
+ */
+class NumericText {
+  public:
+    /**
+     * True for the types read and written by from_chars/to_chars,
+     * bool and the character types keep their stream semantics.
+     */
+    template <typename T, typename U = std::remove_cv_t<T>>
+    static constexpr bool is_numeric = std::is_arithmetic_v<U>
+                                       && !std::is_same_v<U, bool>
+                                       && !std::is_same_v<U, char>
+                                       && !std::is_same_v<U, signed char>
+                                       && !std::is_same_v<U, unsigned char>
+                                       && !std::is_same_v<U, wchar_t>
+                                       && !std::is_same_v<U, char8_t>
+                                       && !std::is_same_v<U, char16_t>
+                                       && !std::is_same_v<U, char32_t>;
+
+    template <typename T>
+    static void appendNumber(std::string& out, T value) {
+      char buffer[64];
+      std::to_chars_result result;
+      if constexpr (std::is_floating_point_v<T>) {
+        result = std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::general, 6);
+      } else {
+        result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+      }
+      out.append(buffer, result.ptr);
+    }
+
+    template <typename T>
+    static void appendVector(std::string& out, const std::vector<T>& vector) {
+      out += '(';
+      for (size_t i = 0; i < vector.size(); i++) {
+        if (i > 0) out += ',';
+        appendNumber(out, vector[i]);
+      }
+      out += ')';
+    }
+
+    template <typename T>
+    static std::string formatVector(const std::vector<T>& vector) {
+      std::string result;
+      result.reserve(2 + vector.size() * estimatedWidth<T>());
+      appendVector(result, vector);
+      return result;
+    }
+
+    template <typename T>
+    static std::string formatMatrix(const std::vector<std::vector<T>>& matrix) {
+      std::string result;
+      result.reserve(2 + matrix.size() * (3 + (matrix.empty() ? 0 : matrix[0].size()) * estimatedWidth<T>()));
+      result += '[';
+      for (size_t i = 0; i < matrix.size(); i++) {
+        if (i > 0) result += ',';
+        appendVector(result, matrix[i]);
+      }
+      result += ']';
+      return result;
+    }
+
+    /**
+     * @brief      Reads a single number spanning the whole token, apart
+     *             from surrounding whitespace.
+     * @param      text     The complete text, only used for the error position
+     * @param      begin    Offset of the token in text
+     * @param      end      Offset behind the token in text
+     */
+    template <typename T>
+    static void parseNumber(std::string_view text, size_t begin, size_t end, T& value) {
+      while (begin < end && isSpace(text[begin])) begin++;
+      while (end > begin && isSpace(text[end - 1])) end--;
+      if (begin == end) {
+        value = T{};
+        return;
+      }
+
+      const char *first = text.data() + begin;
+      const char *last = text.data() + end;
+      // from_chars does not accept the leading plus operator>> allows
+      if (*first == '+' && last - first > 1 && *(first + 1) != '-') first++;
+
+      std::from_chars_result result;
+      if constexpr (std::is_floating_point_v<T>) {
+        result = std::from_chars(first, last, value, std::chars_format::general);
+      } else {
+        result = std::from_chars(first, last, value);
+      }
+
+      if (result.ec == std::errc::result_out_of_range) {
+        throw NumericTextError("Number '" + std::string(text.substr(begin, end - begin)) + "' out of range", begin);
+      }
+      if (result.ec != std::errc() || result.ptr != last) {
+        size_t position = (result.ec == std::errc()) ? static_cast<size_t>(result.ptr - text.data()) : begin;
+        throw NumericTextError("Invalid number '" + std::string(text.substr(begin, end - begin)) + "'", position);
+      }
+    }
+
+    /**
+     * @brief      Splits a vector "(a,b,c)" starting at offset position
+     *             into its elements.
+     * @param      element  Called with the offsets of each element token
+     * @return     The offset behind the closing bracket
+     */
+    template <typename Callback>
+    static size_t splitVector(std::string_view text, size_t position, Callback&& element) {
+      position = skipSpace(text, position);
+      expect(text, position, '(');
+      position++;
+
+      size_t first = skipSpace(text, position);
+      if (first < text.size() && text[first] == ')') {
+        return first + 1;
+      }
+
+      while (true) {
+        size_t begin = position;
+        while (position < text.size() && text[position] != ',' && text[position] != ')') {
+          position++;
+        }
+        if (position == text.size()) {
+          throw NumericTextError("Missing ')'", position);
+        }
+        element(begin, position);
+        if (text[position++] == ')') {
+          return position;
+        }
+      }
+    }
+
+    template <typename T>
+    static void parseVector(std::string_view text, std::vector<T>& vector) {
+      vector.clear();
+      size_t position = parseVectorAt(text, 0, vector);
+      expectEnd(text, position);
+    }
+
+    template <typename T>
+    static void parseMatrix(std::string_view text, std::vector<std::vector<T>>& matrix) {
+      size_t rowcount = 0;
+      size_t position = splitMatrix(text, 0, [&text, &matrix, &rowcount](size_t begin) {
+        if (rowcount == matrix.size()) matrix.emplace_back();
+        std::vector<T>& row = matrix[rowcount];
+        row.clear();
+        if (rowcount > 0) row.reserve(matrix[0].size());
+        rowcount++;
+        return parseVectorAt(text, begin, row);
+      });
+      matrix.resize(rowcount);
+      expectEnd(text, position);
+    }
+
+    /**
+     * @brief      Splits a matrix "[(a,b),(c,d)]" into its rows.
+     * @param      row      Called with the offset of each row, returns the
+     *                      offset behind that row
+     * @return     The offset behind the closing bracket
+     */
+    template <typename Callback>
+    static size_t splitMatrix(std::string_view text, size_t position, Callback&& row) {
+      position = skipSpace(text, position);
+      expect(text, position, '[');
+      position = skipSpace(text, position + 1);
+
+      if (position < text.size() && text[position] == ']') {
+        return position + 1;
+      }
+
+      while (true) {
+        position = skipSpace(text, row(position));
+        if (position == text.size()) {
+          throw NumericTextError("Missing ']'", position);
+        }
+        if (text[position] == ']') {
+          return position + 1;
+        }
+        expect(text, position, ',');
+        position++;
+      }
+    }
+
+    static void expectEnd(std::string_view text, size_t position) {
+      position = skipSpace(text, position);
+      if (position != text.size()) {
+        throw NumericTextError(std::string("Unexpected '") + text[position] + "' after the closing bracket", position);
+      }
+    }
+
+  private:
+    template <typename T>
+    static size_t parseVectorAt(std::string_view text, size_t position, std::vector<T>& vector) {
+      return splitVector(text, position, [&text, &vector](size_t begin, size_t end) {
+        parseNumber(text, begin, end, vector.emplace_back());
+      });
+    }
+
+    template <typename T>
+    static constexpr size_t estimatedWidth() {
+      return std::is_floating_point_v<T> ? 12 : 6;
+    }
+
+    static bool isSpace(char c) {
+      return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+    }
+
+    static size_t skipSpace(std::string_view text, size_t position) {
+      while (position < text.size() && isSpace(text[position])) position++;
+      return position;
+    }
+
+    static void expect(std::string_view text, size_t position, char expected) {
+      if (position == text.size()) {
+        throw NumericTextError(std::string("Missing '") + expected + "'", position);
+      }
+      if (text[position] != expected) {
+        throw NumericTextError(std::string("Expected '") + expected + "' instead of '" + text[position] + "'", position);
+      }
+    }
+};
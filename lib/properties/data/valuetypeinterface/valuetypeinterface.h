@@ -30,7 +30,7 @@ class ValueTypeInterface : public AbstractValueTypeInterface {
     using reference = value_type &;
     using const_reference = const value_type &;
 
-    static constexpr std::string_view EVENT_VALUE_CHANGED{"value_changed"};
+    static constexpr EventId EVENT_VALUE_CHANGED{"value_changed"};
 
   public:
     ValueTypeInterface() : AbstractValueTypeInterface() {
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <functional>
 #include <typeinfo>
 #include "abstractvaluetypeinterface.h"
 
@@ -31,8 +32,28 @@ class ValueTypeInterfaceContainer {
     virtual const std::type_info& getValueTypeInfo() const = 0;
     virtual const std::type_info& getElementValueTypeInfo() = 0;
 
+    /**
+     * @brief      Creates a new interface for the element, the caller
+     *             takes the ownership.
+     */
     virtual AbstractValueTypeInterface* getElementVTI(size_t key) = 0;
 
+    /**
+     * @brief      Returns an interface for the element which is owned by
+     *             the container and returned again on the next call.
+     * @return     nullptr if the container does not keep its element
+     *             interfaces, use getElementVTI() then.
+     */
+    virtual AbstractValueTypeInterface* getElement(size_t /*key*/) {
+      return nullptr;
+    }
+
+    /**
+     * @brief      Calls function for each element. The interface passed
+     *             is only valid during that call.
+     */
+    virtual void forEachElement(const std::function<void(AbstractValueTypeInterface*)>& function);
+
     using iterator = ValueTypeInterfaceIterator;
 
     virtual iterator begin() = 0;
@@ -38,11 +38,11 @@ public:
       : key(key), container(container) {}
 
   pointer operator*() {
-    return container->getElementVTI(key);
+    return element();
   }
 
   pointer operator->() {
-    return container->getElementVTI(key);
+    return element();
   }
 
   ValueTypeInterfaceIterator& operator++() {
@@ -65,6 +65,12 @@ public:
   }
 
   private:
+    pointer element() {
+      // prefer the interfaces kept by the container, only fall back to creating a new one
+      pointer element = container->getElement(key);
+      return element ? element : container->getElementVTI(key);
+    }
+
     size_t key;
     ValueTypeInterfaceContainer *container;
 };
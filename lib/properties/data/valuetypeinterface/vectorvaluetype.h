@@ -15,8 +15,9 @@
 #pragma once
 
 #include <vector>
-#include <regex>
 
+#include "elementaccessor.h"
+#include "numerictext.h"
 #include "valuetypeinterface.h"
 #include "valuetypeinterfacecontainer.h"
 #include "valuetypeinterfaceiterator.h"
@@ -91,12 +92,26 @@ class VectorValueType : public ValueTypeInterface<std::vector<T>>, public Abstra
       return element_type_interface;
     }
 
+    AbstractValueTypeInterface* getElement(size_t key) override {
+      return elements.get(value, key, AbstractValueTypeInterface::updateHint());
+    }
+
+    void forEachElement(const std::function<void(AbstractValueTypeInterface*)>& function) override {
+      elements.forEach(value, AbstractValueTypeInterface::updateHint(), function);
+    }
+
     void fromString(const std::string& str) override {
-      fromStringInternal(str, value);
+      vector_t parsed;
+      fromStringInternal(str, parsed);
+      value = std::move(parsed);
+      elements.rebind(value);
       notify(getValue());
     }
 
     std::string toString() const override {
+      if constexpr (NumericText::is_numeric<T>) {
+        return NumericText::formatVector(value);
+      }
       std::string result = "(";
       for (size_t i = 0; i < value.size(); i++) {
         ElementTypeInterface<const vector_t, const T> element_type_interface(value, i, nullptr);
@@ -109,7 +124,11 @@ class VectorValueType : public ValueTypeInterface<std::vector<T>>, public Abstra
 
     bool compareToString(const std::string& cmp_string) const override {
       std::remove_const_t<vector_t> value;
-      fromStringInternal(cmp_string, value);
+      try {
+        fromStringInternal(cmp_string, value);
+      } catch (const NumericTextError&) {
+        return false;
+      }
       if (value.size() != getValue().size()) return false;
       for (size_t i = 0; i < value.size(); i++) {
         if (value[i] != getValue()[i]) return false;
@@ -141,11 +160,13 @@ class VectorValueType : public ValueTypeInterface<std::vector<T>>, public Abstra
 
     void push_back(const T& val) {
       value.emplace_back(val);
+      elements.rebind(value);
       notify(value);
     }
 
     void push_back(T&& val) {
       value.emplace_back(val);
+      elements.rebind(value);
       notify(value);
     }
 
@@ -153,6 +174,7 @@ class VectorValueType : public ValueTypeInterface<std::vector<T>>, public Abstra
       value.erase(std::find_if(value.begin(), value.end(), [toerase](const T& item) {
         return item == toerase;
       }));
+      elements.rebind(value);
       notify(value);
     }
 
@@ -168,6 +190,7 @@ class VectorValueType : public ValueTypeInterface<std::vector<T>>, public Abstra
 
     void clear() noexcept {
       value.clear();
+      elements.rebind(value);
       notify(value);
     }
 
@@ -202,6 +225,10 @@ class VectorValueType : public ValueTypeInterface<std::vector<T>>, public Abstra
 
     vector_t value;
 
+    ElementAccessor<vector_t, ElementTypeInterface<vector_t, T>> elements {[this] {
+      notify(getValue());
+    }};
+
   private:
     static vector_t initializer_default(size_t size, const T& defaultvalue) {
       return vector_t(size, defaultvalue);
@@ -215,23 +242,20 @@ class VectorValueType : public ValueTypeInterface<std::vector<T>>, public Abstra
 
     void setValueRaw(vector_t rawvector) override {
       value = std::move(rawvector);
+      elements.rebind(value);
     }
 
     void fromStringInternal(const std::string& str, typename ValueTypeInterface<vector_t>::reference value) const {
-      static const std::regex regex("(?:\\(|,)([^,)]*)(?:\\)|)");
-      std::sregex_iterator iter(str.begin(), str.end(), regex);
-
-      size_t columncount = std::distance(iter, std::sregex_iterator());
-      // const int columncount = value.size();
-      // std::cout << "columncount " << columncount << std::endl;
-      value.resize(columncount);
-
-      size_t actualcolumn = 0;
-      for (; iter != std::sregex_iterator(); ++iter) {
-        std::string token = *(++((*iter).begin())); // first is the total match, so we want the second match
-        ElementTypeInterface<vector_t, T> element_type_interface(value, actualcolumn, nullptr);
-        element_type_interface.fromString(token);
-        actualcolumn++;
+      if constexpr (NumericText::is_numeric<T>) {
+        NumericText::parseVector(str, value);
+      } else {
+        value.clear();
+        size_t position = NumericText::splitVector(str, 0, [&str, &value](size_t begin, size_t end) {
+          value.emplace_back();
+          ElementTypeInterface<vector_t, T> element_type_interface(value, value.size() - 1, nullptr);
+          element_type_interface.fromString(str.substr(begin, end - begin));
+        });
+        NumericText::expectEnd(str, position);
       }
     }
 };
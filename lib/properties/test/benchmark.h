@@ -0,0 +1,41 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * @file    benchmark.h
+ * @ingroup test
+ * @brief   The benchmarks run by propertiesbenchmark, grouped by area
+ */
+
+/// keeps the compiler from dropping the measured work
+extern volatile size_t sink;
+
+struct Benchmark {
+  std::string name;
+  std::function<void(long)> run;   ///< runs the given number of iterations
+};
+
+void addPathBenchmarks(std::vector<Benchmark>& benchmarks);
+void addNumericTextBenchmarks(std::vector<Benchmark>& benchmarks);
+void addElementBenchmarks(std::vector<Benchmark>& benchmarks);
+void addPersistenceBenchmarks(std::vector<Benchmark>& benchmarks);
+void addEventBenchmarks(std::vector<Benchmark>& benchmarks);
+void addColorMapBenchmarks(std::vector<Benchmark>& benchmarks);
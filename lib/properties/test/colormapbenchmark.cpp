@@ -0,0 +1,86 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+/**
+ * @file    colormapbenchmark.cpp
+ * @ingroup test
+ * @brief   Compares coloring a scalar field value by value with the batch colormap functions
+ */
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <properties/data/wrapper.h>
+extern "C" {
+  #include <properties/data/colormap.h>
+}
+
+#include "benchmark.h"
+
+namespace {
+
+const long SIZE = 1024 * 1024;
+const REAL MIN_VALUE = -1;
+const REAL MAX_VALUE = 1;
+
+struct Field {
+  std::vector<REAL> values;
+  std::vector<unsigned char> colors;
+  ColorMap colormap;
+
+  Field() : values(SIZE), colors(SIZE * 4) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<REAL> distribution(MIN_VALUE, MAX_VALUE);
+    for (REAL &value : values) {
+      value = distribution(generator);
+    }
+    ColorMap_init(&colormap, nullptr);
+  }
+  ~Field() {
+    ColorMap_deinit(&colormap);
+  }
+};
+
+}
+
+void addColorMapBenchmarks(std::vector<Benchmark>& benchmarks) {
+  // one iteration colors the whole 1024x1024 field
+  for (const auto& [mode, interpolate] : {std::pair {Viridis, true}, std::pair {BGR, true}, std::pair {Jet, false}, std::pair {CONST, true}}) {
+    auto field = std::make_shared<Field>();
+    field->colormap.mode = mode;
+    field->colormap.interpolate = interpolate;
+    const std::string prefix = "colormap/" + std::string(PaceColorStrings[mode]) + (interpolate ? "" : "/levels");
+
+    benchmarks.push_back({prefix + "/scalar", [field](long n) {
+      for (long i = 0; i < n; i++) {
+        for (long v = 0; v < SIZE; v++) {
+          ColorMap_getColor(&field->colormap, &field->colors[v * 3], field->values[v], MIN_VALUE, MAX_VALUE);
+        }
+      }
+    }});
+    benchmarks.push_back({prefix + "/batch/rgb", [field](long n) {
+      for (long i = 0; i < n; i++) {
+        ColorMap_getColors(&field->colormap, field->colors.data(), 3, field->values.data(), SIZE, MIN_VALUE, MAX_VALUE);
+      }
+    }});
+    benchmarks.push_back({prefix + "/batch/rgba", [field](long n) {
+      for (long i = 0; i < n; i++) {
+        ColorMap_getColors(&field->colormap, field->colors.data(), 4, field->values.data(), SIZE, MIN_VALUE, MAX_VALUE);
+      }
+    }});
+  }
+}
@@ -0,0 +1,59 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+/**
+ * @file    elementbenchmark.cpp
+ * @ingroup test
+ * @brief   Compares the element interfaces created by getElementVTI with the ones kept by the container
+ */
+
+#include <memory>
+#include <vector>
+
+#include <properties/data/properties.h>
+
+#include "benchmark.h"
+
+namespace {
+
+const size_t SIZE = 1000;
+
+}
+
+void addElementBenchmarks(std::vector<Benchmark>& benchmarks) {
+  auto matrix = std::make_shared<MatrixProperty<int>>("matrix", SIZE, SIZE, 1);
+
+  // one iteration accesses one element, walking the matrix row by row
+  benchmarks.push_back({"element/getElementVTI", [matrix](long n) {
+    for (long i = 0; i < n; i++) {
+      std::unique_ptr<AbstractValueTypeInterface> element(matrix->getElementVTI((i / SIZE) % SIZE, i % SIZE));
+      sink = sink + dynamic_cast<ValueTypeInterface<int>*>(element.get())->getValue();
+    }
+  }});
+  benchmarks.push_back({"element/getElement", [matrix](long n) {
+    for (long i = 0; i < n; i++) {
+      sink = sink + dynamic_cast<ValueTypeInterface<int>*>(matrix->getElement((i / SIZE) % SIZE, i % SIZE))->getValue();
+    }
+  }});
+  benchmarks.push_back({"element/forEachElement/1000x1000", [matrix](long n) {
+    for (long i = 0; i < n; i++) {
+      matrix->forEachElement([](AbstractValueTypeInterface* row) {
+        dynamic_cast<ValueTypeInterfaceContainer*>(row)->forEachElement([](AbstractValueTypeInterface* element) {
+          sink = sink + dynamic_cast<ValueTypeInterface<int>*>(element)->getValue();
+        });
+      });
+    }
+  }});
+}
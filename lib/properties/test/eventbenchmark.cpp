@@ -0,0 +1,104 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+/**
+ * @file    eventbenchmark.cpp
+ * @ingroup test
+ * @brief   Measures the notification throughput of the EventBus and how far an EventTransaction coalesces
+ */
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <properties/data/properties.h>
+
+#include "benchmark.h"
+
+namespace {
+
+const int THREADS = 4;
+const int MODELS = 20;
+const int PROPERTIES = 25;
+
+constexpr EventId EVENT_VALUE{"value_changed"};
+
+/// sets every value of the preset once
+void loadPreset(PropertiesModel& root, int value) {
+  for (int m = 0; m < MODELS; m++) {
+    for (int p = 0; p < PROPERTIES; p++) {
+      root.setValue<int>("model" + std::to_string(m) + "/value" + std::to_string(p), value);
+    }
+  }
+}
+
+}
+
+void addEventBenchmarks(std::vector<Benchmark>& benchmarks) {
+  auto bus = std::make_shared<EventBus>();
+  benchmarks.push_back({"event/publish/unsubscribed", [bus](long n) {
+    for (long i = 0; i < n; i++) {
+      bus->publish(EVENT_VALUE, static_cast<int>(i));
+    }
+  }});
+
+  // one iteration is one publish, spread over the threads
+  auto shared = std::make_shared<EventBus>();
+  auto counting = std::make_shared<AbstractSignal::Handle>(shared->subscribe<int>(EVENT_VALUE, [](const int& value) {
+    sink = sink + value;
+  }));
+  benchmarks.push_back({"event/publish/" + std::to_string(THREADS) + "threads", [shared, counting](long n) {
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; t++) {
+      threads.emplace_back([&shared, n] {
+        for (long i = 0; i < (n + THREADS - 1) / THREADS; i++) {
+          shared->publish(EVENT_VALUE, 1);
+        }
+      });
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+  }});
+
+  // a preset of 500 values, with a value listener on each and a DOM listener on the root
+  auto root = std::make_shared<PropertiesModel>("root");
+  for (int m = 0; m < MODELS; m++) {
+    PropertiesModel *model = root->addProperty(new PropertiesModel("model" + std::to_string(m)));
+    for (int p = 0; p < PROPERTIES; p++) {
+      IntProperty *property = model->addProperty(new IntProperty("value" + std::to_string(p), 0));
+      property->onValueChange([](const int&) {
+        sink = sink + 1;
+      }).release();
+    }
+  }
+  auto dom_handle = std::make_shared<AbstractSignal::Handle>(root->onDomChange([](const std::string&) {
+    sink = sink + 1;
+  }));
+  const std::string prefix = "event/preset/" + std::to_string(MODELS * PROPERTIES);
+  benchmarks.push_back({prefix, [root, dom_handle](long n) {
+    for (long i = 0; i < n; i++) {
+      loadPreset(*root, static_cast<int>(i));
+    }
+  }});
+  benchmarks.push_back({prefix + "/transaction", [root, dom_handle](long n) {
+    for (long i = 0; i < n; i++) {
+      EventTransaction transaction;
+      loadPreset(*root, static_cast<int>(i));
+    }
+  }});
+}
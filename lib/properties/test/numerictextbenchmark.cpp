@@ -0,0 +1,121 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+/**
+ * @file    numerictextbenchmark.cpp
+ * @ingroup test
+ * @brief   Compares reading and writing matrix values with NumericText against the former regex and stream based path
+ */
+
+#include <memory>
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <properties/data/properties.h>
+
+#include "benchmark.h"
+
+namespace {
+
+using matrix_t = std::vector<std::vector<double>>;
+
+/// MatrixValueType::fromString before NumericText
+void regexParse(const std::string& str, matrix_t& value) {
+  static const std::regex matrixregex("(?:\\[|,)(\\([^)]*\\))*(?:|\\])");
+  static const std::regex vectorregex("(?:\\(|,)([^,)]*)(?:\\)|)");
+  std::sregex_iterator iter(str.begin(), str.end(), matrixregex);
+  value.resize(std::distance(iter, std::sregex_iterator()));
+
+  size_t actualrow = 0;
+  for (; iter != std::sregex_iterator(); ++iter) {
+    std::string row = *(++((*iter).begin()));
+    std::sregex_iterator rowiter(row.begin(), row.end(), vectorregex);
+    value[actualrow].resize(std::distance(rowiter, std::sregex_iterator()));
+
+    size_t actualcolumn = 0;
+    for (; rowiter != std::sregex_iterator(); ++rowiter) {
+      std::stringstream stream(*(++((*rowiter).begin())));
+      stream >> value[actualrow][actualcolumn++];
+    }
+    actualrow++;
+  }
+}
+
+/// MatrixValueType::toString before NumericText
+std::string streamFormat(const matrix_t& value) {
+  std::string result = "[";
+  for (size_t i = 0; i < value.size(); i++) {
+    result += "(";
+    for (size_t j = 0; j < value[i].size(); j++) {
+      std::ostringstream stream;
+      stream << value[i][j];
+      result += stream.str();
+      if (j < value[i].size()-1) result += ",";
+    }
+    result += ")";
+    if (i < value.size()-1) result += ",";
+  }
+  result += "]";
+  return result;
+}
+
+}
+
+void addNumericTextBenchmarks(std::vector<Benchmark>& benchmarks) {
+  for (size_t size : {10, 100, 1000}) {
+    auto matrix = std::make_shared<matrix_t>(size, std::vector<double>(size));
+    for (size_t i = 0; i < size; i++) {
+      for (size_t j = 0; j < size; j++) {
+        (*matrix)[i][j] = (static_cast<double>(i * size + j) - 0.5 * size * size) / 7.0;
+      }
+    }
+    auto property = std::make_shared<MatrixProperty<double>>("matrix", true, *matrix);
+    const std::string text = property->toString();
+    const std::string prefix = "matrix/" + std::to_string(size) + "x" + std::to_string(size);
+
+    // the former path must give the same results, otherwise the comparison is meaningless
+    benchmarks.push_back({prefix + "/regex/read", [property, text](long n) {
+      matrix_t parsed;
+      for (long i = 0; i < n; i++) {
+        regexParse(text, parsed);
+      }
+      if (parsed != property->getValue()) {
+        throw std::runtime_error("The regex path reads a different matrix");
+      }
+    }});
+    benchmarks.push_back({prefix + "/read", [property, text](long n) {
+      for (long i = 0; i < n; i++) {
+        property->fromString(text);
+      }
+    }});
+    benchmarks.push_back({prefix + "/stream/write", [matrix, text](long n) {
+      std::string written;
+      for (long i = 0; i < n; i++) {
+        written = streamFormat(*matrix);
+      }
+      if (written != text) {
+        throw std::runtime_error("The stream path writes a different matrix");
+      }
+    }});
+    benchmarks.push_back({prefix + "/write", [property](long n) {
+      for (long i = 0; i < n; i++) {
+        sink = sink + property->toString().size();
+      }
+    }});
+  }
+}
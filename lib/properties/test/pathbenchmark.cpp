@@ -0,0 +1,87 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+/**
+ * @file    pathbenchmark.cpp
+ * @ingroup test
+ * @brief   Compares accessing property values by string path with compiled PropertyHandles
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <properties/data/properties.h>
+#include <properties/data/propertiesmodel.h>
+
+#include "benchmark.h"
+
+namespace {
+
+const int PROPERTIES_PER_LEVEL = 20;
+
+/// a model as built by the form widgets, the accessed property is the last of each level
+PropertiesModel* createModel(int depth) {
+  PropertiesModel *model = new PropertiesModel("level0");
+  PropertiesModel *current = model;
+  for (int level = 1; level <= depth; ++level) {
+    for (int i = 0; i < PROPERTIES_PER_LEVEL; ++i) {
+      current->addProperty(new IntProperty("value" + std::to_string(i), i));
+    }
+    if (level < depth) {
+      current = current->addProperty(new PropertiesModel("level" + std::to_string(level)));
+    }
+  }
+  return model;
+}
+
+std::string createPath(int depth) {
+  std::string path;
+  for (int level = 1; level < depth; ++level) {
+    path += "level" + std::to_string(level) + "/";
+  }
+  return path + "value" + std::to_string(PROPERTIES_PER_LEVEL - 1);
+}
+
+}
+
+void addPathBenchmarks(std::vector<Benchmark>& benchmarks) {
+  for (int depth : {1, 3, 6}) {
+    std::shared_ptr<PropertiesModel> model(createModel(depth));
+    const std::string path = createPath(depth);
+    const PropertyHandle<int> handle = model->compilePath<int>(path);
+    const std::string prefix = "path/depth" + std::to_string(depth);
+
+    benchmarks.push_back({prefix + "/string/get", [model, path](long n) {
+      for (long i = 0; i < n; i++) {
+        sink = sink + model->getValue<int>(path);
+      }
+    }});
+    benchmarks.push_back({prefix + "/handle/get", [model, handle](long n) {
+      for (long i = 0; i < n; i++) {
+        sink = sink + handle.getValue();
+      }
+    }});
+    benchmarks.push_back({prefix + "/string/set", [model, path](long n) {
+      for (long i = 0; i < n; i++) {
+        model->setValue<int>(path, static_cast<int>(i));
+      }
+    }});
+    benchmarks.push_back({prefix + "/handle/set", [model, handle](long n) {
+      for (long i = 0; i < n; i++) {
+        handle.setValue(static_cast<int>(i));
+      }
+    }});
+  }
+}
@@ -0,0 +1,88 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+/**
+ * @file    persistencebenchmark.cpp
+ * @ingroup test
+ * @brief   Measures storing and loading a large session with the persistence backends
+ */
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <properties/data/properties.h>
+#include <properties/data/properties/persistence/binarypersistentmanager.h>
+#include <properties/data/properties/persistence/jsonpersistentmanager.h>
+
+#include "benchmark.h"
+
+namespace {
+
+const int MODELS = 2000;
+
+PropertiesModel* createSession() {
+  PropertiesModel *session = new PropertiesModel("session");
+  for (int i = 0; i < MODELS; i++) {
+    PropertiesModel *model = session->addProperty(new PropertiesModel("model" + std::to_string(i)));
+    model->addProperty(new IntProperty("count", i));
+    model->addProperty(new DoubleProperty("scale", i * 0.5));
+    model->addProperty(new StringProperty("label", "node \"" + std::to_string(i) + "\""));
+    model->addProperty(new VectorProperty<double>("position", std::vector<double> {1.0 * i, 2.0, 3.0}));
+  }
+  return session;
+}
+
+template <typename Manager>
+void addBackend(std::vector<Benchmark>& benchmarks, const std::string& backend, std::shared_ptr<PropertiesModel> session) {
+  const std::string path = (std::filesystem::temp_directory_path() / ("persistencebenchmark." + backend)).string();
+  const std::string prefix = "session/" + backend;
+
+  benchmarks.push_back({prefix + "/store/new", [session, path](long n) {
+    for (long i = 0; i < n; i++) {
+      std::filesystem::remove(path);
+      Manager manager;
+      manager.openFileToSave(path);
+      session->store(&manager, "");
+      manager.closeFileToSave(path);
+    }
+  }});
+  benchmarks.push_back({prefix + "/store/change", [session, path](long n) {
+    for (long i = 0; i < n; i++) {
+      Manager manager;
+      manager.openFileToSave(path);
+      session->setValue<int>("model0/count", static_cast<int>(-i));
+      session->store(&manager, "");
+      manager.closeFileToSave(path);
+    }
+  }});
+  benchmarks.push_back({prefix + "/load", [session, path](long n) {
+    for (long i = 0; i < n; i++) {
+      Manager manager;
+      manager.loadFile(path);
+      session->load(&manager, "");
+    }
+    std::filesystem::remove(path);
+  }});
+}
+
+}
+
+void addPersistenceBenchmarks(std::vector<Benchmark>& benchmarks) {
+  std::shared_ptr<PropertiesModel> session(createSession());
+  addBackend<BinaryPersistentManager>(benchmarks, "binary", session);
+  addBackend<JsonPersistentManager>(benchmarks, "json", session);
+}
@@ -0,0 +1,339 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+/**
+ * @file    propertiesbenchmark.cpp
+ * @ingroup test
+ * @brief   Benchmark suite for the properties library
+ *
+ * Runs every benchmark until it took at least the minimum time and prints
+ * one CSV line per benchmark, so that the results of two releases can be
+ * compared:
+ *
+ *   propertiesbenchmark > before.csv
+ *   propertiesbenchmark --baseline before.csv --threshold 10
+ *
+ * With a baseline, the change against it is added to each line and the
+ * program fails if a benchmark got slower than the threshold in percent.
+ * The benchmarks of the single areas are added from their own files, see
+ * benchmark.h; --filter selects one of them, e.g. --filter colormap/.
+ *
+ * Options:
+ *   --filter <text>      only run the benchmarks containing the text
+ *   --min-time <ms>      minimum time per benchmark, default 100
+ *   --baseline <file>    CSV output of an earlier run
+ *   --threshold <pct>    allowed slowdown against the baseline, default 10
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <properties/data/properties.h>
+#include <properties/data/propertyfactory.h>
+#include <properties/data/properties/persistence/jsonpersistentmanager.h>
+
+#include "benchmark.h"
+
+volatile size_t sink = 0;
+
+struct Result {
+  std::string name;
+  long iterations;
+  double nanoseconds;   ///< per iteration
+};
+
+/// doubles the iterations until the benchmark ran for at least min_time
+Result measure(const Benchmark& benchmark, std::chrono::milliseconds min_time) {
+  for (long iterations = 1;; iterations *= 2) {
+    const auto start = std::chrono::steady_clock::now();
+    benchmark.run(iterations);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    if (elapsed >= min_time || iterations >= (1L << 30)) {
+      return {benchmark.name, iterations, std::chrono::duration<double, std::nano>(elapsed).count() / iterations};
+    }
+  }
+}
+
+std::map<std::string, double> readBaseline(const std::string& file_name) {
+  std::map<std::string, double> baseline;
+  std::ifstream file(file_name);
+  if (!file) {
+    throw std::runtime_error("Unable to read the baseline " + file_name);
+  }
+
+  std::string line;
+  std::getline(file, line);   // header
+  while (std::getline(file, line)) {
+    std::istringstream fields(line);
+    std::string name, iterations, nanoseconds;
+    if (std::getline(fields, name, ',') && std::getline(fields, iterations, ',') && std::getline(fields, nanoseconds, ',')) {
+      baseline[name] = std::stod(nanoseconds);
+    }
+  }
+  return baseline;
+}
+
+/// a model with the given number of submodels, each holding properties of the common types
+PropertiesModel* createModel(int models, int properties) {
+  PropertiesModel *root = new PropertiesModel("root");
+  for (int m = 0; m < models; m++) {
+    PropertiesModel *model = root->addProperty(new PropertiesModel("model" + std::to_string(m)));
+    for (int p = 0; p < properties; p += 4) {
+      model->addProperty(new IntProperty("int" + std::to_string(p), p));
+      model->addProperty(new DoubleProperty("double" + std::to_string(p), p * 0.5));
+      model->addProperty(new StringProperty("string" + std::to_string(p), "value " + std::to_string(p)));
+      model->addProperty(new VectorProperty<double>("vector" + std::to_string(p), std::vector<double> {1.0 * p, 2, 3}));
+    }
+  }
+  return root;
+}
+
+/// to and from string conversion of a property holding value
+template <typename PropertyT, typename T>
+void addConversion(std::vector<Benchmark>& benchmarks, const std::string& type, const T& value) {
+  auto property = std::make_shared<PropertyT>("value", value);
+  const std::string text = property->toString();
+
+  benchmarks.push_back({"string/" + type + "/to", [property](long n) {
+    for (long i = 0; i < n; i++) {
+      sink = sink + property->toString().size();
+    }
+  }});
+  benchmarks.push_back({"string/" + type + "/from", [property, text](long n) {
+    for (long i = 0; i < n; i++) {
+      property->fromString(text);
+    }
+  }});
+}
+
+std::vector<Benchmark> createBenchmarks() {
+  std::vector<Benchmark> benchmarks;
+
+  // creating properties from the type names of the tool descriptions
+  for (const std::string type : {"int", "float", "bool", "string", "file"}) {
+    const std::string default_value = type == "bool" ? "true" : type == "string" || type == "file" ? "input.txt" : "42";
+    benchmarks.push_back({"factory/" + type, [type, default_value](long n) {
+      for (long i = 0; i < n; i++) {
+        delete PropertyFactory::createProperty("value", type, false, default_value);
+      }
+    }});
+  }
+  benchmarks.push_back({"factory/typeid/double", [](long n) {
+    for (long i = 0; i < n; i++) {
+      delete PropertyFactory::createProperty("value", typeid(double), "", {});
+    }
+  }});
+
+  // path access into a model with 20 submodels of 20 properties
+  std::shared_ptr<PropertiesModel> model(createModel(20, 20));
+  const PropertyHandle<int> handle = model->compilePath<int>("model19/int16");
+  benchmarks.push_back({"path/get", [model](long n) {
+    for (long i = 0; i < n; i++) {
+      sink = sink + model->getValue<int>("model19/int16");
+    }
+  }});
+  benchmarks.push_back({"path/set", [model](long n) {
+    for (long i = 0; i < n; i++) {
+      model->setValue<int>("model19/int16", static_cast<int>(i));
+    }
+  }});
+  benchmarks.push_back({"path/handle/get", [model, handle](long n) {
+    for (long i = 0; i < n; i++) {
+      sink = sink + handle.getValue();
+    }
+  }});
+  benchmarks.push_back({"path/has", [model](long n) {
+    for (long i = 0; i < n; i++) {
+      sink = sink + model->hasProperty("model19/missing");
+    }
+  }});
+
+  addConversion<IntProperty>(benchmarks, "int", 123456);
+  addConversion<DoubleProperty>(benchmarks, "double", 3.14159265);
+  addConversion<BoolProperty>(benchmarks, "bool", true);
+  addConversion<StringProperty>(benchmarks, "string", std::string("a longer string value which does not fit into sso"));
+  addConversion<VectorProperty<double>>(benchmarks, "vector16", std::vector<double>(16, 0.125));
+  addConversion<VectorProperty<std::string>>(benchmarks, "vector16string", std::vector<std::string>(16, "text"));
+  addConversion<MatrixProperty<double>>(benchmarks, "matrix16x16", MatrixProperty<double>::matrix_t(16, std::vector<double>(16, 0.125)));
+
+  auto hint = std::make_shared<ValueTypeInterfaceHint>();
+  hint->setEntry("minimum", 0)->setEntry("maximum", 100)->setEntry("unit", "mm")->setDescription("A length");
+  benchmarks.push_back({"hint/setEntry", [hint](long n) {
+    for (long i = 0; i < n; i++) {
+      hint->setEntry("step", static_cast<int>(i));
+    }
+  }});
+  benchmarks.push_back({"hint/getEntry", [hint](long n) {
+    for (long i = 0; i < n; i++) {
+      sink = sink + hint->getEntry<int>("maximum");
+    }
+  }});
+
+  // notifications of the event bus, the ambassadors and their listeners
+  auto bus = std::make_shared<EventBus>();
+  auto subscription = std::make_shared<AbstractSignal::Handle>(bus->subscribe<int>("value_changed", [](const int& value) {
+    sink = sink + value;
+  }));
+  benchmarks.push_back({"event/publish", [bus, subscription](long n) {
+    for (long i = 0; i < n; i++) {
+      bus->publish(ValueTypeInterface<int>::EVENT_VALUE_CHANGED, static_cast<int>(i));
+    }
+  }});
+  benchmarks.push_back({"event/publish/transaction", [bus, subscription](long n) {
+    EventTransaction transaction;
+    for (long i = 0; i < n; i++) {
+      bus->publish(ValueTypeInterface<int>::EVENT_VALUE_CHANGED, static_cast<int>(i));
+    }
+  }});
+
+  struct CountingListener : public PropertyChangeListener {
+    void receivePropertyChange(const Property*) override {
+      sink = sink + 1;
+    }
+  };
+  auto listener = std::make_shared<CountingListener>();
+  auto listened = std::make_shared<PropertiesModel>("listened");
+  IntProperty *listened_property = listened->addProperty(new IntProperty("value", 0));
+  listened->registerPropertyChangeListener(listener.get());
+  benchmarks.push_back({"event/listener", [listened, listened_property, listener](long n) {
+    for (long i = 0; i < n; i++) {
+      listened_property->setValue(static_cast<int>(i));
+    }
+  }});
+
+  // the session files, 20 models with 20 properties each
+  const std::string path = (std::filesystem::temp_directory_path() / "propertiesbenchmark.json").string();
+  benchmarks.push_back({"json/store/400", [model, path](long n) {
+    for (long i = 0; i < n; i++) {
+      JsonPersistentManager manager;
+      manager.openFileToSave(path);
+      model->store(&manager, "");
+      manager.closeFileToSave(path);
+    }
+  }});
+  benchmarks.push_back({"json/load/400", [model, path](long n) {
+    for (long i = 0; i < n; i++) {
+      JsonPersistentManager manager;
+      manager.loadFile(path);
+      model->load(&manager, "");
+    }
+  }});
+  auto json = std::make_shared<JsonPersistentManager>();
+  model->store(json.get(), "");
+  const std::string text = json->toJson();
+  benchmarks.push_back({"json/serialize/400", [json](long n) {
+    for (long i = 0; i < n; i++) {
+      sink = sink + json->toJson().size();
+    }
+  }});
+  benchmarks.push_back({"json/parse/400", [json, text](long n) {
+    for (long i = 0; i < n; i++) {
+      json->fromJson(text);
+    }
+  }});
+
+  // a whole tool form: created from type names and filled from a preset
+  benchmarks.push_back({"macro/form/100", [](long n) {
+    const std::string types[] = {"int", "float", "bool", "string"};
+    const std::string values[] = {"7", "0.5", "false", "output.txt"};
+    for (long i = 0; i < n; i++) {
+      PropertiesModel form("form");
+      for (int p = 0; p < 100; p++) {
+        form.addProperty(PropertyFactory::createProperty("param" + std::to_string(p), types[p % 4], p % 3 == 0, ""));
+      }
+      EventTransaction transaction;
+      for (int p = 0; p < 100; p++) {
+        form.getProperty("param" + std::to_string(p))->fromString(values[p % 4]);
+      }
+    }
+  }});
+
+  addPathBenchmarks(benchmarks);
+  addNumericTextBenchmarks(benchmarks);
+  addElementBenchmarks(benchmarks);
+  addPersistenceBenchmarks(benchmarks);
+  addEventBenchmarks(benchmarks);
+  addColorMapBenchmarks(benchmarks);
+
+  return benchmarks;
+}
+
+int main(int argc, char **argv) {
+  std::string filter;
+  std::string baseline_file;
+  std::chrono::milliseconds min_time(100);
+  double threshold = 10;
+
+  for (int i = 1; i < argc; i++) {
+    const std::string argument = argv[i];
+    if (i + 1 >= argc) {
+      std::cerr << "Missing value for " << argument << std::endl;
+      return 2;
+    }
+    if (argument == "--filter") {
+      filter = argv[++i];
+    } else if (argument == "--min-time") {
+      min_time = std::chrono::milliseconds(std::atol(argv[++i]));
+    } else if (argument == "--baseline") {
+      baseline_file = argv[++i];
+    } else if (argument == "--threshold") {
+      threshold = std::atof(argv[++i]);
+    } else {
+      std::cerr << "Unknown option " << argument << std::endl;
+      return 2;
+    }
+  }
+
+  std::map<std::string, double> baseline;
+  if (!baseline_file.empty()) {
+    baseline = readBaseline(baseline_file);
+  }
+
+  std::cout << "benchmark,iterations,ns_per_iteration" << (baseline.empty() ? "" : ",baseline_ns_per_iteration,change_percent") << std::endl;
+
+  int regressions = 0;
+  for (const Benchmark& benchmark : createBenchmarks()) {
+    if (benchmark.name.find(filter) == std::string::npos) continue;
+
+    const Result result = measure(benchmark, min_time);
+    std::cout << result.name << ',' << result.iterations << ',' << std::fixed << std::setprecision(1) << result.nanoseconds;
+
+    double change = 0;
+    auto it = baseline.find(result.name);
+    if (it != baseline.end()) {
+      change = (result.nanoseconds / it->second - 1) * 100;
+      std::cout << ',' << it->second << ',' << std::showpos << change << std::noshowpos;
+    }
+    std::cout << std::endl;
+
+    if (change > threshold) {
+      std::cerr << "  (WW) " << result.name << " is " << change << "% slower than the baseline" << std::endl;
+      regressions++;
+    }
+  }
+
+  std::filesystem::remove(std::filesystem::temp_directory_path() / "propertiesbenchmark.json");
+  return regressions == 0 ? 0 : 1;
+}
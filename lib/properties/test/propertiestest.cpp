@@ -18,9 +18,28 @@
  * @ingroup    test
  */
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <thread>
 #include <vector>
 #include <unordered_map>
 
+#include <properties/data/wrapper.h>
+extern "C" {
+  #include <properties/data/colormap.h>
+  #include <properties/data/keytype.h>
+}
+#include <properties/data/propertyfactory.h>
+#include <properties/data/properties/persistence/binarypersistentmanager.h>
+#include <properties/data/properties/persistence/jsonpersistentmanager.h>
+
 #include "propertiestest.h"
 
 void PropertiesTest::test_arrayProperty() {
@@ -283,6 +302,600 @@ void PropertiesTest::test_dynamicProperty() {
   std::cout << "\tDynamicProperty... OK" << std::endl;
 }
 
+void PropertiesTest::test_propertyHandle() {
+  PropertiesModel model("model");
+  PropertiesModel *inner = model.addProperty(new PropertiesModel("inner"));
+  inner->addProperty(new IntProperty("value", 3));
+  model.addProperty(new LinkedProperty("link", "inner/value"));
+
+  PropertyHandle<int> handle = model.compilePath<int>("inner/value");
+  assert(handle.getValue() == 3);
+  handle.setValue(5);
+  assert(model.getValue<int>("inner/value") == 5);
+  assert(model.compilePath<int>("link").getValue() == 5);
+  assert(inner->compilePath<int>("/inner/value").getValue() == 5);
+  assert(inner->compilePath<int>("../link").getValue() == 5);
+
+  // replacing the property changes the structure
+  inner->addProperty(new IntProperty("value", 9));
+  assert(handle.getValue() == 9);
+
+  bool thrown = false;
+  try {
+    model.compilePath<double>("inner/value");
+  } catch (const std::runtime_error&) {
+    thrown = true;
+  }
+  assert(thrown);
+
+  inner->removeProperty("value");
+  thrown = false;
+  try {
+    handle.getValue();
+  } catch (const std::runtime_error&) {
+    thrown = true;
+  }
+  assert(thrown);
+
+  std::cout << "\tPropertyHandle... OK" << std::endl;
+}
+
+/// the text of a vector as written by operator<<, like the stream based toString() did
+template <typename T>
+std::string streamVector(const std::vector<T>& vector) {
+  std::ostringstream stream;
+  stream << "(";
+  for (size_t i = 0; i < vector.size(); i++) {
+    stream << (i > 0 ? "," : "") << vector[i];
+  }
+  stream << ")";
+  return stream.str();
+}
+
+size_t errorPosition(const std::string& text) {
+  std::vector<double> vector;
+  try {
+    NumericText::parseVector(text, vector);
+  } catch (const NumericTextError& error) {
+    return error.getPosition();
+  }
+  return std::string::npos;
+}
+
+void PropertiesTest::test_numericText() {
+  VectorProperty<double> vectorproperty("vector", std::vector<double> {});
+  assert(vectorproperty.toString() == "()");
+  vectorproperty.fromString("()");
+  assert(vectorproperty.size() == 0);
+  vectorproperty.fromString(" ( 1.5 , -2e3,+4 ,) ");
+  assert((vectorproperty.getValue() == std::vector<double> {1.5, -2000, 4, 0}));
+  assert(vectorproperty.toString() == "(1.5,-2000,4,0)");
+  vectorproperty.fromString("(1e300,inf,-0,123456789)");
+  assert(vectorproperty.toString() == "(1e+300,inf,-0,1.23457e+08)");
+
+  MatrixProperty<int> matrixproperty("matrix", true, MatrixProperty<int>::matrix_t {{1}});
+  matrixproperty.fromString("[]");
+  assert(matrixproperty.getValue().empty());
+  assert(matrixproperty.toString() == "[]");
+  matrixproperty.fromString("[(1,2), ( -3,4 ),()]");
+  assert(matrixproperty.toString() == "[(1,2),(-3,4),()]");
+
+  // the value stays untouched if the text is malformed
+  assert(errorPosition("(1,2,x)") == 5);
+  assert(errorPosition("(1,2.5.1)") == 6);
+  assert(errorPosition("(1,2") == 4);
+  assert(errorPosition("1,2)") == 0);
+  assert(errorPosition("(1,2) 3") == 6);
+  assert(errorPosition("(1,--2)") == 3);
+  bool thrown = false;
+  try {
+    matrixproperty.fromString("[(1,2),(3,4]");
+  } catch (const NumericTextError& error) {
+    assert(error.getPosition() == 12);
+    thrown = true;
+  }
+  assert(thrown);
+  assert(matrixproperty.toString() == "[(1,2),(-3,4),()]");
+  thrown = false;
+  try {
+    VectorProperty<short>("shorts", std::vector<short> {}).fromString("(40000)");
+  } catch (const NumericTextError& error) {
+    assert(error.getPosition() == 1);
+    thrown = true;
+  }
+  assert(thrown);
+  assert(!vectorproperty.compareToString("(1,x)"));
+
+  // a malformed default of a tool description is skipped instead of thrown
+  Keytype keytype;
+  Keytype_readType(&keytype, "%v[3]f");
+  std::unique_ptr<Property> defaulted(PropertyFactory::createProperty("defaulted", &keytype, "(1,x,3)", {}));
+  assert(defaulted->toString() == "(0,0,0)");
+  assert(!defaulted->getHint()->hasEntry("default"));
+
+  // the output is the one of operator<<, and reading it back gives the same text
+  std::mt19937 random(42);
+  std::uniform_real_distribution<double> real(-1e6, 1e6);
+  std::uniform_int_distribution<int> exponent(-300, 300);
+  std::uniform_int_distribution<long> integer(std::numeric_limits<long>::min(), std::numeric_limits<long>::max());
+  std::uniform_int_distribution<size_t> length(0, 20);
+  for (int round = 0; round < 2000; round++) {
+    std::vector<double> doubles(length(random));
+    std::vector<float> floats(doubles.size());
+    std::vector<long> longs(doubles.size());
+    for (size_t i = 0; i < doubles.size(); i++) {
+      doubles[i] = real(random) * std::pow(10.0, exponent(random));
+      floats[i] = static_cast<float>(real(random));
+      longs[i] = integer(random);
+    }
+    VectorProperty<double> doubleproperty("doubles", doubles);
+    VectorProperty<float> floatproperty("floats", floats);
+    VectorProperty<long> longproperty("longs", longs);
+    assert(doubleproperty.toString() == streamVector(doubles));
+    assert(floatproperty.toString() == streamVector(floats));
+    assert(longproperty.toString() == streamVector(longs));
+    assert(longproperty.compareToString(streamVector(longs)));
+
+    const std::string text = doubleproperty.toString();
+    doubleproperty.fromString(text);
+    assert(doubleproperty.toString() == text);
+    floatproperty.fromString(floatproperty.toString());
+    assert(floatproperty.toString() == streamVector(floats));
+
+    // mutated text either parses or reports a position inside the text
+    std::string mutated = text;
+    const std::string alphabet = "()[],.-+e0123456789 x";
+    std::uniform_int_distribution<size_t> position(0, mutated.size() - 1);
+    std::uniform_int_distribution<size_t> character(0, alphabet.size() - 1);
+    for (int i = 0; i < 3; i++) {
+      mutated[position(random)] = alphabet[character(random)];
+    }
+    try {
+      doubleproperty.fromString(mutated);
+      doubleproperty.fromString(doubleproperty.toString());
+    } catch (const NumericTextError& error) {
+      assert(error.getPosition() <= mutated.size());
+      assert(doubleproperty.toString() == text);
+    }
+  }
+
+  std::cout << "\tNumericText... OK" << std::endl;
+}
+
+void PropertiesTest::test_elementAccessor() {
+  int vector_notified = 0;
+  VectorProperty<int> vectorproperty("vector", std::vector<int> {1, 2, 3});
+  vectorproperty.onValueChange([&vector_notified](const std::vector<int>&) {
+    vector_notified++;
+  }).release();
+
+  // the same interface is returned on every access and while iterating
+  auto first = dynamic_cast<ValueTypeInterface<int>*>(vectorproperty.getElement(0));
+  assert(first == vectorproperty.getElement(0));
+  assert(*vectorproperty.begin() == first);
+  assert(vectorproperty.getElement(3) == nullptr);
+  first->setValue(5);
+  assert(vectorproperty.at(0) == 5);
+  assert(vector_notified == 1);
+
+  // growing the vector moves the storage, the interface follows it
+  for (int i = 0; i < 100; i++) {
+    vectorproperty.push_back(i);
+  }
+  first->setValue(6);
+  assert(vectorproperty.at(0) == 6 && first->getValue() == 6);
+
+  // interfaces of removed elements are destroyed
+  bool destroyed = false;
+  auto destroyhandle = vectorproperty.getElement(2)->onDestroy([&destroyed] {
+    destroyed = true;
+  });
+  vectorproperty.setValue({7});
+  assert(destroyed);
+  assert(vectorproperty.getElement(2) == nullptr);
+  assert(first->getValue() == 7);
+
+  // a subscription to a pooled interface may outlive the container
+  AbstractSignal::Handle handle;
+  {
+    VectorProperty<int> shortlived("shortlived", std::vector<int> {1});
+    handle = dynamic_cast<ValueTypeInterface<int>*>(shortlived.getElement(0))->onValueChange([](const int&) {});
+  }
+
+  int matrix_notified = 0;
+  int row_notified = 0;
+  MatrixProperty<int> matrixproperty("matrix", true, MatrixProperty<int>::matrix_t {{1, 2}, {3, 4}});
+  matrixproperty.onValueChange([&matrix_notified](const MatrixProperty<int>::matrix_t&) {
+    matrix_notified++;
+  }).release();
+  auto row = dynamic_cast<ValueTypeInterface<std::vector<int>>*>(matrixproperty.getElement(1));
+  auto rowhandle = row->onValueChange([&row_notified](const std::vector<int>&) {
+    row_notified++;
+  });
+  auto cell = dynamic_cast<ValueTypeInterface<int>*>(matrixproperty.getElement(1, 0));
+  assert(cell == dynamic_cast<ValueTypeInterfaceContainer*>(row)->getElement(0));
+  cell->setValue(9);
+  assert(matrixproperty.at(1, 0) == 9);
+  assert(matrix_notified == 1 && row_notified == 1);
+  row->setValue({5, 6});
+  assert(cell->getValue() == 5);
+  assert(matrix_notified == 2);
+
+  matrixproperty.addRow({7, 8});
+  cell->setValue(10);
+  assert(matrixproperty.toString() == "[(1,2),(10,6),(7,8)]");
+
+  // iterating with a single interface passed from element to element
+  int sum = 0;
+  matrixproperty.forEachElement([&sum](AbstractValueTypeInterface* row) {
+    dynamic_cast<ValueTypeInterfaceContainer*>(row)->forEachElement([&sum](AbstractValueTypeInterface* cell) {
+      sum += dynamic_cast<ValueTypeInterface<int>*>(cell)->getValue();
+    });
+  });
+  assert(sum == 1 + 2 + 10 + 6 + 7 + 8);
+  matrixproperty.forEachElement([](AbstractValueTypeInterface* row) {
+    dynamic_cast<ValueTypeInterfaceContainer*>(row)->forEachElement([](AbstractValueTypeInterface* cell) {
+      dynamic_cast<ValueTypeInterface<int>*>(cell)->setValue(0);
+    });
+  });
+  assert(matrixproperty.toString() == "[(0,0),(0,0),(0,0)]");
+  assert(matrix_notified == 4 + 6);
+
+  // arrays keep their interfaces as well
+  int array_notified = 0;
+  ArrayProperty<int, 3> arrayproperty("array", std::array<int, 3> {1, 2, 3});
+  arrayproperty.onValueChange([&array_notified](const std::array<int, 3>&) {
+    array_notified++;
+  }).release();
+  auto arrayelement = dynamic_cast<ValueTypeInterface<int>*>(arrayproperty.getElement(1));
+  assert(*(++arrayproperty.begin()) == arrayelement);
+  arrayproperty.setValue({4, 5, 6});
+  arrayelement->setValue(7);
+  assert(arrayproperty.at(1) == 7 && array_notified == 2);
+  sum = 0;
+  arrayproperty.forEachElement([&sum](AbstractValueTypeInterface* element) {
+    sum += dynamic_cast<ValueTypeInterface<int>*>(element)->getValue();
+  });
+  assert(sum == 4 + 7 + 6);
+
+  // maps keep their interfaces by key, they follow a replaced map and are destroyed with their key
+  int map_notified = 0;
+  MapProperty<std::string, int> mapproperty("map", std::unordered_map<std::string, int> {{"A", 1}});
+  mapproperty.onValueChange([&map_notified](const std::unordered_map<std::string, int>&) {
+    map_notified++;
+  }).release();
+  auto mapelement = dynamic_cast<ValueTypeInterface<int>*>(mapproperty.getElement(0));
+  assert(mapelement == mapproperty.getElement(0));
+  mapproperty.setValue({{"A", 2}, {"B", 3}});
+  assert(mapelement->getValue() == 2);
+  mapelement->setValue(4);
+  assert(mapproperty.at("A") == 4 && map_notified == 2);
+  destroyed = false;
+  auto mapdestroyhandle = mapelement->onDestroy([&destroyed] {
+    destroyed = true;
+  });
+  mapproperty.remove("A");
+  assert(destroyed);
+
+  std::cout << "\tElementAccessor... OK" << std::endl;
+}
+
+PropertiesModel* createPersistenceModel() {
+  PropertiesModel *model = new PropertiesModel("model");
+  model->addProperty(new IntProperty("count", 3));
+  model->addProperty(new StringProperty("name", "a \"quoted\"\n\tvalue, \xc3\xbc"));
+  model->addProperty(new VectorProperty<double>("vector", std::vector<double> {1.5, -2}));
+  PropertiesModel *inner = model->addProperty(new PropertiesModel("inner"));
+  inner->addProperty(new DoubleProperty("value", 0.25));
+  return model;
+}
+
+/// the behaviour every PersistentManager has to provide
+template <typename Manager>
+void checkPersistentManager(const std::string& path) {
+  std::filesystem::remove(path);
+  std::unique_ptr<PropertiesModel> model(createPersistenceModel());
+
+  Manager saving;
+  assert(saving.openFileToSave(path));
+  model->store(&saving, "session.");
+  saving.closeFileToSave(path);
+
+  std::string value;
+  assert(saving.getValue("session.model.inner.value", value) && value == "0.25");
+  assert(Manager::isInNamespace("session.model.count", "session"));
+  assert(!Manager::isInNamespace("sessions.model.count", "session"));
+
+  // loading restores every property, also the nested ones
+  model->setValue<int>("count", 7);
+  model->setValue<std::string>("name", "changed");
+  model->setValue<double>("inner/value", 1);
+  Manager loading;
+  assert(loading.loadFile(path));
+  assert(loading.getSize() == 4);
+  model->load(&loading, "session.");
+  assert(model->getValue<int>("count") == 3);
+  assert(model->getValue<std::string>("name") == "a \"quoted\"\n\tvalue, \xc3\xbc");
+  assert(model->getProperty("vector")->toString() == "(1.5,-2)");
+  assert(model->getValue<double>("inner/value") == 0.25);
+
+  // a second namespace is added to the file, the first one is kept
+  model->setValue<int>("count", 11);
+  assert(saving.openFileToSave(path));
+  model->store(&saving, "other.");
+  saving.closeFileToSave(path);
+  assert(loading.loadFile(path));
+  assert(loading.getSize() == 8);
+  assert(loading.getValue("session.model.count", value) && value == "3");
+  assert(loading.getValue("other.model.count", value) && value == "11");
+
+  // keys missing in the file leave the property untouched
+  model->load(&loading, "missing.");
+  assert(model->getValue<int>("count") == 11);
+
+  assert(loading.removeNamespace("other", path));
+  assert(loading.loadFile(path));
+  assert(loading.getSize() == 4);
+  assert(!loading.getValue("other.model.count", value));
+
+  assert(!loading.loadFile(path + ".missing"));
+  std::filesystem::remove(path);
+}
+
+void PropertiesTest::test_persistentManagers() {
+  const std::filesystem::path directory = std::filesystem::temp_directory_path();
+  checkPersistentManager<BinaryPersistentManager>((directory / "propertiestest.bin").string());
+  checkPersistentManager<JsonPersistentManager>((directory / "propertiestest.json").string());
+
+  JsonPersistentManager json;
+  assert(json.fromJson("{\"a\": \"\\u00fc\\ud83d\\ude00\", \"b\" : \"\"}"));
+  std::string value;
+  assert(json.getValue("a", value) && value == "\xc3\xbc\xf0\x9f\x98\x80");
+  assert(!json.fromJson("{\"a\": 1}"));
+  assert(!json.fromJson("{\"a\": \"b\"} trailing"));
+  assert(json.getSize() == 2);
+  JsonPersistentManager reread;
+  assert(reread.fromJson(json.toJson()) && reread.toJson() == json.toJson());
+
+  // a record torn by a crash while appending is dropped, the ones before are kept
+  const std::string path = (directory / "propertiestest-crash.bin").string();
+  std::filesystem::remove(path);
+  std::unique_ptr<PropertiesModel> model(createPersistenceModel());
+  {
+    BinaryPersistentManager binary;
+    assert(binary.openFileToSave(path));
+    model->store(&binary, "session.");
+    binary.closeFileToSave(path);
+    assert(binary.getRecordCount() == 4);
+  }
+  const auto intact = std::filesystem::file_size(path);
+  {
+    std::ofstream torn(path, std::ios::binary | std::ios::app);
+    torn << '\x01' << "\x10\x00\x00\x00" << "half a rec";
+  }
+  BinaryPersistentManager binary;
+  assert(binary.loadFile(path) && binary.getSize() == 4);
+  assert(binary.openFileToSave(path));
+  assert(std::filesystem::file_size(path) == intact);
+
+  // only changed values are appended, many changes lead to a compaction
+  model->store(&binary, "session.");
+  assert(binary.getRecordCount() == 4);
+  for (int i = 0; i < 400; i++) {
+    model->setValue<int>("count", i);
+    model->store(&binary, "session.");
+  }
+  assert(binary.getRecordCount() == 404);
+  binary.closeFileToSave(path);
+  assert(binary.getRecordCount() == 4);
+  assert(binary.loadFile(path) && binary.getValue("session.model.count", value) && value == "399");
+
+  // an interrupted compaction leaves the file untouched
+  std::ofstream(path + ".compact") << "partial";
+  assert(binary.openFileToSave(path) && !std::filesystem::exists(path + ".compact"));
+  binary.closeFileToSave(path);
+  assert(binary.loadFile(path) && binary.getSize() == 4);
+  std::filesystem::remove(path);
+
+  std::cout << "\tPersistentManager... OK" << std::endl;
+}
+
+void PropertiesTest::test_eventBus() {
+  static_assert(EventId("value_changed") == ValueTypeInterface<int>::EVENT_VALUE_CHANGED);
+  assert(EventId(std::string("dom_change")) == Ambassador::EVENT_DOM_CHANGE);
+
+  EventBus bus;
+  bus.publish("nobody", 1);
+  assert(bus.getEvents().empty());
+
+  int received = 0;
+  int last = 0;
+  {
+    auto handle = bus.subscribe<int>("number", [&](const int& value) {
+      received++;
+      last = value;
+    });
+    bus.publish("number", 1);
+    assert(received == 1 && last == 1 && bus.getEvents().size() == 1);
+
+    // repeated events are delivered once with the last data, at the end of the outermost transaction
+    {
+      EventTransaction transaction;
+      assert(EventTransaction::isActive());
+      for (int i = 2; i <= 5; i++) {
+        bus.publish("number", i);
+      }
+      {
+        EventTransaction nested;
+        bus.publish("number", 6);
+      }
+      assert(received == 1);
+    }
+    assert(!EventTransaction::isActive());
+    assert(received == 2 && last == 6);
+  }
+  bus.publish("number", 7);
+  assert(received == 2);
+
+  // a slot may drop its own subscription
+  std::optional<AbstractSignal::Handle> self;
+  int self_received = 0;
+  self.emplace(bus.subscribe<void>("once", [&] {
+    self_received++;
+    self.reset();
+  }));
+  bus.publish("once");
+  bus.publish("once");
+  assert(self_received == 1);
+
+  // the changes of a whole model reach the root once
+  PropertiesModel root("root");
+  for (int m = 0; m < 3; m++) {
+    PropertiesModel *model = root.addProperty(new PropertiesModel("model" + std::to_string(m)));
+    for (int p = 0; p < 4; p++) {
+      model->addProperty(new IntProperty("value" + std::to_string(p), 0));
+    }
+  }
+  int dom_changes = 0;
+  auto dom_handle = root.onDomChange([&dom_changes](const std::string&) {
+    dom_changes++;
+  });
+  root.setValue<int>("model0/value0", 1);
+  assert(dom_changes == 1);
+  {
+    EventTransaction transaction;
+    for (int m = 0; m < 3; m++) {
+      for (int p = 0; p < 4; p++) {
+        root.setValue<int>("model" + std::to_string(m) + "/value" + std::to_string(p), 2);
+      }
+    }
+  }
+  assert(dom_changes == 2);
+
+  // destroyed objects are not notified and announce their destruction right away
+  int changes = 0;
+  bool destroyed = false;
+  {
+    EventTransaction transaction;
+    IntProperty *shortlived = new IntProperty("shortlived", 0);
+    auto change_handle = shortlived->onValueChange([&changes](const int&) {
+      changes++;
+    });
+    auto destroy_handle = shortlived->onDestroy([&destroyed] {
+      destroyed = true;
+    });
+    shortlived->setValue(1);
+    delete shortlived;
+    assert(destroyed);
+  }
+  assert(changes == 0);
+
+  // publishing from several threads while others subscribe
+  EventBus shared;
+  std::atomic<int> counted {0};
+  auto counting = shared.subscribe<int>("count", [&counted](const int& value) {
+    counted += value;
+  });
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([&shared] {
+      for (int i = 0; i < 10000; i++) {
+        shared.publish("count", 1);
+      }
+    });
+  }
+  threads.emplace_back([&shared] {
+    for (int i = 0; i < 1000; i++) {
+      auto handle = shared.subscribe<int>(i % 2 ? "count" : "other", [](const int&) {});
+    }
+  });
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  assert(counted == 40000);
+  assert(shared.getEvents().size() == 2);
+
+  // two signals notifying each other from two threads
+  auto ping = std::make_shared<Signal<int>>();
+  auto pong = std::make_shared<Signal<int>>();
+  std::atomic<int> bounced {0};
+  ping->connect([&pong, &bounced](const int& value) {
+    bounced++;
+    if (value > 0) pong->notify(value - 1);
+  });
+  pong->connect([&ping, &bounced](const int& value) {
+    bounced++;
+    if (value > 0) ping->notify(value - 1);
+  });
+  std::thread pinging([&ping] {
+    for (int i = 0; i < 1000; i++) ping->notify(3);
+  });
+  std::thread ponging([&pong] {
+    for (int i = 0; i < 1000; i++) pong->notify(3);
+  });
+  pinging.join();
+  ponging.join();
+  assert(bounced == 8000);
+
+  std::cout << "\tEventBus... OK" << std::endl;
+}
+
+void PropertiesTest::test_colorMap() {
+  std::vector<REAL> values {0.0, 1.0, 0.5, 0.125, 0.375, 0.875, -0.5, 1.5, -FLT_MAX, std::nan(""), 1.0 / 3, 2.0 / 3};
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<REAL> distribution(-0.1, 1.1);
+  for (int i = 0; i < 1000; i++) {
+    values.push_back(distribution(generator));
+  }
+  const long count = values.size();
+
+  unsigned char colormapentries[] = {10, 20, 30, 40, 50, 60, 70, 80, 90};
+  ColorMap colormap;
+  ColorMap_init(&colormap, nullptr);
+  colormap.constcolor[0] = 12;
+
+  // the batch functions have to match the scalar ones in each byte
+  for (int mode = 0; mode < NUM_PACECOLORS; mode++) {
+    for (int flags = 0; flags < 8; flags++) {
+      colormap.mode = PaceColorMode(mode);
+      colormap.interpolate = flags & 1;
+      colormap.invert = flags & 2;
+      colormap.negate = flags & 4;
+      colormap.colormap = mode == COLORFILE ? colormapentries : nullptr;
+      colormap.nummapentries = mode == COLORFILE ? 3 : 0;
+
+      std::vector<unsigned char> rgb(count * 3), rgba(count * 4), scaled(count * 3);
+      ColorMap_getColorsNormalized(&colormap, rgb.data(), 3, values.data(), count);
+      ColorMap_getColorsNormalized(&colormap, rgba.data(), 4, values.data(), count);
+      ColorMap_getColors(&colormap, scaled.data(), 3, values.data(), count, -2.0, 3.0);
+
+      for (long i = 0; i < count; i++) {
+        unsigned char color[3];
+        // the scalar function reads out of the table for negative indices
+        if (mode != COLORFILE || (values[i] >= 0 && values[i] < 2.5) || values[i] == -FLT_MAX) {
+          ColorMap_getColorNormalized(&colormap, color, values[i]);
+          assert(std::equal(color, color + 3, &rgb[i * 3]));
+          assert(std::equal(color, color + 3, &rgba[i * 4]) && rgba[i * 4 + 3] == 255);
+        }
+        ColorMap_getColor(&colormap, color, values[i], -2.0, 3.0);
+        assert(std::equal(color, color + 3, &scaled[i * 3]));
+      }
+    }
+  }
+
+  // without a range every value is mapped to the lowest color
+  colormap.mode = Viridis;
+  std::vector<unsigned char> flat(count * 3);
+  ColorMap_getColors(&colormap, flat.data(), 3, values.data(), count, 1.0, 1.0);
+  for (long i = 0; i < count; i++) {
+    unsigned char color[3];
+    ColorMap_getColor(&colormap, color, values[i], 1.0, 1.0);
+    assert(std::equal(color, color + 3, &flat[i * 3]));
+  }
+
+  std::cout << "\tColorMap... OK" << std::endl;
+}
+
 int main() {
   std::cout << "Running basic tests on property implementations..." << std::endl;
   PropertiesTest().run();
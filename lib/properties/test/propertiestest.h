@@ -67,6 +67,12 @@ class PropertiesTest {
       test_mapProperty();
       test_matrixProperty();
       test_dynamicProperty();
+      test_propertyHandle();
+      test_numericText();
+      test_elementAccessor();
+      test_persistentManagers();
+      test_eventBus();
+      test_colorMap();
     }
   private:
     void test_primitiveProperties();
@@ -75,4 +81,10 @@ class PropertiesTest {
     void test_mapProperty();
     void test_matrixProperty();
     void test_dynamicProperty();
+    void test_propertyHandle();
+    void test_numericText();
+    void test_elementAccessor();
+    void test_persistentManagers();
+    void test_eventBus();
+    void test_colorMap();
 };
@@ -21,5 +21,10 @@ VTIWidget::VTIWidget(AbstractValueTypeInterface* valuetypeinterface)
     signal_handler += valuetypeinterface->onChange([this]([[maybe_unused]] AbstractValueTypeInterface* const& avti) {
       synchronizeVTI();
     });
+    // the interfaces of container elements are destroyed when the container shrinks
+    signal_handler += valuetypeinterface->onDestroy([this] {
+      this->valuetypeinterface = nullptr;
+      valueTypeInterfaceDestroyed();
+    });
   }
 }
@@ -14,8 +14,10 @@
 
 #pragma once
 
+#include <iostream>
 #include <stdexcept>
 #include "../../data/properties/propertychangelistener.h"
+#include "../../data/valuetypeinterface/numerictext.h"
 #include "../../data/valuetypeinterface/valuetypeinterface.h"
 
 class AbstractValueTypeInterface;
@@ -30,6 +32,10 @@ class VTIWidget {
     VTIWidget(AbstractValueTypeInterface* valuetypeinterface);
     virtual ~VTIWidget() = default;
 
+    /**
+      * @return The ValueTypeInterface (VTI) of the widget, or nullptr once it
+      * was destroyed, e.g. the element of a container which shrank.
+      */
     AbstractValueTypeInterface* getValueTypeInterface() const {
       return valuetypeinterface;
     }
@@ -42,8 +48,15 @@ class VTIWidget {
     virtual void synchronizeVTI() = 0;
 
   protected:
+    /**
+      * @brief Called when the VTI is destroyed before the widget, the widget
+      * should stop editing it until the panel is rebuilt.
+      */
+    virtual void valueTypeInterfaceDestroyed() {}
+
     template <typename T>
     void setValue(const T& value) {
+      if (not valuetypeinterface) return;
       auto vti = dynamic_cast<ValueTypeInterface<T>*>(valuetypeinterface);
       if (not vti) {
         throw std::runtime_error("Could not set value (invalid VTI)");
@@ -51,8 +64,16 @@ class VTIWidget {
       vti->setValue(value);
     }
 
+    /**
+      * @brief Parses the value, a malformed text is reported and leaves the value untouched.
+      */
     void setValue(const std::string& value) {
-      valuetypeinterface->fromString(value);
+      if (not valuetypeinterface) return;
+      try {
+        valuetypeinterface->fromString(value);
+      } catch (const NumericTextError& error) {
+        std::cerr << "Ignoring the value '" << value << "': " << error.what() << std::endl;
+      }
     }
 
     template <typename T>
@@ -70,6 +91,7 @@ class VTIWidget {
     }
 
     void getValue(std::string& value) const {
+      if (not valuetypeinterface) return;
       value = valuetypeinterface->toString();
     }
 
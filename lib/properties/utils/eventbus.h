@@ -17,23 +17,191 @@
 #include "slot.h"
 
 #include <algorithm>
-#include <map>
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
 #include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
+/// @brief Identifies an event by a hash of its name.
+/// The hash is computed at compile time for constant names, so looking up
+/// an event compares integers instead of strings.
+class EventId final {
+  public:
+    constexpr EventId(std::string_view name) : name{name}, id{hash(name)} {}
+    constexpr EventId(const char* name) : EventId(std::string_view(name)) {}
+
+    [[nodiscard]] constexpr std::string_view getName() const {
+      return name;
+    }
+
+    [[nodiscard]] constexpr uint64_t getId() const {
+      return id;
+    }
+
+    constexpr bool operator==(const EventId& rhs) const {
+      return id == rhs.id;
+    }
+
+    /// @brief Registers the name of the event.
+    /// Throws std::logic_error if another name with the same hash was registered before.
+    void intern() const {
+      static std::mutex mutex;
+      static std::unordered_map<uint64_t, std::string> names;
+
+      std::lock_guard<std::mutex> lock(mutex);
+      const auto [it, inserted] = names.emplace(id, name);
+      if (!inserted && it->second != name) {
+        throw std::logic_error("Events '" + it->second + "' and '" + std::string(name) + "' have the same id");
+      }
+    }
+
+  private:
+    /// FNV-1a
+    static constexpr uint64_t hash(std::string_view name) {
+      uint64_t result = 14695981039346656037ull;
+      for (char c : name) {
+        result = (result ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+      }
+      return result;
+    }
+
+    std::string_view name;
+    uint64_t id;
+};
+
+/// @brief Defers and coalesces the events published on this thread.
+/// While a transaction is open, publishing an event on any EventBus only
+/// records it. Publishing the same event of the same bus again replaces the
+/// recorded data, so the subscribers receive the last data once. When the
+/// outermost transaction ends, the recorded events are delivered in the
+/// order they were first published. Events published by the subscribers
+/// meanwhile are recorded and coalesced as well, until none are left.
+///
+/// Slots run late within a transaction, so only wrap code which does not
+/// depend on the side effects of the slots, like loading many values.
+class EventTransaction final {
+  friend class EventBus;
+
+  public:
+    EventTransaction() {
+      ++state().depth;
+    }
+
+    EventTransaction(const EventTransaction&) = delete;
+    EventTransaction(EventTransaction&&) = delete;
+
+    ~EventTransaction() {
+      State &current = state();
+      if (current.depth > 1) {
+        --current.depth;
+        return;
+      }
+
+      while (!current.pending.empty()) {
+        std::vector<Pending> pending = std::exchange(current.pending, {});
+        current.index.clear();
+        for (const auto &event : pending) {
+          if (auto signal = event.signal.lock()) {
+            try {
+              signal->notify(event.data.get());
+            } catch (const std::exception &e) {
+              std::cerr << "  (WW) Event handler failed: " << e.what() << std::endl;
+            }
+          }
+        }
+      }
+      current.depth = 0;
+    }
+
+    EventTransaction& operator=(const EventTransaction&) = delete;
+    EventTransaction& operator=(EventTransaction&&) = delete;
+
+    /// @brief Whether a transaction is open on this thread.
+    [[nodiscard]] static bool isActive() {
+      return state().depth > 0;
+    }
+
+  private:
+    struct Pending {
+      std::weak_ptr<Signal<const void*>> signal;
+      std::shared_ptr<const void> data;
+    };
+
+    struct State {
+      int depth{};
+      std::vector<Pending> pending{};
+      std::unordered_map<const void*, size_t> index{};
+    };
+
+    static State& state() {
+      thread_local State current;
+      return current;
+    }
+
+    /// @brief Records an event if a transaction is open.
+    /// @return True if the event was recorded.
+    template<typename T>
+    static bool defer(const std::shared_ptr<Signal<const void*>>& signal, const T* data) {
+      State &current = state();
+      if (current.depth == 0) {
+        return false;
+      }
+
+      std::shared_ptr<const void> copy;
+      if constexpr (!std::is_void_v<T>) {
+        if constexpr (std::is_copy_constructible_v<T>) {
+          copy = std::make_shared<const T>(*data);
+        } else {
+          // the data can not be kept until the end of the transaction
+          return false;
+        }
+      }
+
+      const auto [it, inserted] = current.index.try_emplace(signal.get(), current.pending.size());
+      if (inserted) {
+        current.pending.push_back({signal, std::move(copy)});
+      } else {
+        Pending &event = current.pending[it->second];
+        // the address may belong to a signal destroyed in the meantime
+        event.signal = signal;
+        event.data = std::move(copy);
+      }
+      return true;
+    }
+};
+
 /// @brief Provides a pub/sub mechanism for events.
+/// Subscribing and publishing are thread safe. The events are created on
+/// the first subscription, until then publishing costs a single load.
 class EventBus final {
   public:
-    using Events = std::map<std::string_view, std::shared_ptr<Signal<const void*>>>;
+    using Events = std::vector<std::pair<EventId, std::shared_ptr<Signal<const void*>>>>;
 
   public:
     EventBus() = default;
     EventBus(const EventBus&) = delete;
-    EventBus(EventBus&&) = default;
-    ~EventBus() = default;
+
+    EventBus(EventBus&& other) noexcept : channels{other.channels.exchange(nullptr)} {}
+
+    ~EventBus() {
+      delete channels.load();
+    }
 
     EventBus& operator=(const EventBus&) = delete;
-    EventBus& operator=(EventBus&&) = default;
+
+    EventBus& operator=(EventBus&& other) noexcept {
+      if (this != &other) {
+        delete channels.exchange(other.channels.exchange(nullptr));
+      }
+      return *this;
+    }
 
     /// @brief Subscribe to a specific event.
     /// @tparam T The type of callback parameter.
@@ -42,10 +210,8 @@ class EventBus final {
     /// @param callback The callback.
     /// @return Handle to the subscription.
     template<typename T, typename F>
-    [[nodiscard]] AbstractSignal::Handle subscribe(std::string_view event, F&& callback) {
-      addEvent(event);
-
-      return events.at(event)->connectScoped([callback](const void* data) {
+    [[nodiscard]] AbstractSignal::Handle subscribe(EventId event, F&& callback) {
+      return addEvent(event)->connectScoped([callback](const void* data) {
         if constexpr (std::is_void_v<T>) {
           callback();
         } else {
@@ -55,40 +221,94 @@ class EventBus final {
     }
 
     /// @brief Publish an event with data.
+    /// Within an EventTransaction the data is copied and delivered later.
     /// @tparam T The type of the data.
     /// @param event The event.
     /// @param data The data to send.
     template<typename T>
-    void publish(std::string_view event, const T& data) {
-      if (events.find(event) != events.end()) {
-        events.at(event)->notify(reinterpret_cast<const void*>(&data));
+    void publish(EventId event, const T& data) {
+      if (auto signal = findEvent(event)) {
+        if (!EventTransaction::defer(signal, &data)) {
+          signal->notify(reinterpret_cast<const void*>(&data));
+        }
       }
     }
 
     /// @brief Publish an event without data.
     /// @param event The event.
-    void publish(std::string_view event) {
-      if (events.find(event) != events.end()) {
-        events.at(event)->notify(nullptr);
+    void publish(EventId event) {
+      if (auto signal = findEvent(event)) {
+        if (!EventTransaction::defer<void>(signal, nullptr)) {
+          signal->notify(nullptr);
+        }
+      }
+    }
+
+    /// @brief Publish an event without data right away, even within an EventTransaction.
+    /// @param event The event.
+    void publishNow(EventId event) {
+      if (auto signal = findEvent(event)) {
+        signal->notify(nullptr);
       }
     }
 
     /// @brief Returns all events.
-    /// @return The events.
-    [[nodiscard]] const Events& getEvents() const {
-      return events;
+    /// @return A snapshot of the events.
+    [[nodiscard]] Events getEvents() const {
+      Channels *current = channels.load(std::memory_order_acquire);
+      if (current == nullptr) {
+        return {};
+      }
+      std::lock_guard<std::mutex> lock(current->mutex);
+      return current->events;
     }
 
   private:
-    void addEvent(std::string_view event) {
+    struct Channels {
+      std::mutex mutex{};
+      Events events{};
+    };
+
+    std::shared_ptr<Signal<const void*>> findEvent(EventId event) const {
+      Channels *current = channels.load(std::memory_order_acquire);
+      if (current == nullptr) {
+        return nullptr;
+      }
+
+      std::lock_guard<std::mutex> lock(current->mutex);
+      for (const auto &[id, signal] : current->events) {
+        if (id == event) {
+          return signal;
+        }
+      }
+      return nullptr;
+    }
+
+    std::shared_ptr<Signal<const void*>> addEvent(EventId event) {
       // TODO: Check if event is allowed.
-      if (events.find(event) == events.end()) {
-        events.insert({event, std::make_shared<Signal<const void*>>()});
+      Channels *current = channels.load(std::memory_order_acquire);
+      if (current == nullptr) {
+        auto created = new Channels();
+        if (channels.compare_exchange_strong(current, created, std::memory_order_acq_rel)) {
+          current = created;
+        } else {
+          delete created;
+        }
+      }
+
+      std::lock_guard<std::mutex> lock(current->mutex);
+      for (const auto &[id, signal] : current->events) {
+        if (id == event) {
+          return signal;
+        }
       }
+      event.intern();
+      current->events.emplace_back(event, std::make_shared<Signal<const void*>>());
+      return current->events.back().second;
     }
 
   private:
-    Events events{};
+    std::atomic<Channels*> channels{nullptr};
 };
 
 /// @brief Keeps track of event handles.
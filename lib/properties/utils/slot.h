@@ -25,6 +25,7 @@
 #include <utility>
 #include <map>
 #include <memory>
+#include <mutex>
 
 /// @brief Base for Signal class.
 class AbstractSignal : public std::enable_shared_from_this<AbstractSignal> {
@@ -101,6 +102,9 @@ class AbstractSignal : public std::enable_shared_from_this<AbstractSignal> {
 };
 
 /// @brief Allows to register callbacks.
+/// Connecting, disconnecting and notifying may happen on different threads.
+/// The slots are called without holding the lock, so a slot may connect and
+/// disconnect slots, also itself, and notify other signals.
 /// @tparam T The type of value to notify about.
 template<typename T>
 class Signal : public AbstractSignal {
@@ -112,8 +116,18 @@ class Signal : public AbstractSignal {
     /// @brief Notify all registered callbacks about a change.
     /// @param value The new value.
     void notify(const T& value) const {
-      for (auto it = slot_queue.begin(); it != slot_queue.end(); ++it) {
-        it->second(value);
+      // the running slot is kept alive by its own reference, the next one is looked up after its id
+      size_t id = 0;
+      while (true) {
+        std::shared_ptr<const Slot> slot;
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          auto it = slot_queue.upper_bound(id);
+          if (it == slot_queue.end()) return;
+          id = it->first;
+          slot = it->second;
+        }
+        (*slot)(value);
       }
     }
 
@@ -121,7 +135,8 @@ class Signal : public AbstractSignal {
     /// The callback must be valid for the entire lifetime of the signal instance.
     /// @param slot The callback.
     void connect(Slot&& slot) {
-      slot_queue.insert({++id_counter, slot});
+      std::lock_guard<std::mutex> lock(mutex);
+      slot_queue.insert({++id_counter, std::make_shared<const Slot>(std::move(slot))});
     }
 
     /// @brief Register a callback.
@@ -129,8 +144,9 @@ class Signal : public AbstractSignal {
     /// @param slot The callback.
     /// @return The handle to the callback.
     Handle connectScoped(Slot&& slot) {
+      std::lock_guard<std::mutex> lock(mutex);
       const auto id = ++id_counter;
-      slot_queue.insert({id, slot});
+      slot_queue.insert({id, std::make_shared<const Slot>(std::move(slot))});
 
       return createHandle(id);
     }
@@ -146,10 +162,18 @@ class Signal : public AbstractSignal {
     /// @brief Unregisters a callback.
     /// @param handle The handle of the callback.
     void disconnect(Handle&& handle) override {
-      slot_queue.erase(handle.getID());
+      // the slot is destroyed after the lock is released, it may own handles of this signal
+      std::shared_ptr<const Slot> slot;
+      std::lock_guard<std::mutex> lock(mutex);
+      auto it = slot_queue.find(handle.getID());
+      if (it != slot_queue.end()) {
+        slot = std::move(it->second);
+        slot_queue.erase(it);
+      }
     }
 
   private:
+    mutable std::mutex mutex{};
     size_t id_counter{};
-    std::map<size_t, Slot> slot_queue{};
+    std::map<size_t, std::shared_ptr<const Slot>> slot_queue{};
 };
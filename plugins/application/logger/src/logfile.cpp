@@ -0,0 +1,61 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <cstdio>
+
+#include "logfile.h"
+
+LogFile::LogFile(const QString& file_name, qint64 max_size, int rotated_files)
+    : file(file_name), max_size(max_size), rotated_files(rotated_files) {
+  if (!file.open(QIODevice::WriteOnly | QIODevice::Append)) {
+    // qDebug would end up in the log itself
+    std::fprintf(stderr, "Unable to write the log to %s\n", qPrintable(file_name));
+  }
+}
+
+bool LogFile::isOpen() const {
+  return file.isOpen();
+}
+
+void LogFile::write(const QByteArray& lines) {
+  if (!file.isOpen() || lines.isEmpty()) return;
+
+  if (file.size() > 0 && file.size() + lines.size() > max_size) {
+    rotate();
+  }
+  file.write(lines);
+}
+
+void LogFile::flush() {
+  if (file.isOpen()) {
+    file.flush();
+  }
+}
+
+void LogFile::rotate() {
+  const QString file_name = file.fileName();
+  file.close();
+
+  QFile::remove(QString("%1.%2").arg(file_name).arg(rotated_files));
+  for (int i = rotated_files - 1; i >= 1; --i) {
+    QFile::rename(QString("%1.%2").arg(file_name).arg(i), QString("%1.%2").arg(file_name).arg(i + 1));
+  }
+  if (rotated_files > 0) {
+    QFile::rename(file_name, file_name + ".1");
+  } else {
+    QFile::remove(file_name);
+  }
+
+  file.open(QIODevice::WriteOnly | QIODevice::Append);
+}
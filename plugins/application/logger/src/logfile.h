@@ -0,0 +1,50 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtCore/QFile>
+#include <QtCore/QString>
+
+/**
+ * @brief      Writes the log to a local file and rotates it by size.
+ *
+ *             When the file exceeds the maximum size, it is renamed to
+ *             <file>.1, an older <file>.1 to <file>.2 and so on. Only the
+ *             given number of rotated files is kept.
+ * @ingroup    logger
+ */
+class LogFile {
+
+  public:
+    LogFile(const QString& file_name, qint64 max_size = MAX_SIZE, int rotated_files = ROTATED_FILES);
+
+    bool isOpen() const;
+
+    /**
+     * @brief      Writes a batch of lines, each terminated by a newline.
+     */
+    void write(const QByteArray& lines);
+    void flush();
+
+    const static qint64 MAX_SIZE = 8 * 1024 * 1024;
+    const static int ROTATED_FILES = 3;
+
+  private:
+    void rotate();
+
+    QFile file;
+    const qint64 max_size;
+    const int rotated_files;
+};
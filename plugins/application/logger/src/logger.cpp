@@ -12,64 +12,28 @@
  * See the License for the specific language governing permissions and
  * limitations under the License. */
 
-#include <QScrollBar>
-#include <QPointer>
-
 #include "logger.h"
+#include "logpipeline.h"
 
 
-static QPointer<QTextBrowser> logger = NULL;
-
-void myMessageOutput(QtMsgType type, const QMessageLogContext &context, const QString &msg) {
-  QString format;
-
-  switch (type) {
-    case QtDebugMsg:
-      format = QString("<div class=\"log debug\">(DD)</div><b> %1</b><br />");
-      break;
-    case QtWarningMsg:
-      format = QString("<div class=\"log warning\">(WW)</div> %1<br />");
-      break;
-    case QtCriticalMsg:
-      format = QString("<div class=\"log critical\">(CC)</div> %1<br />");
-      break;
-    case QtFatalMsg:
-      format = QString("<div class=\"log fatal\">(EE)</div> %1<br />");
-      abort();
-    default:
-      format = QString("<div class=\"log info\">(II)</div> %1<br />");
-  }
-
-  logger->insertHtml(format.arg(msg));
-}
-
 Logger::Logger() {
-  oldHandler = qInstallMessageHandler(myMessageOutput);
-
-  setAcceptRichText(true);
-  document()->setDefaultStyleSheet(QString(".log {margin-right:7px; font-weight:bold;} .info {color:#ffffff} .debug {color:#6666ff;} .warning {color:#dddd00;} .critical {color:#990000}"));
-  setStyleSheet(QString( "QTextBrowser { background-color:#222; font-family: monospace; color:#ffc; }"));
+  QPalette colors = palette();
+  colors.setColor(QPalette::Base, QColor("#222"));
+  colors.setColor(QPalette::Text, QColor("#ffc"));
+  setPalette(colors);
   setFont(QFont("Courier New", 10));
 
-  connect(this, SIGNAL(textChanged()), this, SLOT(scrollToBottom()));
-  connect(this->verticalScrollBar(), SIGNAL(valueChanged(int)), this, SLOT(scrolledTo(int)));
-
-  this->atbottom = true;
-
-  logger = this;
+  pipeline = new LogPipeline(LogPipeline::RING_CAPACITY, LogPipeline::QUEUE_CAPACITY, this);
+  connect(pipeline, &LogPipeline::flushed, this, &Logger::linesFlushed);
+  setSource(&pipeline->lines());
+  pipeline->install();
 }
 
 Logger::~Logger() {
-  qInstallMessageHandler(oldHandler);
-  logger = nullptr;
-}
-
-void Logger::scrollToBottom(void) {
-  if (this->atbottom) {
-    verticalScrollBar()->setValue( verticalScrollBar()->maximum() );
-  }
+  pipeline->uninstall();
 }
 
-void Logger::scrolledTo(int val) {
-  this->atbottom = (val == verticalScrollBar()->maximum());
+void Logger::linesFlushed(int /*appended*/, int discarded) {
+  // once the ring is full, every appended line drops the oldest one
+  linesDropped(discarded);
 }
@@ -14,13 +14,15 @@
 
 #pragma once
 
-#include <QTextBrowser>
+#include <framework/enhanced/terminalview.h>
+
+class LogPipeline;
 
 /**
  * @brief      Logs all QDebug messages in a widget
  * @ingroup    logger
  */
-class Logger : public QTextBrowser {
+class Logger : public TerminalView {
     Q_OBJECT
 
   public:
@@ -28,12 +30,9 @@ class Logger : public QTextBrowser {
     ~Logger();
 
   private Q_SLOTS:
-    void scrollToBottom(void);
-    void scrolledTo(int val);
+    void linesFlushed(int appended, int discarded);
 
   private:
-    QtMessageHandler oldHandler;
-
-    bool atbottom;
+    LogPipeline *pipeline;
 
 };
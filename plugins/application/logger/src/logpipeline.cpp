@@ -0,0 +1,202 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+#include <QtCore/QDateTime>
+#include <QtCore/QTimer>
+
+#include "logfile.h"
+#include "logpipeline.h"
+
+namespace {
+
+// the pipeline the message handler delivers to
+std::atomic<LogPipeline*> installed_pipeline {nullptr};
+// handlers currently inside post(), which must finish before the pipeline goes away
+std::atomic<int> active_handlers {0};
+
+}
+
+LogPipeline::LogPipeline(std::size_t ring_capacity, std::size_t queue_capacity, QObject *parent)
+    : QObject(parent), queue(queue_capacity), ring(ring_capacity), flush_pending(false), received_count(0),
+      dropped_count(0), previous_handler(nullptr) {
+  flush_timer = new QTimer(this);
+  flush_timer->setSingleShot(true);
+  flush_timer->setInterval(FLUSH_INTERVAL);
+  connect(flush_timer, &QTimer::timeout, this, &LogPipeline::flush);
+
+  QString log_file_name = qEnvironmentVariable("KADISTUDIO_LOG_FILE");
+  if (!log_file_name.isEmpty()) {
+    setLogFile(std::make_unique<LogFile>(log_file_name));
+  }
+}
+
+LogPipeline::~LogPipeline() {
+  uninstall();
+  if (log_file) {
+    flush();
+  }
+}
+
+void LogPipeline::install() {
+  LogPipeline *expected = nullptr;
+  if (installed_pipeline.compare_exchange_strong(expected, this)) {
+    previous_handler = qInstallMessageHandler(handleMessage);
+  }
+}
+
+void LogPipeline::uninstall() {
+  LogPipeline *expected = this;
+  if (!installed_pipeline.compare_exchange_strong(expected, nullptr)) return;
+
+  qInstallMessageHandler(previous_handler);
+  while (active_handlers.load() > 0) {
+    std::this_thread::yield();
+  }
+}
+
+void LogPipeline::setLogFile(std::unique_ptr<LogFile> file) {
+  log_file = std::move(file);
+}
+
+void LogPipeline::handleMessage(QtMsgType type, const QMessageLogContext& context, const QString& message) {
+  QtMessageHandler fallback = nullptr;
+  active_handlers++;
+  LogPipeline *pipeline = installed_pipeline.load();
+  if (pipeline) {
+    pipeline->post(type, message);
+    fallback = pipeline->previous_handler;
+  }
+  active_handlers--;
+
+  if (type == QtFatalMsg) {
+    // there will be no flush anymore, leave the message where it can be found
+    if (fallback) {
+      fallback(type, context, message);
+    } else {
+      std::fprintf(stderr, "%s\n", qPrintable(message));
+    }
+    std::abort();
+  }
+}
+
+void LogPipeline::post(QtMsgType type, const QString& message) {
+  received_count.fetch_add(1, std::memory_order_relaxed);
+  queue.push({type, message, QDateTime::currentMSecsSinceEpoch()});
+
+  if (!flush_pending.exchange(true)) {
+    QMetaObject::invokeMethod(this, &LogPipeline::scheduleFlush, Qt::QueuedConnection);
+  }
+}
+
+void LogPipeline::scheduleFlush() {
+  if (!flush_timer->isActive()) {
+    flush_timer->start();
+  }
+}
+
+void LogPipeline::flush() {
+  // messages arriving from now on schedule the next flush
+  flush_pending = false;
+
+  int appended = 0;
+  int discarded = 0;
+  QByteArray file_lines;
+
+  auto append = [&](const LogRecord& record) {
+    for (const QString& line : format(record).split('\n')) {
+      appended++;
+      if (ring.append(line)) {
+        discarded++;
+      }
+    }
+    if (log_file) {
+      file_lines += QDateTime::fromMSecsSinceEpoch(record.time).toString(Qt::ISODateWithMs).toUtf8() + ' ' +
+                    tag(record.type) + ' ' + record.message.toUtf8() + '\n';
+    }
+  };
+
+  std::size_t dropped_records = queue.takeDropped();
+  if (dropped_records > 0) {
+    dropped_count += dropped_records;
+    append({QtWarningMsg, QString("%1 messages were dropped").arg(dropped_records),
+            QDateTime::currentMSecsSinceEpoch()});
+  }
+
+  LogRecord record;
+  while (queue.pop(record)) {
+    append(record);
+  }
+
+  if (log_file) {
+    log_file->write(file_lines);
+    log_file->flush();
+  }
+  if (appended > 0) {
+    Q_EMIT flushed(appended, discarded);
+  }
+}
+
+const char *LogPipeline::tag(QtMsgType type) {
+  switch (type) {
+    case QtDebugMsg:
+      return "(DD)";
+    case QtWarningMsg:
+      return "(WW)";
+    case QtCriticalMsg:
+      return "(CC)";
+    case QtFatalMsg:
+      return "(EE)";
+    default:
+      return "(II)";
+  }
+}
+
+QString LogPipeline::format(const LogRecord& record) {
+  QString line;
+  switch (record.type) {
+    case QtDebugMsg:
+      line = "\x1B[1;38;2;102;102;255m(DD)\x1B[0m \x1B[1m";
+      break;
+    case QtWarningMsg:
+      line = "\x1B[1;38;2;221;221;0m(WW)\x1B[0m ";
+      break;
+    case QtCriticalMsg:
+    case QtFatalMsg:
+      line = QString("\x1B[1;38;2;153;0;0m%1\x1B[0m ").arg(tag(record.type));
+      break;
+    default:
+      line = "\x1B[1;38;2;255;255;255m(II)\x1B[0m ";
+  }
+  line += record.message;
+  // every line ends in the default format, so dropping lines from the front of the ring does not change the others
+  line.replace('\n', "\x1B[0m\n     ");
+  line += "\x1B[0m";
+  return line;
+}
+
+const LogRing& LogPipeline::lines() const {
+  return ring;
+}
+
+qint64 LogPipeline::received() const {
+  return received_count.load(std::memory_order_relaxed);
+}
+
+qint64 LogPipeline::dropped() const {
+  return dropped_count;
+}
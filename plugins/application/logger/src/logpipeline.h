@@ -0,0 +1,108 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include <QtCore/QObject>
+
+#include "logqueue.h"
+#include "logring.h"
+
+class QTimer;
+class LogFile;
+
+/**
+ * @brief      Collects the Qt messages of all threads and hands them to the
+ *             GUI in batches.
+ *
+ *             The installed message handler only pushes the message to a
+ *             lock-free LogQueue, it never touches a widget and never waits
+ *             for the GUI thread. The first message after a flush schedules
+ *             the next one, so the thread of the pipeline drains the queue
+ *             at most every FLUSH_INTERVAL milliseconds, formats the records
+ *             into the LogRing and appends them to the log file, if any.
+ *
+ *             Setting KADISTUDIO_LOG_FILE to a file name additionally writes
+ *             the log to that file, see LogFile for the rotation.
+ * @ingroup    logger
+ */
+class LogPipeline : public QObject {
+    Q_OBJECT
+
+  public:
+    explicit LogPipeline(std::size_t ring_capacity = RING_CAPACITY, std::size_t queue_capacity = QUEUE_CAPACITY,
+                         QObject *parent = nullptr);
+    ~LogPipeline() override;
+
+    /**
+     * @brief      Makes this pipeline the Qt message handler, until it is
+     *             uninstalled or destroyed.
+     */
+    void install();
+    void uninstall();
+
+    void setLogFile(std::unique_ptr<LogFile> log_file);
+
+    /**
+     * @brief      Queues a message. Thread safe.
+     */
+    void post(QtMsgType type, const QString& message);
+
+    const LogRing& lines() const;
+
+    /**
+     * @return     The number of messages that were queued or dropped.
+     */
+    qint64 received() const;
+    qint64 dropped() const;
+
+    const static int FLUSH_INTERVAL = 16;
+    const static std::size_t RING_CAPACITY = 20000;
+    const static std::size_t QUEUE_CAPACITY = 65536;
+
+  public Q_SLOTS:
+    /**
+     * @brief      Moves all queued messages to the ring and the log file.
+     */
+    void flush();
+
+  Q_SIGNALS:
+    /**
+     * @brief      Emitted after a flush, with the number of new lines and
+     *             the number of old lines that were dropped from the front
+     *             of the ring for them.
+     */
+    void flushed(int appended, int discarded);
+
+  private:
+    static void handleMessage(QtMsgType type, const QMessageLogContext& context, const QString& message);
+    static const char *tag(QtMsgType type);
+    static QString format(const LogRecord& record);
+
+    void scheduleFlush();
+
+    LogQueue queue;
+    LogRing ring;
+    std::unique_ptr<LogFile> log_file;
+
+    QTimer *flush_timer;
+    std::atomic<bool> flush_pending;
+    std::atomic<qint64> received_count;
+    qint64 dropped_count;
+
+    QtMessageHandler previous_handler;
+};
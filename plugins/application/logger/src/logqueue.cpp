@@ -0,0 +1,66 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "logqueue.h"
+
+LogQueue::LogQueue(std::size_t capacity)
+    : max_size(capacity), current_size(0), dropped(0) {
+  // the tail always points to an already consumed node
+  tail = new Node();
+  head.store(tail);
+}
+
+LogQueue::~LogQueue() {
+  LogRecord record;
+  while (pop(record)) {}
+  delete tail;
+}
+
+bool LogQueue::push(LogRecord record) {
+  if (current_size.fetch_add(1, std::memory_order_relaxed) >= max_size) {
+    current_size.fetch_sub(1, std::memory_order_relaxed);
+    dropped.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  Node *node = new Node();
+  node->record = std::move(record);
+  Node *previous = head.exchange(node, std::memory_order_acq_rel);
+  previous->next.store(node, std::memory_order_release);
+  return true;
+}
+
+bool LogQueue::pop(LogRecord& record) {
+  // a producer between its exchange and linking the node looks like an empty queue
+  Node *next = tail->next.load(std::memory_order_acquire);
+  if (!next) return false;
+
+  record = std::move(next->record);
+  delete tail;
+  tail = next;
+  current_size.fetch_sub(1, std::memory_order_relaxed);
+  return true;
+}
+
+std::size_t LogQueue::takeDropped() {
+  return dropped.exchange(0, std::memory_order_relaxed);
+}
+
+std::size_t LogQueue::size() const {
+  return current_size.load(std::memory_order_relaxed);
+}
+
+std::size_t LogQueue::capacity() const {
+  return max_size;
+}
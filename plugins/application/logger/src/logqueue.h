@@ -0,0 +1,87 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+#include <QtCore/QString>
+#include <QtCore/QtGlobal>
+
+/**
+ * @brief      A single message passed to the Qt message handler.
+ * @ingroup    logger
+ */
+struct LogRecord {
+  QtMsgType type = QtDebugMsg;
+  QString message;
+  qint64 time = 0;
+};
+
+/**
+ * @brief      Lock-free queue of log records with many producers and a
+ *             single consumer.
+ *
+ *             Producers never block, a push is one atomic exchange on the
+ *             head of an intrusive list. Once capacity records are waiting,
+ *             further records are counted and dropped, so that a flood of
+ *             messages from background threads can not exhaust the memory
+ *             while the consumer is busy.
+ * @ingroup    logger
+ */
+class LogQueue {
+
+  public:
+    explicit LogQueue(std::size_t capacity);
+    ~LogQueue();
+
+    LogQueue(const LogQueue&) = delete;
+    LogQueue& operator=(const LogQueue&) = delete;
+
+    /**
+     * @brief      Appends a record. Thread safe.
+     * @return     False if the queue was full and the record was dropped.
+     */
+    bool push(LogRecord record);
+
+    /**
+     * @brief      Takes the oldest record. Must only be called from one
+     *             thread at a time.
+     * @return     False if no record is available.
+     */
+    bool pop(LogRecord& record);
+
+    /**
+     * @return     The number of records dropped since the last call.
+     */
+    std::size_t takeDropped();
+
+    std::size_t size() const;
+    std::size_t capacity() const;
+
+  private:
+    struct Node {
+      std::atomic<Node*> next {nullptr};
+      LogRecord record;
+    };
+
+    const std::size_t max_size;
+    std::atomic<std::size_t> current_size;
+    std::atomic<std::size_t> dropped;
+
+    // producers swap themselves in at the head, the consumer follows the tail
+    alignas(64) std::atomic<Node*> head;
+    alignas(64) Node *tail;
+};
@@ -0,0 +1,51 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <algorithm>
+
+#include "logring.h"
+
+LogRing::LogRing(std::size_t capacity)
+    : lines(std::max<std::size_t>(capacity, 1)), first(0), count(0) {
+}
+
+bool LogRing::append(QString line) {
+  if (count < lines.size()) {
+    lines[(first + count++) % lines.size()] = std::move(line);
+    return false;
+  }
+  lines[first] = std::move(line);
+  first = (first + 1) % lines.size();
+  return true;
+}
+
+void LogRing::clear() {
+  for (QString& line : lines) {
+    line.clear();
+  }
+  first = 0;
+  count = 0;
+}
+
+int LogRing::lineCount() const {
+  return static_cast<int>(count);
+}
+
+QString LogRing::lineText(int line_number) const {
+  return lines[(first + line_number) % lines.size()];
+}
+
+std::size_t LogRing::capacity() const {
+  return lines.size();
+}
@@ -0,0 +1,49 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <framework/enhanced/terminalview.h>
+
+/**
+ * @brief      Keeps the newest lines of the log in a buffer of fixed size.
+ *
+ *             Once the buffer is full, every new line replaces the oldest
+ *             one, so the retained output never grows beyond capacity lines.
+ * @ingroup    logger
+ */
+class LogRing : public TerminalLineSource {
+
+  public:
+    explicit LogRing(std::size_t capacity);
+
+    /**
+     * @return     True if the oldest line was dropped to make room.
+     */
+    bool append(QString line);
+    void clear();
+
+    int lineCount() const override;
+    QString lineText(int line_number) const override;
+
+    std::size_t capacity() const;
+
+  private:
+    std::vector<QString> lines;
+    std::size_t first;
+    std::size_t count;
+};
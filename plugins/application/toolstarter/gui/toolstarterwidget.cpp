@@ -24,6 +24,7 @@
 #include <properties/data/properties.h>
 #include <properties/data/ambassador.h>
 #include <properties/data/propertyfactory.h>
+#include <properties/data/valuetypeinterface/numerictext.h>
 
 #include <plugins/infrastructure/toolchooser/toolchooserinterface.h>
 #include <plugins/infrastructure/propertyformwidget/propertyformwidgetinterface.h>
@@ -146,7 +147,11 @@ std::unique_ptr<Ambassador> ToolStarterWidget::buildToolArgumentsAmbassador(cons
     Property *property = PropertyFactory::createProperty(property_name, toolparameter.getType().toStdString(), isoptional, default_value);
 
     if (not value.empty()) {
-      property->fromString(value);
+      try {
+        property->fromString(value);
+      } catch (const NumericTextError& error) {
+        qWarning() << "Ignoring the value" << QString::fromStdString(value) << "of" << QString::fromStdString(property_name) << ":" << error.what();
+      }
     }
 
     ValueTypeInterfaceHint *hint = property->updateHint();
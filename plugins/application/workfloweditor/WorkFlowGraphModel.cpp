@@ -43,58 +43,30 @@ std::unordered_set<NodeId> WorkFlowGraphModel::allNodeIds() const
 
 std::unordered_set<ConnectionId> WorkFlowGraphModel::allConnectionIds(NodeId const nodeId) const
 {
-    std::unordered_set<ConnectionId> result;
-
-    std::copy_if(_connectivity.begin(),
-                 _connectivity.end(),
-                 std::inserter(result, std::end(result)),
-                 [&nodeId](ConnectionId const &cid) {
-                     return cid.inNodeId == nodeId || cid.outNodeId == nodeId;
-                 });
-
-    return result;
+    return _connectivity.all(nodeId);
 }
 
 std::unordered_set<ConnectionId> WorkFlowGraphModel::allConnectionIds() const
 {
-    return _connectivity;
+    return _connectivity.all();
 }
 
 std::unordered_set<ConnectionId> WorkFlowGraphModel::connections(NodeId nodeId,
                                                                  PortType portType) const
 {
-    std::unordered_set<ConnectionId> result;
-
-    std::copy_if(_connectivity.begin(),
-                 _connectivity.end(),
-                 std::inserter(result, std::end(result)),
-                 [&portType, &nodeId](ConnectionId const &cid) {
-                     return (getNodeId(portType, cid) == nodeId);
-                 });
-
-    return result;
+    return _connectivity.connections(nodeId, portType);
 }
 
 std::unordered_set<ConnectionId> WorkFlowGraphModel::connections(NodeId nodeId,
                                                                  PortType portType,
                                                                  PortIndex portIndex) const
 {
-    std::unordered_set<ConnectionId> result;
-
-    std::copy_if(_connectivity.begin(),
-                 _connectivity.end(),
-                 std::inserter(result, std::end(result)),
-                 [&portType, &portIndex, &nodeId](ConnectionId const &cid) {
-                     return (getNodeId(portType, cid) == nodeId
-                             && getPortIndex(portType, cid) == portIndex);
-                 });
-
-    return result;
+    return _connectivity.connections(nodeId, portType, portIndex);
 }
 
 bool WorkFlowGraphModel::connectionExists(ConnectionId const connectionId) const
 {
-    return (_connectivity.find(connectionId) != _connectivity.end());
+    return _connectivity.contains(connectionId);
 }
 
 void WorkFlowGraphModel::connectNode(std::unique_ptr<NodeDelegateModel>& model, NodeId newId) {
@@ -438,15 +410,7 @@ bool WorkFlowGraphModel::setPortData(
 
 bool WorkFlowGraphModel::deleteConnection(ConnectionId const connectionId)
 {
-    bool disconnected = false;
-
-    auto it = _connectivity.find(connectionId);
-
-    if (it != _connectivity.end()) {
-        disconnected = true;
-
-        _connectivity.erase(it);
-    }
+    bool disconnected = _connectivity.erase(connectionId);
 
     if (disconnected) {
         sendConnectionDeletion(connectionId);
@@ -525,7 +489,7 @@ QJsonObject WorkFlowGraphModel::save() const
     sceneJson["nodes"] = nodesJsonArray;
 
     QJsonArray connJsonArray;
-    for (auto const &cid : _connectivity) {
+    for (auto const &cid : _connectivity.all()) {
         QJsonObject connJson;
 
         connJson["out_id"]    = QString::number(static_cast<qint64>(cid.outNodeId));
@@ -24,6 +24,8 @@
 
 #include "QtNodes/internal/Export.hpp"
 
+#include "connectionindex.h"
+
 #include <QJsonObject>
 #include <QJsonArray>
 
@@ -423,7 +425,7 @@ private:
 
     std::unordered_map<NodeId, std::unique_ptr<NodeDelegateModel>> _models;
 
-    std::unordered_set<ConnectionId> _connectivity;
+    ConnectionIndex _connectivity;
 
     mutable std::unordered_map<NodeId, NodeGeometryData> _nodeGeometryData;
 
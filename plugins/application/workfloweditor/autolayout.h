@@ -15,22 +15,12 @@
 #pragma once
 
 #include <QPointF>
-#include <unordered_map>
-
-#include <QtNodes/Definitions>
 
 #include "workflowscene.h"
 
-using QtNodes::NodeId;
-
-struct ColumnInfo {
-  qreal x = 0;
-  qreal width = 0;
-  qreal next_y = 0;
-};
-
 /**
  * @brief      A helper class which can apply automatic layout to nodes in a FlowScene.
+ *             The placement itself is done by LayeredLayout.
  * @ingroup    workfloweditor
  */
 class AutoLayout {
@@ -40,15 +30,8 @@ public:
   void apply();
 
 private:
-  void assignNodesToColumns();
-  void calculateColumnInfos();
-  void processNode(NodeId nodeId, int depth = 0);
-  bool isStartNode(NodeId nodeId);
-
   // setting for the vertical and horizontal distance between nodes in the autolayout
   const QPointF node_distance = {50., 5.};
 
   WorkflowScene &scene;
-  std::unordered_map<NodeId, int> node_columns;
-  std::unordered_map<int, ColumnInfo> column_infos;
 };
@@ -0,0 +1,94 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "connectionindex.h"
+
+bool ConnectionIndex::insert(ConnectionId const connectionId) {
+  if (!connectivity.insert(connectionId).second) {
+    return false;
+  }
+  adjacency[connectionId.outNodeId].out[connectionId.outPortIndex].insert(connectionId);
+  adjacency[connectionId.inNodeId].in[connectionId.inPortIndex].insert(connectionId);
+  return true;
+}
+
+bool ConnectionIndex::erase(ConnectionId const connectionId) {
+  if (connectivity.erase(connectionId) == 0) {
+    return false;
+  }
+  unlink(connectionId.outNodeId, PortType::Out, connectionId.outPortIndex, connectionId);
+  unlink(connectionId.inNodeId, PortType::In, connectionId.inPortIndex, connectionId);
+  return true;
+}
+
+void ConnectionIndex::unlink(NodeId const nodeId, PortType const portType, PortIndex const portIndex,
+                             ConnectionId const connectionId) {
+  auto node = adjacency.find(nodeId);
+  if (node == adjacency.end()) return;
+
+  // drop empty buckets, so that deleted nodes and ports leave nothing behind
+  PortConnections& ports = node->second.ports(portType);
+  auto port = ports.find(portIndex);
+  if (port != ports.end()) {
+    port->second.erase(connectionId);
+    if (port->second.empty()) {
+      ports.erase(port);
+    }
+  }
+  if (node->second.empty()) {
+    adjacency.erase(node);
+  }
+}
+
+bool ConnectionIndex::contains(ConnectionId const connectionId) const {
+  return connectivity.find(connectionId) != connectivity.end();
+}
+
+const std::unordered_set<ConnectionId>& ConnectionIndex::all() const {
+  return connectivity;
+}
+
+std::unordered_set<ConnectionId> ConnectionIndex::all(NodeId const nodeId) const {
+  std::unordered_set<ConnectionId> result = connections(nodeId, PortType::In);
+  std::unordered_set<ConnectionId> outgoing = connections(nodeId, PortType::Out);
+  result.insert(outgoing.begin(), outgoing.end());
+  return result;
+}
+
+std::unordered_set<ConnectionId> ConnectionIndex::connections(NodeId const nodeId, PortType const portType) const {
+  std::unordered_set<ConnectionId> result;
+
+  auto node = adjacency.find(nodeId);
+  if (node != adjacency.end()) {
+    for (const auto& [portIndex, port_connections] : node->second.ports(portType)) {
+      result.insert(port_connections.begin(), port_connections.end());
+    }
+  }
+  return result;
+}
+
+std::unordered_set<ConnectionId> ConnectionIndex::connections(NodeId const nodeId, PortType const portType,
+                                                              PortIndex const portIndex) const {
+  auto node = adjacency.find(nodeId);
+  if (node == adjacency.end()) return {};
+
+  const PortConnections& ports = node->second.ports(portType);
+  auto port = ports.find(portIndex);
+  if (port == ports.end()) return {};
+  return port->second;
+}
+
+std::size_t ConnectionIndex::size() const {
+  return connectivity.size();
+}
@@ -0,0 +1,75 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <unordered_map>
+#include <unordered_set>
+
+#include <QtNodes/Definitions>
+#include <QtNodes/internal/ConnectionIdHash.hpp>
+
+using QtNodes::ConnectionId;
+using QtNodes::NodeId;
+using QtNodes::PortIndex;
+using QtNodes::PortType;
+
+/**
+ * @brief      Stores the connections of a graph together with an adjacency
+ *             index per node and port, so that the connections of a node or
+ *             port can be looked up in time proportional to the result
+ *             instead of scanning all connections of the graph.
+ * @ingroup    workfloweditor
+ */
+class ConnectionIndex {
+
+public:
+  /**
+   * @return     false if the connection was already present
+   */
+  bool insert(ConnectionId const connectionId);
+
+  /**
+   * @return     false if the connection was not present
+   */
+  bool erase(ConnectionId const connectionId);
+
+  bool contains(ConnectionId const connectionId) const;
+
+  const std::unordered_set<ConnectionId>& all() const;
+  std::unordered_set<ConnectionId> all(NodeId const nodeId) const;
+  std::unordered_set<ConnectionId> connections(NodeId const nodeId, PortType const portType) const;
+  std::unordered_set<ConnectionId> connections(NodeId const nodeId, PortType const portType,
+                                               PortIndex const portIndex) const;
+
+  std::size_t size() const;
+
+private:
+  using PortConnections = std::unordered_map<PortIndex, std::unordered_set<ConnectionId>>;
+
+  struct NodeConnections {
+    PortConnections in;
+    PortConnections out;
+
+    PortConnections& ports(PortType const portType) { return portType == PortType::In ? in : out; }
+    const PortConnections& ports(PortType const portType) const { return portType == PortType::In ? in : out; }
+    bool empty() const { return in.empty() && out.empty(); }
+  };
+
+  void unlink(NodeId const nodeId, PortType const portType, PortIndex const portIndex,
+              ConnectionId const connectionId);
+
+  std::unordered_set<ConnectionId> connectivity;
+  std::unordered_map<NodeId, NodeConnections> adjacency;
+};
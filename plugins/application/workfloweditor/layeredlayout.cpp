@@ -0,0 +1,289 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <algorithm>
+#include <limits>
+
+#include "layeredlayout.h"
+
+void LayeredLayout::addNode(NodeId nodeId, const QSizeF& size, bool is_source) {
+  auto [it, inserted] = indices.emplace(nodeId, static_cast<int>(ids.size()));
+  if (!inserted) {
+    sizes[it->second] = size;
+    sources[it->second] = is_source;
+    return;
+  }
+  ids.push_back(nodeId);
+  sizes.push_back(size);
+  sources.push_back(is_source);
+  successors.emplace_back();
+  predecessors.emplace_back();
+}
+
+void LayeredLayout::addEdge(NodeId from, NodeId to) {
+  auto from_it = indices.find(from);
+  auto to_it = indices.find(to);
+  if (from_it == indices.end() || to_it == indices.end() || from == to) return;
+
+  successors[from_it->second].push_back(to_it->second);
+  predecessors[to_it->second].push_back(from_it->second);
+}
+
+std::unordered_map<NodeId, QPointF> LayeredLayout::compute(const QPointF& spacing) {
+  assignRanks();
+  buildLayers();
+  reduceCrossings();
+  return assignCoordinates(spacing);
+}
+
+void LayeredLayout::assignRanks() {
+  const int node_count = static_cast<int>(ids.size());
+
+  // iterative depth-first search, edges leading back onto the stack close a cycle and are dropped
+  enum { UNVISITED, ACTIVE, DONE };
+  std::vector<char> state(node_count, UNVISITED);
+  std::vector<std::vector<int>> acyclic_successors(node_count);
+  std::vector<std::pair<int, std::size_t>> stack;
+  discovery_order.clear();
+  discovery_order.reserve(node_count);
+
+  for (int root = 0; root < node_count; ++root) {
+    if (state[root] != UNVISITED) continue;
+    state[root] = ACTIVE;
+    discovery_order.push_back(root);
+    stack.emplace_back(root, 0);
+
+    while (!stack.empty()) {
+      auto& [node, next] = stack.back();
+      if (next == successors[node].size()) {
+        state[node] = DONE;
+        stack.pop_back();
+        continue;
+      }
+      int successor = successors[node][next++];
+      if (state[successor] == ACTIVE) continue;
+
+      acyclic_successors[node].push_back(successor);
+      if (state[successor] == UNVISITED) {
+        state[successor] = ACTIVE;
+        discovery_order.push_back(successor);
+        stack.emplace_back(successor, 0);
+      }
+    }
+  }
+
+  successors = std::move(acyclic_successors);
+  for (auto& node_predecessors : predecessors) {
+    node_predecessors.clear();
+  }
+  for (int node = 0; node < node_count; ++node) {
+    for (int successor : successors[node]) {
+      predecessors[successor].push_back(node);
+    }
+  }
+
+  // longest path ranking of all nodes except sources, in topological order
+  node_ranks.assign(node_count, 0);
+  std::vector<int> pending(node_count, 0);
+  std::vector<int> ready;
+  for (int node = 0; node < node_count; ++node) {
+    if (sources[node]) continue;
+    for (int predecessor : predecessors[node]) {
+      if (!sources[predecessor]) pending[node]++;
+    }
+    if (pending[node] == 0) ready.push_back(node);
+  }
+  while (!ready.empty()) {
+    int node = ready.back();
+    ready.pop_back();
+    for (int successor : successors[node]) {
+      if (sources[successor]) continue;
+      node_ranks[successor] = std::max(node_ranks[successor], node_ranks[node] + 1);
+      if (--pending[successor] == 0) ready.push_back(successor);
+    }
+  }
+
+  // source nodes go into the layer before the first node that uses their value
+  int minimum_rank = 0;
+  for (int node = 0; node < node_count; ++node) {
+    if (!sources[node]) continue;
+    int rank = std::numeric_limits<int>::max();
+    for (int successor : successors[node]) {
+      if (!sources[successor]) rank = std::min(rank, node_ranks[successor]);
+    }
+    node_ranks[node] = (rank == std::numeric_limits<int>::max() ? 0 : rank) - 1;
+    minimum_rank = std::min(minimum_rank, node_ranks[node]);
+  }
+  for (int& rank : node_ranks) {
+    rank -= minimum_rank;
+  }
+}
+
+void LayeredLayout::buildLayers() {
+  int layer_count = 0;
+  for (int rank : node_ranks) {
+    layer_count = std::max(layer_count, rank + 1);
+  }
+
+  // the discovery order keeps nodes of one branch close together, a good start for the sweeps
+  layers.assign(layer_count, {});
+  positions.assign(ids.size(), 0);
+  for (int node : discovery_order) {
+    std::vector<int>& layer = layers[node_ranks[node]];
+    positions[node] = static_cast<int>(layer.size());
+    layer.push_back(node);
+  }
+
+  // only edges pointing to a later layer take part in ordering and placement
+  for (std::size_t node = 0; node < ids.size(); ++node) {
+    std::erase_if(successors[node], [this, node](int successor) {
+      return node_ranks[successor] <= node_ranks[node];
+    });
+    std::erase_if(predecessors[node], [this, node](int predecessor) {
+      return node_ranks[predecessor] >= node_ranks[node];
+    });
+  }
+}
+
+void LayeredLayout::reduceCrossings() {
+  final_crossings = countCrossings();
+  const int layer_count = static_cast<int>(layers.size());
+  if (final_crossings == 0 || layer_count < 2) return;
+
+  std::vector<std::vector<int>> best_layers = layers;
+  for (int sweep = 0; sweep < SWEEPS; ++sweep) {
+    const bool downwards = sweep % 2 == 0;
+    if (downwards) {
+      for (int rank = 1; rank < layer_count; ++rank) orderByBarycenter(rank, true);
+    } else {
+      for (int rank = layer_count - 2; rank >= 0; --rank) orderByBarycenter(rank, false);
+    }
+
+    long long crossings = countCrossings();
+    if (crossings < final_crossings) {
+      final_crossings = crossings;
+      best_layers = layers;
+      if (crossings == 0) break;
+    }
+  }
+
+  layers = std::move(best_layers);
+  for (const auto& layer : layers) {
+    for (int position = 0; position < static_cast<int>(layer.size()); ++position) {
+      positions[layer[position]] = position;
+    }
+  }
+}
+
+void LayeredLayout::orderByBarycenter(int rank, bool downwards) {
+  std::vector<int>& layer = layers[rank];
+  std::vector<std::pair<double, int>> keyed;
+  keyed.reserve(layer.size());
+
+  // relative positions make neighbours in layers of different sizes comparable
+  auto relative_position = [this](int node) {
+    return (positions[node] + 0.5) / layers[node_ranks[node]].size();
+  };
+
+  for (int node : layer) {
+    const std::vector<int>& neighbours = downwards ? predecessors[node] : successors[node];
+    double key = relative_position(node);
+    if (!neighbours.empty()) {
+      double sum = 0;
+      for (int neighbour : neighbours) sum += relative_position(neighbour);
+      key = sum / neighbours.size();
+    }
+    keyed.emplace_back(key, node);
+  }
+
+  std::stable_sort(keyed.begin(), keyed.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+  for (int position = 0; position < static_cast<int>(keyed.size()); ++position) {
+    layer[position] = keyed[position].second;
+    positions[keyed[position].second] = position;
+  }
+}
+
+long long LayeredLayout::countCrossings() const {
+  long long crossings = 0;
+  std::vector<int> targets;
+  std::vector<int> tree;
+
+  for (std::size_t rank = 0; rank + 1 < layers.size(); ++rank) {
+    // edges sorted by source position and then target position, every inversion in the
+    // target positions is a crossing, counted with a Fenwick tree
+    const int next_rank = static_cast<int>(rank) + 1;
+    tree.assign(layers[next_rank].size() + 1, 0);
+    long long inserted = 0;
+
+    for (int node : layers[rank]) {
+      targets.clear();
+      for (int successor : successors[node]) {
+        if (node_ranks[successor] == next_rank) targets.push_back(positions[successor]);
+      }
+      std::sort(targets.begin(), targets.end());
+
+      for (int target : targets) {
+        long long not_greater = 0;
+        for (int i = target + 1; i > 0; i -= i & -i) not_greater += tree[i];
+        crossings += inserted - not_greater;
+      }
+      for (int target : targets) {
+        for (int i = target + 1; i < static_cast<int>(tree.size()); i += i & -i) tree[i]++;
+        inserted++;
+      }
+    }
+  }
+  return crossings;
+}
+
+std::unordered_map<NodeId, QPointF> LayeredLayout::assignCoordinates(const QPointF& spacing) const {
+  std::vector<qreal> tops(ids.size(), 0);
+  std::vector<qreal> lefts(ids.size(), 0);
+  qreal layer_x = 0;
+  qreal minimum_top = 0;
+
+  for (const auto& layer : layers) {
+    qreal layer_width = 0;
+    qreal lowest_top = std::numeric_limits<qreal>::lowest();
+
+    for (int node : layer) {
+      const qreal height = sizes[node].height();
+      qreal top = lowest_top;
+      if (!predecessors[node].empty()) {
+        qreal center = 0;
+        for (int predecessor : predecessors[node]) {
+          center += tops[predecessor] + sizes[predecessor].height() / 2;
+        }
+        top = center / predecessors[node].size() - height / 2;
+      } else if (lowest_top == std::numeric_limits<qreal>::lowest()) {
+        top = 0;
+      }
+
+      // keep the order of the layer and never overlap the node above
+      tops[node] = std::max(top, lowest_top);
+      lefts[node] = layer_x;
+      lowest_top = tops[node] + height + spacing.y();
+      minimum_top = std::min(minimum_top, tops[node]);
+      layer_width = std::max(layer_width, sizes[node].width());
+    }
+    layer_x += layer_width + spacing.x();
+  }
+
+  std::unordered_map<NodeId, QPointF> result;
+  result.reserve(ids.size());
+  for (std::size_t node = 0; node < ids.size(); ++node) {
+    result[ids[node]] = {lefts[node], tops[node] - minimum_top};
+  }
+  return result;
+}
@@ -16,7 +16,6 @@
 
 #include <QJsonDocument>
 #include <QtCore/QJsonArray>
-#include <QTimer>
 #include <QUrl>
 #include <QtWidgets/QMessageBox>
 #include <QtWidgets/QFileDialog>
@@ -82,11 +81,6 @@ WorkflowExecution::WorkflowExecution(StatusBarInterface *statusBarInterface,
   layout->addWidget(workflowTable);
   QWidget::setLayout(layout);
 
-  workflowRefreshTimer = new QTimer(this);
-  workflowRefreshTimer->setInterval(REFRESH_INTERVAL_ACTIVE);
-  connect(workflowRefreshTimer, &QTimer::timeout, this, &WorkflowExecution::refreshWorkflows);
-  workflowRefreshTimer->start();
-
   qRegisterMetaType<QVector<int> >("QVector<int>");
   connect(tableModel, &WorkflowTableModel::dataChanged, this,
           [&](const QModelIndex &topLeft, const QModelIndex &bottomRight, const QVector<int> &) {
@@ -106,6 +100,12 @@ WorkflowExecution::WorkflowExecution(StatusBarInterface *statusBarInterface,
   assert(logdialog_interface);
   processmanager_interface = pluginmanager->getInterface<ProcessManagerInterface*>("/plugins/infrastructure/workflows/processmanager");
   assert(processmanager_interface);
+  workflow_interface = pluginmanager->getInterface<WorkflowInterface*>("/plugins/infrastructure/workflows/processmanager/workflow");
+  assert(workflow_interface);
+
+  // the table is filled once and afterwards only updated by the changes the process manager reports
+  processmanager_interface->subscribe(this, [this](const WorkflowEvent& event) { onWorkflowEvent(event); });
+  refreshWorkflows();
 }
 
 void WorkflowExecution::retrieveWorkflows() {
@@ -140,17 +140,20 @@ QMenu *WorkflowExecution::createMenu() {
 
 void WorkflowExecution::refreshWorkflows()
 {
-  TabInterface *tab = TabDelegate::getInstance();
-  if (tab->isTabActive(QStringLiteral("/plugins/application/workflowexecution"))) {
-    QFuture<void> fut = QtConcurrent::run(&WorkflowExecution::retrieveWorkflows, this);
+  QFuture<void> fut = QtConcurrent::run(&WorkflowExecution::retrieveWorkflows, this);
+}
 
-    workflowRefreshTimer->setInterval(REFRESH_INTERVAL_ACTIVE);
-  } else {
-    workflowRefreshTimer->setInterval(REFRESH_INTERVAL_INACTIVE);
-  }
+void WorkflowExecution::onWorkflowEvent(const WorkflowEvent& event) {
+  if (event.type != WorkflowEvent::STATE_CHANGED) return;
 
-  // restart the timer
-  workflowRefreshTimer->start();
+  try {
+    auto workflow = workflow_interface->create();
+    workflow->fromJson(event.workflow);
+    tableModel->addWorkflow(std::move(workflow));
+  } catch (std::logic_error& logic_error) {
+    statusBarInterface->showMessage("workflowExecution", "Parsing the workflows failed");
+    qDebug() << logic_error.what();
+  }
 }
 
 void WorkflowExecution::openContextMenu(QPoint position) {
@@ -24,6 +24,7 @@
 #include <framework/statusbar/statusbardelegate.h>
 #include <plugins/infrastructure/workflows/processmanager/workflow/workflowshortcut.h>
 #include <plugins/infrastructure/workflows/processmanager/interaction/interactioninterface.h>
+#include <plugins/infrastructure/workflows/processmanager/workflowevent.h>
 
 #include "workflowtable/WorkflowTableModel.h"
 #include "workflowtable/WorkflowTableSortFilter.h"
@@ -65,10 +66,10 @@ private:
   LibFramework::PluginManagerInterface *pluginmanager;
   LogDialogInterface *logdialog_interface;
   ProcessManagerInterface *processmanager_interface;
+  WorkflowInterface *workflow_interface;
   StatusBarInterface *statusBarInterface;
   WorkflowTableModel *tableModel;
   WorkflowTableSortFilter *tableModelProxy;
-  QTimer *workflowRefreshTimer;
   QMenu *menu;
   QMenu *createMenu();
   const WorkflowInterface *selectedWorkflow;
@@ -78,8 +79,6 @@ private:
 
   void switchToInteractionPlugin(const WorkflowInterface* workflow);
   void retrieveWorkflows();
+  void onWorkflowEvent(const WorkflowEvent& event);
   const WorkflowInterface* getWorkflowAtPosition(const QPoint& position) const;
-
-  const static int REFRESH_INTERVAL_ACTIVE = 500;
-  const static int REFRESH_INTERVAL_INACTIVE = 2000;
 };
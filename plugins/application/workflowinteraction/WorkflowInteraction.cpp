@@ -21,7 +21,6 @@
 #include <QGroupBox>
 #include <QMessageBox>
 #include <QDesktopServices>
-#include <QTimer>
 #include <QDir>
 #include <QDrag>
 #include <QDragEnterEvent>
@@ -45,7 +44,7 @@
 
 WorkflowInteraction::WorkflowInteraction(LibFramework::PluginManagerInterface* pluginmanager, StatusBarInterface* statusBarInterface, QWidget* parent)
     : QWidget(parent), pluginmanager(pluginmanager), statusBarInterface(statusBarInterface),
-      workflowInitialized(false), forceWidgetRefresh(false),
+      workflowInitialized(false), followWorkflow(false), forceWidgetRefresh(false),
       interactionWidget(new InteractionWidget(pluginmanager, this)) {
   auto layout = new QHBoxLayout(this);
   setLayout(layout);
@@ -55,6 +54,7 @@ WorkflowInteraction::WorkflowInteraction(LibFramework::PluginManagerInterface* p
 
   processmanager_interface = pluginmanager->getInterface<ProcessManagerInterface*>("/plugins/infrastructure/workflows/processmanager");
   assert(processmanager_interface);
+  processmanager_interface->subscribe(this, [this](const WorkflowEvent& event) { onWorkflowEvent(event); });
 
   connect(this, &WorkflowInteraction::disableWidgets, interactionWidget, &InteractionWidget::setWidgetsDisabled);
 
@@ -140,10 +140,6 @@ WorkflowInteraction::WorkflowInteraction(LibFramework::PluginManagerInterface* p
   auto infoGroup = new QGroupBox();
   auto infoGroupLayout = new QHBoxLayout();
   infoGroup->setLayout(infoGroupLayout);
-  workflowRefreshTimer = new QTimer(this);
-  workflowRefreshTimer->setInterval(500);
-  connect(workflowRefreshTimer, &QTimer::timeout, this, &WorkflowInteraction::refreshWorkflow,
-          Qt::ConnectionType::QueuedConnection);
   workflowInfoWidget = new WorkflowInfoWidget(pluginmanager);
   infoGroupLayout->addWidget(workflowInfoWidget);
 
@@ -227,14 +223,14 @@ void WorkflowInteraction::initializeWorkflow(unsigned int id) {
   }
 
   updateButtonsForCurrentState();
-  workflowRefreshTimer->start();
+  followWorkflow = true;
 }
 
 void WorkflowInteraction::initializeWorkflow(const QString& filePath) {
   TabInterface *tab = TabDelegate::getInstance();
 
-  // no periodic refreshing necessary until the workflow is started
-  workflowRefreshTimer->stop();
+  // there are no events for this workflow until it is started
+  followWorkflow = false;
 
   interactionWidget->updateView();
 
@@ -292,9 +288,9 @@ void WorkflowInteraction::onStartContinueButtonPressed() {
   }
   if (assumeRunning) {
     startContinueButton->setDisabled(true); // to avoid spamming of the button
-    // the button will be enabled again if necessary in refreshWorkflow()
+    // the button will be enabled again if necessary in refreshInteractions()
 
-    workflowRefreshTimer->start(); // start to periodically refresh since execution is in progress
+    followWorkflow = true; // apply the workflow events since execution is in progress
   }
 }
 
@@ -315,55 +311,73 @@ std::unique_ptr<WorkflowInterface> WorkflowInteraction::retrieveWorkflow(unsigne
   return {};
 }
 
-void WorkflowInteraction::refreshWorkflow() {
-  auto *tab = TabDelegate::getInstance();
-  if (tab->isTabActive("/plugins/application/workflowinteraction") && workflow) {
-    auto updatedWorkflow = retrieveWorkflow(workflow->getId());
+void WorkflowInteraction::onWorkflowEvent(const WorkflowEvent& event) {
+  if (!followWorkflow || !workflow || event.workflow_id != workflow->getId()) return;
 
-    if (!updatedWorkflow) {
-      // refreshing failed -> do nothing, keep old workflow info
-      return;
-    }
+  switch (event.type) {
+    case WorkflowEvent::STATE_CHANGED: {
+      auto updatedWorkflow = workflow->create();
+      try {
+        updatedWorkflow->fromJson(event.workflow);
+      } catch (const std::exception& exception) {
+        // keep the old workflow info
+        qDebug() << exception.what();
+        return;
+      }
 
-    if (*updatedWorkflow != *workflow) {
+      WorkflowState previousState = workflow->getState();
       workflow = std::move(updatedWorkflow);
       workflowInfoWidget->setWorkflow(workflow.get());
       workflowInfoWidget->updateInfo();
-    }
 
-    if (workflow->getState() == NEEDS_INTERACTION) {
-      auto updated_interactions = loadInteractions();
-      if (forceWidgetRefresh || updated_interactions.size() > interactions.size()) {
-        interactions = std::move(loadInteractions());
-        updateInteractionWidgets();
-        forceWidgetRefresh = false;
-        startContinueButton->setEnabled(true);
+      if (workflow->getState() == NEEDS_INTERACTION && forceWidgetRefresh) {
+        refreshInteractions();
       }
-    }
-
-    if (workflow->getState() != RUNNING) {
-      try {
-        auto shortcutsActual = processmanager_interface->retrieveShortcuts(workflow->getId());
-        bool shortcutsUpdated = !std::equal(shortcuts.begin(), shortcuts.end(), shortcutsActual.begin(),
-                                            shortcutsActual.end(),
-                                            [](const auto &lhs, const auto &rhs) {
-                                              return *lhs == *rhs;
-                                            });
-        if (shortcutsUpdated) {
-          shortcuts = std::move(shortcutsActual);
-          emit shortcutsAvailable(!shortcuts.empty());
-          clearShortcutsMenu();
-          generateShortcutsMenu();
-        }
-      } catch (const std::exception& exception) {
-        statusBarInterface->showMessage("workflow interactions",
-                                        tr("Unable to receive shortcuts info from process manager"));
+      if (workflow->getState() != RUNNING && workflow->getState() != previousState) {
+        refreshShortcuts();
       }
+
+      updateButtonsForCurrentState();
+
+      if (workflow->getState() > CANCELLING) followWorkflow = false;
+      break;
     }
+    case WorkflowEvent::INTERACTIONS_CHANGED:
+      refreshInteractions();
+      break;
+    default:
+      // the log dialog follows the log file itself
+      break;
+  }
+}
 
-    updateButtonsForCurrentState();
+void WorkflowInteraction::refreshInteractions() {
+  auto updated_interactions = loadInteractions();
+  if (forceWidgetRefresh || updated_interactions.size() > interactions.size()) {
+    interactions = std::move(updated_interactions);
+    updateInteractionWidgets();
+    forceWidgetRefresh = false;
+    startContinueButton->setEnabled(true);
+  }
+}
 
-    if (workflow->getState() > CANCELLING) workflowRefreshTimer->stop();
+void WorkflowInteraction::refreshShortcuts() {
+  try {
+    auto shortcutsActual = processmanager_interface->retrieveShortcuts(workflow->getId());
+    bool shortcutsUpdated = !std::equal(shortcuts.begin(), shortcuts.end(), shortcutsActual.begin(),
+                                        shortcutsActual.end(),
+                                        [](const auto &lhs, const auto &rhs) {
+                                          return *lhs == *rhs;
+                                        });
+    if (shortcutsUpdated) {
+      shortcuts = std::move(shortcutsActual);
+      emit shortcutsAvailable(!shortcuts.empty());
+      clearShortcutsMenu();
+      generateShortcutsMenu();
+    }
+  } catch (const std::exception& exception) {
+    statusBarInterface->showMessage("workflow interactions",
+                                    tr("Unable to receive shortcuts info from process manager"));
   }
 }
 
@@ -384,7 +398,7 @@ void WorkflowInteraction::updateButtonsForCurrentState() {
         startContinueButton->setText(tr("Continue"));
         cancel_button->setEnabled(true);
         // not enabling the button here, to avoid that it will be spammed
-        // it will be enabled as soon as new interactions are available in refreshWorkflow()
+        // it will be enabled as soon as new interactions are available in refreshInteractions()
         break;
       case CANCELLED:
       case FINISHED:
@@ -17,7 +17,6 @@
 #include <QWidget>
 #include <QString>
 
-class QTimer;
 class QMenu;
 class QPushButton;
 class StatusBarInterface;
@@ -26,6 +25,7 @@ class StatusBarInterface;
 #include <plugins/infrastructure/workflows/processmanager/workflow/workflowinterface.h>
 #include <plugins/infrastructure/workflows/processmanager/workflow/workflowshortcut.h>
 #include <plugins/infrastructure/workflows/processmanager/interaction/interactioninterface.h>
+#include <plugins/infrastructure/workflows/processmanager/workflowevent.h>
 
 #include "widgets/WorkflowInfoWidget.h"
 
@@ -58,7 +58,7 @@ public:
    * This means the workflow has not been pushed to the process manager for execution and is in the state READY.
    * Instead of retrieving the workflow info from the process manager API, create a new Workflow instance.
    *
-   * Also the periodic refreshing of workflow information is stopped when this method is called.
+   * Also following the workflow events is stopped when this method is called.
    *
    * @param fileName File name of the workflow definition file
    */
@@ -72,7 +72,7 @@ Q_SIGNALS:
 private Q_SLOTS:
   void onStartContinueButtonPressed();
   void onCancelButtonPressed();
-  void refreshWorkflow();
+  void onWorkflowEvent(const WorkflowEvent& event);
   void switchToExecutionTab();
   void openLoadDialog(const QString& dialog_namespace);
 
@@ -80,6 +80,8 @@ private:
   void createMenu();
   std::vector<std::unique_ptr<InteractionInterface>> loadInteractions();
   void updateInteractionWidgets();
+  void refreshInteractions();
+  void refreshShortcuts();
   bool performContinueWorkflow();
   bool performStartWorkflow();
   bool performCancelWorkflow();
@@ -101,7 +103,7 @@ private:
   std::unique_ptr<WorkflowInterface> workflow;
   std::vector<std::unique_ptr<WorkflowShortcut>> shortcuts;
   std::vector<std::unique_ptr<InteractionInterface>> interactions;
-  QTimer *workflowRefreshTimer;
+  bool followWorkflow;
   bool forceWidgetRefresh;
 
   // user interface
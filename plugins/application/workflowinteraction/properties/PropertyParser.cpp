@@ -25,6 +25,7 @@
 #include <properties/data/properties/derivative/openfileproperty.h>
 #include <properties/data/validator.h>
 #include <properties/data/propertyfactory.h>
+#include <properties/data/valuetypeinterface/numerictext.h>
 
 #ifdef WEBVIEW_SUPPORT_ENABLED
 #include <properties/data/properties/controls/webviewproperty.h>
@@ -124,11 +125,16 @@ Property* PropertyParser::buildProperty(InteractionInterface* interaction) {
     hint->setEntry("default", defaultvalue.toString().toStdString());
   }
 
+  // a malformed value falls back to the default, a malformed default leaves the initial value
   const auto actualvalue = interaction->getValue();
-  if (not actualvalue.isNull()) {
-    result->fromString(actualvalue.toString().toStdString());
-  } else if (not defaultvalue.isNull()) {
-    result->fromString(defaultvalue.toString().toStdString());
+  for (const QVariant& value : {actualvalue, defaultvalue}) {
+    if (value.isNull()) continue;
+    try {
+      result->fromString(value.toString().toStdString());
+      break;
+    } catch (const NumericTextError& error) {
+      qWarning() << "Ignoring the value" << value.toString() << "of interaction" << interaction->getId() << ":" << error.what();
+    }
   }
 
   return result;
@@ -42,4 +42,7 @@ PLUGIN_AUTHORS(Matthieu Laqua)
 PLUGIN_NAME(File from &Kadi)
 PLUGIN_DESCRIPTION(Open a file from Kadi)
 PLUGIN_NAMESPACE(/plugins/infrastructure/dialogs/fileopen/kadifiledialog)
-PLUGIN_REQUIRED_NAMESPACES(/plugins/infrastructure/kadiintegration)
+PLUGIN_REQUIRED_NAMESPACES(
+  /plugins/infrastructure/kadiconfig
+  /plugins/infrastructure/kadiintegration
+)
@@ -0,0 +1,324 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <algorithm>
+
+#include <QDateTime>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QLockFile>
+#include <QSaveFile>
+#include <QTemporaryFile>
+
+#include "kadifilecache.h"
+
+KadiFileCache::KadiFileCache(const QString& directory, qint64 maximumsize)
+    : directory(directory), maximumsize(maximumsize), totalsize(0), clock(0), loaded(false) {
+}
+
+QString KadiFileCache::key(const QString& instance, const QString& record, const QString& fileid) {
+  return instance + "/" + record + "/" + fileid;
+}
+
+QString KadiFileCache::lookup(const QString& key, const QString& checksum) {
+  load();
+
+  auto it = entries.find(key);
+  if (it == entries.end() || (!checksum.isEmpty() && it->checksum.compare(checksum, Qt::CaseInsensitive) != 0)) {
+    stats.misses++;
+    return QString();
+  }
+
+  QString path = blobPath(it->blob);
+  QFileInfo info(path);
+  if (!info.exists() || info.size() != it->size) {
+    // removed or changed behind our back, the content is useless for every entry referring to it
+    const Entry changed = it.value();
+    removeBlob(changed.blob);
+    totalsize -= changed.size;
+    for (auto entry = entries.begin(); entry != entries.end();) {
+      if (entry->blob == changed.blob) {
+        removed.insert(entry.key());
+        entry = entries.erase(entry);
+      } else {
+        ++entry;
+      }
+    }
+    save();
+    stats.misses++;
+    return QString();
+  }
+
+  it->used = ++clock;
+  save();
+  stats.hits++;
+  return path;
+}
+
+QString KadiFileCache::etag(const QString& key) {
+  load();
+  return entries.value(key).etag;
+}
+
+std::unique_ptr<QTemporaryFile> KadiFileCache::createDownloadFile() {
+  QDir().mkpath(directory + "/incoming");
+  auto file = std::make_unique<QTemporaryFile>(directory + "/incoming/XXXXXX.part");
+  if (!file->open()) {
+    qWarning() << "Can not create a download in the Kadi file cache: " << file->errorString();
+    return nullptr;
+  }
+  return file;
+}
+
+QString KadiFileCache::publish(const QString& key, QTemporaryFile& download, const QByteArray& md5,
+                               const QString& checksum, const QString& etag) {
+  load();
+
+  QString blob = QString::fromLatin1(md5.toHex());
+  if (!checksum.isEmpty() && checksum.compare(blob, Qt::CaseInsensitive) != 0) {
+    qWarning() << "Downloaded file does not match its checksum: " << key;
+    download.remove();
+    return QString();
+  }
+
+  // another instance must not take the new content for an orphan before it is in the index
+  QLockFile lock(directory + "/index.lock");
+  const bool locked = lockIndex(lock);
+
+  QString path = blobPath(blob);
+  qint64 size = download.size();
+  download.close();
+  QFileInfo existing(path);
+  if (existing.exists() && existing.size() == size) {
+    // identical content is already cached
+    download.remove();
+  } else {
+    QDir().mkpath(directory + "/blobs");
+    removeBlob(blob);
+    download.setAutoRemove(false);
+    if (!download.rename(path)) {
+      qWarning() << "Can not publish download in the Kadi file cache: " << download.errorString();
+      download.remove();
+      return QString();
+    }
+    QFile::setPermissions(path, QFileDevice::ReadOwner | QFileDevice::ReadUser | QFileDevice::ReadGroup | QFileDevice::ReadOther);
+    totalsize += size;
+  }
+
+  auto previous = entries.find(key);
+  if (previous != entries.end() && previous->blob != blob) {
+    Entry replaced = previous.value();
+    entries.erase(previous);
+    release(replaced);
+  }
+  entries.insert(key, {blob, checksum, etag, size, ++clock});
+  removed.remove(key);
+
+  evict(key);
+  if (locked) writeIndex();
+  return path;
+}
+
+void KadiFileCache::setMaximumSize(qint64 bytes) {
+  load();
+  maximumsize = bytes;
+
+  QLockFile lock(directory + "/index.lock");
+  if (!lockIndex(lock)) return;
+  evict(QString());
+  writeIndex();
+}
+
+qint64 KadiFileCache::maximumSize() const {
+  return maximumsize;
+}
+
+qint64 KadiFileCache::size() {
+  load();
+  return totalsize;
+}
+
+int KadiFileCache::count() {
+  load();
+  return static_cast<int>(entries.size());
+}
+
+const KadiFileCache::Statistics& KadiFileCache::statistics() const {
+  return stats;
+}
+
+QString KadiFileCache::defaultDirectory() {
+  return QDir::homePath() + QDir::separator() + ".kadistudio" + QDir::separator() + "kadifiles";
+}
+
+QString KadiFileCache::blobPath(const QString& blob) const {
+  return directory + "/blobs/" + blob;
+}
+
+void KadiFileCache::removeBlob(const QString& blob) {
+  // cached content is read-only, which would keep it on some platforms
+  const QString path = blobPath(blob);
+  QFile::setPermissions(path, QFile::permissions(path) | QFileDevice::WriteOwner);
+  QFile::remove(path);
+}
+
+void KadiFileCache::release(const Entry& removed) {
+  for (const Entry& entry : entries) {
+    if (entry.blob == removed.blob) return;
+  }
+
+  removeBlob(removed.blob);
+  totalsize -= removed.size;
+}
+
+void KadiFileCache::evict(const QString& keep) {
+  // the entry just published stays, even if it alone exceeds the maximum size
+  while (totalsize > maximumsize) {
+    auto oldest = entries.end();
+    for (auto it = entries.begin(); it != entries.end(); ++it) {
+      if (it.key() != keep && (oldest == entries.end() || it->used < oldest->used)) {
+        oldest = it;
+      }
+    }
+    if (oldest == entries.end()) break;
+
+    erase(oldest);
+    stats.evictions++;
+  }
+}
+
+void KadiFileCache::erase(QHash<QString, Entry>::iterator entry) {
+  Entry erased = entry.value();
+  removed.insert(entry.key());
+  entries.erase(entry);
+  release(erased);
+}
+
+void KadiFileCache::load() {
+  if (loaded) return;
+  loaded = true;
+
+  // leftovers of interrupted downloads, recent ones may belong to another running instance
+  QDir incoming(directory + "/incoming");
+  for (const QFileInfo& part : incoming.entryInfoList({"*.part"}, QDir::Files)) {
+    if (part.lastModified().secsTo(QDateTime::currentDateTime()) > 24 * 60 * 60) {
+      QFile::remove(part.filePath());
+    }
+  }
+
+  // another instance publishes under the lock, so unknown content is really orphaned
+  QLockFile lock(directory + "/index.lock");
+  if (!lockIndex(lock)) return;
+
+  // content published right before a crash, without an entry in the index
+  QSet<QString> blobs;
+  for (const Entry& entry : entries) {
+    blobs.insert(entry.blob);
+  }
+  QDir blobdir(directory + "/blobs");
+  for (const QString& blob : blobdir.entryList(QDir::Files)) {
+    if (!blobs.contains(blob)) {
+      removeBlob(blob);
+    }
+  }
+}
+
+void KadiFileCache::save() {
+  QLockFile lock(directory + "/index.lock");
+  if (lockIndex(lock)) {
+    writeIndex();
+  }
+}
+
+bool KadiFileCache::lockIndex(QLockFile& lock) {
+  QDir().mkpath(directory);
+  if (!lock.tryLock(5000)) {
+    qWarning() << "Can not lock Kadi file cache index: " << lock.error();
+    return false;
+  }
+  merge(readIndex());
+  return true;
+}
+
+void KadiFileCache::merge(const QJsonObject& stored) {
+  for (auto it = stored.begin(); it != stored.end(); ++it) {
+    if (removed.contains(it.key())) continue;
+
+    QJsonObject object = it.value().toObject();
+    Entry entry {object["blob"].toString(), object["checksum"].toString(), object["etag"].toString(),
+                 object["size"].toInteger(), object["used"].toInteger()};
+    clock = std::max(clock, entry.used);
+
+    auto known = entries.find(it.key());
+    if (known != entries.end()) {
+      // used by another instance in the meantime
+      if (known->blob == entry.blob) known->used = std::max(known->used, entry.used);
+      continue;
+    }
+
+    QFileInfo info(blobPath(entry.blob));
+    if (entry.blob.isEmpty() || !info.exists() || info.size() != entry.size) continue;
+
+    bool counted = std::any_of(entries.begin(), entries.end(), [&entry](const Entry& other) {
+      return other.blob == entry.blob;
+    });
+    if (!counted) totalsize += entry.size;
+    entries.insert(it.key(), entry);
+  }
+}
+
+void KadiFileCache::writeIndex() {
+  QJsonObject stored;
+  for (auto it = entries.begin(); it != entries.end(); ++it) {
+    QJsonObject object;
+    object["blob"] = it->blob;
+    object["checksum"] = it->checksum;
+    object["etag"] = it->etag;
+    object["size"] = it->size;
+    object["used"] = it->used;
+    stored[it.key()] = object;
+  }
+
+  QJsonObject root;
+  root["version"] = FORMAT_VERSION;
+  root["entries"] = stored;
+
+  // write to a temporary file first, a crash must not leave a truncated index behind
+  QSaveFile file(directory + "/index.json");
+  if (!file.open(QIODevice::WriteOnly)) {
+    qWarning() << "Can not write Kadi file cache index: " << file.fileName();
+    return;
+  }
+  file.write(QJsonDocument(root).toJson(QJsonDocument::Compact));
+  if (file.commit()) {
+    // the stored index no longer has them, nothing to keep out of the next merge
+    removed.clear();
+  }
+}
+
+QJsonObject KadiFileCache::readIndex() const {
+  QFile file(directory + "/index.json");
+  if (!file.open(QIODevice::ReadOnly)) return QJsonObject();
+
+  QJsonObject root = QJsonDocument::fromJson(file.readAll()).object();
+  if (root["version"].toInt() != FORMAT_VERSION) {
+    qDebug() << "Discarding Kadi file cache index with unsupported version" << root["version"].toInt();
+    return QJsonObject();
+  }
+  return root["entries"].toObject();
+}
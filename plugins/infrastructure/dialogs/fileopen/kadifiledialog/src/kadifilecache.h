@@ -0,0 +1,155 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <memory>
+
+#include <QHash>
+#include <QJsonObject>
+#include <QSet>
+#include <QString>
+
+class QLockFile;
+class QTemporaryFile;
+
+/**
+ * @brief      Local cache of files downloaded from Kadi records.
+ *
+ *             Entries are keyed by instance, record and file id and refer
+ *             to the content by its MD5 checksum, the checksum Kadi reports
+ *             for every file. Identical content is stored once. A cached
+ *             file is only served while its checksum matches the one the
+ *             server currently reports, or while the server confirms the
+ *             stored ETag.
+ *
+ *             Downloads are written to a temporary file in the cache and
+ *             are published with a rename once they are complete and their
+ *             checksum matches, an interrupted download never shows up as
+ *             cached content. The least recently used entries are evicted
+ *             once the cache grows beyond maximumSize().
+ *
+ *             Cached content is read-only and must be copied before it is
+ *             handed to a tool, an entry whose content changed anyway is
+ *             dropped. Several running instances share the cache, the
+ *             index is merged with the stored one under a lock file before
+ *             it is written.
+ * @ingroup    kadifiledialog
+ */
+class KadiFileCache {
+
+  public:
+    struct Statistics {
+      int hits      = 0;
+      int misses    = 0;
+      int evictions = 0;
+    };
+
+    explicit KadiFileCache(const QString& directory = defaultDirectory(), qint64 maximumsize = DEFAULT_MAXIMUM_SIZE);
+
+    static QString key(const QString& instance, const QString& record, const QString& fileid);
+
+    /**
+     * @brief      Looks up an entry and marks it as recently used.
+     * @param      checksum  The checksum reported by the server, an empty
+     *                       checksum matches any entry.
+     * @return     Path of the cached content, empty if there is no entry
+     *             with this checksum.
+     */
+    QString lookup(const QString& key, const QString& checksum);
+
+    /**
+     * @return     The ETag the server sent with the cached content, for a
+     *             conditional request.
+     */
+    QString etag(const QString& key);
+
+    /**
+     * @brief      Creates the file a download is written to, in the cache
+     *             directory so that publishing it is a rename.
+     */
+    std::unique_ptr<QTemporaryFile> createDownloadFile();
+
+    /**
+     * @brief      Moves a completed download into the cache.
+     * @param      md5       MD5 of the downloaded content.
+     * @param      checksum  The checksum reported by the server, the
+     *                       download is dropped if it does not match.
+     * @return     Path of the cached content, empty on failure.
+     */
+    QString publish(const QString& key, QTemporaryFile& download, const QByteArray& md5,
+                    const QString& checksum, const QString& etag = QString());
+
+    void setMaximumSize(qint64 bytes);
+    qint64 maximumSize() const;
+
+    /**
+     * @return     Size of the cached content in bytes.
+     */
+    qint64 size();
+    int count();
+
+    const Statistics& statistics() const;
+
+    static QString defaultDirectory();
+
+    const static qint64 DEFAULT_MAXIMUM_SIZE = qint64(8) << 30;
+    const static int FORMAT_VERSION = 1;
+
+  private:
+    struct Entry {
+      QString blob;
+      QString checksum;
+      QString etag;
+      qint64  size;
+      qint64  used;
+    };
+
+    QString blobPath(const QString& blob) const;
+    void removeBlob(const QString& blob);
+    /**
+     * @brief      Deletes the content of a removed entry unless another
+     *             entry refers to the same content.
+     */
+    void release(const Entry& removed);
+    void evict(const QString& keep);
+    /**
+     * @brief      Removes an entry, also from the index other instances
+     *             stored.
+     */
+    void erase(QHash<QString, Entry>::iterator entry);
+
+    void load();
+    void save();
+    /**
+     * @brief      Locks the index against other instances and merges the
+     *             entries they stored since, entries removed here stay
+     *             removed.
+     * @return     False if the lock could not be taken in time.
+     */
+    bool lockIndex(QLockFile& lock);
+    void merge(const QJsonObject& stored);
+    void writeIndex();
+    QJsonObject readIndex() const;
+
+    QString directory;
+    qint64 maximumsize;
+    qint64 totalsize;
+    qint64 clock;
+    bool loaded;
+
+    QHash<QString, Entry> entries;
+    QSet<QString> removed;
+    Statistics stats;
+};
@@ -12,18 +12,21 @@
  * See the License for the specific language governing permissions and
  * limitations under the License. */
 
+#include <QFileInfo>
 #include <QLoggingCategory>
 #include <QProcess>
 #include <QMessageBox>
 
 #include <framework/pluginframework/pluginmanagerinterface.h>
+#include <plugins/infrastructure/kadiconfig/kadiconfiginterface.h>
 #include <plugins/infrastructure/kadiintegration/kadiintegrationinterface.h>
 
 #include "kadifiledialog.h"
 
 
 KadiFileDialog::KadiFileDialog(LibFramework::PluginManagerInterface* pluginManager)
-    : tmpfolder(QTemporaryDir(QDir::tempPath() + "/kadi_XXXXXX")) {
+    : pluginmanager(pluginManager), tmpfolder(QTemporaryDir(QDir::tempPath() + "/kadi_XXXXXX")),
+      filefetcher(&filecache, [this](const KadiInstance& instance) { return kadiintegration->createTransfer(instance); }) {
   kadiintegration = pluginManager->getInterface<KadiIntegrationInterface*>("/plugins/infrastructure/kadiintegration");
 
   downloadDialog = kadiintegration->createDownloadFromKadiDialog();
@@ -85,8 +88,28 @@ bool KadiFileDialog::validateAndLoadFilePath(const QString& kadiInstanceName, co
 
   if (kadifilename.isEmpty()) return true; // is a record URI
 
+  // reopened files come from the local file cache, kadi-apy is left for instances it knows but we do not
+  KadiInstance instance;
+  if (findKadiInstance(kadiInstanceName, instance)) {
+    QString cachedcontent = filefetcher.fetch(instance, recordIdentifier, kadifilename);
+    if (!cachedcontent.isEmpty()) {
+      // a copy, the tool opening the file may write it and must not change the cached content
+      QFile::remove(cachedfilepath);
+      if (QFile::copy(cachedcontent, cachedfilepath)) {
+        QFile::setPermissions(cachedfilepath, QFile::permissions(cachedfilepath) | QFileDevice::WriteOwner | QFileDevice::WriteUser);
+        return true;
+      }
+    } else {
+      qWarning() << "Could not fetch" << kadifilename << "from" << kadiInstanceName << ":" << filefetcher.errorString();
+    }
+  }
+
+  return downloadWithKadiApy(kadiInstanceName, recordIdentifier, kadifilename);
+}
+
+bool KadiFileDialog::downloadWithKadiApy(const QString& kadiInstanceName, const QString& recordIdentifier, const QString& kadifilename) {
   QProcess proc;
-  proc.setWorkingDirectory(fileDir.absolutePath());
+  proc.setWorkingDirectory(QFileInfo(cachedfilepath).absolutePath());
   proc.start("kadi-apy", {
     "records",
     "get-file",
@@ -99,25 +122,22 @@ bool KadiFileDialog::validateAndLoadFilePath(const QString& kadiInstanceName, co
     return false;
   }
 
-#if 0
-  QNetworkRequest request;
-  request.setUrl(QUrl(recordFileInfo.fileDownloadApiLink));
-  request.setRawHeader("Authorization", (QString("Bearer ") + currentKadiInstance.token).toUtf8());
-
-  preRequestHooks();
-  auto requesthandler = new kadiutils::NetworkHandler(networkAccessManager, this);
-  connect(requesthandler, &kadiutils::NetworkHandler::finished, this, [=](QNetworkReply* reply) {
-    processFileReply(reply);
-    postRequestHooks();
-    delete requesthandler;
-    QDialog::accept();
-  });
-  requesthandler->sendRequest(request);
-#endif
-
   return true;
 }
 
+bool KadiFileDialog::findKadiInstance(const QString& kadiInstanceName, KadiInstance& instance) {
+  auto kadiconfig = pluginmanager->getInterface<KadiConfigInterface*>("/plugins/infrastructure/kadiconfig");
+  if (!kadiconfig) return false;
+
+  for (const KadiInstance& candidate : kadiconfig->getAllInstances()) {
+    if (candidate.name == kadiInstanceName) {
+      instance = candidate;
+      return true;
+    }
+  }
+  return false;
+}
+
 bool KadiFileDialog::validateAndLoadFilePath(const QString& filepath) {
   QString kadiInstanceName;
   QString recordIdentifier;
@@ -133,48 +153,6 @@ bool KadiFileDialog::validateAndLoadFilePath(const QString& filepath) {
   return validateAndLoadFilePath(kadiInstanceName, recordIdentifier, kadifilename);
 }
 
-#if 0
-void KadiFileDialog::processFileReply(QNetworkReply* reply) {
-  int statusCode = kadiutils::getHttpCode(reply);
-
-  if (statusCode > 0 && statusCode != 200) {
-    return;
-  }
-
-  // save to kadi integration
-  QString kadiInstanceName;
-  QString recordIdentifier;
-  QString kadifilename;
-  if (not kadiutils::getRecordIdentifier(getFilePath(), kadiInstanceName, recordIdentifier, kadifilename)) {
-    std::cout << "Broken filename " << getFilePath().toStdString() << " ." << std::endl;
-    setCachedFileName(QString());
-    return;
-  }
-
-  // determine caching location
-  QDir fileDir(getTmpFolder() + "/" + kadiInstanceName + "/" + recordIdentifier);
-
-  QString filePath = fileDir.absolutePath() + "/" + kadifilename;
-
-  qDebug() << fileDir;
-  qDebug() << filePath;
-
-  // write file
-  QFile cacheFile(filePath);
-  if (cacheFile.open(QFile::WriteOnly)) {
-    cacheFile.write(reply->readAll());
-    cacheFile.flush();
-    cacheFile.close();
-
-    setCachedFileName(filePath);
-  } else {
-    qWarning() << "File '" << cacheFile.fileName() << "' could not be opened." << Qt::endl;
-
-    setCachedFileName(QString());
-  }
-}
-#endif
-
 bool KadiFileDialog::openFilePath(const QString& filepath, QFile& qfile) {
   QString kadiInstanceName;
   QString recordIdentifier;
@@ -19,13 +19,18 @@
 #include <QString>
 #include <QTemporaryDir>
 
+#include "kadifilecache.h"
+#include "kadifilefetcher.h"
+
 
 namespace LibFramework {
   class PluginManagerInterface;
 }
 
 class DownloadFromKadiDialogInterface;
+class KadiConfigInterface;
 class KadiIntegrationInterface;
+struct KadiInstance;
 
 /**
  * @class Provides a dialog in which the user is able to select a file from Kadi
@@ -64,11 +69,14 @@ public:
 private:
 
   bool validateAndLoadFilePath(const QString& kadiInstanceName, const QString& recordIdentifier, const QString& kadifilename);
+  bool downloadWithKadiApy(const QString& kadiInstanceName, const QString& recordIdentifier, const QString& kadifilename);
+  bool findKadiInstance(const QString& kadiInstanceName, KadiInstance& instance);
 
   QString getTmpFolder() {
     return tmpfolder.path();
   }
 
+  LibFramework::PluginManagerInterface *pluginmanager;
   KadiIntegrationInterface *kadiintegration;
 
   FileOpenDialogInterface::FileMode filemode;
@@ -78,4 +86,7 @@ private:
 
   QTemporaryDir tmpfolder;
 
+  KadiFileCache filecache;
+  KadiFileFetcher filefetcher;
+
 };
@@ -0,0 +1,142 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <memory>
+
+#include <QEventLoop>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QNetworkReply>
+#include <QNetworkRequest>
+#include <QTemporaryFile>
+#include <QUrl>
+
+#include <plugins/infrastructure/kadiconfig/kadiinstance.h>
+#include <plugins/infrastructure/kadiintegration/kaditransferinterface.h>
+
+#include "kadifilecache.h"
+#include "kadifilefetcher.h"
+
+KadiFileFetcher::KadiFileFetcher(KadiFileCache *cache, const TransferFactory& createTransfer)
+    : cache(cache), createTransfer(createTransfer), timeoutMsecs(DEFAULT_TIMEOUT) {
+}
+
+QString KadiFileFetcher::fetch(const KadiInstance& instance, const QString& recordIdentifier, const QString& filename) {
+  error.clear();
+
+  QString recordkey = apiUrl(instance, "records/identifier/" + QString::fromLatin1(QUrl::toPercentEncoding(recordIdentifier)));
+  if (!recordIds.contains(recordkey)) {
+    QJsonObject record;
+    if (!getJson(instance, recordkey, record)) return QString();
+    recordIds.insert(recordkey, record["id"].toInt());
+  }
+  int recordid = recordIds.value(recordkey);
+
+  // asking for the file every time revalidates the cached content, replaced files get a new id or checksum
+  QJsonObject file;
+  QString fileurl = apiUrl(instance, QString("records/%1/files/name/%2").arg(recordid).arg(QString::fromLatin1(QUrl::toPercentEncoding(filename))));
+  if (!getJson(instance, fileurl, file)) return QString();
+
+  QString key = KadiFileCache::key(instanceKey(instance), QString::number(recordid), file["id"].toString());
+  QString checksum = file["checksum"].toString();
+  if (!checksum.isEmpty()) {
+    QString cached = cache->lookup(key, checksum);
+    if (!cached.isEmpty()) return cached;
+  }
+
+  QString downloadurl = file["_links"].toObject()["download"].toString();
+  if (downloadurl.isEmpty()) {
+    downloadurl = apiUrl(instance, QString("records/%1/files/%2/download").arg(recordid).arg(file["id"].toString()));
+  }
+  return download(instance, downloadurl, key, checksum);
+}
+
+const QString& KadiFileFetcher::errorString() const {
+  return error;
+}
+
+void KadiFileFetcher::setTimeout(int msecs) {
+  timeoutMsecs = msecs;
+}
+
+int KadiFileFetcher::timeout() const {
+  return timeoutMsecs;
+}
+
+QNetworkRequest KadiFileFetcher::createRequest(const KadiInstance& instance, const QString& url) const {
+  QNetworkRequest request((QUrl(url)));
+  request.setRawHeader("Authorization", (QString("Bearer ") + instance.token).toUtf8());
+  request.setTransferTimeout(timeoutMsecs);
+  return request;
+}
+
+bool KadiFileFetcher::getJson(const KadiInstance& instance, const QString& url, QJsonObject& result) {
+  std::unique_ptr<QNetworkReply> reply(networkAccessManager.get(createRequest(instance, url)));
+  wait(reply.get());
+
+  if (reply->error() != QNetworkReply::NoError) {
+    error = reply->errorString();
+    return false;
+  }
+
+  QJsonParseError parseerror;
+  result = QJsonDocument::fromJson(reply->readAll(), &parseerror).object();
+  if (parseerror.error != QJsonParseError::NoError) {
+    error = QObject::tr("Invalid response from %1: %2").arg(url, parseerror.errorString());
+    return false;
+  }
+  return true;
+}
+
+QString KadiFileFetcher::download(const KadiInstance& instance, const QString& url, const QString& key, const QString& checksum) {
+  std::unique_ptr<QTemporaryFile> file = cache->createDownloadFile();
+  if (!file) {
+    error = QObject::tr("Can not write to the Kadi file cache");
+    return QString();
+  }
+
+  // without a checksum only the server can tell whether the cached content is current
+  QString etag = checksum.isEmpty() ? cache->etag(key) : QString();
+  std::unique_ptr<KadiTransferInterface> transfer(createTransfer(instance));
+  if (!transfer->download(url, file.get(), checksum, etag)) {
+    error = transfer->errorString();
+    return QString();
+  }
+  if (transfer->notModified()) {
+    return cache->lookup(key, QString());
+  }
+
+  QString cached = cache->publish(key, *file, transfer->md5(), checksum, transfer->etag());
+  if (cached.isEmpty()) {
+    error = QObject::tr("Can not store the downloaded file in the Kadi file cache");
+  }
+  return cached;
+}
+
+QString KadiFileFetcher::apiUrl(const KadiInstance& instance, const QString& path) {
+  return instance.host + (instance.host.endsWith("/") ? "" : "/") + "api/" + path;
+}
+
+QString KadiFileFetcher::instanceKey(const KadiInstance& instance) {
+  // the host, instance names are only local aliases
+  return instance.host.endsWith("/") ? instance.host.chopped(1) : instance.host;
+}
+
+void KadiFileFetcher::wait(QNetworkReply *reply) {
+  if (reply->isFinished()) return;
+
+  QEventLoop eventLoop;
+  QObject::connect(reply, &QNetworkReply::finished, &eventLoop, &QEventLoop::quit);
+  eventLoop.exec();
+}
@@ -0,0 +1,83 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <functional>
+
+#include <QHash>
+#include <QNetworkAccessManager>
+#include <QString>
+
+class KadiFileCache;
+class KadiTransferInterface;
+class QJsonObject;
+class QNetworkReply;
+class QNetworkRequest;
+struct KadiInstance;
+
+/**
+ * @brief      Downloads files of Kadi records into a KadiFileCache.
+ *
+ *             Every fetch asks the server for the current metadata of the
+ *             file and serves the cached content while its checksum
+ *             matches. Without a checksum the download is made conditional
+ *             on the ETag of the cached content. Downloads go through the
+ *             transfer engine of the Kadi integration, which streams them
+ *             into the cache and continues interrupted ones.
+ *
+ *             The calls block in a local event loop until the requests are
+ *             finished.
+ * @ingroup    kadifiledialog
+ */
+class KadiFileFetcher {
+
+  public:
+    using TransferFactory = std::function<KadiTransferInterface*(const KadiInstance&)>;
+
+    KadiFileFetcher(KadiFileCache *cache, const TransferFactory& createTransfer);
+
+    /**
+     * @return     Path of the cached content of the file, empty on failure,
+     *             see errorString().
+     */
+    QString fetch(const KadiInstance& instance, const QString& recordIdentifier, const QString& filename);
+
+    const QString& errorString() const;
+
+    /**
+     * @brief      Requests for the metadata are aborted once no data
+     *             arrived for this long.
+     */
+    void setTimeout(int msecs);
+    int timeout() const;
+
+    const static int DEFAULT_TIMEOUT = 30000;
+
+  private:
+    QNetworkRequest createRequest(const KadiInstance& instance, const QString& url) const;
+    bool getJson(const KadiInstance& instance, const QString& url, QJsonObject& result);
+    QString download(const KadiInstance& instance, const QString& url, const QString& key, const QString& checksum);
+
+    static QString apiUrl(const KadiInstance& instance, const QString& path);
+    static QString instanceKey(const KadiInstance& instance);
+    static void wait(QNetworkReply *reply);
+
+    KadiFileCache *cache;
+    TransferFactory createTransfer;
+    QNetworkAccessManager networkAccessManager;
+    QHash<QString, int> recordIds;
+    QString error;
+    int timeoutMsecs;
+};
@@ -47,3 +47,4 @@ PLUGIN_NAMESPACE(/plugins/infrastructure/dialogs/logdialog)
 PLUGIN_REQUIRED_NAMESPACES(
   /plugins/infrastructure/workflows/processmanager // ??
 )
+PLUGIN_LOAD_ON_DEMAND()
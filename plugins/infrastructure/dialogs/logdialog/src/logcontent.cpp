@@ -12,7 +12,6 @@
  * See the License for the specific language governing permissions and
  * limitations under the License. */
 
-#include <sstream>
 #include "logdialog.h"
 #include "logcontent.h"
 
@@ -20,38 +19,23 @@ LogContent::LogContent(const std::string& context, LogDialog* dialog)
     : context(context), dialog(dialog) {
 }
 
-LogLine* LogContent::add(const std::string& string) {
-  auto line = std::make_unique<LogLineString>(*this, string);
-  LogLine *result = line.get();
+void LogContent::add(quint32 line_number) {
+  lines.push_back(line_number);
   if (parent) {
-    parent->add(*line);
+    parent->add(line_number);
   }
-  lines.push_back(std::move(line));
-  dialog->logContentUpdated(context, *result);
-  return result;
-}
-
-LogLine* LogContent::add(LogLine& ref) {
-  auto new_ref = std::make_unique<LogLineRef>(ref);
-  LogLine *result = new_ref.get();
-  lines.push_back(std::move(new_ref));
-  if (parent) {
-    parent->add(ref);
-  }
-  dialog->logContentUpdated(context, *result);
-  return result;
 }
 
 void LogContent::clear() {
   lines.clear();
 }
 
-std::string LogContent::toString() const {
-  std::ostringstream result;
-  for (const auto& line : lines) {
-    result << line->toString();
+QString LogContent::toString() const {
+  QString result;
+  for (quint32 line_number : lines) {
+    result += dialog->log_store.message(line_number);
   }
-  return result.str();
+  return result;
 };
 
 void LogContent::setParent(LogContent* parent) {
@@ -62,12 +46,21 @@ std::string LogContent::getContextForLine(size_t line_number) const {
   if (line_number >= lines.size()) {
     return {};
   }
-  if (LogLine *line = lines.at(line_number).get()) {
-    return line->getContext();
-  }
-  return {};
+  return dialog->log_store.context(lines[line_number]);
 }
 
 const std::string& LogContent::getContext() const {
   return context;
 }
+
+int LogContent::lineCount() const {
+  return static_cast<int>(lines.size());
+}
+
+QString LogContent::lineText(int line_number) const {
+  QString message = dialog->log_store.message(lines.at(line_number));
+  if (message.endsWith('\n')) {
+    message.chop(1);
+  }
+  return message;
+}
@@ -14,33 +14,37 @@
 
 #pragma once
 
+#include <string>
 #include <vector>
-#include <memory>
 
-#include "logline.h"
+#include <QString>
+
+#include <framework/enhanced/terminalview.h>
 
 class LogDialog;
 
 /**
  * @brief      A class representing log content for a given context. It can contain any number of lines,
- *             which can a) store a real string or b) a reference to a line, and it can have a parent.
- *             Whenever a line is added, a reference to this line will also be added to the parent to incorporate a
- *             hierarchical log. The LogDialog is notified when a new line was added to allow updating the GUI.
+ *             each stored as the number of the line in the LogStore of the dialog, and it can have a parent.
+ *             Whenever a line is added, it will also be added to the parent to incorporate a
+ *             hierarchical log. The lines are shown by the LogTextWidget, which pulls them when painting.
  * @ingroup    src
  */
-class LogContent {
+class LogContent : public TerminalLineSource {
   public:
     LogContent(const std::string& context, LogDialog* dialog);
-    LogLine* add(const std::string& string);
-    LogLine* add(LogLine& ref);
+    void add(quint32 line_number);
     void clear();
-    std::string toString() const;
+    QString toString() const;
     void setParent(LogContent* parent);
     std::string getContextForLine(size_t line_number) const;
     const std::string& getContext() const;
 
+    int lineCount() const override;
+    QString lineText(int line_number) const override;
+
   private:
-    std::vector<std::unique_ptr<LogLine>> lines;
+    std::vector<quint32> lines;
     LogContent *parent{};
     std::string context;
     LogDialog *dialog;
@@ -12,6 +12,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License. */
 
+#include <algorithm>
 #include <cmath>
 
 #include <QDebug>
@@ -32,13 +33,13 @@
 
 #include "logtextwidget.h"
 #include "logtreeitem.h"
-#include "logline.h"
 #include "logdialog.h"
 
 
 LogDialog::LogDialog(LibFramework::PluginManagerInterface* pluginmanager)
     : QDialog(nullptr, Qt::WindowTitleHint | Qt::WindowSystemMenuHint), error_label(new QLabel()),
-      current_workflow_id(-1), log_seek(0), incomplete_last_line(nullptr), root(nullptr), tree_view_enabled(false) {
+      log_store(DEFAULT_CONTEXT), all_lines({}, this), current_workflow_id(-1), distributed_lines(0), root(nullptr),
+      tree_view_enabled(false) {
 
   processmanager_interface = pluginmanager->getInterface<ProcessManagerInterface*>("/plugins/infrastructure/workflows/processmanager");
 
@@ -51,7 +52,6 @@ LogDialog::LogDialog(LibFramework::PluginManagerInterface* pluginmanager)
   setWindowFlags(Qt::Window);
   auto *layout = new QVBoxLayout(this);
   log_text_widget = new LogTextWidget();
-  log_text_widget->setReadOnly(true);
   logtree = new QTreeWidget();
   logtree->setHeaderLabels({"Log context", "Order"});
   logtree->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Expanding);
@@ -97,7 +97,7 @@ void LogDialog::open() {
   raise();  // for MacOS
   activateWindow(); // for Windows
 
-  log_text_widget->ensureCursorVisible(); // to enable autoscroll initially
+  log_text_widget->scrollToBottom(); // to enable autoscroll initially
 }
 
 
@@ -125,12 +125,14 @@ void LogDialog::showLogDialog(int workflow_id) {
       // not showing an error here for backwards compatibility for now
       // setError(error);
     }
-    log_seek = 0;
+    log_store.close();
+    distributed_lines = 0;
     setWindowTitle(tr("Workflow %1 Execution Log").arg(workflow_id));
     current_workflow_id = workflow_id;
+    log_text_widget->setCurrentContent(nullptr);
     logtree->clear();
     log_content.clear();
-    log_text_widget->clear();
+    all_lines.clear();
     initContextTree(tree_path);
   }
 
@@ -149,41 +151,30 @@ bool LogDialog::isOpen() {
   return isVisible();
 }
 
-LogLine* LogDialog::addLogLine(const QString& line) {
-  LogLine *result = nullptr;
-  if (line.isEmpty()) return result;
-  QString log_context, log_message;
-  if (line.count(";") < 1) {
-    log_context = QString::fromStdString(DEFAULT_CONTEXT);
-    log_message = line;
-  } else {
-    const QChar separator = ';';
-    log_context = line.section(separator, 0, 0).trimmed();
-    log_message = line.section(separator, 1);
-  }
-
-  if (!log_message.isEmpty()) {
-    result = getOrInsertLogContent(log_context.toStdString())->add(log_message.toStdString());
-    if (tree_view_enabled) {
-      auto item_iter = tree_items.find(log_context.toStdString());
-      if (item_iter == tree_items.end()) {
-        QJsonObject updated_tree = loadStatusTree(tree_path);
-        bool item_was_added = false;
-        if (!updated_tree.isEmpty()) {
-          addTreeItems(updated_tree, {log_context});
-          item_was_added = (tree_items.find(log_context.toStdString()) != tree_items.end());
-        }
-        if (!item_was_added) {
-          // fallback, it does not seem to be part of the workflow hierarchy
-          auto item = new LogTreeItem(log_context, log_context);
-          logtree->addTopLevelItem(item);
-          tree_items[log_context.toStdString()] = item;
-        }
+void LogDialog::addLogLine(quint32 line_number) {
+  const std::string& context = log_store.context(line_number);
+  if (tree_view_enabled) {
+    auto item_iter = tree_items.find(context);
+    if (item_iter == tree_items.end()) {
+      const QString log_context = QString::fromStdString(context);
+      QJsonObject updated_tree = loadStatusTree(tree_path);
+      bool item_was_added = false;
+      if (!updated_tree.isEmpty()) {
+        addTreeItems(updated_tree, {log_context});
+        item_was_added = (tree_items.find(context) != tree_items.end());
+      }
+      if (!item_was_added) {
+        // fallback, it does not seem to be part of the workflow hierarchy
+        auto item = new LogTreeItem(log_context, log_context);
+        logtree->addTopLevelItem(item);
+        tree_items[context] = item;
       }
     }
-
   }
-  return result;
+  getOrInsertLogContent(context)->add(line_number);
+  if (!tree_view_enabled) {
+    all_lines.add(line_number);
+  }
 }
 
 void LogDialog::initContextTree(const QString& path) {
@@ -205,6 +196,8 @@ void LogDialog::initContextTree(const QString& path) {
     addTreeItems(tree, tree.keys()); // add all items from the json tree info
     logtree->expandAll();
     root->setSelected(true);
+  } else {
+    log_text_widget->setCurrentContent(&all_lines);
   }
 }
 
@@ -245,34 +238,33 @@ void LogDialog::addTreeItems(const QJsonObject& tree, const QStringList& keys) {
 }
 
 bool LogDialog::updateLog(const QString& file_path) {
-  QFile file(file_path);
-  if (!file.open(QIODevice::ReadOnly)) {
+  if (!log_store.isOpen() && !log_store.open(file_path)) {
     fileNotFound(file_path);
     log_watcher->removePath(file_path);
     close();
     return false;
   }
-  if (log_seek > 0) {
-    file.seek(log_seek);
-    if (incomplete_last_line) {
-      QByteArray raw = file.readLine();
-      std::string line = raw.toStdString();
-      incomplete_last_line->append(line); // make the last line complete
-      incomplete_last_line = nullptr;
+
+  bool reset = false;
+  auto [first, last] = log_store.update(&reset);
+  if (reset) {
+    // the log file was replaced, distribute all lines again
+    for (auto& [context, content] : log_content) {
+      content.clear();
     }
+    all_lines.clear();
+    log_text_widget->reset();
+    distributed_lines = 0;
+  } else if (first < distributed_lines) {
+    // the incomplete last line has grown, it is already part of its contents
+    first++;
   }
-  qint64 chars_read = 0;
-  LogLine *last_line = nullptr;
-  while (!file.atEnd()) {
-    const QString& line = file.readLine();
-    last_line = addLogLine(line);
-    chars_read += line.size();
-  }
-  if (last_line && !last_line->isEmpty() && last_line->getLastChar() != '\n') {
-    incomplete_last_line = last_line;
+
+  for (quint32 line_number = first; line_number < last; ++line_number) {
+    addLogLine(line_number);
   }
-  log_seek += chars_read;
-  file.seek(log_seek);
+  distributed_lines = std::max(distributed_lines, last);
+  log_text_widget->linesChanged();
   return true;
 }
 
@@ -298,30 +290,12 @@ void LogDialog::updateTree(const QString& file_path) {
 
 void LogDialog::selectedContextChanged() {
   auto selectedItems = logtree->selectedItems();
-  log_text_widget->clear();
-  if (!selectedItems.isEmpty()) {
-    QString selected = dynamic_cast<LogTreeItem*>(selectedItems[0])->getId();
-    LogContent *content = getOrInsertLogContent(selected.toStdString());
-    QString log_line = removeTrailingNewline(content->toString()); // QTextEdit::append() adds a newline
-    log_text_widget->setCurrentContent(content);
-    log_text_widget->setTextTermFormatting(log_line);
-    log_text_widget->ensureCursorVisible();
-  }
-}
-
-void LogDialog::logContentUpdated(const std::string& context, const LogLine& line) {
-  QString log_line = removeTrailingNewline(line.toString()); // QTextEdit::append() adds a newline
-  if (tree_view_enabled) {
-    auto selectedItems = logtree->selectedItems();
-    if (!selectedItems.isEmpty()) {
-      std::string selected = dynamic_cast<LogTreeItem*>(selectedItems[0])->getId().toStdString();
-      if (selected == context) {
-        log_text_widget->setTextTermFormatting(log_line);
-      }
-    }
-  } else {
-    log_text_widget->setTextTermFormatting(log_line);
+  if (selectedItems.isEmpty()) {
+    log_text_widget->setCurrentContent(nullptr);
+    return;
   }
+  QString selected = dynamic_cast<LogTreeItem*>(selectedItems[0])->getId();
+  log_text_widget->setCurrentContent(getOrInsertLogContent(selected.toStdString()));
 }
 
 LogContent* LogDialog::getOrInsertLogContent(const std::string& context) {
@@ -332,7 +306,7 @@ LogContent* LogDialog::getOrInsertLogContent(const std::string& context) {
   return &result->second;
 }
 
-std::string LogDialog::getLogForContext(const std::string& context) const {
+QString LogDialog::getLogForContext(const std::string& context) const {
   auto content = log_content.find(context);
   if (content != log_content.end()) {
     return content->second.toString();
@@ -366,16 +340,6 @@ void LogDialog::fileNotFound(const QString& path) {
                               tr("Can not read the log file from %1. Please check your installation!").arg(path));
 }
 
-QString LogDialog::removeTrailingNewline(const std::string& str) {
-  // NOT NEEDED FOR colorterminalwidget
-  // std::string result = str;
-  // if (!result.empty() && result.back() == '\n') {
-  //   result.pop_back();
-  // }
-  // return QString::fromStdString(result);
-  return QString::fromStdString(str);
-}
-
 void LogDialog::setError(const QString& error_message) {
   error_label->setText(error_message);
 }
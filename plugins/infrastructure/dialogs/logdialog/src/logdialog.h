@@ -21,6 +21,7 @@
 
 #include "../logdialoginterface.h"
 #include "logcontent.h"
+#include "logstore.h"
 
 class LogTextWidget;
 class QTreeWidget;
@@ -49,7 +50,7 @@ class LogDialog : public QDialog, public LogDialogInterface {
     bool isOpen() override;
 
   Q_SIGNALS:
-    void updatedLog(const QString& context, const LogLine& line);
+    void updatedLog(const QString& context, quint32 line_number);
 
   private Q_SLOTS:
     bool updateLog(const QString& file_path);
@@ -58,23 +59,27 @@ class LogDialog : public QDialog, public LogDialogInterface {
     void selectedContextChanged();
 
   private:
+    const std::string DEFAULT_CONTEXT = "Process Engine";
+    const std::string WORKFLOW_ROOT_CONTEXT = "Workflow";
+
     void initContextTree(const QString& path);
-    LogLine* addLogLine(const QString& line);
+    void addLogLine(quint32 line_number);
     void addTreeItems(const QJsonObject& tree, const QStringList& keys);
     LogContent* getOrInsertLogContent(const std::string& context);
-    std::string getLogForContext(const std::string& context) const;
+    QString getLogForContext(const std::string& context) const;
 
-    void logContentUpdated(const std::string& context, const LogLine& line);
     QJsonObject loadStatusTree(const QString& path);
     void fileNotFound(const QString& path);
-    static QString removeTrailingNewline(const std::string& str);
     void setError(const QString& error_message);
 
     LogTextWidget *log_text_widget;
     QTreeWidget *logtree;
     QLabel *error_label;
 
+    LogStore log_store;
     std::unordered_map<std::string, LogContent> log_content;
+    // all lines in order, shown if there is no context tree
+    LogContent all_lines;
     std::unordered_map<std::string, LogTreeItem*> tree_items;
 
     ProcessManagerInterface *processmanager_interface;
@@ -83,13 +88,9 @@ class LogDialog : public QDialog, public LogDialogInterface {
     QString tree_path;
     QFileSystemWatcher *log_watcher;
     QFileSystemWatcher *tree_watcher;
-    qint64 log_seek;
-    LogLine *incomplete_last_line;
+    quint32 distributed_lines;
     LogTreeItem *root;
     bool tree_view_enabled;
 
-    const std::string DEFAULT_CONTEXT = "Process Engine";
-    const std::string WORKFLOW_ROOT_CONTEXT = "Workflow";
-
     friend class LogContent;
 };
@@ -0,0 +1,231 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <algorithm>
+#include <cstring>
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#endif
+
+#include "logstore.h"
+
+namespace {
+
+bool isSpace(char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+}
+
+}
+
+LogStore::LogStore(std::string default_context) : default_context(std::move(default_context)) {
+  contextId(this->default_context);
+}
+
+bool LogStore::open(const QString& file_path) {
+  close();
+  file.setFileName(file_path);
+  file_id = pathId();
+  return file.open(QIODevice::ReadOnly);
+}
+
+void LogStore::close() {
+  restart();
+  file.close();
+}
+
+void LogStore::restart() {
+  if (mapping) {
+    file.unmap(const_cast<uchar*>(mapping));
+    mapping = nullptr;
+    mapped_size = 0;
+  }
+  lines.clear();
+  tail = 0;
+  tail_incomplete = false;
+  tail_fingerprint.clear();
+}
+
+LogStore::FileId LogStore::pathId() const {
+#ifndef _WIN32
+  struct stat info;
+  if (::stat(QFile::encodeName(file.fileName()).constData(), &info) == 0) {
+    return {static_cast<quint64>(info.st_dev), static_cast<quint64>(info.st_ino)};
+  }
+#endif
+  return {};
+}
+
+bool LogStore::isReplaced(qint64 size) const {
+  if (size < tail) return true;
+  if (tail_fingerprint.isEmpty()) return false;
+
+  // read instead of using the mapping, which may reach beyond a truncated file
+  if (!file.seek(tail - tail_fingerprint.size())) return true;
+  return file.read(tail_fingerprint.size()) != tail_fingerprint;
+}
+
+bool LogStore::isOpen() const {
+  return file.isOpen();
+}
+
+std::pair<quint32, quint32> LogStore::update(bool *reset) {
+  if (reset) *reset = false;
+  if (!file.isOpen()) {
+    return {lineCount(), lineCount()};
+  }
+
+  const FileId current_id = pathId();
+  if (current_id.inode != 0 && current_id != file_id) {
+    // the log was rotated, follow the path to the new file
+    restart();
+    if (reset) *reset = true;
+    file.close();
+    file_id = current_id;
+    if (!file.open(QIODevice::ReadOnly)) {
+      return {0, 0};
+    }
+  }
+
+  const qint64 size = file.size();
+  if (isReplaced(size)) {
+    // the file was truncated or written again, start over
+    restart();
+    if (reset) *reset = true;
+  }
+  if (tail_incomplete) {
+    // the last line is indexed again from its beginning
+    lines.pop_back();
+    tail_incomplete = false;
+  }
+  const auto first = lineCount();
+  if (size == tail) {
+    return {first, lineCount()};
+  }
+
+  if (remap(size)) {
+    scan(reinterpret_cast<const char*>(mapping) + tail, tail, size - tail, true);
+  } else {
+    // mapping is not supported for this file, stream it instead
+    qint64 chunk_size = CHUNK_SIZE;
+    while (tail < size) {
+      if (!file.seek(tail)) break;
+      const qint64 start = tail;
+      const QByteArray chunk = file.read(std::min(chunk_size, size - tail));
+      if (chunk.isEmpty()) break;
+
+      const bool at_end = start + chunk.size() >= size;
+      if (scan(chunk.constData(), start, chunk.size(), at_end) == 0 && !at_end) {
+        // a single line longer than the chunk
+        chunk_size *= 2;
+      }
+      if (at_end) break;
+    }
+  }
+
+  const qint64 fingerprint_size = std::min(tail, FINGERPRINT_SIZE);
+  if (fingerprint_size > 0 && file.seek(tail - fingerprint_size)) {
+    tail_fingerprint = file.read(fingerprint_size);
+  }
+  return {first, lineCount()};
+}
+
+bool LogStore::remap(qint64 size) {
+  if (mapping && mapped_size == size) return true;
+  if (mapping) {
+    file.unmap(const_cast<uchar*>(mapping));
+  }
+  mapping = file.map(0, size);
+  mapped_size = mapping ? size : 0;
+  return mapping != nullptr;
+}
+
+qint64 LogStore::scan(const char *data, qint64 base, qint64 size, bool at_end) {
+  const char *end = data + size;
+  const char *line = data;
+  while (line < end) {
+    const auto *newline = static_cast<const char*>(std::memchr(line, '\n', end - line));
+    if (!newline) break;
+    addLine(line, newline + 1, base + (line - data));
+    line = newline + 1;
+  }
+
+  const qint64 consumed = line - data;
+  tail = base + consumed;
+  if (at_end && line < end) {
+    addLine(line, end, tail);
+    tail_incomplete = true;
+  }
+  return consumed;
+}
+
+void LogStore::addLine(const char *begin, const char *end, qint64 offset) {
+  const auto *separator = static_cast<const char*>(std::memchr(begin, ';', end - begin));
+  if (!separator) {
+    lines.push_back({offset, static_cast<quint32>(end - begin), 0});
+    return;
+  }
+
+  const char *name_begin = begin;
+  const char *name_end = separator;
+  while (name_begin < name_end && isSpace(*name_begin)) ++name_begin;
+  while (name_end > name_begin && isSpace(*(name_end - 1))) --name_end;
+
+  const qint64 message_offset = offset + (separator + 1 - begin);
+  lines.push_back({message_offset, static_cast<quint32>(end - separator - 1),
+                   contextId({name_begin, static_cast<std::size_t>(name_end - name_begin)})});
+}
+
+quint32 LogStore::contextId(std::string_view name) {
+  // consecutive lines mostly share their context
+  if (last_context < contexts.size() && contexts[last_context] == name) {
+    return last_context;
+  }
+  auto [it, inserted] = context_ids.try_emplace(std::string(name), static_cast<quint32>(contexts.size()));
+  if (inserted) {
+    contexts.push_back(it->first);
+  }
+  last_context = it->second;
+  return last_context;
+}
+
+quint32 LogStore::lineCount() const {
+  return static_cast<quint32>(lines.size());
+}
+
+bool LogStore::isComplete(quint32 line_number) const {
+  return line_number + 1 < lineCount() || !tail_incomplete;
+}
+
+QString LogStore::message(quint32 line_number) const {
+  const Line& line = lines.at(line_number);
+  // the mapping may reach beyond a file truncated since the last update, accessing it there raises SIGBUS
+  if (mapping && line.offset + line.length <= mapped_size && line.offset + line.length <= file.size()) {
+    return QString::fromUtf8(reinterpret_cast<const char*>(mapping) + line.offset, line.length);
+  }
+  if (!file.seek(line.offset)) return {};
+  return QString::fromUtf8(file.read(line.length));
+}
+
+const std::string& LogStore::context(quint32 line_number) const {
+  return contexts[lines.at(line_number).context];
+}
+
+std::size_t LogStore::indexMemory() const {
+  std::size_t result = lines.capacity() * sizeof(Line);
+  for (const auto& name : contexts) {
+    result += sizeof(std::string) + name.capacity() + sizeof(std::pair<std::string, quint32>) + name.capacity();
+  }
+  return result;
+}
@@ -0,0 +1,130 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <QByteArray>
+#include <QFile>
+#include <QString>
+
+/**
+ * @brief      Line index over a growing log file.
+ *
+ *             The file is memory mapped (or read in chunks if mapping is not
+ *             possible) and scanned once from a tail cursor whenever it grew.
+ *             For every line only the position of its message and the id of
+ *             its context is kept, the text itself is decoded on demand. A log
+ *             line has the form "context;message", lines without separator
+ *             belong to the default context.
+ *
+ *             A trailing line without newline is indexed as well, but scanned
+ *             again on the next update, so it can still grow.
+ *
+ *             A file that was rotated, i.e. the path refers to a new file, or
+ *             truncated and written again is indexed again from its start.
+ *             The latter is recognized by the bytes in front of the tail
+ *             cursor, which no longer match.
+ * @ingroup    src
+ */
+class LogStore {
+  public:
+    explicit LogStore(std::string default_context);
+
+    /**
+     * @brief      Opens the given file and drops the previous index.
+     */
+    bool open(const QString& file_path);
+    void close();
+    bool isOpen() const;
+
+    /**
+     * @brief      Indexes the data appended since the last update.
+     * @param      reset  If given, set to whether the file was rotated or
+     *                    replaced and the index was rebuilt from its start.
+     * @return     The range [first, last) of lines that are new or have grown.
+     *             Empty if the file could not be read.
+     */
+    std::pair<quint32, quint32> update(bool *reset = nullptr);
+
+    quint32 lineCount() const;
+    bool isComplete(quint32 line_number) const;
+
+    /**
+     * @brief      Decodes the message of a line, including its newline. Empty or
+     *             cut short if the file was truncated since the last update.
+     */
+    QString message(quint32 line_number) const;
+    const std::string& context(quint32 line_number) const;
+
+    /**
+     * @return     The memory used by the index in bytes, without the mapping.
+     */
+    std::size_t indexMemory() const;
+
+    /**
+     * @brief      Amount of data that is read at once if the file can not be mapped.
+     */
+    const static qint64 CHUNK_SIZE = 16 * 1024 * 1024;
+
+    /**
+     * @brief      Number of bytes in front of the tail cursor that must be
+     *             unchanged on the next update.
+     */
+    const static qint64 FINGERPRINT_SIZE = 64;
+
+  private:
+    struct Line {
+      qint64 offset;
+      quint32 length;
+      quint32 context;
+    };
+
+    // device and inode of the file behind the path, zero if unknown
+    struct FileId {
+      quint64 device = 0;
+      quint64 inode = 0;
+
+      bool operator==(const FileId& other) const = default;
+    };
+
+    void restart();
+    FileId pathId() const;
+    bool isReplaced(qint64 size) const;
+    bool remap(qint64 size);
+    qint64 scan(const char *data, qint64 base, qint64 size, bool at_end);
+    void addLine(const char *begin, const char *end, qint64 offset);
+    quint32 contextId(std::string_view name);
+
+    const std::string default_context;
+    mutable QFile file;
+    FileId file_id;
+    const uchar *mapping = nullptr;
+    qint64 mapped_size = 0;
+
+    std::vector<Line> lines;
+    std::vector<std::string> contexts;
+    std::unordered_map<std::string, quint32> context_ids;
+    quint32 last_context = 0;
+
+    // start of the first line that is not complete yet
+    qint64 tail = 0;
+    bool tail_incomplete = false;
+    QByteArray tail_fingerprint;
+};
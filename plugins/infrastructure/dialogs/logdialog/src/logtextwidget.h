@@ -15,39 +15,31 @@
 #pragma once
 
 #include <QWidget>
-#include <framework/enhanced/coloredterminalwidget.h>
+#include <framework/enhanced/terminalview.h>
 
 class LogContent;
 
 /**
- * @brief      This widget extends a text widget with a area on the left showing a colored rectangle
- *             with a color unique to the context.
- *             See https://stackoverflow.com/a/24596246/3997725
- *             and https://doc.qt.io/qt-5/qtwidgets-widgets-codeeditor-example.html
+ * @brief      This widget extends a terminal view with a area on the left showing a colored rectangle
+ *             with a color unique to the context of each line.
  * @ingroup    src
  */
-class LogTextWidget : public ColoredTerminalWidget {
+class LogTextWidget : public TerminalView {
   Q_OBJECT
 
   public:
     explicit LogTextWidget(QWidget *parent = nullptr);
 
-    void logContextAreaPaintEvent(QPaintEvent *event);
-    int getLogContextAreaWidth() const;
-    void setCurrentContent(const LogContent* context);
+    void setCurrentContent(const LogContent* content);
+    const LogContent* getCurrentContent() const;
 
   protected:
-    void resizeEvent(QResizeEvent* event) override;
-
-  private Q_SLOTS:
-    void updateLogContextAreaWidth(int block_count);
-    void updateLogContextArea();
+    int marginWidth() const override;
+    void paintMargin(QPainter& painter, int line_number, const QRect& rect) override;
 
   private:
-    int getFirstVisibleBlockId();
     static QColor stringToColor(const std::string& str);
     static void adjustBrightness(QColor& color, int minBrightness);
 
-    QWidget *log_context_area;
     const LogContent *current_content;
 };
@@ -42,3 +42,4 @@ PLUGIN_AUTHORS(Matthieu Laqua)
 PLUGIN_NAME(RegisterToolDialog)
 PLUGIN_DESCRIPTION(Provides a dialog in which the user is able add an external tool to the tools.txt)
 PLUGIN_NAMESPACE(/plugins/infrastructure/dialogs/registertooldialog)
+PLUGIN_LOAD_ON_DEMAND()
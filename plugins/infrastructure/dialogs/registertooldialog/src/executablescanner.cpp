@@ -0,0 +1,61 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <QDateTime>
+#include <QDir>
+#include <QFileInfo>
+
+#include "executablescanner.h"
+
+QList<ExecutableEntry> ExecutableScanner::scan(const QStringList& directories) {
+  QList<ExecutableEntry> result;
+  for (const auto& directory : directories) {
+    if (directory.isEmpty()) {
+      continue;
+    }
+    result.append(listing(directory).entries);
+  }
+  return result;
+}
+
+void ExecutableScanner::clear() {
+  listings.clear();
+}
+
+const ExecutableScanner::Listing& ExecutableScanner::listing(const QString& directory) {
+  QFileInfo directoryInfo(directory);
+  qint64 mtime = directoryInfo.exists() ? directoryInfo.lastModified().toMSecsSinceEpoch() : -1;
+
+  Listing& cached = listings[directory];
+  if (cached.mtime == mtime && mtime != -1) {
+    return cached;
+  }
+
+  cached.mtime = mtime;
+  cached.entries.clear();
+  listed++;
+
+  QDir pathDir(directory);
+  for (const auto& executableName : pathDir.entryList(QDir::Files | QDir::Executable)) {
+    QFileInfo executableFileInfo(directory + QDir::separator() + executableName);
+
+    ExecutableEntry entry;
+    entry.name = executableName;
+    entry.directory = directory;
+    entry.canonicalPath = executableFileInfo.canonicalFilePath();
+    entry.symlink = executableFileInfo.isSymLink();
+    cached.entries.append(entry);
+  }
+  return cached;
+}
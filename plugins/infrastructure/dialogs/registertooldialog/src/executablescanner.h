@@ -0,0 +1,71 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QHash>
+#include <QList>
+#include <QString>
+#include <QStringList>
+
+/**
+ * @brief      An executable found in one of the search directories.
+ * @ingroup    tooldialog
+ */
+struct ExecutableEntry {
+  QString name;
+  QString directory;
+  QString canonicalPath;
+  bool    symlink = false;
+};
+
+/**
+ * @brief      Lists the executables in the search directories.
+ *
+ *             The listing of every directory is kept together with the
+ *             modification time of the directory, a directory is only
+ *             listed again once files were added, removed or renamed in
+ *             it. Changed permissions of a file do not touch the
+ *             directory, clear() forces a complete scan.
+ * @ingroup    tooldialog
+ */
+class ExecutableScanner {
+
+  public:
+    /**
+     * @return     The executables of all directories, in the order of the
+     *             directories
+     */
+    QList<ExecutableEntry> scan(const QStringList& directories);
+
+    void clear();
+
+    /**
+     * @brief      Number of directories actually listed by the scans so far.
+     */
+    int listedDirectories() const {
+      return listed;
+    }
+
+  private:
+    struct Listing {
+      qint64 mtime = -1;
+      QList<ExecutableEntry> entries;
+    };
+
+    const Listing& listing(const QString& directory);
+
+    QHash<QString, Listing> listings;
+    int listed = 0;
+};
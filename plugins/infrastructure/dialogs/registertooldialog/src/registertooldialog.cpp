@@ -27,16 +27,12 @@
 #include <QDir>
 #include <QFile>
 #include <QFileDialog>
-#include <QtConcurrent/QtConcurrentMap>
-#include <QFutureWatcher>
-#include <QThreadPool>
 #include <QProgressDialog>
-#include <QProcess>
-#include <QDomDocument>
 
 #include <framework/enhanced/qlineeditclearable.h>
 
 #include "searchdirectorydialog.h"
+#include "xmlhelpprober.h"
 
 #include "registertooldialog.h"
 
@@ -153,6 +149,8 @@ RegisterToolDialog::RegisterToolDialog(LibFramework::PluginManagerInterface* plu
   });
 
   connect(resetListTree, &QPushButton::clicked, this, [this] {
+    executableScanner.clear();
+    XmlhelpProber::clearStoredResults();
     reinitialize(true);
     filterToolListTree(searchFilterEdit->text());
   });
@@ -203,18 +201,11 @@ void RegisterToolDialog::checkTool(const QString &filepath, bool *executable, bo
 QMap<QString, ExecutableInfo*> RegisterToolDialog::findAllExecutables(const QStringList& searchDirs) {
   QMap<QString, ExecutableInfo*> result;
 
-  // iterate over list entries
-  for (const auto& pathEntry : searchDirs) {
-    QDir pathDir(pathEntry);
-
-    // iterate over every executable file in this path entry
-    for (const auto& executableName : pathDir.entryList(QDir::Files | QDir::Executable)) {
-      QFileInfo executableFileInfo(pathEntry + QDir::separator() + executableName);
-
-      // if it is a proper file or if the target of the symlink wasn't yet added, insert the entry
-      if (!executableFileInfo.isSymLink() || !result.contains(executableFileInfo.canonicalFilePath())) {
-        result.insert(executableFileInfo.canonicalFilePath(), new ExecutableInfo(executableName, pathEntry, false, true));
-      }
+  // unchanged directories are served from the listings of the last scan
+  for (const auto& entry : executableScanner.scan(searchDirs)) {
+    // if it is a proper file or if the target of the symlink wasn't yet added, insert the entry
+    if (!entry.symlink || !result.contains(entry.canonicalPath)) {
+      result.insert(entry.canonicalPath, new ExecutableInfo(entry.name, entry.directory, false, true));
     }
   }
 
@@ -474,28 +465,38 @@ bool RegisterToolDialog::applyChangesAndRegisterTools() {
   }
 
   // check for xmlhelp (and executable status)
+  QMultiHash<QString, ExecutableInfo*> pendingChecks;
+  for (auto* item : additions) {
+    pendingChecks.insert(item->getPath() + QDir::separator() + item->getName(), item);
+  }
 
-  // Create a progress dialog.
+  XmlhelpProber prober;
   QProgressDialog dialog;
-  dialog.setLabelText(tr("Checking tools using %1 thread(s)...").arg(QThread::idealThreadCount()));
-
-  // Create a QFutureWatcher and connect signals and slots.
-  // Monitor progress changes of the future
-  QFutureWatcher<void> futureWatcher;
-  QObject::connect(&futureWatcher, SIGNAL(finished()), &dialog, SLOT(reset()));
-  QObject::connect(&dialog, SIGNAL(canceled()), &futureWatcher, SLOT(cancel()));
-  QObject::connect(&futureWatcher, SIGNAL(progressRangeChanged(int,int)), &dialog, SLOT(setRange(int,int)));
-  QObject::connect(&futureWatcher, SIGNAL(progressValueChanged(int)), &dialog, SLOT(setValue(int)));
+  const QString labelText = tr("Checking tools using %1 process(es)...").arg(prober.maximumProcesses());
+  dialog.setLabelText(labelText);
+  const QStringList paths = pendingChecks.uniqueKeys();
+  dialog.setRange(0, paths.size());
+
+  // results arrive one by one while the dialog is shown
+  QObject::connect(&prober, &XmlhelpProber::probed, &dialog, [&](const XmlhelpProbeResult& result) {
+    for (auto* item : pendingChecks.values(result.path)) {
+      item->executable = result.executable;
+      item->xmlhelpPresent = result.xmlhelpPresent;
+    }
+    dialog.setLabelText(labelText + "\n" + QFileInfo(result.path).fileName());
+  });
+  QObject::connect(&prober, &XmlhelpProber::progress, &dialog, [&dialog](int done, int) {
+    dialog.setValue(done);
+  });
+  QObject::connect(&prober, &XmlhelpProber::finished, &dialog, &QProgressDialog::reset);
+  QObject::connect(&dialog, &QProgressDialog::canceled, &prober, &XmlhelpProber::cancel);
 
-  // Start the computation.
-  futureWatcher.setFuture(QtConcurrent::map(additions, RegisterToolDialog::checkToolForXmlhelp));
+  prober.probe(paths);
 
   // Display the dialog and start the event loop.
   dialog.exec();
 
-  futureWatcher.waitForFinished();
-
-  if (futureWatcher.future().isCanceled()) {
+  if (dialog.wasCanceled()) {
     return false;
   }
 
@@ -560,32 +561,10 @@ bool RegisterToolDialog::applyChangesAndRegisterTools() {
 }
 
 bool RegisterToolDialog::checkToolForXmlhelp(ExecutableInfo* executableInfo) {
-  QString toolFilePath(executableInfo->getPath() + QDir::separator() + executableInfo->getName());
-  QProcess proc;
-
-  // check executable status
-  QFileInfo toolFileInfo(toolFilePath);
-  executableInfo->executable = toolFileInfo.isExecutable();
-
-  if (!executableInfo->executable) {
-    return false; // if not executable don't check for xmlhelp
-  }
-
-  // check for xmlhelp
-  proc.start(toolFilePath, { "--xmlhelp" });
-  if (!proc.waitForFinished()) { // timeout, check unsuccessful
-    qWarning() << "Timeout when trying to request XML description";
-    proc.kill();
-    return false;
-  }
-
-  QString output = proc.readAllStandardOutput();
-  proc.close();
-
-  QDomDocument testdoc;
-  executableInfo->xmlhelpPresent = testdoc.setContent(output);
-
-  return executableInfo->xmlhelpPresent;
+  XmlhelpProbeResult result = XmlhelpProber::probeBlocking(executableInfo->getPath() + QDir::separator() + executableInfo->getName());
+  executableInfo->executable = result.executable;
+  executableInfo->xmlhelpPresent = result.xmlhelpPresent;
+  return result.xmlhelpPresent;
 }
 
 bool RegisterToolDialog::appendToolToToolstxt(const ExecutableInfo& executableInfo) {
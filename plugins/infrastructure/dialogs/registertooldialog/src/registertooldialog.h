@@ -27,6 +27,7 @@ class QDialogButtonBox;
 #include <framework/pluginframework/pluginmanagerinterface.h>
 
 #include "registertooldialoginterface.h"
+#include "executablescanner.h"
 
 
 #define TOOLS_TXT_PATH ".kadistudio" + QDir::separator() + "tools.txt"
@@ -116,4 +117,5 @@ private:
   QDialogButtonBox *bottomButtonBox;
 
   QMap<QString, ExecutableInfo*> *allTools;
+  ExecutableScanner executableScanner;
 };
@@ -0,0 +1,290 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <algorithm>
+
+#include <QDateTime>
+#include <QDebug>
+#include <QDir>
+#include <QDomDocument>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QProcess>
+#include <QSaveFile>
+#include <QThread>
+#include <QTimer>
+
+#include "xmlhelpprober.h"
+
+XmlhelpProber::XmlhelpProber(QObject *parent)
+    : XmlhelpProber(defaultCacheFile(), parent) {
+}
+
+XmlhelpProber::XmlhelpProber(const QString& cachefile, QObject *parent)
+    : QObject(parent), maximum(QThread::idealThreadCount()), timeoutMsecs(DEFAULT_TIMEOUT), done(0), total(0),
+      scheduled(false), cachefile(cachefile), loaded(false), modified(false) {
+  qRegisterMetaType<XmlhelpProbeResult>();
+}
+
+XmlhelpProber::~XmlhelpProber() {
+  // kill all before waiting, so that hanging tools are waited for at once
+  for (auto it = running.begin(); it != running.end(); ++it) {
+    disconnect(it.key(), nullptr, this, nullptr);
+    it.key()->kill();
+  }
+  for (auto it = running.begin(); it != running.end(); ++it) {
+    it.key()->waitForFinished(1000);
+    delete it.key();
+  }
+  running.clear();
+  save();
+}
+
+void XmlhelpProber::setMaximumProcesses(int count) {
+  maximum = std::max(1, count);
+}
+
+int XmlhelpProber::maximumProcesses() const {
+  return maximum;
+}
+
+void XmlhelpProber::setTimeout(int msecs) {
+  timeoutMsecs = msecs;
+}
+
+int XmlhelpProber::timeout() const {
+  return timeoutMsecs;
+}
+
+void XmlhelpProber::probe(const QStringList& paths) {
+  queue.append(paths);
+  total += paths.size();
+
+  if (!scheduled) {
+    scheduled = true;
+    QMetaObject::invokeMethod(this, &XmlhelpProber::startNext, Qt::QueuedConnection);
+  }
+}
+
+void XmlhelpProber::cancel() {
+  total -= queue.size();
+  queue.clear();
+
+  for (auto it = running.begin(); it != running.end(); ++it) {
+    it.value().canceled = true;
+    it.key()->kill();
+  }
+}
+
+bool XmlhelpProber::isRunning() const {
+  return scheduled || !running.isEmpty();
+}
+
+int XmlhelpProber::runningProcesses() const {
+  return running.size();
+}
+
+void XmlhelpProber::startNext() {
+  scheduled = false;
+  load();
+
+  while (running.size() < maximum && !queue.isEmpty()) {
+    XmlhelpProbeResult result;
+    result.path = queue.dequeue();
+    result.executable = QFileInfo(result.path).isExecutable();
+
+    if (!result.executable) {
+      report(result);
+      continue;
+    }
+    if (knownWithoutXmlhelp(result.path)) {
+      result.cached = true;
+      report(result);
+      continue;
+    }
+
+    auto *process = new QProcess(this);
+    configure(*process, result.path);
+
+    auto *timer = new QTimer(process);
+    timer->setSingleShot(true);
+    connect(timer, &QTimer::timeout, this, [this, process] {
+      running[process].timedOut = true;
+      process->kill();
+    });
+    connect(process, &QProcess::finished, this, [this, process] {
+      finishProbe(process);
+    });
+    connect(process, &QProcess::errorOccurred, this, [this, process](QProcess::ProcessError error) {
+      // a process failing to start never finishes
+      if (error == QProcess::FailedToStart) {
+        finishProbe(process);
+      }
+    });
+
+    running.insert(process, {result.path, timer});
+    process->start();
+    timer->start(timeoutMsecs);
+  }
+
+  if (running.isEmpty() && queue.isEmpty()) {
+    done = 0;
+    total = 0;
+    save();
+    Q_EMIT finished();
+  }
+}
+
+void XmlhelpProber::finishProbe(QProcess *process) {
+  auto it = running.find(process);
+  if (it == running.end()) return;
+
+  Probe probe = it.value();
+  running.erase(it);
+  probe.timer->stop();
+
+  if (!probe.canceled) {
+    XmlhelpProbeResult result;
+    result.path = probe.path;
+    result.executable = true;
+    result.timedOut = probe.timedOut;
+    result.xmlhelpPresent = !probe.timedOut && isXmlhelp(process->readAllStandardOutput());
+    if (probe.timedOut) {
+      qWarning() << "Timeout when trying to request XML description of" << probe.path;
+    }
+    remember(result);
+    report(result);
+  }
+
+  process->deleteLater();
+  startNext();
+}
+
+void XmlhelpProber::report(const XmlhelpProbeResult& result) {
+  done++;
+  Q_EMIT probed(result);
+  Q_EMIT progress(done, total);
+}
+
+bool XmlhelpProber::knownWithoutXmlhelp(const QString& path) {
+  auto it = storedEntries.constFind(path);
+  if (it == storedEntries.constEnd()) return false;
+
+  QFileInfo fileInfo(path);
+  QJsonObject stored = it.value().toObject();
+  return stored["size"].toInteger() == fileInfo.size() &&
+         stored["mtime"].toInteger() == fileInfo.lastModified().toMSecsSinceEpoch();
+}
+
+void XmlhelpProber::remember(const XmlhelpProbeResult& result) {
+  // a timeout says nothing about the executable, a busy machine must not hide a tool for good
+  if (result.xmlhelpPresent || result.timedOut) {
+    if (storedEntries.contains(result.path)) {
+      storedEntries.remove(result.path);
+      modified = true;
+    }
+    return;
+  }
+
+  QFileInfo fileInfo(result.path);
+  QJsonObject stored;
+  stored["size"]  = fileInfo.size();
+  stored["mtime"] = fileInfo.lastModified().toMSecsSinceEpoch();
+  storedEntries[result.path] = stored;
+  modified = true;
+}
+
+XmlhelpProbeResult XmlhelpProber::probeBlocking(const QString& path, int timeout) {
+  XmlhelpProbeResult result;
+  result.path = path;
+  result.executable = QFileInfo(path).isExecutable();
+  if (!result.executable) {
+    return result; // if not executable don't check for xmlhelp
+  }
+
+  QProcess process;
+  configure(process, path);
+  process.start();
+  if (!process.waitForFinished(timeout)) {
+    if (process.state() != QProcess::NotRunning) {
+      qWarning() << "Timeout when trying to request XML description of" << path;
+      process.kill();
+      process.waitForFinished();
+      result.timedOut = true;
+    }
+    return result;
+  }
+
+  result.xmlhelpPresent = isXmlhelp(process.readAllStandardOutput());
+  return result;
+}
+
+void XmlhelpProber::clearStoredResults(const QString& cachefile) {
+  if (QFile::exists(cachefile) && !QFile::remove(cachefile)) {
+    qWarning() << "Can not remove xmlhelp probe results: " << cachefile;
+  }
+}
+
+QString XmlhelpProber::defaultCacheFile() {
+  return QDir::homePath() + QDir::separator() + ".kadistudio" + QDir::separator() + "xmlhelpprobes.json";
+}
+
+void XmlhelpProber::configure(QProcess& process, const QString& path) {
+  process.setProgram(path);
+  process.setArguments({"--xmlhelp"});
+  // a tool reading stdin would otherwise wait until the timeout
+  process.setStandardInputFile(QProcess::nullDevice());
+  process.setStandardErrorFile(QProcess::nullDevice());
+}
+
+bool XmlhelpProber::isXmlhelp(const QByteArray& output) {
+  QDomDocument testdoc;
+  return static_cast<bool>(testdoc.setContent(output));
+}
+
+void XmlhelpProber::load() {
+  if (loaded) return;
+  loaded = true;
+
+  QFile file(cachefile);
+  if (!file.open(QIODevice::ReadOnly)) return;
+
+  QJsonObject root = QJsonDocument::fromJson(file.readAll()).object();
+  if (root["version"].toInt() != FORMAT_VERSION) {
+    qDebug() << "Discarding xmlhelp probe results with unsupported version" << root["version"].toInt();
+    return;
+  }
+  storedEntries = root["entries"].toObject();
+}
+
+void XmlhelpProber::save() {
+  if (!modified) return;
+  modified = false;
+
+  QDir().mkpath(QFileInfo(cachefile).absolutePath());
+
+  QJsonObject root;
+  root["version"] = FORMAT_VERSION;
+  root["entries"] = storedEntries;
+
+  // write to a temporary file first, a crash must not leave truncated results behind
+  QSaveFile file(cachefile);
+  if (!file.open(QIODevice::WriteOnly)) {
+    qWarning() << "Can not write xmlhelp probe results: " << cachefile;
+    return;
+  }
+  file.write(QJsonDocument(root).toJson(QJsonDocument::Compact));
+  file.commit();
+}
@@ -0,0 +1,138 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QHash>
+#include <QJsonObject>
+#include <QObject>
+#include <QQueue>
+#include <QString>
+#include <QStringList>
+
+class QProcess;
+class QTimer;
+
+/**
+ * @brief      Outcome of asking an executable for its --xmlhelp output.
+ * @ingroup    tooldialog
+ */
+struct XmlhelpProbeResult {
+  QString path;
+  bool executable     = false;
+  bool xmlhelpPresent = false;
+  bool timedOut       = false;
+  bool cached         = false; ///< negative result of an earlier scan, the executable was not run
+};
+
+/**
+ * @brief      Probes executables for the --xmlhelp option.
+ *
+ *             Queued executables are run asynchronously with at most
+ *             maximumProcesses() of them at once. Their stdin is closed,
+ *             so that executables waiting for input finish right away,
+ *             and every probe is killed after timeout() milliseconds.
+ *             Results are reported one by one as they arrive.
+ *
+ *             Negative results are stored together with the size and
+ *             modification time of the executable, later scans only run
+ *             the executables which changed since. Timeouts are not
+ *             stored, the executable is run again by the next scan.
+ * @ingroup    tooldialog
+ */
+class XmlhelpProber : public QObject {
+    Q_OBJECT
+
+  public:
+    explicit XmlhelpProber(QObject *parent = nullptr);
+    XmlhelpProber(const QString& cachefile, QObject *parent = nullptr);
+    ~XmlhelpProber() override;
+
+    void setMaximumProcesses(int count);
+    int maximumProcesses() const;
+    void setTimeout(int msecs);
+    int timeout() const;
+
+    /**
+     * @brief      Queues executables, the probes start once the event loop
+     *             is entered.
+     */
+    void probe(const QStringList& paths);
+
+    /**
+     * @brief      Kills the running probes and drops the queued ones. A
+     *             running scan still emits finished() once the killed
+     *             processes are gone, canceled probes are not reported.
+     */
+    void cancel();
+
+    bool isRunning() const;
+    int runningProcesses() const;
+
+    /**
+     * @brief      Runs a single probe and waits for it, for callers outside
+     *             of an event loop. Does not use the stored results.
+     */
+    static XmlhelpProbeResult probeBlocking(const QString& path, int timeout = DEFAULT_TIMEOUT);
+
+    /**
+     * @brief      Forgets the stored results, the next scan runs every
+     *             executable again.
+     */
+    static void clearStoredResults(const QString& cachefile = defaultCacheFile());
+    static QString defaultCacheFile();
+
+    const static int DEFAULT_TIMEOUT = 10000;
+    const static int FORMAT_VERSION = 1;
+
+  Q_SIGNALS:
+    void probed(const XmlhelpProbeResult& result);
+    void progress(int done, int total);
+    void finished();
+
+  private:
+    struct Probe {
+      QString path;
+      QTimer *timer;
+      bool timedOut = false;
+      bool canceled = false;
+    };
+
+    void startNext();
+    void finishProbe(QProcess *process);
+    void report(const XmlhelpProbeResult& result);
+    bool knownWithoutXmlhelp(const QString& path);
+    void remember(const XmlhelpProbeResult& result);
+
+    static void configure(QProcess& process, const QString& path);
+    static bool isXmlhelp(const QByteArray& output);
+
+    void load();
+    void save();
+
+    QQueue<QString> queue;
+    QHash<QProcess *, Probe> running;
+    int maximum;
+    int timeoutMsecs;
+    int done;
+    int total;
+    bool scheduled;
+
+    QString cachefile;
+    bool loaded;
+    bool modified;
+    QJsonObject storedEntries;
+};
+
+Q_DECLARE_METATYPE(XmlhelpProbeResult)
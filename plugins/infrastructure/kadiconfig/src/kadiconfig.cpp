@@ -12,6 +12,8 @@
  * See the License for the specific language governing permissions and
  * limitations under the License. */
 
+#include <memory>
+
 #include <QtWidgets>
 #include <unistd.h>
 
@@ -516,16 +518,19 @@ bool KadiConfig::saveKadiConfig(KadiInstanceListItem* item) {
   return true;
 }
 
-QString KadiConfig::testKadiInstance(const QString& host, const QString& token) {
+QString KadiConfig::testKadiInstance(const QString& host, const QString& token, int timeout) {
   QNetworkAccessManager networkAccessManager;
 
-  auto url = host + (host.endsWith("/") ? "" : "/") + "api/records";
-  QNetworkRequest request((QUrl(url)));
+  // one record is enough to know the token works, instances with many records answer as fast
+  QUrl url(host + (host.endsWith("/") ? "" : "/") + "api/records");
+  url.setQuery("per_page=1");
+  QNetworkRequest request(url);
   request.setRawHeader("Authorization", (QString("Bearer ") + token).toUtf8());
+  request.setTransferTimeout(timeout);
 
-  auto *reply = networkAccessManager.get(request);
+  std::unique_ptr<QNetworkReply> reply(networkAccessManager.get(request));
   QEventLoop eventLoop;
-  connect(reply, &QNetworkReply::finished, &eventLoop, &QEventLoop::quit);
+  connect(reply.get(), &QNetworkReply::finished, &eventLoop, &QEventLoop::quit);
   eventLoop.exec();
 
   if (reply->error() == QNetworkReply::NoError) {
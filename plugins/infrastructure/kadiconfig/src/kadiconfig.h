@@ -90,6 +90,14 @@ public:
 
   KadiInstance getDefaultInstance() override;
 
+  static const int TEST_TIMEOUT = 15000;
+
+  /**
+   * @brief      Checks the host and token by listing a single record.
+   * @return     An empty string if the instance answered, the error otherwise.
+   */
+  static QString testKadiInstance(const QString& host, const QString& token, int timeout = TEST_TIMEOUT);
+
   void keyPressEvent(QKeyEvent* e) override;
   void closeEvent(QCloseEvent* e) override;
 
@@ -136,7 +144,5 @@ private:
   bool checkForUnsavedChanges(KadiInstanceListItem* item);
   bool saveKadiConfig(KadiInstanceListItem* item);
 
-  static QString testKadiInstance(const QString& host, const QString& token);
-
   void currentInstanceChanged();
 };
@@ -38,7 +38,7 @@ public:
 
   virtual void applyFilter(const QString& filter) = 0;
 
-  virtual QVector<RecordInfo>& getAllRecords() = 0;
+  virtual const QVector<RecordInfo>& getAllRecords() const = 0;
 
   virtual void selectFile(const QString& filepath) = 0;
   virtual void setFilename(const QString& instancename, const QString& recordidentifier, const QString& filename) = 0;
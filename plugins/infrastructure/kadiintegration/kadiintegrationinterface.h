@@ -20,8 +20,11 @@
 #include <framework/pluginframework/pluginclientinterface.h>
 
 #include "downloadfromkadidialoginterface.h"
+#include "kaditransferinterface.h"
 #include "uploadtokadidialoginterface.h"
 
+struct KadiInstance;
+
 
 /**
  * @ingroup    kadiintegration
@@ -37,6 +40,7 @@ public:
 
   virtual DownloadFromKadiDialogInterface* createDownloadFromKadiDialog() = 0;
   virtual UploadToKadiDialogInterface* createUploadToKadiDialog() = 0;
+  virtual KadiTransferInterface* createTransfer(const KadiInstance& instance) = 0;
 
   virtual bool getRecordIdentifier(const QString &filepath, QString& kadiInstanceName, QString& recordIdentifier, QString& kadifilename) = 0;
 
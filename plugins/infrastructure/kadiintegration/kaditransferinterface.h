@@ -0,0 +1,72 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QByteArray>
+#include <QString>
+
+class QFileDevice;
+class QIODevice;
+
+/**
+ * @brief      Streams files between KadiStudio and a Kadi instance.
+ *
+ *             Files are transferred in chunks, the memory used does not
+ *             depend on the file size. Interrupted requests are retried
+ *             and continue where they stopped. The calls block in a local
+ *             event loop until the transfer is finished.
+ * @ingroup    kadiintegration
+ */
+class KadiTransferInterface {
+
+public:
+  virtual ~KadiTransferInterface() = default;
+
+  /**
+   * @brief      Downloads a file, appending to the content target already
+   *             holds, so that a partial download is continued.
+   * @param      checksum  Expected MD5 of the whole file, the download
+   *                       fails if the content does not match.
+   * @param      etag      ETag of a copy the caller already has, nothing is
+   *                       downloaded if it is still current, see notModified().
+   */
+  virtual bool download(const QString& url, QFileDevice* target, const QString& checksum = QString(),
+                        const QString& etag = QString()) = 0;
+
+  /**
+   * @brief      Uploads the content of source as a file of a record.
+   * @param      source   Must stay open and be seekable until the upload
+   *                      is finished.
+   * @param      replace  Replaces a file with the same name, otherwise the
+   *                      upload fails with HTTP status 409.
+   */
+  virtual bool upload(const QString& recordIdentifier, const QString& filename, QIODevice* source, bool replace = false) = 0;
+
+  virtual bool notModified() const = 0;
+  virtual QString etag() const = 0;
+
+  /**
+   * @return     MD5 of the downloaded file.
+   */
+  virtual QByteArray md5() const = 0;
+
+  /**
+   * @return     HTTP status of the last response, 0 without a response.
+   */
+  virtual int httpStatus() const = 0;
+
+  virtual QString errorString() const = 0;
+
+};
@@ -0,0 +1,595 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+#include <algorithm>
+
+#include <QCryptographicHash>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QNetworkReply>
+#include <QNetworkRequest>
+#include <QRegularExpression>
+#include <QSaveFile>
+#include <QTimer>
+#include <QUrl>
+#include <QUrlQuery>
+
+#include "../utils/kadiutils.h"
+#include "recordcatalog.h"
+
+namespace {
+
+// the catalog is stored in the format of the API, so that both are read the same way
+RecordFileInfo parseFile(const QJsonObject& item) {
+  return {
+    .uuid = QUuid(item["id"].toString()),
+    .fileName = item["name"].toString(),
+    .lastModified = QDateTime::fromString(item["last_modified"].toString(), Qt::ISODate),
+    .fileDownloadApiLink = item["_links"].toObject()["download"].toString(),
+    .recordApiLink = item["_links"].toObject()["record"].toString(),
+    .mimeType = item["mimetype"].toString(),
+    .magicMimeType = item["magic_mimetype"].toString(),
+    .checksum = item["checksum"].toString(),
+    .size = static_cast<long>(item["size"].toInteger()),
+  };
+}
+
+QJsonObject fileObject(const RecordFileInfo& file) {
+  QJsonObject item;
+  item["id"] = file.uuid.toString(QUuid::WithoutBraces);
+  item["name"] = file.fileName;
+  item["last_modified"] = file.lastModified.toString(Qt::ISODateWithMs);
+  item["_links"] = QJsonObject {{"download", file.fileDownloadApiLink}, {"record", file.recordApiLink}};
+  item["mimetype"] = file.mimeType;
+  item["magic_mimetype"] = file.magicMimeType;
+  item["checksum"] = file.checksum;
+  item["size"] = static_cast<qint64>(file.size);
+  return item;
+}
+
+RecordInfo parseRecord(const QJsonObject& item) {
+  RecordInfo record = {
+    .id = item["id"].toInt(),
+    .identifier = item["identifier"].toString(),
+    .title = item["title"].toString(),
+    .authorDisplayName = item["creator"].toObject()["displayname"].toString(),
+    .description = item["description"].toString(),
+    .filesApiLink = item["_links"].toObject()["files"].toString(),
+    .lastModified = QDateTime::fromString(item["last_modified"].toString(), Qt::ISODate),
+    .files = {},
+    .filesAlreadyFetched = false,
+    .type = {},
+    .license = ""
+  };
+  for (const QJsonValue& tag : item["tags"].toArray()) {
+    record.tags.append(tag.toString());
+  }
+  return record;
+}
+
+QJsonObject recordObject(const RecordInfo& record) {
+  QJsonArray files;
+  for (const RecordFileInfo& file : record.files) {
+    files.append(fileObject(file));
+  }
+
+  QJsonObject item;
+  item["id"] = static_cast<qint64>(record.id);
+  item["identifier"] = record.identifier;
+  item["title"] = record.title;
+  item["creator"] = QJsonObject {{"displayname", record.authorDisplayName}};
+  item["description"] = record.description;
+  item["_links"] = QJsonObject {{"files", record.filesApiLink}};
+  item["last_modified"] = record.lastModified.toString(Qt::ISODateWithMs);
+  item["tags"] = QJsonArray::fromStringList(record.tags);
+  item["files"] = files;
+  item["files_fetched"] = record.filesAlreadyFetched;
+  return item;
+}
+
+bool sameRecord(const RecordInfo& lhs, const RecordInfo& rhs) {
+  return lhs.id == rhs.id && lhs.title == rhs.title && lhs.authorDisplayName == rhs.authorDisplayName &&
+         lhs.description == rhs.description && lhs.filesApiLink == rhs.filesApiLink &&
+         lhs.lastModified == rhs.lastModified && lhs.tags == rhs.tags;
+}
+
+}
+
+RecordCatalog::RecordCatalog(const KadiInstance& instance, const QString& directory, QObject *parent)
+    : QObject(parent), kadiInstance(instance), directory(directory), active(0), generation(0), refreshing(false),
+      prefetchFiles(false), dirty(false), concurrentRequests(DEFAULT_CONCURRENT_REQUESTS),
+      retries(DEFAULT_MAXIMUM_RETRIES), perPage(DEFAULT_PAGE_SIZE), pagesTotal(0), pagesLoaded(0), recordsTotal(0),
+      pagesFailed(false), consistent(true) {
+  networkAccessManager.setTransferTimeout();
+  load();
+}
+
+RecordCatalog::~RecordCatalog() {
+  cancel();
+  if (dirty) {
+    save();
+  }
+}
+
+QString RecordCatalog::defaultDirectory() {
+  return QDir::homePath() + QDir::separator() + ".kadistudio" + QDir::separator() + "kadirecords";
+}
+
+const KadiInstance& RecordCatalog::instance() const {
+  return kadiInstance;
+}
+
+const QVector<RecordInfo>& RecordCatalog::records() const {
+  return recordList;
+}
+
+int RecordCatalog::indexOf(const QString& identifier) const {
+  return indexes.value(identifier, -1);
+}
+
+void RecordCatalog::refresh() {
+  cancel();
+
+  refreshing = true;
+  seen.clear();
+  pagesTotal = 0;
+  pagesLoaded = 0;
+  recordsTotal = 0;
+  pagesFailed = false;
+  consistent = true;
+  error.clear();
+
+  // the number of pages is known with the first one
+  enqueue({RecordPage, 1, QString(), 0});
+  pump();
+}
+
+void RecordCatalog::fetchFiles(int record) {
+  if (record < 0 || record >= recordList.size()) return;
+  const QString identifier = recordList[record].identifier;
+
+  // a queued prefetch moves to the front, the user is waiting for it
+  auto queued = std::find_if(queue.begin(), queue.end(), [&identifier](const Job& job) {
+    return job.kind == FilePage && job.identifier == identifier;
+  });
+  if (queued != queue.end()) {
+    Job job = *queued;
+    queue.erase(queued);
+    enqueue(job, true);
+    return;
+  }
+
+  // running or already fetched during this refresh
+  if (requestedFiles.contains(identifier)) return;
+
+  requestedFiles.insert(identifier);
+  enqueue({FilePage, 1, identifier, 0}, true);
+  pump();
+}
+
+void RecordCatalog::cancel() {
+  // replies and retries of earlier generations are dropped when they come in
+  generation++;
+  queue.clear();
+  active = 0;
+  refreshing = false;
+  requestedFiles.clear();
+  pendingFiles.clear();
+
+  const QSet<QNetworkReply *> aborted = running;
+  running.clear();
+  for (QNetworkReply *reply : aborted) {
+    reply->abort();
+  }
+}
+
+bool RecordCatalog::isRefreshing() const {
+  return refreshing;
+}
+
+QVector<int> RecordCatalog::search(const QString& query, const QString& mimetype) const {
+  static const QRegularExpression termexpression("\"([^\"]*)\"|(\\S+)");
+
+  QStringList terms;
+  QRegularExpressionMatchIterator it = termexpression.globalMatch(query.toCaseFolded());
+  while (it.hasNext()) {
+    QRegularExpressionMatch match = it.next();
+    QString term = match.capturedStart(1) >= 0 ? match.captured(1) : match.captured(2);
+    if (!term.isEmpty()) {
+      terms.append(term);
+    }
+  }
+
+  QVector<int> matches;
+  for (int record = 0; record < recordList.size(); ++record) {
+    const QString& haystack = haystacks[record];
+    bool match = std::all_of(terms.begin(), terms.end(), [&haystack](const QString& term) {
+      return haystack.contains(term);
+    });
+
+    const RecordInfo& info = recordList[record];
+    if (match && !mimetype.isEmpty() && info.filesAlreadyFetched) {
+      match = std::any_of(info.files.begin(), info.files.end(), [&mimetype](const RecordFileInfo& file) {
+        return file.mimeType == mimetype || file.magicMimeType == mimetype;
+      });
+    }
+
+    if (match) {
+      matches.append(record);
+    }
+  }
+  return matches;
+}
+
+void RecordCatalog::setFilesPrefetched(bool prefetched) {
+  prefetchFiles = prefetched;
+}
+
+bool RecordCatalog::filesPrefetched() const {
+  return prefetchFiles;
+}
+
+void RecordCatalog::setMaximumConcurrentRequests(int requests) {
+  concurrentRequests = std::max(1, requests);
+}
+
+int RecordCatalog::maximumConcurrentRequests() const {
+  return concurrentRequests;
+}
+
+void RecordCatalog::setMaximumRetries(int retries) {
+  this->retries = retries;
+}
+
+int RecordCatalog::maximumRetries() const {
+  return retries;
+}
+
+void RecordCatalog::setPageSize(int size) {
+  // Kadi does not return more than 100 items per page
+  perPage = std::clamp(size, 1, 100);
+}
+
+int RecordCatalog::pageSize() const {
+  return perPage;
+}
+
+QString RecordCatalog::errorString() const {
+  return error;
+}
+
+void RecordCatalog::enqueue(const Job& job, bool first) {
+  if (first) {
+    queue.push_front(job);
+  } else {
+    queue.push_back(job);
+  }
+}
+
+void RecordCatalog::pump() {
+  while (active < concurrentRequests && !queue.empty()) {
+    Job job = queue.front();
+    queue.pop_front();
+
+    active++;
+    if (!start(job)) {
+      active--;
+    }
+  }
+
+  if (active == 0 && queue.empty()) {
+    if (dirty) {
+      save();
+    }
+    if (refreshing) {
+      refreshing = false;
+      Q_EMIT finished(!pagesFailed && error.isEmpty());
+    }
+  }
+}
+
+bool RecordCatalog::start(const Job& job) {
+  QString url;
+  if (job.kind == RecordPage) {
+    url = recordsUrl(job.page);
+  } else {
+    // the record may have been deleted meanwhile
+    int record = indexOf(job.identifier);
+    if (record < 0) return false;
+    url = filesUrl(recordList[record], job.page);
+  }
+
+  QNetworkRequest request((QUrl(url)));
+  request.setRawHeader("Authorization", (QString("Bearer ") + kadiInstance.token).toUtf8());
+
+  QNetworkReply *reply = networkAccessManager.get(request);
+  running.insert(reply);
+
+  connect(reply, &QNetworkReply::finished, this, [this, reply, job, current = generation]() {
+    reply->deleteLater();
+    if (current != generation) return;
+
+    running.remove(reply);
+    jobFinished(job, reply);
+  });
+  return true;
+}
+
+void RecordCatalog::jobFinished(const Job& job, QNetworkReply *reply) {
+  // the slot stays taken while waiting, the server asked for fewer requests
+  if (kadiutils::isTransientError(reply) && job.attempt < retries) {
+    int delay = kadiutils::retryDelay(reply, job.attempt);
+    qDebug() << "Retrying" << reply->url() << "in" << delay << "ms:" << reply->errorString();
+
+    Job retry = job;
+    retry.attempt++;
+    QTimer::singleShot(delay, this, [this, retry, current = generation]() {
+      if (current != generation) return;
+      if (!start(retry)) {
+        active--;
+        pump();
+      }
+    });
+    return;
+  }
+
+  active--;
+
+  QJsonParseError parseerror;
+  QJsonObject page = QJsonDocument::fromJson(reply->readAll(), &parseerror).object();
+  if (reply->error() != QNetworkReply::NoError || parseerror.error != QJsonParseError::NoError) {
+    QString description = page["description"].toString();
+    error = description.isEmpty() ? reply->errorString() : description;
+    qWarning() << "Fetching" << reply->url() << "failed:" << error;
+
+    if (job.kind == RecordPage) {
+      pagesFailed = true;
+    } else {
+      // expanding the record asks again
+      requestedFiles.remove(job.identifier);
+      pendingFiles.remove(job.identifier);
+    }
+  } else if (job.kind == RecordPage) {
+    recordPageReceived(job, page);
+  } else {
+    filePageReceived(job, page);
+  }
+
+  pump();
+}
+
+void RecordCatalog::recordPageReceived(const Job& job, const QJsonObject& page) {
+  QJsonObject pagination = page["_pagination"].toObject();
+  int total = pagination["total_items"].toInt();
+
+  if (job.page == 1) {
+    // the remaining pages go before the file listings of the records
+    pagesTotal = std::max(1, pagination["total_pages"].toInt());
+    recordsTotal = total;
+    for (int number = 2; number <= pagesTotal; ++number) {
+      enqueue({RecordPage, number, QString(), 0});
+    }
+  } else if (total != recordsTotal) {
+    // records shifted between the pages, some may have been skipped
+    consistent = false;
+  }
+
+  int first = static_cast<int>(recordList.size());
+  for (const QJsonValue& value : page["items"].toArray()) {
+    int record = merge(value.toObject());
+    if (record < 0) continue;
+
+    const RecordInfo& info = recordList[record];
+    seen.insert(info.identifier);
+    if (prefetchFiles && !info.filesAlreadyFetched && !requestedFiles.contains(info.identifier)) {
+      requestedFiles.insert(info.identifier);
+      enqueue({FilePage, 1, info.identifier, 0});
+    }
+  }
+  if (recordList.size() > first) {
+    Q_EMIT recordsAdded(first, static_cast<int>(recordList.size()) - 1);
+  }
+
+  pagesLoaded++;
+  Q_EMIT progress(static_cast<int>(seen.size()), recordsTotal);
+
+  if (pagesLoaded == pagesTotal) {
+    removeDeletedRecords();
+  }
+}
+
+void RecordCatalog::filePageReceived(const Job& job, const QJsonObject& page) {
+  int record = indexOf(job.identifier);
+  if (record < 0) return;
+
+  // the files are replaced once the listing is complete, never in between
+  QVector<RecordFileInfo>& files = pendingFiles[job.identifier];
+  if (job.page == 1) {
+    files.clear();
+  }
+  for (const QJsonValue& value : page["items"].toArray()) {
+    RecordFileInfo file = parseFile(value.toObject());
+    if (!files.contains(file)) {
+      files.append(file);
+    }
+  }
+
+  if (page["_pagination"].toObject()["_links"].toObject()["next"].isString()) {
+    enqueue({FilePage, job.page + 1, job.identifier, 0}, true);
+    return;
+  }
+
+  RecordInfo& info = recordList[record];
+  info.files = pendingFiles.take(job.identifier);
+  info.filesAlreadyFetched = true;
+  indexRecord(record);
+  dirty = true;
+  Q_EMIT filesFetched(record);
+}
+
+void RecordCatalog::removeDeletedRecords() {
+  if (pagesFailed || !consistent) return;
+
+  bool deleted = std::any_of(recordList.begin(), recordList.end(), [this](const RecordInfo& record) {
+    return !seen.contains(record.identifier);
+  });
+  if (!deleted) return;
+
+  QVector<RecordInfo> kept;
+  QVector<QString> keptHaystacks;
+  indexes.clear();
+  for (int record = 0; record < recordList.size(); ++record) {
+    if (seen.contains(recordList[record].identifier)) {
+      indexes.insert(recordList[record].identifier, static_cast<int>(kept.size()));
+      kept.append(std::move(recordList[record]));
+      keptHaystacks.append(std::move(haystacks[record]));
+    }
+  }
+  recordList = std::move(kept);
+  haystacks = std::move(keptHaystacks);
+
+  dirty = true;
+  Q_EMIT recordsReset();
+}
+
+int RecordCatalog::merge(const QJsonObject& item) {
+  RecordInfo received = parseRecord(item);
+  if (received.identifier.isEmpty()) return -1;
+
+  int record = indexOf(received.identifier);
+  if (record < 0) {
+    recordList.append(received);
+    haystacks.append(QString());
+    record = static_cast<int>(recordList.size()) - 1;
+    indexes.insert(received.identifier, record);
+    indexRecord(record);
+    dirty = true;
+    return record;
+  }
+
+  RecordInfo& known = recordList[record];
+  if (!sameRecord(known, received)) {
+    // the files stay visible until they are fetched again
+    received.files = std::move(known.files);
+    received.filesAlreadyFetched = known.filesAlreadyFetched && known.lastModified == received.lastModified;
+    known = std::move(received);
+    indexRecord(record);
+    dirty = true;
+    Q_EMIT recordUpdated(record);
+  }
+  return record;
+}
+
+void RecordCatalog::indexRecord(int record) {
+  const RecordInfo& info = recordList[record];
+
+  QStringList text {info.identifier, info.title, info.authorDisplayName, info.description};
+  text += info.tags;
+  for (const RecordFileInfo& file : info.files) {
+    text.append(file.fileName);
+  }
+  haystacks[record] = text.join('\n').toCaseFolded();
+}
+
+QString RecordCatalog::recordsUrl(int page) const {
+  QString host = kadiInstance.host;
+  if (!host.endsWith('/')) {
+    host.append('/');
+  }
+
+  QUrl url(host + "api/records");
+  QUrlQuery query;
+  query.addQueryItem("page", QString::number(page));
+  query.addQueryItem("per_page", QString::number(perPage));
+  url.setQuery(query);
+  return url.toString();
+}
+
+QString RecordCatalog::filesUrl(const RecordInfo& record, int page) const {
+  QString link = record.filesApiLink;
+  if (link.isEmpty()) {
+    QString host = kadiInstance.host;
+    if (!host.endsWith('/')) {
+      host.append('/');
+    }
+    link = host + QString("api/records/%1/files").arg(record.id);
+  }
+
+  QUrl url(link);
+  QUrlQuery query;
+  query.addQueryItem("page", QString::number(page));
+  query.addQueryItem("per_page", QString::number(perPage));
+  url.setQuery(query);
+  return url.toString();
+}
+
+void RecordCatalog::load() {
+  QFile file(indexPath());
+  if (!file.open(QIODevice::ReadOnly)) return;
+
+  QJsonObject root = QJsonDocument::fromJson(file.readAll()).object();
+  if (root["version"].toInt() != FORMAT_VERSION) {
+    qDebug() << "Discarding Kadi record catalog with unsupported version" << root["version"].toInt();
+    return;
+  }
+
+  for (const QJsonValue& value : root["entries"].toArray()) {
+    QJsonObject item = value.toObject();
+    RecordInfo record = parseRecord(item);
+    if (record.identifier.isEmpty() || indexes.contains(record.identifier)) continue;
+
+    for (const QJsonValue& file : item["files"].toArray()) {
+      record.files.append(parseFile(file.toObject()));
+    }
+    record.filesAlreadyFetched = item["files_fetched"].toBool();
+
+    recordList.append(record);
+    haystacks.append(QString());
+    indexes.insert(record.identifier, static_cast<int>(recordList.size()) - 1);
+    indexRecord(static_cast<int>(recordList.size()) - 1);
+  }
+}
+
+void RecordCatalog::save() {
+  QJsonArray entries;
+  for (const RecordInfo& record : recordList) {
+    entries.append(recordObject(record));
+  }
+
+  QJsonObject root;
+  root["version"] = FORMAT_VERSION;
+  root["host"] = kadiInstance.host;
+  root["entries"] = entries;
+
+  // write to a temporary file first, a crash must not leave a truncated catalog behind
+  QDir().mkpath(directory);
+  QSaveFile file(indexPath());
+  if (!file.open(QIODevice::WriteOnly)) {
+    qWarning() << "Can not write Kadi record catalog: " << file.fileName();
+    return;
+  }
+  file.write(QJsonDocument(root).toJson(QJsonDocument::Compact));
+  if (file.commit()) {
+    dirty = false;
+  }
+}
+
+QString RecordCatalog::indexPath() const {
+  // the records visible differ between the users of an instance
+  QByteArray key = (kadiInstance.host + '\n' + kadiInstance.token).toUtf8();
+  return directory + "/" + QCryptographicHash::hash(key, QCryptographicHash::Sha1).toHex() + ".json";
+}
@@ -0,0 +1,213 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+#pragma once
+
+#include <deque>
+
+#include <QHash>
+#include <QNetworkAccessManager>
+#include <QObject>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+#include <plugins/infrastructure/kadiconfig/kadiinstance.h>
+
+#include "../domain/recordinfo.h"
+
+class QJsonObject;
+class QNetworkReply;
+
+/**
+ * @brief      Local catalog of the records of a Kadi instance and of the
+ *             files in them.
+ *
+ *             refresh() fetches all pages of the record listing, after
+ *             the first page the remaining ones are requested side by
+ *             side. At most maximumConcurrentRequests() requests are
+ *             running at once, the file listings of the records are
+ *             queued behind the record pages. Requests failing with a
+ *             transient error are sent again after a backoff, waiting for
+ *             it is done with a timer.
+ *
+ *             The catalog is stored in a JSON file per instance and is
+ *             available right away the next time, while it is refreshed.
+ *             A record keeps its files as long as its modification date
+ *             does not change. Searching is done locally over the stored
+ *             records, without asking the server.
+ *
+ *             Records are only appended or updated during a refresh, so
+ *             their indexes stay valid. Records deleted on the server are
+ *             removed once all pages arrived, which is announced with
+ *             recordsReset().
+ * @ingroup    kadiintegration
+ */
+class RecordCatalog : public QObject {
+    Q_OBJECT
+
+  public:
+    explicit RecordCatalog(const KadiInstance& instance, const QString& directory = defaultDirectory(),
+                           QObject *parent = nullptr);
+    ~RecordCatalog() override;
+
+    static QString defaultDirectory();
+
+    const KadiInstance& instance() const;
+    const QVector<RecordInfo>& records() const;
+
+    /**
+     * @return     Index of the record in records(), -1 if it is unknown.
+     */
+    int indexOf(const QString& identifier) const;
+
+    /**
+     * @brief      Fetches all records again, requests of an earlier refresh
+     *             are aborted. The stored records stay available meanwhile.
+     */
+    void refresh();
+
+    /**
+     * @brief      Fetches the files of a record ahead of the queued requests,
+     *             if they are not known yet.
+     */
+    void fetchFiles(int record);
+
+    /**
+     * @brief      Aborts the running and queued requests.
+     */
+    void cancel();
+
+    bool isRefreshing() const;
+
+    /**
+     * @return     The indexes of the records matching the query, in the
+     *             order of records(). All words of the query have to occur
+     *             in the identifier, title, author, description, tags or
+     *             file names of a record, text in double quotes is matched
+     *             as a whole. With a mime type only records with a file of
+     *             this type match, records whose files are not fetched yet
+     *             are kept.
+     */
+    QVector<int> search(const QString& query, const QString& mimetype = QString()) const;
+
+    /**
+     * @brief      Fetch the files of all records during a refresh, not only
+     *             the ones requested with fetchFiles().
+     */
+    void setFilesPrefetched(bool prefetched);
+    bool filesPrefetched() const;
+
+    void setMaximumConcurrentRequests(int requests);
+    int maximumConcurrentRequests() const;
+
+    void setMaximumRetries(int retries);
+    int maximumRetries() const;
+
+    /**
+     * @brief      Number of records or files requested per page.
+     */
+    void setPageSize(int size);
+    int pageSize() const;
+
+    /**
+     * @return     Description of the last failed request of the current
+     *             refresh, empty if none failed.
+     */
+    QString errorString() const;
+
+    const static int FORMAT_VERSION = 1;
+    const static int DEFAULT_CONCURRENT_REQUESTS = 4;
+    const static int DEFAULT_MAXIMUM_RETRIES = 5;
+    const static int DEFAULT_PAGE_SIZE = 100;
+
+  Q_SIGNALS:
+    /**
+     * @brief      Records were appended, from first to last.
+     */
+    void recordsAdded(int first, int last);
+    void recordUpdated(int record);
+    void filesFetched(int record);
+
+    /**
+     * @brief      Records were removed, all indexes may have changed.
+     */
+    void recordsReset();
+
+    void progress(int loaded, int total);
+    void finished(bool success);
+
+  private:
+    enum Kind {
+      RecordPage,
+      FilePage
+    };
+
+    struct Job {
+      Kind kind;
+      int page;
+      QString identifier; ///< of the record whose files are listed
+      int attempt;
+    };
+
+    void enqueue(const Job& job, bool first = false);
+    void pump();
+    /**
+     * @return     false if the job is obsolete, its record is gone
+     */
+    bool start(const Job& job);
+    void jobFinished(const Job& job, QNetworkReply *reply);
+    void recordPageReceived(const Job& job, const QJsonObject& page);
+    void filePageReceived(const Job& job, const QJsonObject& page);
+    void removeDeletedRecords();
+
+    int merge(const QJsonObject& item);
+    void indexRecord(int record);
+    QString recordsUrl(int page) const;
+    QString filesUrl(const RecordInfo& record, int page) const;
+
+    void load();
+    void save();
+    QString indexPath() const;
+
+    KadiInstance kadiInstance;
+    QString directory;
+    QNetworkAccessManager networkAccessManager;
+
+    QVector<RecordInfo> recordList;
+    QHash<QString, int> indexes;
+    QVector<QString> haystacks; ///< case folded text of each record searched in
+
+    std::deque<Job> queue;
+    QSet<QNetworkReply *> running;
+    int active;
+    int generation;
+    bool refreshing;
+    bool prefetchFiles;
+    bool dirty;
+    int concurrentRequests;
+    int retries;
+    int perPage;
+
+    // state of the current refresh
+    QSet<QString> seen;
+    QSet<QString> requestedFiles;
+    QHash<QString, QVector<RecordFileInfo>> pendingFiles; ///< pages of file listings not complete yet
+    int pagesTotal;
+    int pagesLoaded;
+    int recordsTotal;
+    bool pagesFailed;
+    bool consistent; ///< no record was added or deleted while the pages were fetched
+    QString error;
+};
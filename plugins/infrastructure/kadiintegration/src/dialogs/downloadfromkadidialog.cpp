@@ -12,12 +12,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License. */
 
-#include <cmath>
-
 #include <QString>
-#include <QAtomicInt>
-#include <QJsonArray>
-#include <QJsonValue>
 
 #include <QMimeDatabase>
 #include <QMimeData>
@@ -33,13 +28,7 @@
 #include <QPushButton>
 #include <QMovie>
 #include <QMessageBox>
-#include <QNetworkAccessManager>
-#include <QNetworkReply>
-#include <QUrlQuery>
-
-#include <QFile>
-#include <QDir>
-#include <QTemporaryDir>
+#include <QRegularExpression>
 
 #include <framework/enhanced/qlineeditclearable.h>
 #include <framework/pluginframework/pluginmanagerinterface.h>
@@ -48,6 +37,7 @@
 
 #include "../utils/kadiutils.h"
 #include "../kadiintegration.h"
+#include "../catalog/recordcatalog.h"
 #include "../domain/recordinfo.h"
 #include "../domain/recordfileinfo.h"
 #include "createnewrecorddialog.h"
@@ -56,23 +46,15 @@
 #include "downloadfromkadidialog.h"
 
 
-#define KADI_RECORDS_ENDPOINT "api/records"
-
 static const char *workflowmimetype = "application/x-flow+json";
 
 DownloadFromKadiDialog::DownloadFromKadiDialog(LibFramework::PluginManagerInterface* pluginmanager, QWidget* parent)
-    : QDialog(parent), pluginmanager(pluginmanager), loadedRecords(0), totalItems(0) {
-
-  networkAccessManager = new QNetworkAccessManager(this);
-  activeRequests.storeRelease(0);
-
-  pageSize = new QComboBox(this);
-  pageSize->addItems({ "10", "20", "30", "40", "50", "60", "70", "80", "90", "100" });
-  pageSize->setToolTip(tr("Amount of items retrieved per request"));
+    : QDialog(parent), pluginmanager(pluginmanager) {
 
   filterField = new QLineEditClearable(this);
   filterField->setPlaceholderText(tr("Enter filter string"));
-  filterField->setToolTip(tr("The API uses fuzzy matching. Exact matches can be requested by using double quotes, e.g. \"your-query\"."));
+  filterField->setToolTip(tr("Filters the records by identifier, title, author, description, tags and file names. "
+                             "Exact phrases can be requested by using double quotes, e.g. \"your query\"."));
   filterField->setMinimumWidth(400);
 
   mimeTypeFilter = new QLineEditClearable(this);
@@ -93,8 +75,7 @@ DownloadFromKadiDialog::DownloadFromKadiDialog(LibFramework::PluginManagerInterf
   mimeTypeFilter->setCompleter(mimetypecompleter);
 
   fetchRecordsBtn = new QPushButton(tr("Fetch Records"), this);
-  loadMoreRecordsBtn = new QPushButton(tr("Load More"));
-  loadMoreRecordsBtn->setDisabled(true);
+  recordCountLbl = new QLabel(this);
 
   treeWidget = new QTreeWidget(this);
   treeWidget->setColumnCount(2);
@@ -138,13 +119,12 @@ DownloadFromKadiDialog::DownloadFromKadiDialog(LibFramework::PluginManagerInterf
   hbox1->addWidget(kadiConfigBtn, 1);
 
   formLayout->addRow(tr("Kadi Instance:"), hbox1);
-  formLayout->addRow(tr("Results per Request:"), pageSize);
   formLayout->addRow(tr("Search Query:"), filterField);
   formLayout->addRow(tr("MimeType:"), mimeTypeFilter);
 
   auto *hbox2 = new QHBoxLayout(nullptr);
   hbox2->addWidget(fetchRecordsBtn);
-  hbox2->addWidget(loadMoreRecordsBtn);
+  hbox2->addWidget(recordCountLbl, 1, Qt::AlignRight);
 
   formLayout->addRow(hbox2);
 
@@ -171,25 +151,25 @@ DownloadFromKadiDialog::DownloadFromKadiDialog(LibFramework::PluginManagerInterf
     }
   });
   connect(fetchRecordsBtn, &QPushButton::clicked, acceptAndLoadFileBtn, [this]() { acceptAndLoadFileBtn->setDisabled(true); });
-  connect(fetchRecordsBtn, &QPushButton::clicked, this, &DownloadFromKadiDialog::fetchRecordsFromKadiInstance);
+  connect(fetchRecordsBtn, &QPushButton::clicked, this, &DownloadFromKadiDialog::refreshRecords);
   connect(createNewRecordBtn, &QPushButton::clicked, this, &DownloadFromKadiDialog::openCreateNewRecordDialog);
   connect(acceptAndLoadFileBtn, &QPushButton::clicked, this, &DownloadFromKadiDialog::accept);
   connect(cancelBtn, &QPushButton::clicked, this, &DownloadFromKadiDialog::reject);
-  connect(loadMoreRecordsBtn, &QPushButton::clicked, this, [this]{ this->fetchRecordsFromKadiInstance(true); });
-  connect(filterField, &QLineEdit::textEdited, loadMoreRecordsBtn, [this]{ this->loadMoreRecordsBtn->setDisabled(true); });
-  connect(kadiInstanceSelectionBox, &QComboBox::activated, this, &DownloadFromKadiDialog::getSelectedKadiInstanceFromSelectionBox);
+  connect(filterField, &QLineEdit::textChanged, this, &DownloadFromKadiDialog::applyLocalFilter);
+  connect(mimeTypeFilter, &QLineEdit::textChanged, this, &DownloadFromKadiDialog::applyLocalFilter);
+  connect(treeWidget, &QTreeWidget::itemDoubleClicked, this, &DownloadFromKadiDialog::showRecordFiles);
+  connect(treeWidget, &QTreeWidget::itemExpanded, this, &DownloadFromKadiDialog::showRecordFiles);
+  connect(kadiInstanceSelectionBox, &QComboBox::activated, this, [this](int index) {
+    getSelectedKadiInstanceFromSelectionBox(index);
+    refreshRecords();
+  });
 
   fetchRecordsBtn->setFocus();
   filterField->setFocus();
 }
 
 bool DownloadFromKadiDialog::showDialog(int mode) {
-  if (mode != operationMode) { // if there was a mode change
-    getAllRecords().clear();
-    treeWidget->clear();
-    loadedRecords.storeRelease(0);
-  }
-
+  bool modechanged = (mode != operationMode);
   operationMode = mode;
 
   switch (operationMode) {
@@ -212,6 +192,13 @@ bool DownloadFromKadiDialog::showDialog(int mode) {
       return false;
   }
 
+  // stored records are shown while the catalog is refreshed in the background
+  openCatalog();
+  if (modechanged) {
+    rebuildRecordItems();
+  }
+  refreshRecords();
+
   exec();
   mimeTypeFilter->setText("");
   return (result() == DownloadFromKadiDialog::Accepted);
@@ -287,287 +274,221 @@ void DownloadFromKadiDialog::getSelectedKadiInstanceFromSelectionBox(int index)
   auto kadiConfigInterface = pluginmanager->getInterface<KadiConfigInterface *>("/plugins/infrastructure/kadiconfig");
 
   currentKadiInstance = kadiConfigInterface->getAllInstances()[index];
-  if (!currentKadiInstance.host.endsWith("/")) {
-    currentKadiInstance.host.append("/");
+
+  // the catalog is read from disk once the dialog is shown
+  if (isVisible()) {
+    openCatalog();
   }
-  currentKadiInstance.host.append(KADI_RECORDS_ENDPOINT);
 }
 
-void DownloadFromKadiDialog::fetchRecordsFromKadiInstance(bool useUrlToNextPage = false) {
-  showLoadingIndicator();
-  fetchRecordsBtn->setDisabled(true);
-  acceptAndLoadFileBtn->setDisabled(true);
-  loadMoreRecordsBtn->setDisabled(true);
-  pageSize->setDisabled(true);
-  filterField->setDisabled(true);
-  treeWidget->sortByColumn(-1, Qt::AscendingOrder);
+void DownloadFromKadiDialog::openCatalog() {
+  if (catalog && catalog->instance().host == currentKadiInstance.host && catalog->instance().token == currentKadiInstance.token) {
+    return;
+  }
 
-  // sort the list by default if no query string was given
-  if (filterField->text().isEmpty()) {
-    treeWidget->sortItems(0, Qt::AscendingOrder);
+  delete catalog;
+  catalog = nullptr;
+
+  if (not currentKadiInstance.host.isEmpty()) {
+    catalog = new RecordCatalog(currentKadiInstance, RecordCatalog::defaultDirectory(), this);
+    connect(catalog, &RecordCatalog::recordsAdded, this, &DownloadFromKadiDialog::addRecordItems);
+    connect(catalog, &RecordCatalog::recordUpdated, this, &DownloadFromKadiDialog::updateRecordItem);
+    connect(catalog, &RecordCatalog::recordsReset, this, &DownloadFromKadiDialog::rebuildRecordItems);
+    connect(catalog, &RecordCatalog::filesFetched, this, &DownloadFromKadiDialog::updateFileItems);
+    connect(catalog, &RecordCatalog::finished, this, &DownloadFromKadiDialog::catalogFinished);
+    connect(catalog, &RecordCatalog::progress, recordCountLbl, [this](int loaded, int total) {
+      recordCountLbl->setText(tr("Loading records (%1/%2)").arg(loaded).arg(total));
+    });
   }
 
-  // url query
-  QUrlQuery urlQuery;
+  acceptAndLoadFileBtn->setDisabled(true);
+  rebuildRecordItems();
+}
+
+void DownloadFromKadiDialog::refreshRecords() {
+  openCatalog();
+  if (!catalog) return;
 
-  QNetworkRequest request;
-  if (useUrlToNextPage) {
-    QUrl url(urlToNextPageOfRecords);
+  // the files are needed to filter by mime type, they are fetched after all records
+  catalog->setFilesPrefetched(operationMode != DLD_IDENTIFIER_MODE);
+  catalog->refresh();
 
-    urlQuery = QUrlQuery(url);
-    urlQuery.removeAllQueryItems("page");
-    urlQuery.removeAllQueryItems("per_page");
-    urlQuery.addQueryItem("page", QString::number(getNextPageNumber()));
-    urlQuery.addQueryItem("per_page", pageSize->currentText());
+  fetchRecordsBtn->setText(tr("Fetch Records"));
+  showLoadingIndicator();
+}
 
-    url.setQuery(urlQuery);
-    request.setUrl(url);
+void DownloadFromKadiDialog::rebuildRecordItems() {
+  treeWidget->clear();
+  recordItems.clear();
+  if (catalog && not catalog->records().isEmpty()) {
+    addRecordItems(0, catalog->records().size() - 1);
   } else {
-    QUrl url(currentKadiInstance.host);
+    applyLocalFilter();
+  }
+}
 
-    urlQuery.addQueryItem("per_page", pageSize->currentText());
-    urlQuery.addQueryItem("query", filterField->text());
-    if (not mimeTypeFilter->text().isEmpty()) {
-      urlQuery.addQueryItem("mimetype", QUrl::toPercentEncoding(mimeTypeFilter->text()));
+void DownloadFromKadiDialog::addRecordItems(int first, int last) {
+  // sorting once after the batch, not on every inserted item
+  treeWidget->setSortingEnabled(false);
+  for (int recordIndex = first; recordIndex <= last; ++recordIndex) {
+    auto *newRecordListItem = new RecordListItem(treeWidget, {});
+    newRecordListItem->setIcon(0, this->style()->standardIcon(QStyle::SP_DirIcon));
+    newRecordListItem->recordInfoIndex = recordIndex;
+    recordItems.append(newRecordListItem);
+    updateRecordItem(recordIndex);
+
+    if (operationMode == DLD_ANY_MODE || operationMode == DLD_FILE_MODE) {
+      // add a dummy entry, so that the tree view shows an arrow to expand the item
+      newRecordListItem->addChild(new RecordFileListItem(nullptr, { tr("loading files ..."), "" }));
     }
-
-    url.setQuery(urlQuery);
-    request.setUrl(url);
-
-    loadMoreRecordsBtn->setText(tr("Load More"));
-    getAllRecords().clear();
-    treeWidget->clear();
-    loadedRecords.storeRelease(0);
   }
-  request.setRawHeader("Authorization", (QString("Bearer ") + currentKadiInstance.token).toUtf8());
-
-  preRequestHooks();
-  //qDebug() << request.url() << endl;
-  auto requesthandler = new kadiutils::NetworkHandler(networkAccessManager, this);
-  connect(requesthandler, &kadiutils::NetworkHandler::finished, this, [this, requesthandler](QNetworkReply* reply) {
-    processRecordsReply(reply);
-    postRequestHooks();
-    delete requesthandler;
-  });
-  requesthandler->sendRequest(request);
+  treeWidget->setSortingEnabled(true);
 
-  filterField->setDisabled(false);
+  applyLocalFilter();
 }
 
-void DownloadFromKadiDialog::processRecordsReply(QNetworkReply* reply) {
-  int statusCode = kadiutils::getHttpCode(reply);
+void DownloadFromKadiDialog::updateRecordItem(int recordIndex) {
+  const RecordInfo &recordInfo = catalog->records()[recordIndex];
+  RecordListItem *recordListItem = recordItems[recordIndex];
 
-  if (statusCode != 200) {
-    fetchRecordsBtn->setText(tr("Fetch Records - HTTP Code ") + QString::number(statusCode));
-    fetchRecordsBtn->setDisabled(false);
-    pageSize->setDisabled(false);
-    return;
-  } else {
-    // restore button text
-    fetchRecordsBtn->setText(tr("Fetch Records"));
-  }
+  recordListItem->setText(0, recordInfo.identifier);
+  recordListItem->setText(1, recordInfo.lastModified.toString("yyyy-MM-dd hh:mm"));
+  recordListItem->setToolTip(0, tr("Title: ").append(recordInfo.title).append('\n')
+    .append(tr("Author: ")).append(recordInfo.authorDisplayName).append('\n')
+    .append(tr("Description: ")).append(recordInfo.description.isEmpty() ? "" : "\n")
+    .append(recordInfo.description));
+}
 
-  // parse the json in the reply body
-  QJsonObject jsonobject;
-  if (not kadiutils::parseJsonData(reply, jsonobject)) {
+void DownloadFromKadiDialog::showRecordFiles(QTreeWidgetItem* recordTreeWidgetItem) {
+  if (!catalog || recordTreeWidgetItem->parent() != nullptr || operationMode == DLD_IDENTIFIER_MODE) {
     return;
   }
 
-  for (const QJsonValue &value : jsonobject["items"].toArray()) {
-    QJsonObject item = value.toObject();
-    RecordInfo recordInfo = {
-      .id = item["id"].toInt(),
-      .identifier = item["identifier"].toString(),
-      .title = item["title"].toString(),
-      .authorDisplayName = item["creator"].toObject()["displayname"].toString(),
-      .description = item["description"].toString(),
-      .filesApiLink = item["_links"].toObject()["files"].toString(),
-      .lastModified = QDateTime::fromString(item["last_modified"].toString(), Qt::ISODate),
-      .files = {},
-      .filesAlreadyFetched = false,
-      .type = {},
-      .license = ""
-    };
-
-    // check if record was already appended to the vector
-    QVector<RecordInfo> &allRecords = getAllRecords();
-    if (!allRecords.contains(recordInfo)) {
-      allRecords.append(recordInfo);
-      int recordIndex = allRecords.size() - 1;
-
-      // update item count
-      loadedRecords++;
-      updateLoadMoreRecordsBtn();
-
-      // create record list item in tree view
-      auto *newRecordListItem = new RecordListItem(treeWidget, {
-        recordInfo.identifier,
-        recordInfo.lastModified.toString("yyyy-MM-dd hh:mm"),
-      });
-
-      newRecordListItem->setIcon(0, this->style()->standardIcon(QStyle::SP_DirIcon));
-      newRecordListItem->setToolTip(0, tr("Title: ").append(recordInfo.title).append('\n')
-        .append(tr("Author: ")).append(recordInfo.authorDisplayName).append('\n')
-        .append(tr("Description: ")).append(recordInfo.description.isEmpty() ? "" : "\n")
-        .append(recordInfo.description));
-      newRecordListItem->recordInfoIndex = recordIndex;
-
-      // fetch files contained in this record
-      if (operationMode == DLD_ANY_MODE || operationMode == DLD_FILE_MODE) {
-        if (filterField->text().isEmpty()) { // lazy loading
-          // add a dummy entry, so that the tree view shows an arrow to expand the item
-          auto dummy = new RecordFileListItem(nullptr, { tr("loading files ..."), "" });
-          newRecordListItem->addChild(dummy);
-
-          connect(treeWidget, &QTreeWidget::itemDoubleClicked, this, &DownloadFromKadiDialog::fetchRecordFiles);
-          connect(treeWidget, &QTreeWidget::itemExpanded, this, &DownloadFromKadiDialog::fetchRecordFiles);
-        } else {
-          fetchRecordFiles(newRecordListItem);
-        }
-      }
-    }
-  }
-
-  totalItems = jsonobject["_pagination"].toObject()["total_items"].toInt();
-  updateLoadMoreRecordsBtn();
-
-  // pagination
-  if (jsonobject["_pagination"].toObject()["_links"].toObject()["next"].isString()) {
-    urlToNextPageOfRecords = jsonobject["_pagination"].toObject()["_links"].toObject()["next"].toString();
-    loadMoreRecordsBtn->setDisabled(false);
+  int recordIndex = static_cast<RecordListItem *>(recordTreeWidgetItem)->recordInfoIndex;
+  if (catalog->records()[recordIndex].filesAlreadyFetched) {
+    addFileItems(recordIndex);
+  } else {
+    showLoadingIndicator();
   }
+  recordTreeWidgetItem->setExpanded(true);
 
-  fetchRecordsBtn->setDisabled(false);
-  pageSize->setDisabled(false);
+  // files read from disk are shown right away and fetched again once
+  catalog->fetchFiles(recordIndex);
 }
 
-void DownloadFromKadiDialog::fetchRecordFiles(QTreeWidgetItem* recordTreeWidgetItem) {
-  showLoadingIndicator();
-  auto recordListItem = (RecordListItem *) recordTreeWidgetItem;
-  auto &recordInfo = getAllRecords()[recordListItem->recordInfoIndex];
-
-  if (recordInfo.filesAlreadyFetched) {
+void DownloadFromKadiDialog::updateFileItems(int recordIndex) {
+  if (not catalog->isRefreshing()) {
     hideLoadingIndicator();
+  }
+  if (operationMode == DLD_IDENTIFIER_MODE) {
     return;
   }
 
-  if (recordTreeWidgetItem->childCount() == 1) {
-    recordTreeWidgetItem->takeChild(0); // remove dummy
+  RecordListItem *recordListItem = recordItems[recordIndex];
+  if (recordListItem->isExpanded()) {
+    addFileItems(recordIndex);
+  } else {
+    qDeleteAll(recordListItem->takeChildren());
+    recordListItem->addChild(new RecordFileListItem(nullptr, { tr("loading files ..."), "" }));
   }
 
-  QNetworkRequest request;
-  request.setUrl(QUrl(recordInfo.filesApiLink + "?per_page=100"));
-  request.setRawHeader("Authorization", (QString("Bearer ") + currentKadiInstance.token).toUtf8());
+  // the files decide whether the record matches the mime type
+  if (not mimeTypeFilter->text().isEmpty()) {
+    applyLocalFilter();
+  }
+}
 
-  preRequestHooks();
-  auto requesthandler = new kadiutils::NetworkHandler(networkAccessManager, this);
-  connect(requesthandler, &kadiutils::NetworkHandler::finished, this, [this, requesthandler, recordListItem](QNetworkReply* reply) {
-    processFilesReply(reply, recordListItem->recordInfoIndex, recordListItem);
-    postRequestHooks();
-    delete requesthandler;
-  });
-  requesthandler->sendRequest(request);
+void DownloadFromKadiDialog::addFileItems(int recordIndex) {
+  const RecordInfo &recordInfo = catalog->records()[recordIndex];
+  RecordListItem *parentRecordListItem = recordItems[recordIndex];
+  qDeleteAll(parentRecordListItem->takeChildren());
 
-  recordInfo.filesAlreadyFetched = true;
-  recordTreeWidgetItem->setExpanded(true);
-}
+  QMimeDatabase db;
+  for (int fileIndex = 0; fileIndex < recordInfo.files.size(); ++fileIndex) {
+    const RecordFileInfo &recordFileInfo = recordInfo.files[fileIndex];
 
-void DownloadFromKadiDialog::processFilesReply(QNetworkReply *filesReply, int recordIndex, RecordListItem *parentRecordListItem) {
-  int statusCode = kadiutils::getHttpCode(filesReply);
+    // create tree widget item for this file
+    auto *newRecordFileListItem = new RecordFileListItem(nullptr, {
+      recordFileInfo.fileName,
+      recordFileInfo.lastModified.toString("yyyy-MM-dd hh:mm"),
+    });
 
-  if (statusCode > 0 && statusCode != 200) {
-    return;
-  }
+    newRecordFileListItem->setToolTip(0, QString(recordFileInfo.fileName).append('\n')
+      .append(tr("Size: %1 Bytes").arg(recordFileInfo.size)).append('\n')
+      .append(tr("Mime type: %1").arg(recordFileInfo.mimeType)).append('\n')
+      .append(tr("Magic mime type: %1").arg(recordFileInfo.magicMimeType)).append('\n')
+      .append(tr("Checksum: %1").arg(recordFileInfo.checksum).append('\n'))
+      .append(tr("UUID: %1").arg(recordFileInfo.uuid.toString())));
+    newRecordFileListItem->recordFileInfoIndex = fileIndex;
+
+    auto mimeType = db.mimeTypeForName(recordFileInfo.mimeType);
+    auto magicMimeType = db.mimeTypeForName(recordFileInfo.magicMimeType);
+
+    if (not mimeType.iconName().isEmpty() && QIcon::hasThemeIcon(mimeType.iconName())) {
+      newRecordFileListItem->setIcon(0, QIcon::fromTheme(mimeType.iconName()));
+    } else if (not magicMimeType.iconName().isEmpty() && QIcon::hasThemeIcon(magicMimeType.iconName())) {
+      newRecordFileListItem->setIcon(0, QIcon::fromTheme(magicMimeType.iconName()));
+    } else {
+      newRecordFileListItem->setIcon(0, this->style()->standardIcon(QStyle::SP_FileIcon));
+    }
 
-  auto &allRecords = getAllRecords();
+    // add as a child to the record list item
+    parentRecordListItem->addChild(newRecordFileListItem);
+    newRecordFileListItem->setHidden(not matchesMimeTypeFilter(recordFileInfo));
+  }
+}
 
-  // parse the json in the reply body
-  QJsonObject jsonobject;
-  if (not kadiutils::parseJsonData(filesReply, jsonobject)) {
+void DownloadFromKadiDialog::applyLocalFilter() {
+  if (!catalog) {
+    recordCountLbl->clear();
     return;
   }
 
-  for (auto value : jsonobject["items"].toArray()) {
-    QJsonObject item = value.toObject();
-    RecordFileInfo recordFileInfo = {
-      .uuid = QUuid(item["id"].toString()),
-      .fileName = item["name"].toString(),
-      .lastModified = QDateTime::fromString(item["last_modified"].toString(), Qt::ISODate),
-      .fileDownloadApiLink = item["_links"].toObject()["download"].toString(),
-      .recordApiLink = item["_links"].toObject()["record"].toString(),
-      .mimeType = item["mimetype"].toString(),
-      .magicMimeType = item["magic_mimetype"].toString(),
-      .checksum = item["checksum"].toString(),
-      .size = item["size"].toInt(),
-    };
-
-    if (!allRecords[recordIndex].files.contains(recordFileInfo)) {
-      allRecords[recordIndex].files.append(recordFileInfo);
-
-      // create tree widget item for this file
-      auto *newRecordFileListItem = new RecordFileListItem(nullptr, {
-        recordFileInfo.fileName,
-        //allRecords[recordIndex].title,
-        recordFileInfo.lastModified.toString("yyyy-MM-dd hh:mm"),
-      });
-
-      newRecordFileListItem->setToolTip(0, QString(recordFileInfo.fileName).append('\n')
-        .append(tr("Size: %1 Bytes").arg(recordFileInfo.size)).append('\n')
-        .append(tr("Mime type: %1").arg(recordFileInfo.mimeType)).append('\n')
-        .append(tr("Magic mime type: %1").arg(recordFileInfo.magicMimeType)).append('\n')
-        .append(tr("Checksum: %1").arg(recordFileInfo.checksum).append('\n'))
-        .append(tr("UUID: %1").arg(recordFileInfo.uuid.toString())));
-      newRecordFileListItem->recordFileInfoIndex = allRecords[recordIndex].files.size() - 1;
-
-      QMimeDatabase db;
-      auto mimeType = db.mimeTypeForName(recordFileInfo.mimeType);
-      auto magicMimeType = db.mimeTypeForName(recordFileInfo.magicMimeType);
-
-      if (not mimeType.iconName().isEmpty() && QIcon::hasThemeIcon(mimeType.iconName())) {
-        newRecordFileListItem->setIcon(0, QIcon::fromTheme(mimeType.iconName()));
-      } else if (not magicMimeType.iconName().isEmpty() && QIcon::hasThemeIcon(magicMimeType.iconName())) {
-        newRecordFileListItem->setIcon(0, QIcon::fromTheme(magicMimeType.iconName()));
-      } else {
-        newRecordFileListItem->setIcon(0, this->style()->standardIcon(QStyle::SP_FileIcon));
-      }
+  QVector<bool> visible(recordItems.size(), false);
+  const QVector<int> matches = catalog->search(filterField->text(), mimeTypeFilter->text());
+  for (int recordIndex : matches) {
+    visible[recordIndex] = true;
+  }
 
-      // add as a child to the record list item
-      parentRecordListItem->addChild(newRecordFileListItem);
-      if (not mimeTypeFilter->text().isEmpty()) {
-        if (mimeTypeFilter->text() == workflowmimetype) {
-          if (recordFileInfo.mimeType != workflowmimetype) { // magic will never match
-            newRecordFileListItem->setHidden(true);
-          }
-        } else {
-          QMimeType filtermimetype = db.mimeTypeForName(mimeTypeFilter->text());
-          if (filtermimetype != mimeType && filtermimetype != magicMimeType) {
-            newRecordFileListItem->setHidden(true);
-          }
-        }
+  treeWidget->setUpdatesEnabled(false);
+  for (int recordIndex = 0; recordIndex < recordItems.size(); ++recordIndex) {
+    RecordListItem *recordListItem = recordItems[recordIndex];
+    recordListItem->setHidden(not visible[recordIndex]);
+
+    const RecordInfo &recordInfo = catalog->records()[recordIndex];
+    for (int child = 0; child < recordListItem->childCount(); ++child) {
+      auto *recordFileListItem = static_cast<RecordFileListItem *>(recordListItem->child(child));
+      if (recordFileListItem->recordFileInfoIndex >= 0) {
+        recordFileListItem->setHidden(not matchesMimeTypeFilter(recordInfo.files[recordFileListItem->recordFileInfoIndex]));
       }
     }
   }
+  treeWidget->setUpdatesEnabled(true);
 
-  // pagination
-  QJsonValue paginationnext = jsonobject["_pagination"].toObject()["_links"].toObject()["next"];
-  if (paginationnext.isString()) {
-    auto nextPageUrl = paginationnext.toString();
-    QNetworkRequest request = filesReply->request();
-    request.setUrl(QUrl(nextPageUrl));
+  if (not catalog->isRefreshing()) {
+    recordCountLbl->setText(tr("%1 of %2 records").arg(matches.size()).arg(recordItems.size()));
+  }
+}
 
-    preRequestHooks();
-    auto requesthandler = new kadiutils::NetworkHandler(networkAccessManager, this);
-    connect(requesthandler, &kadiutils::NetworkHandler::finished, this, [=, this](QNetworkReply* reply) {
-      processFilesReply(reply, recordIndex, parentRecordListItem);
-      postRequestHooks();
-      delete requesthandler;
-    });
-    requesthandler->sendRequest(request);
+bool DownloadFromKadiDialog::matchesMimeTypeFilter(const RecordFileInfo& recordFileInfo) const {
+  if (mimeTypeFilter->text().isEmpty()) {
+    return true;
   }
+  if (mimeTypeFilter->text() == workflowmimetype) {
+    return recordFileInfo.mimeType == workflowmimetype; // magic will never match
+  }
+
+  QMimeDatabase db;
+  QMimeType filtermimetype = db.mimeTypeForName(mimeTypeFilter->text());
+  return filtermimetype == db.mimeTypeForName(recordFileInfo.mimeType) || filtermimetype == db.mimeTypeForName(recordFileInfo.magicMimeType);
 }
 
-void DownloadFromKadiDialog::updateLoadMoreRecordsBtn() {
-  loadMoreRecordsBtn->setText(tr("Load More (%1/%2 loaded)").arg(loadedRecords).arg(totalItems));
+void DownloadFromKadiDialog::catalogFinished(bool success) {
+  hideLoadingIndicator();
+  if (not success) {
+    fetchRecordsBtn->setText(tr("Fetch Records - %1").arg(catalog->errorString()));
+  }
+  applyLocalFilter();
 }
 
 void DownloadFromKadiDialog::showLoadingIndicator() {
@@ -582,28 +503,9 @@ void DownloadFromKadiDialog::hideLoadingIndicator() {
   loadingIndicatorLbl->setDisabled(true);
 }
 
-int DownloadFromKadiDialog::getNextPageNumber() {
-  int per_page = pageSize->currentText().toInt();
-  if (loadedRecords < per_page) {
-    return 1;
-  } else if (loadedRecords == per_page) {
-    return 2;
-  } else {
-    return (int) floor(((double) loadedRecords / (double) per_page) + 1.0);
-  }
-}
-
-void DownloadFromKadiDialog::preRequestHooks() {
-  activeRequests.ref();
-}
-
-void DownloadFromKadiDialog::postRequestHooks() {
-  activeRequests.deref();
-  if (activeRequests == 0) {
-    hideLoadingIndicator();
-  } else {
-    showLoadingIndicator();
-  }
+const QVector<RecordInfo>& DownloadFromKadiDialog::getAllRecords() const {
+  static const QVector<RecordInfo> none;
+  return catalog ? catalog->records() : none;
 }
 
 void DownloadFromKadiDialog::selectFile(const QString& filepath) {
@@ -658,8 +560,8 @@ void DownloadFromKadiDialog::accept() {
 
   auto *selectedItem = (RecordFileListItem *) treeWidget->selectedItems().first();
   selectedRecord = (RecordListItem *) treeWidget->selectedItems().first()->parent();
-  auto &recordInfo = getAllRecords()[selectedRecord->recordInfoIndex];
-  RecordFileInfo &recordFileInfo = recordInfo.files[selectedItem->recordFileInfoIndex];
+  const auto &recordInfo = getAllRecords()[selectedRecord->recordInfoIndex];
+  const RecordFileInfo &recordFileInfo = recordInfo.files[selectedItem->recordFileInfoIndex];
 
   if (not mimeTypeFilter->text().isEmpty() && (mimeTypeFilter->text() != recordFileInfo.mimeType && mimeTypeFilter->text() != recordFileInfo.magicMimeType)) {
     hideLoadingIndicator();
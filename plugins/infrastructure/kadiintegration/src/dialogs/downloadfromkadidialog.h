@@ -28,13 +28,11 @@ namespace LibFramework {
   class PluginManagerInterface;
 }
 
-class QAtomicInt;
 class QComboBox;
 class QLabel;
 class QMovie;
-class QNetworkAccessManager;
-class QNetworkReply;
 class QString;
+class RecordCatalog;
 
 
 struct RecordListItem : public QTreeWidgetItem {
@@ -71,9 +69,7 @@ public:
 
   void applyFilter(const QString& filter) override;
 
-  QVector<RecordInfo>& getAllRecords() override {
-    return recordsCache;
-  }
+  const QVector<RecordInfo>& getAllRecords() const override;
 
   void selectFile(const QString& filepath) override;
   void setFilename(const QString& instancename, const QString& recordidentifier, const QString& filename) override;
@@ -89,26 +85,21 @@ private:
 
   int operationMode = 0;
 
-  QNetworkAccessManager *networkAccessManager;
-  QAtomicInt activeRequests;
+  RecordCatalog *catalog = nullptr;
+  QVector<RecordListItem *> recordItems;
 
   QComboBox *kadiInstanceSelectionBox;
   QPushButton *kadiConfigBtn;
-  QComboBox *pageSize;
   QLineEdit *filterField;
   QLineEditClearable *mimeTypeFilter;
   QPushButton *fetchRecordsBtn;
-  QPushButton *loadMoreRecordsBtn;
+  QLabel *recordCountLbl;
   QTreeWidget *treeWidget;
   QMovie *loadingGif;
   QLabel *loadingIndicatorLbl;
   QPushButton *createNewRecordBtn;
   QPushButton *acceptAndLoadFileBtn;
 
-  QString urlToNextPageOfRecords;
-  QAtomicInt loadedRecords;
-  QAtomicInt totalItems;
-
   QString loadedFileName;
 
   void setLoadedFileName(const QString &fileName) {
@@ -121,31 +112,40 @@ private:
 
   void getSelectedKadiInstanceFromSelectionBox(int index);
 
-  void fetchRecordsFromKadiInstance(bool useUrlToNextPage);
+  /**
+   * @brief Opens the record catalog of the selected instance, its stored records are shown right away.
+   */
+  void openCatalog();
 
-  void processRecordsReply(QNetworkReply *reply);
+  void refreshRecords();
 
-  void fetchRecordFiles(QTreeWidgetItem *recordTreeWidgetItem);
+  void rebuildRecordItems();
 
-  void processFilesReply(QNetworkReply *filesReply, int recordIndex,
-                         RecordListItem *parentRecordListItem);
+  void addRecordItems(int first, int last);
 
-  void updateLoadMoreRecordsBtn();
+  void updateRecordItem(int recordIndex);
 
-  void showLoadingIndicator();
+  void showRecordFiles(QTreeWidgetItem *recordTreeWidgetItem);
 
-  void hideLoadingIndicator();
+  void updateFileItems(int recordIndex);
+
+  void addFileItems(int recordIndex);
 
-  int getNextPageNumber();
+  /**
+   * @brief Hides the records and files not matching the search query and mime type, without asking the server.
+   */
+  void applyLocalFilter();
 
-  void preRequestHooks();
+  bool matchesMimeTypeFilter(const RecordFileInfo& recordFileInfo) const;
 
-  void postRequestHooks();
+  void catalogFinished(bool success);
+
+  void showLoadingIndicator();
+
+  void hideLoadingIndicator();
 
   void accept() Q_DECL_OVERRIDE;
 
   void openCreateNewRecordDialog();
 
-  QVector<RecordInfo> recordsCache{};
-
 };
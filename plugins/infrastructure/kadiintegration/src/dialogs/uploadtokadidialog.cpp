@@ -20,18 +20,18 @@
 #include <QPushButton>
 #include <QRadioButton>
 #include <QDialogButtonBox>
+#include <QBuffer>
 #include <QMessageBox>
 #include <QProcess>
+#include <QProgressDialog>
 #include <QToolTip>
-#include <QTemporaryFile>
-#include <QTemporaryDir>
-#include <QTextStream>
 
 #include <framework/enhanced/qlineeditclearable.h>
 
 #include <framework/pluginframework/pluginmanagerinterface.h>
 #include <plugins/infrastructure/kadiconfig/kadiconfiginterface.h>
 #include "../kadiintegration.h"
+#include "../transfer/kaditransfer.h"
 #include "../utils/kadiutils.h"
 
 #include "downloadfromkadidialog.h"
@@ -266,80 +266,69 @@ bool UploadToKadiDialog::tryToCreateRecord(const QString& identifier) {
   return true;
 }
 
-bool UploadToKadiDialog::uploadFile(const QByteArray& fileContent, const QString& fileName, const QString& identifier, bool use_fallback_method) {
-
-  QTemporaryDir tmpdir;
-  QTemporaryFile tmpfile;
-  if (!use_fallback_method) {
-    if (!tmpdir.isValid()) {
-      int result = QMessageBox::question(this, tr("File Upload"),
-                           tr("Uploading failed: No temporary directory available. Do you want to reattempt using direct upload?"), QMessageBox::Ok | QMessageBox::Cancel);
-      if (result == QMessageBox::Ok) {
-        use_fallback_method = true;
-      } else {
-        return false;
-      }
-    } else if (!tmpfile.open()) {
-      int result = QMessageBox::question(this, tr("File Upload"),
-                           tr("Uploading failed: No temporary file could be created. Do you want to reattempt using direct upload?"), QMessageBox::Ok | QMessageBox::Cancel);
-      if (result == QMessageBox::Ok) {
-        use_fallback_method = true;
-      } else {
-        return false;
-      }
-    }
+bool UploadToKadiDialog::uploadFile(const QByteArray& fileContent, const QString& fileName, const QString& identifier) {
+  KadiInstance instance;
+  if (!getSelectedKadiInstance(instance)) {
+    QMessageBox::warning(this, tr("File Upload"), tr("The Kadi instance %1 is not configured.").arg(kadiInstanceSelectionBox->currentText()));
+    return false;
   }
 
-  QStringList arguments;
-  if (use_fallback_method) {
-    arguments = QStringList {
-      "records",
-      "add-string-as-file",
-      "-I", kadiInstanceSelectionBox->currentText(),
-      "-R", identifier,
-      "-s", fileContent,
-      "-n", fileName
-    };
-  } else {
-    QTextStream stream(&tmpfile);
-    stream << fileContent << Qt::endl;
-    tmpfile.rename(tmpdir.path() + "/" + fileName); // this is important because the basename is used as filename in kadi
-
-    arguments = QStringList {
-      "records",
-      "add-files",
-      "-I", kadiInstanceSelectionBox->currentText(),
-      "-R", identifier,
-      "-n", tmpfile.fileName()
-    };
-  }
+  QBuffer source;
+  source.setData(fileContent);
+  source.open(QIODevice::ReadOnly);
 
-  if (radioAddToExistingRecord->isChecked() && overwriteFiles->isChecked()) {
-    arguments.append("-f");
-  }
+  KadiTransfer transfer(instance);
+  QProgressDialog progressDialog(tr("Uploading %1 ...").arg(fileName), tr("Cancel"), 0, 1000, this);
+  progressDialog.setWindowModality(Qt::WindowModal);
+  progressDialog.setMinimumDuration(500);
+  connect(&transfer, &KadiTransfer::progress, &progressDialog, [&progressDialog](qint64 done, qint64 total) {
+    progressDialog.setValue(total > 0 ? static_cast<int>(done * 1000 / total) : 0);
+  });
+  connect(&progressDialog, &QProgressDialog::canceled, &transfer, &KadiTransfer::cancel);
 
-  QProcess proc;
-  proc.start("kadi-apy", arguments);
-  proc.waitForFinished();
+  bool overwrite = radioAddToExistingRecord->isChecked() && overwriteFiles->isChecked();
+  transfer.upload(identifier, fileName, &source, overwrite);
 
-  QString stdoutAsStr(proc.readAllStandardOutput());
-  QRegularExpression fileAlreadyExistsPattern("A file with the name '.*' already exists.");
+  while (transfer.state() == KadiTransfer::Failed) {
+    progressDialog.reset();
 
-  if (proc.exitCode() != 0) {
-    if (stdoutAsStr.contains(fileAlreadyExistsPattern)) {
+    if (transfer.httpStatus() == 409) {
       int result = QMessageBox::question(this, tr("File Upload"), tr("Uploading the file failed, because it already exists in this record, do you want to overwrite it?"), QMessageBox::Ok | QMessageBox::Cancel);
       if (result == QMessageBox::Ok) {
         this->overwriteFiles->click();
         this->radioAddToExistingRecord->click();
-        return uploadFile(fileContent, fileName, identifier, use_fallback_method);
+        return uploadFile(fileContent, fileName, identifier);
       }
       return false;
-    } else {
-      kadiutils::showWarningWithProcOutput(this, tr("File Upload"), tr("Uploading the file failed. Output from kadi-apy:"), proc);
+    }
+
+    // the chunks which made it to Kadi are not sent again
+    int result = QMessageBox::question(this, tr("File Upload"), tr("Uploading the file failed: %1\n\nDo you want to resume the upload?").arg(transfer.errorString()), QMessageBox::Retry | QMessageBox::Cancel);
+    if (result != QMessageBox::Retry) {
+      transfer.cancel();
+      transfer.wait();
       return false;
     }
-  } else {
-    QMessageBox::information(this, tr("File Upload"), tr("Upload successful."));
-    return true;
+    transfer.resume();
+    transfer.wait();
+  }
+
+  if (transfer.state() != KadiTransfer::Finished) {
+    // canceled, the upload is still being deleted on the server
+    transfer.wait();
+    return false;
+  }
+
+  QMessageBox::information(this, tr("File Upload"), tr("Upload successful."));
+  return true;
+}
+
+bool UploadToKadiDialog::getSelectedKadiInstance(KadiInstance& instance) {
+  for (const auto &kadiInstance : kadiConfigInterface->getAllInstances()) {
+    if (kadiInstance.name == kadiInstanceSelectionBox->currentText()) {
+      instance = kadiInstance;
+      return true;
+    }
   }
+  return false;
 }
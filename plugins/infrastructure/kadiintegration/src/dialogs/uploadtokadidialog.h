@@ -23,6 +23,7 @@ namespace LibFramework {
 }
 
 class KadiConfigInterface;
+struct KadiInstance;
 
 class QString;
 class QCheckBox;
@@ -66,7 +67,9 @@ private:
 
   bool tryToCreateRecord(const QString& identifier);
 
-  bool uploadFile(const QByteArray& fileContent, const QString& filename, const QString& identifier, bool use_fallback_method = false);
+  bool uploadFile(const QByteArray& fileContent, const QString& filename, const QString& identifier);
+
+  bool getSelectedKadiInstance(KadiInstance& instance);
 
   KadiConfigInterface *kadiConfigInterface;
 
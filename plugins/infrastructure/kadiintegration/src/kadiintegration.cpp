@@ -16,6 +16,7 @@
 #include "utils/kadiutils.h"
 #include "../src/dialogs/downloadfromkadidialog.h"
 #include "../src/dialogs/uploadtokadidialog.h"
+#include "transfer/kaditransfer.h"
 
 
 KadiIntegration::KadiIntegration(LibFramework::PluginManagerInterface* pluginManager) : pluginManager(pluginManager) {
@@ -29,6 +30,10 @@ UploadToKadiDialogInterface* KadiIntegration::createUploadToKadiDialog() {
   return new UploadToKadiDialog(pluginManager);
 }
 
+KadiTransferInterface* KadiIntegration::createTransfer(const KadiInstance& instance) {
+  return new KadiTransfer(instance);
+}
+
 bool KadiIntegration::getRecordIdentifier(const QString &filepath, QString& kadiInstanceName, QString& recordIdentifier, QString& kadifilename) {
   return kadiutils::getRecordIdentifier(filepath, kadiInstanceName, recordIdentifier, kadifilename);
 }
@@ -36,6 +36,7 @@ public:
 
   DownloadFromKadiDialogInterface* createDownloadFromKadiDialog() override;
   UploadToKadiDialogInterface* createUploadToKadiDialog() override;
+  KadiTransferInterface* createTransfer(const KadiInstance& instance) override;
 
   bool getRecordIdentifier(const QString &filepath, QString& kadiInstanceName, QString& recordIdentifier, QString& kadifilename) override;
 
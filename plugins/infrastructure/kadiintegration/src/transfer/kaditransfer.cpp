@@ -0,0 +1,542 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <algorithm>
+
+#include <QDebug>
+#include <QEventLoop>
+#include <QFileDevice>
+#include <QHttpMultiPart>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QNetworkReply>
+#include <QNetworkRequest>
+#include <QSet>
+#include <QTimer>
+#include <QUrl>
+
+#include "../utils/kadiutils.h"
+#include "kaditransfer.h"
+
+namespace {
+
+int statusOf(QNetworkReply *reply) {
+  return reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+}
+
+QHttpPart formPart(const QString& name, const QByteArray& body) {
+  QHttpPart part;
+  part.setHeader(QNetworkRequest::ContentDispositionHeader, QString("form-data; name=\"%1\"").arg(name));
+  part.setBody(body);
+  return part;
+}
+
+}
+
+KadiTransfer::KadiTransfer(const KadiInstance& instance, QObject *parent)
+    : QObject(parent), instance(instance), direction(Download), currentState(Idle), retries(DEFAULT_MAXIMUM_RETRIES),
+      attempt(0), timeoutMsecs(DEFAULT_TIMEOUT), lastStatus(0), target(nullptr), unmodified(false),
+      hash(QCryptographicHash::Md5), written(0), total(-1), source(nullptr), replace(false), recordId(-1),
+      chunkSize(0), acknowledged(0) {
+}
+
+KadiTransfer::~KadiTransfer() {
+  // the handlers of the aborted request must not continue the transfer
+  currentState = Canceled;
+  if (current) {
+    current->abort();
+  }
+}
+
+void KadiTransfer::startDownload(const QString& url, QFileDevice *target, const QString& checksum, const QString& etag) {
+  if (currentState == Running) {
+    qWarning() << "Kadi transfer is already running";
+    return;
+  }
+
+  direction = Download;
+  this->url = url;
+  this->target = target;
+  expectedChecksum = checksum;
+  knownEtag = etag;
+  receivedEtag.clear();
+  unmodified = false;
+  result.clear();
+  error.clear();
+  lastStatus = 0;
+  attempt = 0;
+  total = -1;
+
+  // a partial file is continued, the checksum still covers all of it
+  hash.reset();
+  written = 0;
+  if (target->size() > 0) {
+    target->seek(0);
+    while (!target->atEnd()) {
+      QByteArray chunk = target->read(BUFFER_SIZE);
+      if (chunk.isEmpty()) break;
+      hash.addData(chunk);
+      written += chunk.size();
+    }
+  }
+  target->seek(written);
+
+  currentState = Running;
+  sendDownloadRequest();
+}
+
+void KadiTransfer::startUpload(const QString& recordIdentifier, const QString& filename, QIODevice *source, bool replace) {
+  if (currentState == Running) {
+    qWarning() << "Kadi transfer is already running";
+    return;
+  }
+
+  direction = Upload;
+  this->recordIdentifier = recordIdentifier;
+  this->filename = filename;
+  this->source = source;
+  this->replace = replace;
+  recordId = -1;
+  uploadObject = QJsonObject();
+  pendingChunks.clear();
+  acknowledged = 0;
+  total = source->size();
+  error.clear();
+  lastStatus = 0;
+  attempt = 0;
+
+  currentState = Running;
+  resolveRecord();
+}
+
+void KadiTransfer::resume() {
+  if (currentState != Failed) return;
+
+  if (direction == Download) {
+    currentState = Idle;
+    startDownload(url, target, expectedChecksum, knownEtag);
+    return;
+  }
+
+  currentState = Running;
+  error.clear();
+  attempt = 0;
+  if (recordId < 0) {
+    resolveRecord();
+  } else if (uploadObject.isEmpty()) {
+    createUpload();
+  } else {
+    queryUploadedChunks();
+  }
+}
+
+void KadiTransfer::cancel() {
+  if (currentState != Running && currentState != Failed) return;
+
+  currentState = Canceled;
+  if (current) {
+    current->abort();
+  }
+
+  if (direction == Upload && !uploadObject.isEmpty()) {
+    cleanup = networkAccessManager.deleteResource(createRequest(uploadObject["_links"].toObject()["self"].toString()));
+    connect(cleanup, &QNetworkReply::finished, cleanup, &QNetworkReply::deleteLater);
+  }
+
+  Q_EMIT finished();
+}
+
+void KadiTransfer::wait() {
+  QEventLoop eventLoop;
+  if (currentState == Running) {
+    connect(this, &KadiTransfer::finished, &eventLoop, &QEventLoop::quit);
+  } else if (cleanup && cleanup->isRunning()) {
+    // destroying the transfer would abort deleting the canceled upload
+    connect(cleanup, &QNetworkReply::finished, &eventLoop, &QEventLoop::quit);
+  } else {
+    return;
+  }
+  eventLoop.exec();
+}
+
+KadiTransfer::State KadiTransfer::state() const {
+  return currentState;
+}
+
+void KadiTransfer::setMaximumRetries(int retries) {
+  this->retries = retries;
+}
+
+int KadiTransfer::maximumRetries() const {
+  return retries;
+}
+
+void KadiTransfer::setTimeout(int msecs) {
+  timeoutMsecs = msecs;
+}
+
+int KadiTransfer::timeout() const {
+  return timeoutMsecs;
+}
+
+bool KadiTransfer::download(const QString& url, QFileDevice *target, const QString& checksum, const QString& etag) {
+  startDownload(url, target, checksum, etag);
+  wait();
+  return currentState == Finished;
+}
+
+bool KadiTransfer::upload(const QString& recordIdentifier, const QString& filename, QIODevice *source, bool replace) {
+  startUpload(recordIdentifier, filename, source, replace);
+  wait();
+  return currentState == Finished;
+}
+
+bool KadiTransfer::notModified() const {
+  return unmodified;
+}
+
+QString KadiTransfer::etag() const {
+  return receivedEtag;
+}
+
+QByteArray KadiTransfer::md5() const {
+  return result;
+}
+
+int KadiTransfer::httpStatus() const {
+  return lastStatus;
+}
+
+QString KadiTransfer::errorString() const {
+  return error;
+}
+
+QNetworkRequest KadiTransfer::createRequest(const QString& url) const {
+  QNetworkRequest request((QUrl(url)));
+  request.setRawHeader("Authorization", (QString("Bearer ") + instance.token).toUtf8());
+  request.setTransferTimeout(timeoutMsecs);
+  return request;
+}
+
+void KadiTransfer::send(const std::function<QNetworkReply*()>& request, const std::function<void(QNetworkReply*)>& handler) {
+  // a progress handler may have canceled the transfer
+  if (currentState != Running) return;
+
+  QNetworkReply *reply = request();
+  current = reply;
+
+  connect(reply, &QNetworkReply::finished, this, [this, reply, request, handler]() {
+    reply->deleteLater();
+    if (current == reply) {
+      current = nullptr;
+    }
+    if (currentState != Running) return;
+
+    lastStatus = statusOf(reply);
+    if (kadiutils::isTransientError(reply) && attempt < retries) {
+      int delay = kadiutils::retryDelay(reply, attempt);
+      attempt++;
+      qDebug() << "Retrying" << reply->url() << "in" << delay << "ms:" << reply->errorString();
+      QTimer::singleShot(delay, this, [this, request, handler]() {
+        if (currentState == Running) {
+          send(request, handler);
+        }
+      });
+      return;
+    }
+
+    attempt = 0;
+    handler(reply);
+  });
+}
+
+void KadiTransfer::sendDownloadRequest() {
+  send([this]() {
+    // the range is computed for every attempt, a retry continues after the bytes already written
+    QNetworkRequest request = createRequest(url);
+    if (written > 0) {
+      request.setRawHeader("Range", "bytes=" + QByteArray::number(written) + "-");
+    } else if (!knownEtag.isEmpty()) {
+      request.setRawHeader("If-None-Match", knownEtag.toUtf8());
+    }
+
+    QNetworkReply *reply = networkAccessManager.get(request);
+    reply->setReadBufferSize(BUFFER_SIZE);
+    connect(reply, &QNetworkReply::readyRead, this, [this, reply]() { writeDownloadData(reply); });
+    return reply;
+  }, [this](QNetworkReply *reply) { downloadFinished(reply); });
+}
+
+void KadiTransfer::writeDownloadData(QNetworkReply *reply) {
+  if (currentState != Running) return;
+
+  int status = statusOf(reply);
+  if (status != 200 && status != 206) return; // error bodies are no content
+
+  if (status == 200 && written > 0) {
+    // the server ignored the range, start over
+    qDebug() << "Range request not supported, downloading" << url << "again";
+    discardDownload();
+  }
+
+  if (total < 0) {
+    QByteArray range = reply->rawHeader("Content-Range");
+    qsizetype slash = range.lastIndexOf('/');
+    if (status == 206 && slash >= 0) {
+      total = range.mid(slash + 1).toLongLong();
+    } else {
+      QVariant length = reply->header(QNetworkRequest::ContentLengthHeader);
+      total = length.isValid() ? written + length.toLongLong() : 0;
+    }
+  }
+
+  while (reply->bytesAvailable() > 0) {
+    QByteArray chunk = reply->read(BUFFER_SIZE);
+    if (target->write(chunk) != chunk.size()) {
+      fail(tr("Can not write the downloaded file: %1").arg(target->errorString()));
+      reply->abort();
+      return;
+    }
+    hash.addData(chunk);
+    written += chunk.size();
+  }
+  Q_EMIT progress(written, total);
+}
+
+void KadiTransfer::downloadFinished(QNetworkReply *reply) {
+  if (lastStatus == 304) {
+    unmodified = true;
+    receivedEtag = knownEtag;
+    finish(Finished);
+    return;
+  }
+  if (lastStatus == 416 && written > 0) {
+    // the partial file is not a prefix of the file on the server
+    qDebug() << "Range not satisfiable, downloading" << url << "again";
+    discardDownload();
+    sendDownloadRequest();
+    return;
+  }
+  if (reply->error() != QNetworkReply::NoError) {
+    fail(reply);
+    return;
+  }
+
+  writeDownloadData(reply);
+  if (currentState != Running) return;
+
+  target->flush();
+  result = hash.result();
+  receivedEtag = QString::fromUtf8(reply->rawHeader("ETag"));
+  if (!expectedChecksum.isEmpty() && expectedChecksum.compare(QString::fromLatin1(result.toHex()), Qt::CaseInsensitive) != 0) {
+    // nothing of it can be trusted, resume() has to start from the beginning
+    discardDownload();
+    fail(tr("The downloaded file does not match its checksum"));
+    return;
+  }
+  finish(Finished);
+}
+
+void KadiTransfer::discardDownload() {
+  target->resize(0);
+  target->seek(0);
+  hash.reset();
+  written = 0;
+  total = -1;
+}
+
+void KadiTransfer::resolveRecord() {
+  QString url = apiUrl("records/identifier/" + QString::fromLatin1(QUrl::toPercentEncoding(recordIdentifier)));
+  send([this, url]() { return networkAccessManager.get(createRequest(url)); }, [this](QNetworkReply *reply) {
+    QJsonObject record;
+    if (!receiveJson(reply, record)) {
+      return;
+    }
+    recordId = record["id"].toInt();
+    createUpload();
+  });
+}
+
+void KadiTransfer::createUpload() {
+  QString url = apiUrl(QString("records/%1/uploads").arg(recordId));
+  QByteArray body = QJsonDocument(QJsonObject {{"name", filename}, {"size", total}}).toJson(QJsonDocument::Compact);
+  send([this, url, body]() {
+    QNetworkRequest request = createRequest(url);
+    request.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
+    return networkAccessManager.post(request, body);
+  }, [this](QNetworkReply *reply) {
+    if (lastStatus == 409 && replace) {
+      replaceFile();
+    } else {
+      uploadCreated(reply);
+    }
+  });
+}
+
+void KadiTransfer::replaceFile() {
+  QString url = apiUrl(QString("records/%1/files/name/").arg(recordId) + QString::fromLatin1(QUrl::toPercentEncoding(filename)));
+  send([this, url]() { return networkAccessManager.get(createRequest(url)); }, [this](QNetworkReply *reply) {
+    QJsonObject file;
+    if (!receiveJson(reply, file)) {
+      return;
+    }
+
+    // uploading a new version of an existing file
+    QString url = apiUrl(QString("records/%1/files/%2").arg(recordId).arg(file["id"].toString()));
+    QByteArray body = QJsonDocument(QJsonObject {{"size", total}}).toJson(QJsonDocument::Compact);
+    send([this, url, body]() {
+      QNetworkRequest request = createRequest(url);
+      request.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
+      return networkAccessManager.put(request, body);
+    }, [this](QNetworkReply *reply) { uploadCreated(reply); });
+  });
+}
+
+void KadiTransfer::uploadCreated(QNetworkReply *reply) {
+  QJsonObject upload;
+  if (!receiveJson(reply, upload)) {
+    return;
+  }
+
+  chunkSize = upload["_meta"].toObject()["chunk_size"].toInteger();
+  int chunkcount = upload["chunk_count"].toInt();
+  if (chunkSize <= 0 || chunkcount * chunkSize < total) {
+    fail(tr("Invalid upload from %1").arg(reply->url().toString()));
+    return;
+  }
+  uploadObject = upload;
+
+  for (int index = 0; index < chunkcount; ++index) {
+    pendingChunks.append(index);
+  }
+  sendNextChunk();
+}
+
+void KadiTransfer::queryUploadedChunks() {
+  QString url = uploadObject["_links"].toObject()["self"].toString();
+  send([this, url]() { return networkAccessManager.get(createRequest(url)); }, [this](QNetworkReply *reply) {
+    QJsonObject status;
+    if (!receiveJson(reply, status)) {
+      return;
+    }
+
+    // only the chunks the server is missing are sent again
+    QSet<int> uploaded;
+    for (const QJsonValue& chunk : status["chunks"].toArray()) {
+      uploaded.insert(chunk.toObject()["index"].toInt());
+    }
+    pendingChunks.clear();
+    acknowledged = 0;
+    for (int index = 0; index < uploadObject["chunk_count"].toInt(); ++index) {
+      if (uploaded.contains(index)) {
+        acknowledged += std::min(chunkSize, total - index * chunkSize);
+      } else {
+        pendingChunks.append(index);
+      }
+    }
+    Q_EMIT progress(acknowledged, total);
+    sendNextChunk();
+  });
+}
+
+void KadiTransfer::sendNextChunk() {
+  if (pendingChunks.isEmpty()) {
+    finishUpload();
+    return;
+  }
+
+  int index = pendingChunks.first();
+  qint64 size = std::min(chunkSize, total - index * chunkSize);
+  QString url = uploadObject["_actions"].toObject()["upload_chunk"].toString();
+
+  send([this, index, size, url]() {
+    // read when sent, only one chunk is held in memory
+    source->seek(index * chunkSize);
+    QByteArray data = source->read(size);
+
+    auto *multipart = new QHttpMultiPart(QHttpMultiPart::FormDataType);
+    multipart->append(formPart("index", QByteArray::number(index)));
+    multipart->append(formPart("size", QByteArray::number(data.size())));
+    multipart->append(formPart("checksum", QCryptographicHash::hash(data, QCryptographicHash::Md5).toHex()));
+    QHttpPart blob;
+    blob.setHeader(QNetworkRequest::ContentTypeHeader, "application/octet-stream");
+    blob.setHeader(QNetworkRequest::ContentDispositionHeader, "form-data; name=\"blob\"; filename=\"blob\"");
+    blob.setBody(data);
+    multipart->append(blob);
+
+    QNetworkReply *reply = networkAccessManager.put(createRequest(url), multipart);
+    multipart->setParent(reply);
+    connect(reply, &QNetworkReply::uploadProgress, this, [this, size](qint64 sent, qint64) {
+      Q_EMIT progress(acknowledged + std::min(sent, size), total);
+    });
+    return reply;
+  }, [this, index, size](QNetworkReply *reply) {
+    if (reply->error() != QNetworkReply::NoError) {
+      fail(reply);
+      return;
+    }
+    pendingChunks.removeOne(index);
+    acknowledged += size;
+    Q_EMIT progress(acknowledged, total);
+    sendNextChunk();
+  });
+}
+
+void KadiTransfer::finishUpload() {
+  QString url = uploadObject["_actions"].toObject()["finish_upload"].toString();
+  send([this, url]() { return networkAccessManager.post(createRequest(url), QByteArray()); }, [this](QNetworkReply *reply) {
+    if (reply->error() != QNetworkReply::NoError) {
+      fail(reply);
+      return;
+    }
+    finish(Finished);
+  });
+}
+
+void KadiTransfer::fail(QNetworkReply *reply) {
+  // Kadi explains errors in the description of the JSON body
+  QJsonObject body = QJsonDocument::fromJson(reply->readAll()).object();
+  QString description = body["description"].toString();
+  fail(description.isEmpty() ? reply->errorString() : description);
+}
+
+void KadiTransfer::fail(const QString& message) {
+  error = message;
+  qWarning() << "Kadi transfer failed:" << message;
+  finish(Failed);
+}
+
+void KadiTransfer::finish(State state) {
+  currentState = state;
+  Q_EMIT finished();
+}
+
+bool KadiTransfer::receiveJson(QNetworkReply *reply, QJsonObject& result) {
+  if (reply->error() != QNetworkReply::NoError) {
+    fail(reply);
+    return false;
+  }
+
+  QJsonParseError parseerror;
+  result = QJsonDocument::fromJson(reply->readAll(), &parseerror).object();
+  if (parseerror.error != QJsonParseError::NoError) {
+    fail(tr("Invalid response from %1: %2").arg(reply->url().toString(), parseerror.errorString()));
+    return false;
+  }
+  return true;
+}
+
+QString KadiTransfer::apiUrl(const QString& path) const {
+  return instance.host + (instance.host.endsWith("/") ? "" : "/") + "api/" + path;
+}
@@ -0,0 +1,206 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <functional>
+
+#include <QCryptographicHash>
+#include <QJsonObject>
+#include <QNetworkAccessManager>
+#include <QObject>
+#include <QPointer>
+
+#include <plugins/infrastructure/kadiconfig/kadiinstance.h>
+
+#include "../../kaditransferinterface.h"
+
+class QNetworkReply;
+class QNetworkRequest;
+
+/**
+ * @brief      Uploads and downloads files of Kadi records without holding
+ *             them in memory.
+ *
+ *             Downloads are streamed to the target through a bounded read
+ *             buffer. An interrupted download continues with a range
+ *             request after the bytes already written, a partial file
+ *             from an earlier session is continued the same way. A
+ *             download failing its checksum is discarded and starts over.
+ *
+ *             Uploads go through the chunked upload API of Kadi: an upload
+ *             is created for the record, the chunks are sent one by one,
+ *             each read from the source only when it is sent, and the
+ *             upload is finished once all chunks are there. A failed chunk
+ *             is sent again, resume() continues a failed upload with the
+ *             chunks the server does not have yet.
+ *
+ *             Requests failing with a network error or with HTTP status
+ *             429, 502, 503 or 504 are retried after an exponential
+ *             backoff. Waiting for the retry is done with a timer, the
+ *             transfer runs in the event loop of the caller.
+ * @ingroup    kadiintegration
+ */
+class KadiTransfer : public QObject, public KadiTransferInterface {
+    Q_OBJECT
+
+  public:
+    enum State {
+      Idle,
+      Running,
+      Finished,
+      Failed,
+      Canceled
+    };
+
+    explicit KadiTransfer(const KadiInstance& instance, QObject *parent = nullptr);
+    ~KadiTransfer() override;
+
+    /**
+     * @brief      Starts a download, see download(). The transfer is
+     *             finished with the finished() signal.
+     */
+    void startDownload(const QString& url, QFileDevice *target, const QString& checksum = QString(),
+                       const QString& etag = QString());
+
+    /**
+     * @brief      Starts an upload, see upload().
+     */
+    void startUpload(const QString& recordIdentifier, const QString& filename, QIODevice *source, bool replace = false);
+
+    /**
+     * @brief      Continues a failed transfer where it stopped.
+     */
+    void resume();
+
+    /**
+     * @brief      Aborts the transfer. A started upload is deleted on the
+     *             server, a partial download stays in the target. Call
+     *             wait() before destroying the transfer, so that deleting
+     *             the upload is not aborted.
+     */
+    void cancel();
+
+    /**
+     * @brief      Blocks in a local event loop until the transfer is no
+     *             longer running, and a canceled upload is deleted.
+     */
+    void wait();
+
+    State state() const;
+
+    void setMaximumRetries(int retries);
+    int maximumRetries() const;
+
+    /**
+     * @brief      Requests are aborted once no data arrived for this long.
+     */
+    void setTimeout(int msecs);
+    int timeout() const;
+
+    // KadiTransferInterface
+    bool download(const QString& url, QFileDevice *target, const QString& checksum = QString(),
+                  const QString& etag = QString()) override;
+    bool upload(const QString& recordIdentifier, const QString& filename, QIODevice *source, bool replace = false) override;
+    bool notModified() const override;
+    QString etag() const override;
+    QByteArray md5() const override;
+    int httpStatus() const override;
+    QString errorString() const override;
+
+    const static int DEFAULT_MAXIMUM_RETRIES = 5;
+    const static int DEFAULT_TIMEOUT = 30000;
+    const static qint64 BUFFER_SIZE = 1 << 20;
+
+  Q_SIGNALS:
+    void progress(qint64 done, qint64 total);
+    void finished();
+
+  private:
+    enum Direction {
+      Download,
+      Upload
+    };
+
+    QNetworkRequest createRequest(const QString& url) const;
+
+    /**
+     * @brief      Sends a request and retries it on transient errors. The
+     *             handler gets the final reply, it is deleted afterwards.
+     */
+    void send(const std::function<QNetworkReply*()>& request, const std::function<void(QNetworkReply*)>& handler);
+
+    void sendDownloadRequest();
+    void writeDownloadData(QNetworkReply *reply);
+    void downloadFinished(QNetworkReply *reply);
+    /**
+     * @brief      Empties the target, the download starts over with the
+     *             next request.
+     */
+    void discardDownload();
+
+    void resolveRecord();
+    void createUpload();
+    void replaceFile();
+    void uploadCreated(QNetworkReply *reply);
+    void queryUploadedChunks();
+    void sendNextChunk();
+    void finishUpload();
+
+    void fail(QNetworkReply *reply);
+    void fail(const QString& message);
+    void finish(State state);
+    /**
+     * @brief      Parses the JSON body of a reply, fails the transfer if the
+     *             request failed or the body is no JSON.
+     */
+    bool receiveJson(QNetworkReply *reply, QJsonObject& result);
+    QString apiUrl(const QString& path) const;
+
+    KadiInstance instance;
+    QNetworkAccessManager networkAccessManager;
+    QPointer<QNetworkReply> current;
+    QPointer<QNetworkReply> cleanup;
+
+    Direction direction;
+    State currentState;
+    int retries;
+    int attempt;
+    int timeoutMsecs;
+    int lastStatus;
+    QString error;
+
+    // download
+    QString url;
+    QFileDevice *target;
+    QString expectedChecksum;
+    QString knownEtag;
+    QString receivedEtag;
+    bool unmodified;
+    QCryptographicHash hash;
+    QByteArray result;
+    qint64 written;
+    qint64 total;
+
+    // upload
+    QString recordIdentifier;
+    QString filename;
+    QIODevice *source;
+    bool replace;
+    int recordId;
+    QJsonObject uploadObject;
+    QList<int> pendingChunks;
+    qint64 chunkSize;
+    qint64 acknowledged;
+};
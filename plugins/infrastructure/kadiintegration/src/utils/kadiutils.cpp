@@ -12,6 +12,8 @@
  * See the License for the specific language governing permissions and
  * limitations under the License. */
 
+#include <algorithm>
+
 #include <QEventLoop>
 #include <QTimer>
 #include <QNetworkAccessManager>
@@ -102,6 +104,43 @@ void kadiutils::reportErrorToUser(QNetworkReply* networkReply, QWidget* parent)
   mbox.exec();
 }
 
+bool kadiutils::isTransientError(QNetworkReply* networkReply) {
+  switch (getHttpCode(networkReply)) {
+    case 429:
+    case 502:
+    case 503:
+    case 504:
+      return true;
+    default:
+      break;
+  }
+
+  // the connection broke or timed out, possibly in the middle of the response
+  switch (networkReply->error()) {
+    case QNetworkReply::ConnectionRefusedError:
+    case QNetworkReply::RemoteHostClosedError:
+    case QNetworkReply::TimeoutError:
+    case QNetworkReply::OperationCanceledError:
+    case QNetworkReply::TemporaryNetworkFailureError:
+    case QNetworkReply::NetworkSessionFailedError:
+    case QNetworkReply::UnknownNetworkError:
+    case QNetworkReply::ProxyTimeoutError:
+      return true;
+    default:
+      return false;
+  }
+}
+
+int kadiutils::retryDelay(QNetworkReply* networkReply, int attempt) {
+  bool ok = false;
+  int retryafter = networkReply->rawHeader("Retry-After").toInt(&ok);
+  if (ok && retryafter >= 0) {
+    // a server asking for minutes would block the transfer, retry at the latest after the backoff cap
+    return std::min(retryafter, MAXIMUM_RETRY_DELAY / 1000) * 1000;
+  }
+  return std::min(500 << std::min(attempt, 4), MAXIMUM_RETRY_DELAY);
+}
+
 void kadiutils::NetworkHandler::sendRequest(const QNetworkRequest& request) {
   qDebug() << request.url();
   qDebug() << request.rawHeaderList();
@@ -114,25 +153,18 @@ void kadiutils::NetworkHandler::sendRequest(const QNetworkRequest& request) {
 }
 
 void kadiutils::NetworkHandler::handleRequest(QNetworkReply* reply) {
-  int statuscode = getHttpCode(reply);
-
-  // handle 429 error
-  if (statuscode == 429) {
-    qWarning() << "429 received, delaying retry..." << Qt::endl;
-    kadiutils::yieldForMilliseconds(500);
+  if (isTransientError(reply) && attempt < MAXIMUM_RETRIES) {
+    int delay = retryDelay(reply, attempt);
+    attempt++;
+    qWarning() << "HTTP code" << getHttpCode(reply) << "received, retrying in" << delay << "ms";
 
-    QNetworkRequest request(reply->request());
-
-    auto *retryReply = networkAccessManager->get(request);
-
-    connect(retryReply, &QNetworkReply::finished, this, [this, retryReply] {
-      handleRequest(retryReply);
-      retryReply->deleteLater();
+    QTimer::singleShot(delay, this, [this, request = reply->request()] {
+      sendRequest(request);
     });
-
     return;
   }
 
+  attempt = 0;
   if (reply->error()) reportErrorToUser(reply, parent);
 
   Q_EMIT finished(reply);
@@ -75,13 +75,32 @@ namespace kadiutils {
    */
   void reportErrorToUser(QNetworkReply* networkReply, QWidget* parent);
 
+  /**
+   * @brief Tells whether a failed request may succeed when sent again, because the server
+   *        asked to slow down or was unavailable, or because the connection broke.
+   * @param networkReply finished reply of the request
+   */
+  bool isTransientError(QNetworkReply* networkReply);
+
+  const int MAXIMUM_RETRY_DELAY = 8000;
+
+  /**
+   * @brief Time to wait before sending a request again, the Retry-After header of the reply
+   *        if there is one and an exponential backoff otherwise, at most MAXIMUM_RETRY_DELAY.
+   * @param networkReply finished reply of the request
+   * @param attempt number of retries already done
+   * @return the delay in milliseconds
+   */
+  int retryDelay(QNetworkReply* networkReply, int attempt);
+
 class NetworkHandler : public QObject {
   Q_OBJECT
 
 public:
   NetworkHandler(QNetworkAccessManager* networkAccessManager, QWidget* parent = nullptr)
       : networkAccessManager(networkAccessManager),
-        parent(parent) {
+        parent(parent),
+        attempt(0) {
   }
 
   ~NetworkHandler() = default;
@@ -94,7 +113,8 @@ Q_SIGNALS:
 private:
 
   /**
-   * Checks the http code and if not status code 429 send a signal
+   * Sends the request again after a delay on transient errors, signals the reply otherwise.
+   * The delay is waited for with a timer, not in a nested event loop.
    * @param networkReply reply to handle
    */
   void handleRequest(QNetworkReply* reply);
@@ -103,6 +123,10 @@ private:
 
   QWidget *parent;
 
+  int attempt;
+
+  const static int MAXIMUM_RETRIES = 5;
+
 };
 
 }
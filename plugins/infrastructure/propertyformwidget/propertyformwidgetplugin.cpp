@@ -30,3 +30,8 @@ LibFramework::InterfaceContainer* PropertyFormWidgetPlugin::createInterfaces() {
   // to add it to a layout
   return new LibFramework::InterfaceContainer(new PropertyFormWidget(pluginmanager));
 }
+
+bool PropertyFormWidgetPlugin::hasStableInterfaces() const {
+  // every lookup has to get its own widget
+  return false;
+}
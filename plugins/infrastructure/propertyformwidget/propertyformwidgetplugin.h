@@ -32,6 +32,7 @@ class PropertyFormWidgetPlugin : public LibFramework::PluginInterface {
     void unload() override;
 
     LibFramework::InterfaceContainer* createInterfaces() override;
+    bool hasStableInterfaces() const override;
 
   private:
     PropertyFormWidgetInterface *interface;
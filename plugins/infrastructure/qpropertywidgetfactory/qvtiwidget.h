@@ -39,4 +39,9 @@ class QVTIWidget : public QWidgetInterfaceImpl, public VTIWidget {
       return VTIWidget::getValueTypeInterface();
     }
 
+  protected:
+    void valueTypeInterfaceDestroyed() override {
+      setEnabled(false);
+    }
+
 };
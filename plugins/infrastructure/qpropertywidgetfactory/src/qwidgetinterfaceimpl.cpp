@@ -20,6 +20,7 @@
 #include <QList>
 
 #include <plugins/infrastructure/widgetdialog/editdialoginterface.h>
+#include <properties/data/valuetypeinterface/numerictext.h>
 
 #include "qwidgetinterfaceimpl.h"
 
@@ -50,11 +51,16 @@ QWidgetInterfaceImpl::QWidgetInterfaceImpl(QWidget* widget) : /*QWidget(widget->
 }
 
 void QWidgetInterfaceImpl::resetDefault() {
+  if (!getValueTypeInterface()) return;
   const ValueTypeInterfaceHint *hint = getValueTypeInterface()->getHint();
   if (hint->hasEntry("default")) {
     std::string default_value;
     hint->getEntry("default", default_value);
-    getValueTypeInterface()->fromString(default_value);
+    try {
+      getValueTypeInterface()->fromString(default_value);
+    } catch (const NumericTextError& error) {
+      qWarning() << "Can not reset to the default" << QString::fromStdString(default_value) << ":" << error.what();
+    }
   }
 }
 
@@ -82,6 +88,8 @@ void QWidgetInterfaceImpl::sendFocus() {
 }
 
 void QWidgetInterfaceImpl::validate() {
+  // the element of a shrunk container is gone, there is nothing to validate against
+  if (!getValueTypeInterface()) return;
   Q_EMIT inputValidated(validateValue());
 }
 
@@ -149,7 +157,9 @@ void QWidgetInterfaceImpl::addDialog(EditDialogInterface* dialog) {
 
   connect(action, &QAction::triggered, this, &QWidgetInterfaceImpl::sendFocus);
   connect(action, &QAction::triggered, [dialog, this]() {
-    dialog->exec(this->getValueTypeInterface());
+    if (this->getValueTypeInterface()) {
+      dialog->exec(this->getValueTypeInterface());
+    }
   });
 
   dialoglist->append(dialog);
@@ -21,7 +21,7 @@
 
 
 void QVTIToolTip::showText(const QPoint &pos, const QWidgetInterface* qwti) {
-  if (qwti) {
+  if (qwti && qwti->getValueTypeInterface()) {
     const auto hint = qwti->getValueTypeInterface()->getHint();
     QString tooltiptext;
     if (hint->hasEntry("label")) {
@@ -44,6 +44,11 @@ class QVTIWidget_ContainerPanel : public PropertyPanel, public QWidgetInterfaceI
     void nextColumn() override;
     void nextRow() override;
 
+  protected:
+    void valueTypeInterfaceDestroyed() override {
+      setEnabled(false);
+    }
+
   private:
     int main_row{};
     int main_column{};
@@ -12,6 +12,8 @@
  * See the License for the specific language governing permissions and
  * limitations under the License. */
 
+#include <properties/data/valuetypeinterface/numerictext.h>
+
 #include "qvtiwidget_matrix_lineedit.h"
 
 
@@ -57,7 +59,11 @@ bool QVTIWidget_Matrix_lineedit::validateValue() {
 
 void QVTIWidget_Matrix_lineedit::updateValue(const QString& value) {
   if (validateSize() && validateValue()) {
-    getValueTypeInterface()->fromString(value.toStdString());
+    try {
+      getValueTypeInterface()->fromString(value.toStdString());
+    } catch (const NumericTextError&) {
+      // the text is incomplete while typing, the matrix keeps its last value until it parses
+    }
   }
 }
 
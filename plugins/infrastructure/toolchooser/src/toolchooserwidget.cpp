@@ -132,8 +132,8 @@ QWidget *ToolChooserWidget::getWidget() {
 void ToolChooserWidget::updateDirContent(QTreeWidgetItem *toolItem, const QString &path) {
   QString toolname = toolItem->text(0);
   QString firstletteruppercase = toolname.at(0).toUpper();
-  QTreeWidgetItem *toplevelletteritem;
-  bool toplevelitemnotaddedyet = (dircontent->findItems(firstletteruppercase, Qt::MatchExactly).isEmpty());
+  QTreeWidgetItem *toplevelletteritem = toplevelletteritems.value(firstletteruppercase);
+  bool toplevelitemnotaddedyet = (toplevelletteritem == nullptr);
 
   if (toplevelitemnotaddedyet) {
     toplevelletteritem = new QTreeWidgetItem(QStringList() << firstletteruppercase);
@@ -151,56 +151,43 @@ void ToolChooserWidget::updateDirContent(QTreeWidgetItem *toolItem, const QStrin
     }
 
     dircontent->addTopLevelItem(toplevelletteritem);
-    toplevelletteritems.append(toplevelletteritem);
+    toplevelletteritems.insert(firstletteruppercase, toplevelletteritem);
     bool searchfieldinuse = (not searchbarwidget->text().isEmpty());
 
     if (searchfieldinuse) {
       // hide new items by default to not disturb the search results with additional nodes
       toplevelletteritem->setHidden(true);
     }
-  } else {
-    toplevelletteritem = dircontent->findItems(firstletteruppercase, Qt::MatchExactly).first();
   }
 
-  bool toolnotaddedyet = true;
-  for (int j = 0; j < toplevelletteritem->childCount(); ++j) {
-    QTreeWidgetItem *child = toplevelletteritem->child(j);
+  auto addToolItem = [this, toplevelletteritem](QTreeWidgetItem *toolitem) {
+    toplevelletteritem->addChild(toolitem);
+    toolitems.insert(toolitem->text(0), toolitem);
+    searchindex.insert(toolitem->text(0));
+    setToolItemShown(toolitem, true);
+  };
 
-    if (child->text(0) == toolname) {
-      toolnotaddedyet = false;
-      break;
-    }
-  }
+  bool toolnotaddedyet = !toolitems.contains(toolname);
 
   if (toolnotaddedyet) {
     bool versionedtool = toolname.contains(rxversionedtool);
 
     if (versionedtool) {
       QString nonversionedtool = toolname.section(rxversionedtool, 0, 0);
-      int index = -1;
-
-      for (int j = 0; j < toplevelletteritem->childCount(); ++j) {
-        QTreeWidgetItem *child = toplevelletteritem->child(j);
-
-        if (child->text(0) == nonversionedtool) {
-          index = j;
-          break;
-        }
-      }
+      QTreeWidgetItem *toolnameitem = toolitems.value(nonversionedtool);
 
       QString releasedate = toolname.split("-").last();
       QString comboboxentryreleasedate = releasedate + " - " + path;
 
-      if (index != -1) {
-        QTreeWidgetItem *toolnameitem = toplevelletteritem->child(index);
+      if (toolnameitem) {
         comboboxentries.insert(toolnameitem, comboboxentryreleasedate);
       } else {
         toolItem->setText(0, nonversionedtool);
-        toplevelletteritem->addChild(toolItem);
+        addToolItem(toolItem);
         comboboxentries.insert(toolItem, comboboxentryreleasedate);
       }
     } else {
-      toplevelletteritem->addChild(toolItem);
+      addToolItem(toolItem);
       QString comboboxentrycurrent = "current - " + path;
       comboboxentries.insert(toolItem, comboboxentrycurrent);
     }
@@ -210,7 +197,11 @@ void ToolChooserWidget::updateDirContent(QTreeWidgetItem *toolItem, const QStrin
 void ToolChooserWidget::initTreeItems() {
   infotabwidget->clear();
   toplevelletteritems.clear();
+  toolitems.clear();
   comboboxentries.clear();
+  searchindex.clear();
+  showntoolitems.clear();
+  shownchildren.clear();
   dircontent->clear();
   lastselectedtoolitem = nullptr;
   toolxml.resetCache();
@@ -241,6 +232,17 @@ void ToolChooserWidget::initTreeItems() {
     QFileInfo fileInfo(toolsFile.fileName());
     qWarning() << "Can not read tool list from: " << fileInfo.absoluteFilePath();
   }
+
+  // descriptions stored by earlier sessions are searchable right away, other tools once they were selected
+  for (QTreeWidgetItem *toolitem : std::as_const(toolitems)) {
+    const QStringList versions = comboboxentries.values(toolitem);
+    if (versions.isEmpty()) continue;
+    // the version the combo box offers first
+    const QString path = versions.constLast().split(" - ").last();
+    if (std::optional<ToolDescription> tooldescription = toolxml.cachedToolDescription(path)) {
+      indexToolDescription(toolitem, *tooldescription);
+    }
+  }
 }
 
 void ToolChooserWidget::resizeColumns(QTreeWidgetItem *item) {
@@ -253,41 +255,68 @@ void ToolChooserWidget::resetFilterTools() {
 }
 
 void ToolChooserWidget::filterTools(QString text) {
-  Q_FOREACH (QTreeWidgetItem * toplevelletteritem, toplevelletteritems) {
-    toplevelletteritem->setHidden(false);
-    int childrenHidden = 0;
-
-    for (int j = 0; j < toplevelletteritem->childCount(); ++j) {
-      QTreeWidgetItem *toolitem = toplevelletteritem->child(j);
+  QSet<QTreeWidgetItem *> matches;
+  QTreeWidgetItem *bestmatch = nullptr;
 
-      if (text.isEmpty() && toolitem->isHidden()) {
-        toolitem->setHidden(false);
-      } else if (toolitem->text(0).contains(text)) {
-        toolitem->setHidden(false);
-        toplevelletteritem->setExpanded(true);
-      } else {
-        toolitem->setHidden(true);
-        childrenHidden++;
-      }
+  if (text.isEmpty()) {
+    for (QTreeWidgetItem *toolitem : std::as_const(toolitems)) {
+      matches.insert(toolitem);
     }
-
-    bool allchildrenhidden = (childrenHidden == toplevelletteritem->childCount());
-    if (allchildrenhidden) {
-      toplevelletteritem->setHidden(true);
+  } else {
+    for (const ToolSearchIndex::Match& match : searchindex.search(text)) {
+      QTreeWidgetItem *toolitem = toolitems.value(match.name);
+      if (!bestmatch) bestmatch = toolitem;
+      matches.insert(toolitem);
     }
+  }
 
-    if (text.isEmpty()) {
-      bool otheritemselected = false;
+  const QList<QTreeWidgetItem *> shownitems = showntoolitems.values();
+  for (QTreeWidgetItem *toolitem : shownitems) {
+    if (!matches.contains(toolitem)) {
+      setToolItemShown(toolitem, false);
+    }
+  }
+  for (QTreeWidgetItem *toolitem : std::as_const(matches)) {
+    setToolItemShown(toolitem, true);
+  }
 
-      for (int j = 0; j < toplevelletteritem->childCount(); ++j) {
-        QTreeWidgetItem *toolitem = toplevelletteritem->child(j);
-        otheritemselected = toolitem->isSelected();
-        if (otheritemselected) break;
-      }
+  Q_FOREACH (QTreeWidgetItem * toplevelletteritem, toplevelletteritems) {
+    bool anychildshown = (shownchildren.value(toplevelletteritem) > 0);
+    toplevelletteritem->setHidden(!anychildshown);
 
+    if (text.isEmpty()) {
+      bool otheritemselected = (lastselectedtoolitem != nullptr && lastselectedtoolitem->parent() == toplevelletteritem &&
+                                lastselectedtoolitem->isSelected());
       toplevelletteritem->setExpanded(otheritemselected);
+    } else if (anychildshown) {
+      toplevelletteritem->setExpanded(true);
     }
   }
+
+  if (bestmatch) {
+    dircontent->scrollToItem(bestmatch);
+  }
+}
+
+void ToolChooserWidget::setToolItemShown(QTreeWidgetItem *toolitem, bool shown) {
+  if (shown == showntoolitems.contains(toolitem)) return;
+
+  toolitem->setHidden(!shown);
+  if (shown) {
+    showntoolitems.insert(toolitem);
+    shownchildren[toolitem->parent()]++;
+  } else {
+    showntoolitems.remove(toolitem);
+    shownchildren[toolitem->parent()]--;
+  }
+}
+
+void ToolChooserWidget::indexToolDescription(QTreeWidgetItem *toolitem, const ToolDescription &tooldescription) {
+  QStringList parameters;
+  for (const ToolParameter &parameter : tooldescription.parameterVector()) {
+    parameters.append(parameter.getLongName());
+  }
+  searchindex.insert(toolitem->text(0), tooldescription.description(), parameters);
 }
 
 void ToolChooserWidget::toolHovered(QTreeWidgetItem *toolnameitem, int column) {
@@ -379,6 +408,7 @@ void ToolChooserWidget::toolVersionSelected(const QString &versionWithPath) {
   infotabwidget->setToolInformation(&toolxml.Description());
 
   if (valid) {
+    indexToolDescription(toolitem, toolxml.Description());
     Q_EMIT toolSelected();
   } else {
     Q_EMIT toolReset();
@@ -388,7 +418,7 @@ void ToolChooserWidget::toolVersionSelected(const QString &versionWithPath) {
 
 void ToolChooserWidget::setTool(const QString &toolidentificationstring) {
 
-  if (toolxml.createXML(toolidentificationstring)) {
+  if (toolxml.createToolDescription(toolidentificationstring)) {
     QString name = toolxml.Description().name();
     QString shortname = toolxml.Description().shortName();
     QString toolname = shortname.split(" - ").first();
@@ -408,7 +438,7 @@ void ToolChooserWidget::setTool(const QString &toolidentificationstring) {
           }
 
           // maybe it is filtered out so make it visible again
-          toolnameitem->setHidden(false);
+          setToolItemShown(toolnameitem, true);
           toplevelletteritem->setHidden(false);
 
           toplevelletteritem->setExpanded(true);
@@ -453,6 +483,7 @@ void ToolChooserWidget::setTool(const QString &toolidentificationstring) {
     }
 
     if (toolfound) {
+      indexToolDescription(lastselectedtoolitem, toolxml.Description());
       Q_EMIT toolSelected();
     } else {
       Q_EMIT toolReset();
@@ -15,9 +15,12 @@
 #pragma once
 
 #include <QWidget>
+#include <QHash>
 #include <QMultiMap>
+#include <QSet>
 #include <QString>
 
+#include "tooldata/toolsearchindex.h"
 #include "tooldata/toolxmldata.h"
 #include "../toolchooserinterface.h"
 
@@ -51,7 +54,7 @@ class ToolChooserWidget : public QWidget, public ToolChooserInterface {
     void setTool(const QString& toolidentificationstring) override;
 
     const ToolDescription& getToolDescription(const QString& toolidentificationstring) override {
-      toolxml.createXML(toolidentificationstring);
+      toolxml.createToolDescription(toolidentificationstring);
       return toolxml.Description();
     }
 
@@ -82,12 +85,20 @@ class ToolChooserWidget : public QWidget, public ToolChooserInterface {
 
   private:
     void updateDirContent(QTreeWidgetItem *toolnameitem, const QString &path);
+    void setToolItemShown(QTreeWidgetItem *toolitem, bool shown);
+    void indexToolDescription(QTreeWidgetItem *toolitem, const ToolDescription &tooldescription);
 
     ToolXMLData toolxml;
     bool externaltool;
     QRegularExpression rxversionedtool;
-    QList<QTreeWidgetItem *> toplevelletteritems;
+    QMap<QString, QTreeWidgetItem *> toplevelletteritems;
+    QHash<QString, QTreeWidgetItem *> toolitems;
     QMultiMap<QTreeWidgetItem *, QString> comboboxentries;
+
+    // the filter only touches the tool items whose visibility changes
+    ToolSearchIndex searchindex;
+    QSet<QTreeWidgetItem *> showntoolitems;
+    QHash<QTreeWidgetItem *, int> shownchildren;
     QTreeWidgetItem *lastselectedtoolitem;
 
     QLineEditClearable *searchbarwidget;
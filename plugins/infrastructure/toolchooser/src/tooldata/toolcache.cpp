@@ -12,21 +12,213 @@
  * See the License for the specific language governing permissions and
  * limitations under the License. */
 
+
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QLockFile>
+#include <QProcess>
+#include <QSaveFile>
+#include <QStandardPaths>
 #include <QString>
 
 #include "toolcache.h"
 
 
+ToolFileIdentity ToolFileIdentity::fromToolId(const QString& toolId) {
+  ToolFileIdentity identity;
+
+  QStringList args = QProcess::splitCommand(toolId);
+  if (args.isEmpty()) return identity;
+
+  QString program = args.first();
+  if (!QFileInfo(program).isAbsolute()) {
+    program = QStandardPaths::findExecutable(program);
+  }
+  QFileInfo fileinfo(program);
+  if (program.isEmpty() || !fileinfo.isFile()) return identity;
+
+  identity.path  = fileinfo.canonicalFilePath();
+  identity.size  = fileinfo.size();
+  identity.mtime = fileinfo.lastModified().toMSecsSinceEpoch();
+  return identity;
+}
+
+QByteArray ToolFileIdentity::contentHash(const QString& path) {
+  QFile file(path);
+  if (!file.open(QIODevice::ReadOnly)) return {};
+
+  QCryptographicHash hash(QCryptographicHash::Sha256);
+  hash.addData(&file);
+  return hash.result().toHex();
+}
+
+
+ToolCache::ToolCache()
+    : ToolCache(defaultCacheFile()) {
+}
+
+ToolCache::ToolCache(const QString& cachefile)
+    : cachefile(cachefile), loaded(false) {
+  savetimer.setSingleShot(true);
+  savetimer.setInterval(SAVE_DELAY);
+  QObject::connect(&savetimer, &QTimer::timeout, [this] {
+    flush();
+  });
+}
+
+ToolCache::~ToolCache() {
+  flush();
+}
+
+QString ToolCache::defaultCacheFile() {
+  return QDir::homePath() + QDir::separator() + ".kadistudio" + QDir::separator() + "tooldescriptioncache.json";
+}
+
 ToolDescription* ToolCache::get(const QString& toolId) {
-  auto toolDescription = cache[toolId.toStdString()].get();
-  return toolDescription;
+  auto it = cache.find(toolId.toStdString());
+  if (it == cache.end()) return nullptr;
+
+  ToolFileIdentity identity = ToolFileIdentity::fromToolId(toolId);
+  const ToolFileIdentity& cached = it->second.identity;
+  if (!identity.isValid() || identity.path != cached.path ||
+      identity.size != cached.size || identity.mtime != cached.mtime) {
+    cache.erase(it);
+    return nullptr;
+  }
+
+  stats.memory_hits++;
+  return it->second.description.get();
 }
 
 ToolDescription* ToolCache::insert(const QString& toolId, std::unique_ptr<ToolDescription> toolDescription) {
-  cache[toolId.toStdString()] = std::move(toolDescription);
-  return cache[toolId.toStdString()].get();
+  Entry& entry = cache[toolId.toStdString()];
+  entry.identity = ToolFileIdentity::fromToolId(toolId);
+  entry.description = std::move(toolDescription);
+  return entry.description.get();
+}
+
+std::optional<QString> ToolCache::getXml(const QString& toolId) {
+  load();
+
+  ToolFileIdentity identity = ToolFileIdentity::fromToolId(toolId);
+  auto it = stored_entries.find(toolId);
+  if (!identity.isValid() || it == stored_entries.end()) {
+    stats.misses++;
+    return std::nullopt;
+  }
+
+  QJsonObject stored = it.value().toObject();
+  if (!matches(stored, identity)) {
+    stats.misses++;
+    return std::nullopt;
+  }
+  if (stored != it.value().toObject()) {
+    // same content with a new timestamp, remember it to skip hashing next time
+    *it = stored;
+    changed(toolId);
+  }
+
+  stats.disk_hits++;
+  return stored["xml"].toString();
+}
+
+void ToolCache::storeXml(const QString& toolId, const QString& xml) {
+  load();
+
+  ToolFileIdentity identity = ToolFileIdentity::fromToolId(toolId);
+  if (!identity.isValid()) return;
+
+  QJsonObject stored;
+  stored["path"]  = identity.path;
+  stored["size"]  = identity.size;
+  stored["mtime"] = identity.mtime;
+  stored["hash"]  = QString::fromLatin1(ToolFileIdentity::contentHash(identity.path));
+  stored["xml"]   = xml;
+  stored_entries[toolId] = stored;
+  changed(toolId);
+}
+
+bool ToolCache::matches(QJsonObject& stored, const ToolFileIdentity& identity) {
+  if (stored["path"].toString() != identity.path || stored["size"].toInteger() != identity.size) {
+    return false;
+  }
+  if (stored["mtime"].toInteger() == identity.mtime) {
+    return true;
+  }
+
+  // touched or reinstalled, only the content decides
+  QByteArray hash = ToolFileIdentity::contentHash(identity.path);
+  if (hash.isEmpty() || hash != stored["hash"].toString().toLatin1()) {
+    return false;
+  }
+  stored["mtime"] = identity.mtime;
+  return true;
 }
 
 void ToolCache::reset() {
   cache.clear();
 }
+
+void ToolCache::load() {
+  if (loaded) return;
+  loaded = true;
+  stored_entries = readEntries();
+}
+
+void ToolCache::changed(const QString& toolId) {
+  changed_entries.insert(toolId);
+  if (!savetimer.isActive()) {
+    savetimer.start();
+  }
+}
+
+void ToolCache::flush() {
+  savetimer.stop();
+  if (changed_entries.isEmpty()) return;
+
+  QDir().mkpath(QFileInfo(cachefile).absolutePath());
+
+  // other instances write the same file, keep what they stored since it was loaded
+  QLockFile lock(cachefile + ".lock");
+  if (!lock.tryLock(5000)) {
+    qWarning() << "Can not lock tool description cache: " << cachefile;
+    return;
+  }
+  QJsonObject merged = readEntries();
+  for (const QString& toolId : changed_entries) {
+    merged[toolId] = stored_entries[toolId];
+  }
+  stored_entries = merged;
+
+  QJsonObject root;
+  root["version"] = FORMAT_VERSION;
+  root["entries"] = stored_entries;
+
+  // write to a temporary file first, a crash must not leave a truncated cache behind
+  QSaveFile file(cachefile);
+  if (!file.open(QIODevice::WriteOnly)) {
+    qWarning() << "Can not write tool description cache: " << cachefile;
+    return;
+  }
+  file.write(QJsonDocument(root).toJson(QJsonDocument::Compact));
+  if (file.commit()) {
+    changed_entries.clear();
+  }
+}
+
+QJsonObject ToolCache::readEntries() const {
+  QFile file(cachefile);
+  if (!file.open(QIODevice::ReadOnly)) return QJsonObject();
+
+  QJsonObject root = QJsonDocument::fromJson(file.readAll()).object();
+  if (root["version"].toInt() != FORMAT_VERSION) {
+    qDebug() << "Discarding tool description cache with unsupported version" << root["version"].toInt();
+    return QJsonObject();
+  }
+  return root["entries"].toObject();
+}
@@ -12,28 +12,118 @@
  * See the License for the specific language governing permissions and
  * limitations under the License. */
 
+
 #pragma once
 
+#include <optional>
 #include <unordered_map>
 #include <memory> // std::unique_ptr
 #include <string>
 
+#include <QByteArray>
+#include <QJsonObject>
+#include <QSet>
+#include <QString>
+#include <QTimer>
+
 #include "tooldescription.h"
 
 
 /**
- * @brief      Datastructure for information about a tool.
+ * @brief      Identifies the executable behind a tool identification
+ *             string. Size and modification time are compared first,
+ *             the content hash only when they differ.
+ * @ingroup    tooldialog
+ */
+struct ToolFileIdentity {
+  QString    path;
+  qint64     size = -1;
+  qint64     mtime = -1;
+
+  bool isValid() const {
+    return !path.isEmpty();
+  }
+
+  static ToolFileIdentity fromToolId(const QString& toolId);
+  static QByteArray contentHash(const QString& path);
+};
+
+/**
+ * @brief      Cache for tool descriptions.
+ *
+ *             Parsed descriptions are kept in memory, the --xmlhelp
+ *             output they were parsed from is additionally stored on
+ *             disk, so that it survives restarts. Every entry remembers
+ *             the identity of the executable it was created from and is
+ *             only returned while the executable is unchanged.
+ *
+ *             Changes to the stored entries are written together, at most
+ *             every SAVE_DELAY milliseconds and on destruction. Entries
+ *             other instances stored meanwhile are merged under a lock
+ *             file before writing.
  * @ingroup    tooldialog
  */
 class ToolCache {
 
   public:
+    struct Statistics {
+      int memory_hits = 0;
+      int disk_hits   = 0;
+      int misses      = 0;
+    };
+
+    ToolCache();
+    explicit ToolCache(const QString& cachefile);
+    ~ToolCache();
+
     ToolDescription* insert(const QString& toolId, std::unique_ptr<ToolDescription> toolDescription);
     ToolDescription* get(const QString& toolId);
 
+    /**
+     * @brief      Looks up the stored xmlhelp output of a tool.
+     */
+    std::optional<QString> getXml(const QString& toolId);
+    void storeXml(const QString& toolId, const QString& xml);
+
+    /**
+     * @brief      Drops the in memory descriptions. Stored entries are kept,
+     *             they are validated against the executable on every lookup.
+     */
     void reset();
 
+    /**
+     * @brief      Writes the changed stored entries now instead of after
+     *             the delay.
+     */
+    void flush();
+
+    const Statistics& statistics() const {
+      return stats;
+    }
+
+    static QString defaultCacheFile();
+
+    const static int FORMAT_VERSION = 1;
+    const static int SAVE_DELAY = 2000;
+
   private:
-    std::unordered_map<std::string, std::unique_ptr<ToolDescription>> cache; // must be std::string on older versions, might be QString in future
+    struct Entry {
+      ToolFileIdentity identity;
+      std::unique_ptr<ToolDescription> description;
+    };
+
+    bool matches(QJsonObject& stored, const ToolFileIdentity& identity);
+    void load();
+    void changed(const QString& toolId);
+    QJsonObject readEntries() const;
+
+    std::unordered_map<std::string, Entry> cache; // must be std::string on older versions, might be QString in future
+
+    QString     cachefile;
+    bool        loaded;
+    QJsonObject stored_entries;
+    QSet<QString> changed_entries;
+    QTimer      savetimer;
+    Statistics  stats;
 
 };
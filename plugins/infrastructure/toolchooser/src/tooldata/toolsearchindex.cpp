@@ -0,0 +1,240 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <algorithm>
+
+#include "toolsearchindex.h"
+
+void ToolSearchIndex::insert(const QString& name, const QString& description, const QStringList& parameters) {
+  remove(name);
+
+  Document document;
+  document.name = name;
+  document.foldedname = name.toCaseFolded();
+  document.description = description;
+  document.parameters = parameters;
+  documents.push_back(std::move(document));
+
+  int id = static_cast<int>(documents.size()) - 1;
+  ids.insert(name, id);
+  index(id);
+}
+
+bool ToolSearchIndex::remove(const QString& name) {
+  auto it = ids.find(name);
+  if (it == ids.end()) return false;
+
+  // the postings of a removed tool are skipped until the next rebuild
+  documents[it.value()].removed = true;
+  ids.erase(it);
+  removedcount++;
+
+  if (removedcount > 64 && removedcount * 2 > documents.size()) {
+    rebuild();
+  }
+  return true;
+}
+
+bool ToolSearchIndex::contains(const QString& name) const {
+  return ids.contains(name);
+}
+
+void ToolSearchIndex::clear() {
+  documents.clear();
+  ids.clear();
+  removedcount = 0;
+  prefixes.clear();
+  edges.clear();
+  grams.clear();
+}
+
+std::size_t ToolSearchIndex::size() const {
+  return ids.size();
+}
+
+std::vector<ToolSearchIndex::Match> ToolSearchIndex::search(const QString& query) const {
+  const QString folded = query.trimmed().toCaseFolded();
+  std::vector<int> scores(documents.size(), 0);
+
+  auto raise = [&](int document, int score) {
+    if (documents[document].removed) return;
+    scores[document] = std::max(scores[document], score);
+  };
+
+  if (!folded.isEmpty()) {
+    // words starting with the query
+    int node = 0;
+    for (QChar c : folded) {
+      node = edges.value((quint64(node) << 16) | c.unicode(), -1);
+      if (node == -1) break;
+    }
+    if (node > 0) {
+      for (const Posting& posting : prefixes[node]) {
+        raise(posting.document, posting.fields & NAME        ? SCORE_WORD_PREFIX
+                                : posting.fields & PARAMETER ? SCORE_PARAMETER
+                                                             : SCORE_DESCRIPTION);
+      }
+    }
+
+    // substrings of the names, the rarest trigram of longer queries narrows the candidates
+    const Postings* candidates = nullptr;
+    for (int i = 0; i + std::min<int>(folded.size(), 3) <= folded.size(); ++i) {
+      auto it = grams.find(folded.mid(i, 3));
+      if (it == grams.end()) {
+        candidates = nullptr;
+        break;
+      }
+      if (!candidates || it->size() < candidates->size()) {
+        candidates = &it.value();
+      }
+    }
+    if (candidates) {
+      for (const Posting& posting : *candidates) {
+        if (!(posting.fields & NAME)) continue;
+
+        const QString& name = documents[posting.document].foldedname;
+        qsizetype position = name.indexOf(folded);
+        if (position == 0) {
+          raise(posting.document, name.size() == folded.size() ? SCORE_EXACT : SCORE_NAME_PREFIX);
+        } else if (position > 0) {
+          raise(posting.document, SCORE_SUBSTRING);
+        }
+      }
+    }
+
+    // misspelled queries, only when nothing else matches to not clutter the results
+    bool found = std::any_of(scores.begin(), scores.end(), [](int score) { return score > 0; });
+    QStringList trigrams;
+    for (int i = 0; !found && i + 3 <= folded.size(); ++i) {
+      QString trigram = folded.mid(i, 3);
+      if (!trigrams.contains(trigram)) {
+        trigrams.append(trigram);
+      }
+    }
+    if (trigrams.size() >= 3) {
+      std::vector<int> shared(documents.size(), 0);
+      for (const QString& trigram : trigrams) {
+        for (const Posting& posting : grams.value(trigram)) {
+          shared[posting.document]++;
+        }
+      }
+      for (std::size_t document = 0; document < documents.size(); ++document) {
+        if (shared[document] * 3 >= trigrams.size() * 2) {
+          raise(static_cast<int>(document), SCORE_FUZZY * shared[document] / static_cast<int>(trigrams.size()));
+        }
+      }
+    }
+  }
+
+  std::vector<Match> matches;
+  for (std::size_t document = 0; document < documents.size(); ++document) {
+    if (folded.isEmpty() ? !documents[document].removed : scores[document] > 0) {
+      matches.push_back({documents[document].name, scores[document]});
+    }
+  }
+  std::sort(matches.begin(), matches.end(), [](const Match& lhs, const Match& rhs) {
+    if (lhs.score != rhs.score) return lhs.score > rhs.score;
+    if (lhs.name.size() != rhs.name.size()) return lhs.name.size() < rhs.name.size();
+    return lhs.name < rhs.name;
+  });
+  return matches;
+}
+
+void ToolSearchIndex::index(int document) {
+  const Document& indexed = documents[document];
+
+  indexWord(document, indexed.foldedname, NAME);
+  for (const QString& word : words(indexed.foldedname)) {
+    indexWord(document, word, NAME);
+  }
+  indexGrams(document, indexed.foldedname, NAME, 1);
+
+  for (const QString& parameter : indexed.parameters) {
+    for (const QString& word : words(parameter.toCaseFolded())) {
+      indexWord(document, word, PARAMETER);
+      indexGrams(document, word, PARAMETER, 3);
+    }
+  }
+
+  for (const QString& word : words(indexed.description.toCaseFolded())) {
+    indexWord(document, word, DESCRIPTION);
+    indexGrams(document, word, DESCRIPTION, 3);
+  }
+}
+
+void ToolSearchIndex::indexWord(int document, const QString& word, Field field) {
+  if (prefixes.empty()) {
+    prefixes.emplace_back();
+  }
+
+  int node = 0;
+  for (QChar c : word) {
+    quint64 edge = (quint64(node) << 16) | c.unicode();
+    auto it = edges.find(edge);
+    if (it == edges.end()) {
+      prefixes.emplace_back();
+      it = edges.insert(edge, static_cast<int>(prefixes.size()) - 1);
+    }
+    node = it.value();
+    add(prefixes[node], document, field);
+  }
+}
+
+void ToolSearchIndex::indexGrams(int document, const QString& text, Field field, int minimumlength) {
+  for (int length = minimumlength; length <= 3; ++length) {
+    for (int i = 0; i + length <= text.size(); ++i) {
+      add(grams[text.mid(i, length)], document, field);
+    }
+  }
+}
+
+void ToolSearchIndex::rebuild() {
+  std::vector<Document> remaining;
+  for (Document& document : documents) {
+    if (!document.removed) {
+      remaining.push_back(std::move(document));
+    }
+  }
+
+  clear();
+  documents = std::move(remaining);
+  for (std::size_t document = 0; document < documents.size(); ++document) {
+    ids.insert(documents[document].name, static_cast<int>(document));
+    index(static_cast<int>(document));
+  }
+}
+
+void ToolSearchIndex::add(Postings& postings, int document, Field field) {
+  // a tool is indexed at once, so its postings are always the last ones
+  if (!postings.empty() && postings.back().document == document) {
+    postings.back().fields |= field;
+  } else {
+    postings.push_back({document, field});
+  }
+}
+
+QStringList ToolSearchIndex::words(const QString& text) {
+  QStringList result;
+  qsizetype start = -1;
+  for (qsizetype i = 0; i <= text.size(); ++i) {
+    bool wordcharacter = i < text.size() && text.at(i).isLetterOrNumber();
+    if (wordcharacter && start == -1) {
+      start = i;
+    } else if (!wordcharacter && start != -1) {
+      result.append(text.mid(start, i - start));
+      start = -1;
+    }
+  }
+  return result;
+}
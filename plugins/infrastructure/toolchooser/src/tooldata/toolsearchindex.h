@@ -0,0 +1,114 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <vector>
+
+#include <QHash>
+#include <QString>
+#include <QStringList>
+
+/**
+ * @brief      Search index over the names, descriptions and parameter
+ *             names of the registered tools.
+ *
+ *             Every word is stored in a prefix trie, so that looking up
+ *             the tools with a word starting with the query costs time
+ *             proportional to the query and the result. Substrings of
+ *             tool names and misspelled queries are found over the
+ *             n-grams of the indexed text. A query matching nothing is
+ *             taken as misspelled and matches the tools sharing two
+ *             thirds of its trigrams. The index is case insensitive and is updated tool by
+ *             tool, descriptions can be added once they are known.
+ * @ingroup    tooldialog
+ */
+class ToolSearchIndex {
+
+  public:
+    struct Match {
+      QString name;
+      int     score;
+    };
+
+    // scores of the different kinds of matches, the best one counts
+    static const int SCORE_EXACT       = 100;
+    static const int SCORE_NAME_PREFIX = 80;
+    static const int SCORE_WORD_PREFIX = 60;
+    static const int SCORE_SUBSTRING   = 50;
+    static const int SCORE_PARAMETER   = 30;
+    static const int SCORE_DESCRIPTION = 20;
+    static const int SCORE_FUZZY       = 10;
+
+    /**
+     * @brief      Adds a tool or replaces the indexed text of a tool with
+     *             the same name.
+     */
+    void insert(const QString& name, const QString& description = QString(),
+                const QStringList& parameters = QStringList());
+
+    /**
+     * @return     false if the tool was not indexed
+     */
+    bool remove(const QString& name);
+
+    bool contains(const QString& name) const;
+    void clear();
+    std::size_t size() const;
+
+    /**
+     * @return     The matching tools, best matches first and tools with the
+     *             same score by name. An empty query matches all tools.
+     */
+    std::vector<Match> search(const QString& query) const;
+
+  private:
+    enum Field : quint8 {
+      NAME        = 1,
+      PARAMETER   = 2,
+      DESCRIPTION = 4
+    };
+
+    struct Posting {
+      int    document;
+      quint8 fields;
+    };
+    using Postings = std::vector<Posting>;
+
+    struct Document {
+      QString name;
+      QString foldedname;
+      QString description;
+      QStringList parameters;
+      bool    removed = false;
+    };
+
+    void index(int document);
+    void indexWord(int document, const QString& word, Field field);
+    void indexGrams(int document, const QString& text, Field field, int minimumlength);
+    void rebuild();
+
+    static void add(Postings& postings, int document, Field field);
+    static QStringList words(const QString& text);
+
+    std::vector<Document> documents;
+    QHash<QString, int>   ids;
+    std::size_t           removedcount = 0;
+
+    // trie node 0 is the root, every node lists the tools having a word with its prefix
+    std::vector<Postings> prefixes;
+    QHash<quint64, int>   edges;
+
+    QHash<QString, Postings> grams;
+};
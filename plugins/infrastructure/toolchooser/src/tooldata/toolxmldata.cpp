@@ -23,6 +23,10 @@ ToolXMLData::ToolXMLData()
     : tooldescription() {
 }
 
+ToolXMLData::ToolXMLData(const QString& cachefile)
+    : toolcache(cachefile), tooldescription() {
+}
+
 ToolXMLData::~ToolXMLData() {
 }
 
@@ -71,8 +75,7 @@ bool ToolXMLData::createFromXML(const QString& xmlstring, const QString& command
   return true;
 }
 
-bool ToolXMLData::createXML(const QString &toolidentificationstring) {
-  tooldescription = ToolDescription();
+bool ToolXMLData::runXmlhelp(const QString &toolidentificationstring, QByteArray &output) {
   QProcess toolprocess;
 
   QStringList args = QProcess::splitCommand(toolidentificationstring);
@@ -92,28 +95,68 @@ bool ToolXMLData::createXML(const QString &toolidentificationstring) {
     return false;
   }
 
-  QByteArray stdoutput = toolprocess.readAllStandardOutput();
+  output = toolprocess.readAllStandardOutput();
   toolprocess.close();
+  return true;
+}
+
+bool ToolXMLData::createXML(const QString &toolidentificationstring) {
+  tooldescription = ToolDescription();
+
+  QByteArray stdoutput;
+  if (!runXmlhelp(toolidentificationstring, stdoutput)) {
+    return false;
+  }
 
   return createFromXML(stdoutput, toolidentificationstring);
 }
 
 bool ToolXMLData::createToolDescription(const QString& command) {
-  QString toolidentificationstring;
-
   ToolDescription *cachedDescription = toolcache.get(command);
   if (cachedDescription) {
     tooldescription = *cachedDescription;
-  } else if (createXML(command)) {
-    // give ownership of the new ToolDescription pointer to the cache
-    toolcache.insert(toolidentificationstring,
-                                     std::make_unique<ToolDescription>(tooldescription));
+    return true;
+  }
+
+  tooldescription = ToolDescription();
+  if (std::optional<QString> cachedXml = toolcache.getXml(command)) {
+    if (!createFromXML(*cachedXml, command)) {
+      return false;
+    }
   } else {
-    return false;
+    QByteArray stdoutput;
+    if (!runXmlhelp(command, stdoutput) || !createFromXML(stdoutput, command)) {
+      return false;
+    }
+    toolcache.storeXml(command, QString::fromUtf8(stdoutput));
   }
+
+  // give ownership of the new ToolDescription pointer to the cache
+  toolcache.insert(command, std::make_unique<ToolDescription>(tooldescription));
   return true;
 }
 
+std::optional<ToolDescription> ToolXMLData::cachedToolDescription(const QString& command) {
+  if (ToolDescription *cachedDescription = toolcache.get(command)) {
+    return *cachedDescription;
+  }
+  std::optional<QString> cachedXml = toolcache.getXml(command);
+  if (!cachedXml) {
+    return std::nullopt;
+  }
+
+  // parse without replacing the description of the selected tool
+  ToolDescription selected = std::move(tooldescription);
+  tooldescription = ToolDescription();
+  std::optional<ToolDescription> result;
+  if (createFromXML(*cachedXml, command)) {
+    result = tooldescription;
+    toolcache.insert(command, std::make_unique<ToolDescription>(tooldescription));
+  }
+  tooldescription = std::move(selected);
+  return result;
+}
+
 const ToolDescription& ToolXMLData::Description() const {
   return tooldescription;
 }
@@ -121,3 +164,7 @@ const ToolDescription& ToolXMLData::Description() const {
 void ToolXMLData::resetCache() {
   toolcache.reset();
 }
+
+const ToolCache::Statistics& ToolXMLData::cacheStatistics() const {
+  return toolcache.statistics();
+}
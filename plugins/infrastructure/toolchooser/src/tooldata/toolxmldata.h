@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <optional>
+
 #include <QString>
 
 #include "toolcache.h"
@@ -31,17 +33,33 @@ class ToolXMLData {
 
   public:
     ToolXMLData();
+    explicit ToolXMLData(const QString& cachefile);
     virtual ~ToolXMLData();
 
     bool createFromXML(const QString& xmlstring, const QString& command);
     bool createXML(const QString &toolidentificationstring);
+
+    /**
+     * @brief      Like createXML, but served from the tool cache as long
+     *             as the executable did not change.
+     */
     bool createToolDescription(const QString& command);
 
+    /**
+     * @brief      The description of a tool as far as the tool cache knows
+     *             it, the executable is never run. Does not change
+     *             Description().
+     */
+    std::optional<ToolDescription> cachedToolDescription(const QString& command);
+
     const ToolDescription& Description() const;
 
     void resetCache();
+    const ToolCache::Statistics& cacheStatistics() const;
 
   private:
+    bool runXmlhelp(const QString &toolidentificationstring, QByteArray &output);
+
     ToolCache       toolcache;
     ToolDescription tooldescription;
 
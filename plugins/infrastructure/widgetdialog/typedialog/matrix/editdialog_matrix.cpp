@@ -666,7 +666,10 @@ void EditDialog_Matrix::apply() {
 
     matrixstr += ",";
   }
-  matrixstr.chop(1);
+  // last row has no ','
+  if (matrixsizey > 0) {
+    matrixstr.chop(1);
+  }
   matrixstr += "]";
 
   // set matrix to modified one
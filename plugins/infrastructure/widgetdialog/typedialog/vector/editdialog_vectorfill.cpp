@@ -15,6 +15,8 @@
 #include <QLabel>
 #include <QMessageBox>
 
+#include <properties/data/valuetypeinterface/numerictext.h>
+
 #include "editdialog_vectorfill.h"
 
 EditDialog_VectorFill::EditDialog_VectorFill() : EditDialog() {
@@ -112,8 +114,14 @@ void EditDialog_VectorFill::apply() {
   }
   vectorstr += ")";
 
-  // overwrite String with vector String
-  avti->fromString(vectorstr.toLatin1().toStdString());
+  // overwrite String with vector String, a prefix which is no number does not fit numeric vectors
+  try {
+    avti->fromString(vectorstr.toLatin1().toStdString());
+  } catch (const NumericTextError& error) {
+    QMessageBox::warning(this, tr("Fill Vector"), tr("The generated vector %1 is not valid for this property: %2")
+                         .arg(vectorstr, QString::fromStdString(error.what())));
+    return;
+  }
 
   done(0);
 }
@@ -20,6 +20,9 @@
 #include <plugins/infrastructure/workflows/processmanager/workflow/workflowshortcut.h>
 #include <plugins/infrastructure/workflows/processmanager/workflow/workflowinterface.h>
 #include <plugins/infrastructure/workflows/processmanager/interaction/interactioninterface.h>
+#include <plugins/infrastructure/workflows/processmanager/workflowevent.h>
+
+class QObject;
 
 struct ShellResult {
   int exit_code = -1;
@@ -49,4 +52,13 @@ class ProcessManagerInterface : public LibFramework::PluginClientInterface {
     virtual QString retrieveWorkflowTreePath(unsigned int workflowId) = 0;
     virtual QJsonObject retrieveWorkflowTree(unsigned int workflowId) = 0;
 
+    /**
+     * @brief      Registers a listener for workflow events. The listener
+     *             is invoked in the thread of the receiver and only as
+     *             long as the receiver is alive.
+     * @return     Handle to pass to unsubscribe.
+     */
+    virtual int subscribe(QObject *receiver, WorkflowEventListener listener) = 0;
+    virtual void unsubscribe(int handle) = 0;
+
 };
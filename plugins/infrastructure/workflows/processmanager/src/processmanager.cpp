@@ -13,11 +13,12 @@
  * limitations under the License. */
 
 #include <QDebug>
-#include <QtCore/QProcess>
 #include <QtCore/QJsonDocument>
 #include <QtCore/QJsonObject>
 #include <QtCore/QJsonArray>
 
+#include "processmanagerclient.h"
+#include "workfloweventsource.h"
 #include "processmanager.h"
 
 ProcessManager::ProcessManager(LibFramework::PluginManagerInterface* pluginmanager_interface) {
@@ -25,10 +26,14 @@ ProcessManager::ProcessManager(LibFramework::PluginManagerInterface* pluginmanag
   assert(workflow_interface);
   interaction_interface = pluginmanager_interface->getInterface<InteractionInterface*>("/plugins/infrastructure/workflows/processmanager/interaction");
   assert(workflow_interface);
+  client = std::make_unique<ProcessManagerClient>(process_manager);
+  event_source = std::make_unique<WorkflowEventSource>(client.get());
 }
 
+ProcessManager::~ProcessManager() = default;
+
 std::unique_ptr<WorkflowInterface> ProcessManager::startWorkflow(const QString& workflowFile) {
-  auto result = readFromShell(process_manager, {"start", "--no-color", workflowFile});
+  auto result = client->execute({"start", "--no-color", workflowFile});
 
   if (result.exit_code == 0) {
     QString jsonString = result.stdout_result;
@@ -40,7 +45,7 @@ std::unique_ptr<WorkflowInterface> ProcessManager::startWorkflow(const QString&
 }
 
 void ProcessManager::continueWorkflow(unsigned int workflowId) {
-  auto result = readFromShell(process_manager, {"continue", QString::number(workflowId)});
+  auto result = client->execute({"continue", QString::number(workflowId)});
 
   if (result.exit_code != 0) {
     throw std::runtime_error(result.stderr_result.toStdString());
@@ -48,20 +53,19 @@ void ProcessManager::continueWorkflow(unsigned int workflowId) {
 }
 
 void ProcessManager::cancelWorkflow(unsigned int workflowId) {
-  auto process = new QProcess();
-  process->start(process_manager, {"cancel", QString::number(workflowId)});
+  client->post({"cancel", QString::number(workflowId)});
 }
 
 void ProcessManager::inputValue(unsigned int workflowId, const QString& interactionId, const QString& value) {
   QStringList args = {"input", QString::number(workflowId), interactionId, "'" + value + "'"};
-  auto inputResult = readFromShell(process_manager, args);
+  auto inputResult = client->execute(args);
   if (inputResult.exit_code != 0) {
     throw std::runtime_error(inputResult.stderr_result.toStdString());
   }
 }
 
 std::unique_ptr<WorkflowInterface> ProcessManager::retrieveWorkflow(unsigned int workflowId) {
-  auto processManagerResult = readFromShell(process_manager, {"status", QString::number(workflowId)});
+  auto processManagerResult = client->execute({"status", QString::number(workflowId)});
 
   if (processManagerResult.exit_code != 0) {
     throw std::runtime_error(processManagerResult.stderr_result.toStdString());
@@ -76,7 +80,7 @@ std::unique_ptr<WorkflowInterface> ProcessManager::retrieveWorkflow(unsigned int
 }
 
 std::vector<std::unique_ptr<WorkflowInterface>> ProcessManager::retrieveWorkflows() {
-  auto result = readFromShell(process_manager,  {"list", "workflows"});
+  auto result = client->execute({"list", "workflows"});
   if (result.exit_code != 0) {
     throw std::runtime_error(result.stderr_result.toStdString());
   }
@@ -98,7 +102,7 @@ std::vector<std::unique_ptr<WorkflowInterface>> ProcessManager::retrieveWorkflow
 
 std::vector<std::unique_ptr<WorkflowShortcut>> ProcessManager::retrieveShortcuts(unsigned int workflowId) {
   std::vector<std::unique_ptr<WorkflowShortcut>> shortcuts;
-  auto shortcutsOutput = readFromShell(process_manager, {"shortcuts", QString::number(workflowId)});
+  auto shortcutsOutput = client->execute({"shortcuts", QString::number(workflowId)});
   if (shortcutsOutput.exit_code != 0) {
     throw std::runtime_error(shortcutsOutput.stderr_result.toStdString());
   }
@@ -128,7 +132,7 @@ std::vector<std::unique_ptr<WorkflowShortcut>> ProcessManager::retrieveShortcuts
 }
 
 std::vector<std::unique_ptr<InteractionInterface>> ProcessManager::retrieveInteractions(unsigned int workflowId) {
-  auto shortcutsOutput = readFromShell(process_manager, {"interactions", QString::number(workflowId)});
+  auto shortcutsOutput = client->execute({"interactions", QString::number(workflowId)});
   if (shortcutsOutput.exit_code != 0) {
     throw std::runtime_error(shortcutsOutput.stderr_result.toStdString());
   }
@@ -154,7 +158,7 @@ std::vector<std::unique_ptr<InteractionInterface>> ProcessManager::retrieveInter
 }
 
 QString ProcessManager::retrieveWorkflowLog(unsigned int workflowId) {
-  auto result = readFromShell(process_manager, {"log", QString::number(workflowId)});
+  auto result = client->execute({"log", QString::number(workflowId)});
   if (result.exit_code != 0) {
     throw std::runtime_error(result.stderr_result.toStdString());
   }
@@ -162,7 +166,7 @@ QString ProcessManager::retrieveWorkflowLog(unsigned int workflowId) {
 }
 
 QString ProcessManager::retrieveWorkflowLogPath(unsigned int workflowId) {
-  auto result = readFromShell(process_manager, {"log_path", QString::number(workflowId)});
+  auto result = client->execute({"log_path", QString::number(workflowId)});
   if (result.exit_code != 0) {
     throw std::runtime_error(result.stderr_result.toStdString());
   }
@@ -170,7 +174,7 @@ QString ProcessManager::retrieveWorkflowLogPath(unsigned int workflowId) {
 }
 
 QString ProcessManager::retrieveWorkflowTreePath(unsigned int workflowId) {
-  auto result = readFromShell(process_manager, {"tree_path", QString::number(workflowId)});
+  auto result = client->execute({"tree_path", QString::number(workflowId)});
   if (result.exit_code != 0) {
     throw std::runtime_error(result.stderr_result.toStdString());
   }
@@ -179,7 +183,7 @@ QString ProcessManager::retrieveWorkflowTreePath(unsigned int workflowId) {
 
 QJsonObject ProcessManager::retrieveWorkflowTree(unsigned int workflowId) {
   QJsonObject result;
-  ShellResult shell_result = readFromShell(process_manager, {"tree", QString::number(workflowId)});
+  ShellResult shell_result = client->execute({"tree", QString::number(workflowId)});
   if (shell_result.exit_code != 0) {
     throw std::runtime_error(shell_result.stderr_result.toStdString());
   }
@@ -191,22 +195,12 @@ QJsonObject ProcessManager::retrieveWorkflowTree(unsigned int workflowId) {
   return result;
 }
 
-ShellResult ProcessManager::readFromShell(const QString& command, const QStringList &arguments) {
-  ShellResult result;
-
-  QProcess process;
-
-  process.start(command, arguments);
-  process.waitForFinished();
-
-  result.exit_code = process.exitCode();
-
-
-  result.stdout_result = QString(process.readAllStandardOutput());
-  result.stderr_result = QString(process.readAllStandardError());
-  process.close();
+int ProcessManager::subscribe(QObject *receiver, WorkflowEventListener listener) {
+  return event_source->subscribe(receiver, std::move(listener));
+}
 
-  return result;
+void ProcessManager::unsubscribe(int handle) {
+  event_source->unsubscribe(handle);
 }
 
 std::unique_ptr<WorkflowInterface> ProcessManager::parseWorkflow(const QJsonObject& jsonWorkflowObject) const {
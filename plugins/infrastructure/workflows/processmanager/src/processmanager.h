@@ -18,6 +18,9 @@
 
 #include "../processmanagerinterface.h"
 
+class ProcessManagerClient;
+class WorkflowEventSource;
+
 
 /**
  * @brief      Provides access to the widget factory of the opengl
@@ -29,6 +32,7 @@ class ProcessManager : public ProcessManagerInterface {
 
   public:
     explicit ProcessManager(LibFramework::PluginManagerInterface* pluginmanager_interface);
+    ~ProcessManager() override;
     std::unique_ptr<WorkflowInterface> startWorkflow(const QString& workflowFile) override;
     void continueWorkflow(unsigned int workflowId) override;
     void cancelWorkflow(unsigned int workflowId) override;
@@ -41,12 +45,15 @@ class ProcessManager : public ProcessManagerInterface {
     QString retrieveWorkflowLogPath(unsigned int workflowId) override;
     QString retrieveWorkflowTreePath(unsigned int workflowId) override;
     QJsonObject retrieveWorkflowTree(unsigned int workflowId) override;
+    int subscribe(QObject *receiver, WorkflowEventListener listener) override;
+    void unsubscribe(int handle) override;
 
   private:
     std::unique_ptr<WorkflowInterface> parseWorkflow(const QJsonObject& jsonWorkflowObject) const;
-    static ShellResult readFromShell(const QString& command, const QStringList &arguments = {});
 
     const QString process_manager = "process-manager";
+    std::unique_ptr<ProcessManagerClient> client;
+    std::unique_ptr<WorkflowEventSource> event_source;
 
     WorkflowInterface *workflow_interface;
     InteractionInterface *interaction_interface;
@@ -0,0 +1,251 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <QDebug>
+#include <QtCore/QDeadlineTimer>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+
+#include "processmanagerclient.h"
+
+ProcessManagerClient::ProcessManagerClient(const QString& program, QObject *parent)
+    : QObject(parent), program(program), next_request_id(1), session_state(NOT_STARTED) {
+  session_thread.setObjectName("ProcessManagerSession");
+  session = new ProcessManagerSession(this, program);
+  session->moveToThread(&session_thread);
+  connect(&session_thread, &QThread::finished, session, &QObject::deleteLater);
+}
+
+ProcessManagerClient::~ProcessManagerClient() {
+  if (session_thread.isRunning()) {
+    QMetaObject::invokeMethod(session, &ProcessManagerSession::stop, Qt::BlockingQueuedConnection);
+    session_thread.quit();
+    session_thread.wait();
+  } else {
+    delete session;
+  }
+  abandonPending();
+}
+
+bool ProcessManagerClient::ensureSession() {
+  if (session_state == ACTIVE) return true;
+  if (session_state == UNAVAILABLE) return false;
+
+  std::lock_guard<std::mutex> lock(start_mutex);
+  if (session_state == NOT_STARTED) {
+    session_thread.start();
+    bool started = false;
+    QMetaObject::invokeMethod(session, &ProcessManagerSession::start, Qt::BlockingQueuedConnection, &started);
+    session_state = started ? ACTIVE : UNAVAILABLE;
+    if (!started) {
+      qDebug() << "Process manager session unavailable, falling back to one process per command";
+    }
+  }
+  return session_state == ACTIVE;
+}
+
+std::pair<quint64, std::future<std::optional<ShellResult>>> ProcessManagerClient::send(const QStringList& arguments) {
+  quint64 id;
+  std::future<std::optional<ShellResult>> future;
+  {
+    std::lock_guard<std::mutex> lock(pending_mutex);
+    id = next_request_id++;
+    future = pending[id].get_future();
+  }
+
+  QJsonObject request;
+  request["id"] = static_cast<qint64>(id);
+  request["args"] = QJsonArray::fromStringList(arguments);
+  QByteArray line = QJsonDocument(request).toJson(QJsonDocument::Compact);
+  line.append('\n');
+
+  QMetaObject::invokeMethod(session, [this, line] { session->write(line); }, Qt::QueuedConnection);
+
+  return {id, std::move(future)};
+}
+
+ShellResult ProcessManagerClient::execute(const QStringList& arguments, int timeout) {
+  if (ensureSession()) {
+    auto [id, future] = send(arguments);
+    if (future.wait_for(std::chrono::milliseconds(timeout)) == std::future_status::ready) {
+      std::optional<ShellResult> result = future.get();
+      if (result) {
+        return *result;
+      }
+      // the session died before answering, retry the command standalone
+    } else {
+      // a late response is ignored
+      forget(id);
+      ShellResult result;
+      result.stderr_result = QString("Timeout while waiting for the process manager (%1)").arg(arguments.join(' '));
+      return result;
+    }
+  }
+  return runProcess(program, arguments, timeout);
+}
+
+void ProcessManagerClient::post(const QStringList& arguments) {
+  if (ensureSession()) {
+    send(arguments);
+  } else {
+    QProcess::startDetached(program, arguments);
+  }
+}
+
+bool ProcessManagerClient::isSessionActive() const {
+  return session_state == ACTIVE;
+}
+
+void ProcessManagerClient::resolve(quint64 id, std::optional<ShellResult> result) {
+  std::lock_guard<std::mutex> lock(pending_mutex);
+  auto it = pending.find(id);
+  if (it != pending.end()) {
+    it->second.set_value(std::move(result));
+    pending.erase(it);
+  }
+}
+
+void ProcessManagerClient::forget(quint64 id) {
+  std::lock_guard<std::mutex> lock(pending_mutex);
+  pending.erase(id);
+}
+
+void ProcessManagerClient::abandonPending() {
+  std::lock_guard<std::mutex> lock(pending_mutex);
+  for (auto& [id, promise] : pending) {
+    promise.set_value(std::nullopt);
+  }
+  pending.clear();
+}
+
+ShellResult ProcessManagerClient::runProcess(const QString& program, const QStringList& arguments, int timeout) {
+  ShellResult result;
+
+  QProcess process;
+
+  process.start(program, arguments);
+  process.waitForFinished(timeout);
+
+  result.exit_code = process.exitCode();
+
+  result.stdout_result = QString(process.readAllStandardOutput());
+  result.stderr_result = QString(process.readAllStandardError());
+  process.close();
+
+  return result;
+}
+
+
+ProcessManagerSession::ProcessManagerSession(ProcessManagerClient *client, const QString& program)
+    : client(client), program(program), process(nullptr) {
+}
+
+bool ProcessManagerSession::start() {
+  process = new QProcess(this);
+  process->start(program, {"session", "--no-color"});
+  if (!process->waitForStarted()) {
+    return false;
+  }
+  if (!handshake()) {
+    process->kill();
+    process->waitForFinished();
+    return false;
+  }
+
+  connect(process, &QProcess::readyReadStandardOutput, this, &ProcessManagerSession::readResponses);
+  connect(process, &QProcess::finished, this, &ProcessManagerSession::processFinished);
+  // messages sent right after the greeting
+  if (!buffer.isEmpty()) {
+    readResponses();
+  }
+  return true;
+}
+
+bool ProcessManagerSession::handshake() {
+  QDeadlineTimer deadline(ProcessManagerClient::SESSION_HANDSHAKE_TIMEOUT);
+  while (!buffer.contains('\n')) {
+    // process managers without session support exit with a usage message, others may wait for input
+    if (!process->waitForReadyRead(static_cast<int>(deadline.remainingTime()))) {
+      qDebug() << "No greeting from the process manager session";
+      return false;
+    }
+    buffer.append(process->readAllStandardOutput());
+  }
+
+  const qsizetype newline = buffer.indexOf('\n');
+  const QJsonObject hello = QJsonDocument::fromJson(buffer.left(newline)).object();
+  buffer.remove(0, newline + 1);
+  if (hello["hello"].toString() != "process-manager"
+      || hello["protocol"].toInt() != ProcessManagerClient::SESSION_PROTOCOL) {
+    qDebug() << "Unsupported process manager session:" << hello;
+    return false;
+  }
+  return true;
+}
+
+void ProcessManagerSession::write(const QByteArray& line) {
+  if (!process || process->state() != QProcess::Running) {
+    client->abandonPending();
+    return;
+  }
+  process->write(line);
+}
+
+void ProcessManagerSession::stop() {
+  if (!process) return;
+
+  disconnect(process, nullptr, this, nullptr);
+  process->closeWriteChannel();
+  if (!process->waitForFinished(1000)) {
+    process->kill();
+    process->waitForFinished();
+  }
+}
+
+void ProcessManagerSession::readResponses() {
+  buffer.append(process->readAllStandardOutput());
+
+  qsizetype newline;
+  while ((newline = buffer.indexOf('\n')) >= 0) {
+    QByteArray line = buffer.left(newline);
+    buffer.remove(0, newline + 1);
+    if (line.trimmed().isEmpty()) continue;
+
+    QJsonParseError error;
+    QJsonDocument document = QJsonDocument::fromJson(line, &error);
+    if (error.error != QJsonParseError::NoError || !document.isObject()) {
+      qDebug() << "Ignoring malformed process manager message:" << error.errorString();
+      continue;
+    }
+
+    QJsonObject message = document.object();
+    if (!message.contains("id")) {
+      Q_EMIT client->messageReceived(message);
+      continue;
+    }
+
+    ShellResult result;
+    result.exit_code = message["exitCode"].toInt(-1);
+    result.stdout_result = message["stdout"].toString();
+    result.stderr_result = message["stderr"].toString();
+    client->resolve(static_cast<quint64>(message["id"].toInteger()), std::move(result));
+  }
+}
+
+void ProcessManagerSession::processFinished() {
+  qDebug() << "Process manager session ended with exit code" << process->exitCode();
+  client->session_state = ProcessManagerClient::UNAVAILABLE;
+  client->abandonPending();
+}
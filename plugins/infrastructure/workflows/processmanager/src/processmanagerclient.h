@@ -0,0 +1,160 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <atomic>
+#include <future>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+#include <QtCore/QObject>
+#include <QtCore/QProcess>
+#include <QtCore/QStringList>
+#include <QtCore/QThread>
+
+#include "../processmanagerinterface.h"
+
+class ProcessManagerSession;
+
+/**
+ * @brief      Long-lived connection to the process manager.
+ *
+ *             Instead of spawning one process per command, a single
+ *             process manager is started in session mode and kept
+ *             alive. Requests and responses are exchanged as one JSON
+ *             document per line over its stdin/stdout channel:
+ *
+ *               <- {"hello": "process-manager", "protocol": 1}
+ *               -> {"id": 7, "args": ["status", "3"]}
+ *               <- {"id": 7, "exitCode": 0, "stdout": "...", "stderr": ""}
+ *
+ *             The session is only used after the process manager greeted
+ *             with exactly SESSION_PROTOCOL within SESSION_HANDSHAKE_TIMEOUT.
+ *             This requires a process manager implementing the `session`
+ *             command with protocol version 1, released process managers
+ *             without it, or with another protocol, are used one process
+ *             per command.
+ *
+ *             Responses are matched to requests by their id, so any
+ *             number of threads may have requests in flight at the same
+ *             time. If the process manager does not support the session
+ *             mode or the session dies, the client falls back to
+ *             spawning one process per command.
+ * @ingroup    processmanager
+ */
+class ProcessManagerClient : public QObject {
+  Q_OBJECT
+
+  public:
+    explicit ProcessManagerClient(const QString& program, QObject *parent = nullptr);
+    ~ProcessManagerClient() override;
+
+    /**
+     * @brief      Executes a command and blocks until its result arrives.
+     *             Thread safe, but must not be called from the session
+     *             thread itself.
+     */
+    ShellResult execute(const QStringList& arguments, int timeout = DEFAULT_TIMEOUT);
+
+    /**
+     * @brief      Sends a command without waiting for its result.
+     */
+    void post(const QStringList& arguments);
+
+    bool isSessionActive() const;
+
+    const static int DEFAULT_TIMEOUT = 30000;
+    const static int SESSION_PROTOCOL = 1;
+    const static int SESSION_HANDSHAKE_TIMEOUT = 2000;
+
+  Q_SIGNALS:
+    /**
+     * @brief      Emitted for every message of the session that is not
+     *             the response to a request. Emitted from the session
+     *             thread.
+     */
+    void messageReceived(const QJsonObject& message);
+
+  private:
+    friend class ProcessManagerSession;
+
+    using PendingResult = std::promise<std::optional<ShellResult>>;
+
+    bool ensureSession();
+    /**
+     * @return     The id of the request and the future of its result.
+     */
+    std::pair<quint64, std::future<std::optional<ShellResult>>> send(const QStringList& arguments);
+    void resolve(quint64 id, std::optional<ShellResult> result);
+    /**
+     * @brief      Drops a request nobody waits for anymore.
+     */
+    void forget(quint64 id);
+    void abandonPending();
+
+    static ShellResult runProcess(const QString& program, const QStringList& arguments, int timeout);
+
+    const QString program;
+
+    QThread session_thread;
+    ProcessManagerSession *session;
+
+    std::mutex pending_mutex;
+    std::map<quint64, PendingResult> pending;
+    quint64 next_request_id;
+
+    enum SessionState {
+      NOT_STARTED,
+      ACTIVE,
+      UNAVAILABLE
+    };
+    std::atomic<SessionState> session_state;
+    std::mutex start_mutex;
+};
+
+/**
+ * @brief      Owns the process manager process. Lives in the session
+ *             thread of its client, all slots are invoked there.
+ * @ingroup    processmanager
+ */
+class ProcessManagerSession : public QObject {
+  Q_OBJECT
+
+  public:
+    explicit ProcessManagerSession(ProcessManagerClient *client, const QString& program);
+
+  public Q_SLOTS:
+    bool start();
+    void write(const QByteArray& line);
+    void stop();
+
+  private Q_SLOTS:
+    void readResponses();
+    void processFinished();
+
+  private:
+    /**
+     * @brief      Waits for the greeting of the process manager, a process
+     *             which is merely alive may not speak the protocol at all.
+     */
+    bool handshake();
+
+    ProcessManagerClient *client;
+    const QString program;
+    QProcess *process;
+    QByteArray buffer;
+};
@@ -0,0 +1,285 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <algorithm>
+
+#include <QDebug>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QTimer>
+#include <QtConcurrent/QtConcurrentRun>
+#include <QtWidgets/QWidget>
+
+#include "processmanagerclient.h"
+#include "workfloweventsource.h"
+
+namespace {
+
+bool hasEnded(const QString& state) {
+  return state == "Finished" || state == "Cancelled" || state == "Error";
+}
+
+}
+
+WorkflowEventSource::WorkflowEventSource(ProcessManagerClient *client, QObject *parent)
+    : QObject(parent), client(client), pushing(false), next_handle(1) {
+  poll_timer = new QTimer(this);
+  poll_timer->setInterval(POLL_INTERVAL);
+  connect(poll_timer, &QTimer::timeout, this, &WorkflowEventSource::poll);
+
+  if (client) {
+    connect(client, &ProcessManagerClient::messageReceived, this, &WorkflowEventSource::dispatch,
+            Qt::DirectConnection);
+  }
+
+  QString trace_file_name = qEnvironmentVariable("KADISTUDIO_WORKFLOW_EVENT_TRACE");
+  if (!trace_file_name.isEmpty()) {
+    trace_file.setFileName(trace_file_name);
+    if (!trace_file.open(QIODevice::WriteOnly | QIODevice::Append)) {
+      qDebug() << "Unable to record workflow events to" << trace_file_name;
+    }
+  }
+}
+
+WorkflowEventSource::~WorkflowEventSource() {
+  // both run in the thread pool and use the client
+  subscribing.waitForFinished();
+  polling.waitForFinished();
+}
+
+int WorkflowEventSource::subscribe(QObject *receiver, WorkflowEventListener listener) {
+  int handle;
+  bool first;
+  {
+    std::lock_guard<std::mutex> lock(subscriber_mutex);
+    handle = next_handle++;
+    first = subscribers.empty();
+    subscribers[handle] = {receiver, std::move(listener)};
+  }
+  connect(receiver, &QObject::destroyed, this, [this, handle] { unsubscribe(handle); });
+
+  if (first) {
+    QMetaObject::invokeMethod(this, &WorkflowEventSource::start);
+  }
+  return handle;
+}
+
+void WorkflowEventSource::unsubscribe(int handle) {
+  bool last;
+  {
+    std::lock_guard<std::mutex> lock(subscriber_mutex);
+    if (subscribers.erase(handle) == 0) return;
+    last = subscribers.empty();
+  }
+  if (last) {
+    QMetaObject::invokeMethod(this, &WorkflowEventSource::stop);
+  }
+}
+
+bool WorkflowEventSource::isPushing() const {
+  return pushing;
+}
+
+void WorkflowEventSource::start() {
+  if (poll_timer->isActive()) return;
+
+  // in push mode the timer only watches for the session to go away
+  poll_timer->start();
+  // a request still in flight answers for this start as well
+  if (!client || subscribing.isRunning()) return;
+
+  // starting the session and waiting for its answer must not block the GUI thread
+  subscribing = QtConcurrent::run([this] {
+    ShellResult result = client->execute({"subscribe"});
+    const bool accepted = result.exit_code == 0 && client->isSessionActive();
+    QMetaObject::invokeMethod(this, [this, accepted] { subscribed(accepted); });
+  });
+}
+
+void WorkflowEventSource::subscribed(bool accepted) {
+  if (!poll_timer->isActive()) {
+    // the last subscriber left while the request was in flight
+    if (accepted) client->post({"unsubscribe"});
+    return;
+  }
+
+  pushing = accepted;
+  if (!pushing) {
+    qDebug() << "Process manager can not push workflow events, polling instead";
+    poll();
+  }
+}
+
+void WorkflowEventSource::stop() {
+  poll_timer->stop();
+  if (pushing && client) {
+    client->post({"unsubscribe"});
+  }
+  pushing = false;
+}
+
+void WorkflowEventSource::poll() {
+  if (!client || subscribing.isRunning()) return;
+  if (pushing) {
+    if (client->isSessionActive()) return;
+    pushing = false;
+  }
+  if (polling.isRunning() || !hasVisibleSubscriber()) return;
+
+  polling = QtConcurrent::run([this] {
+    ShellResult result = client->execute({"list", "workflows"});
+    if (result.exit_code == 0) {
+      const QJsonArray workflows = QJsonDocument::fromJson(result.stdout_result.toUtf8()).array();
+      for (const auto& value : workflows) {
+        const QJsonObject workflow = value.toObject();
+        const unsigned int workflow_id = workflow["id"].toInt();
+        bool was_running;
+        {
+          std::lock_guard<std::mutex> lock(state_mutex);
+          auto it = known_workflows.find(workflow_id);
+          was_running = it != known_workflows.end() && !hasEnded(it->second["state"].toString());
+        }
+        updateWorkflow(workflow);
+        // the log may still grow while a workflow ends
+        const QString state = workflow["state"].toString();
+        if (was_running || !hasEnded(state)) {
+          pollDetails(workflow_id, state);
+        }
+      }
+    }
+  });
+}
+
+bool WorkflowEventSource::hasVisibleSubscriber() {
+  // widgets in inactive tabs are hidden, they do not need to be polled for
+  std::lock_guard<std::mutex> lock(subscriber_mutex);
+  return std::any_of(subscribers.begin(), subscribers.end(), [](const auto& entry) {
+    auto widget = qobject_cast<QWidget*>(entry.second.receiver.data());
+    return entry.second.receiver && (!widget || widget->isVisible());
+  });
+}
+
+void WorkflowEventSource::dispatch(const QJsonObject& message) {
+  if (trace_file.isOpen()) {
+    std::lock_guard<std::mutex> lock(state_mutex);
+    trace_file.write(QJsonDocument(message).toJson(QJsonDocument::Compact) + '\n');
+    trace_file.flush();
+  }
+
+  const QString type = message["event"].toString();
+  if (type == "workflow") {
+    updateWorkflow(message["workflow"].toObject());
+  } else if (type == "interactions") {
+    WorkflowEvent event {WorkflowEvent::INTERACTIONS_CHANGED};
+    event.workflow_id = message["workflowId"].toInt();
+    publish(event);
+  } else if (type == "log") {
+    logGrown(message["workflowId"].toInt(), message["size"].toInteger());
+  }
+}
+
+bool WorkflowEventSource::updateWorkflow(const QJsonObject& workflow) {
+  WorkflowEvent event {WorkflowEvent::STATE_CHANGED};
+  event.workflow_id = workflow["id"].toInt();
+  event.workflow = workflow;
+  {
+    std::lock_guard<std::mutex> lock(state_mutex);
+    auto it = known_workflows.find(event.workflow_id);
+    if (it != known_workflows.end() && it->second == workflow) {
+      return false;
+    }
+    known_workflows[event.workflow_id] = workflow;
+  }
+
+  publish(event);
+  return true;
+}
+
+void WorkflowEventSource::pollDetails(unsigned int workflow_id, const QString& state) {
+  const QString id = QString::number(workflow_id);
+
+  // a workflow may ask for further interactions without leaving NEEDS_INTERACTION
+  bool interactions_changed = false;
+  if (state == "Needs_interaction") {
+    ShellResult result = client->execute({"interactions", id});
+    if (result.exit_code == 0) {
+      std::lock_guard<std::mutex> lock(state_mutex);
+      QString& known = known_interactions[workflow_id];
+      interactions_changed = result.stdout_result != known;
+      known = result.stdout_result;
+    }
+  } else {
+    std::lock_guard<std::mutex> lock(state_mutex);
+    known_interactions.erase(workflow_id);
+  }
+  if (interactions_changed) {
+    WorkflowEvent event {WorkflowEvent::INTERACTIONS_CHANGED};
+    event.workflow_id = workflow_id;
+    publish(event);
+  }
+
+  QString log_path;
+  {
+    std::lock_guard<std::mutex> lock(state_mutex);
+    log_path = log_paths[workflow_id];
+  }
+  if (log_path.isEmpty()) {
+    ShellResult result = client->execute({"log_path", id});
+    if (result.exit_code != 0) return;
+    log_path = result.stdout_result.trimmed();
+    std::lock_guard<std::mutex> lock(state_mutex);
+    log_paths[workflow_id] = log_path;
+  }
+  logGrown(workflow_id, QFileInfo(log_path).size());
+}
+
+void WorkflowEventSource::logGrown(unsigned int workflow_id, qint64 log_size) {
+  {
+    std::lock_guard<std::mutex> lock(state_mutex);
+    qint64& known_size = log_sizes[workflow_id];
+    if (log_size <= known_size) return;
+    known_size = log_size;
+  }
+
+  WorkflowEvent event {WorkflowEvent::LOG_GROWN};
+  event.workflow_id = workflow_id;
+  event.log_size = log_size;
+  publish(event);
+}
+
+void WorkflowEventSource::publish(const WorkflowEvent& event) {
+  std::lock_guard<std::mutex> lock(subscriber_mutex);
+  for (const auto& [handle, subscriber] : subscribers) {
+    if (!subscriber.receiver) continue;
+    QMetaObject::invokeMethod(subscriber.receiver, [listener = subscriber.listener, event] {
+      listener(event);
+    }, Qt::QueuedConnection);
+  }
+}
+
+int WorkflowEventSource::replay(QIODevice *trace) {
+  int dispatched = 0;
+  while (!trace->atEnd()) {
+    QByteArray line = trace->readLine().trimmed();
+    if (line.isEmpty() || line.startsWith('#')) continue;
+
+    QJsonDocument document = QJsonDocument::fromJson(line);
+    if (document.isObject()) {
+      dispatch(document.object());
+      dispatched++;
+    }
+  }
+  return dispatched;
+}
@@ -0,0 +1,116 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <mutex>
+
+#include <QtCore/QFile>
+#include <QtCore/QFuture>
+#include <QtCore/QObject>
+#include <QtCore/QPointer>
+
+#include "../workflowevent.h"
+
+class QIODevice;
+class QTimer;
+class ProcessManagerClient;
+
+/**
+ * @brief      Turns process manager messages into workflow events and
+ *             delivers them to the subscribers.
+ *
+ *             While someone is subscribed, the source asks the process
+ *             manager session to push its changes:
+ *
+ *               {"event": "workflow", "workflow": {...}}
+ *               {"event": "interactions", "workflowId": 3}
+ *               {"event": "log", "workflowId": 3, "size": 4096}
+ *
+ *             Only deltas are forwarded, a workflow message equal to
+ *             the last known state of that workflow is dropped. If the
+ *             process manager can not push, the source polls the
+ *             workflow list once for all subscribers instead, but only
+ *             while one of them is visible, or is not a widget. While
+ *             polling, the interactions of waiting workflows are compared
+ *             to the ones of the last poll and the log files of workflows
+ *             which did not end yet are checked for growth.
+ *
+ *             Setting KADISTUDIO_WORKFLOW_EVENT_TRACE to a file name
+ *             records all messages to that file, which can be fed to
+ *             replay() later on.
+ * @ingroup    processmanager
+ */
+class WorkflowEventSource : public QObject {
+  Q_OBJECT
+
+  public:
+    explicit WorkflowEventSource(ProcessManagerClient *client, QObject *parent = nullptr);
+    ~WorkflowEventSource() override;
+
+    int subscribe(QObject *receiver, WorkflowEventListener listener);
+    void unsubscribe(int handle);
+
+    /**
+     * @brief      Handles a single message in the wire format above.
+     *             Thread safe.
+     */
+    void dispatch(const QJsonObject& message);
+
+    /**
+     * @brief      Dispatches a recorded trace, one message per line.
+     * @return     The number of dispatched messages.
+     */
+    int replay(QIODevice *trace);
+
+    bool isPushing() const;
+
+    const static int POLL_INTERVAL = 1000;
+
+  private:
+    struct Subscriber {
+      QPointer<QObject> receiver;
+      WorkflowEventListener listener;
+    };
+
+    void start();
+    void subscribed(bool accepted);
+    void stop();
+    void poll();
+    bool hasVisibleSubscriber();
+    bool updateWorkflow(const QJsonObject& workflow);
+    void pollDetails(unsigned int workflow_id, const QString& state);
+    void logGrown(unsigned int workflow_id, qint64 log_size);
+    void publish(const WorkflowEvent& event);
+
+    ProcessManagerClient *client;
+    QTimer *poll_timer;
+    std::atomic<bool> pushing;
+    QFuture<void> subscribing;
+    QFuture<void> polling;
+
+    std::mutex subscriber_mutex;
+    std::map<int, Subscriber> subscribers;
+    int next_handle;
+
+    std::mutex state_mutex;
+    std::map<unsigned int, QJsonObject> known_workflows;
+    std::map<unsigned int, qint64> log_sizes;
+    // only used while polling
+    std::map<unsigned int, QString> log_paths;
+    std::map<unsigned int, QString> known_interactions;
+    QFile trace_file;
+};
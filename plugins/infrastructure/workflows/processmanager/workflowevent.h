@@ -0,0 +1,41 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+/**
+ * @file       workflowevent.h
+ * @ingroup    processmanager
+ * @brief      Change notifications pushed by the process manager.
+ */
+
+#pragma once
+
+#include <functional>
+
+#include <QtCore/QJsonObject>
+
+struct WorkflowEvent {
+
+  enum Type {
+    STATE_CHANGED,        ///< the workflow json differs from the last known one
+    INTERACTIONS_CHANGED, ///< new interactions are available
+    LOG_GROWN             ///< the log file grew to log_size bytes
+  };
+
+  Type type;
+  unsigned int workflow_id = 0;
+  QJsonObject workflow;   ///< full workflow json, only set for STATE_CHANGED
+  qint64 log_size = 0;    ///< only set for LOG_GROWN
+};
+
+using WorkflowEventListener = std::function<void(const WorkflowEvent&)>;
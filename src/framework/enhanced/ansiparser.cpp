@@ -0,0 +1,423 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <type_traits>
+
+#include <QDebug>
+#include <QFontDatabase>
+#include <QStringList>
+
+#include "ansiparser.h"
+
+namespace {
+
+/**
+ * Walks over a line, applying SGR sequences to the format and passing runs of
+ * visible text to the segment callback, if there is one.
+ */
+template<typename Segment>
+int parse(QStringView line, QTextCharFormat& format, const QTextCharFormat& defaultTextCharFormat, Segment segment) {
+  QString run;
+  int column = 0;
+
+  auto flush = [&]() {
+    if constexpr (!std::is_same_v<Segment, std::nullptr_t>) {
+      if (!run.isEmpty()) {
+        segment(run, format);
+        run.clear();
+      }
+    }
+  };
+
+  for (qsizetype pos = 0; pos < line.size(); ++pos) {
+    const QChar c = line[pos];
+    if (c == u'\x1B') {
+      if (pos + 1 >= line.size() || line[pos + 1] != u'[') continue;
+
+      // CSI: parameters up to the final character
+      qsizetype end = pos + 2;
+      while (end < line.size() && (line[end].isDigit() || line[end] == u';')) ++end;
+      if (end >= line.size()) break;
+
+      if (line[end] == u'm') {
+        flush();
+        AnsiParser::applySelectGraphicRendition(line.sliced(pos + 2, end - pos - 2), format, defaultTextCharFormat);
+      }
+      // other control sequences (cursor movement etc.) are ignored
+      pos = end;
+    } else if (c == u'\t') {
+      const int spaces = AnsiParser::TAB_WIDTH - column % AnsiParser::TAB_WIDTH;
+      if constexpr (!std::is_same_v<Segment, std::nullptr_t>) run.append(QString(spaces, u' '));
+      column += spaces;
+    } else if (c.unicode() < 0x20 || c.unicode() == 0x7F) {
+      // BEL, BS, VT, FF, CR and friends have no visible representation
+      continue;
+    } else {
+      if constexpr (!std::is_same_v<Segment, std::nullptr_t>) run.append(c);
+      column++;
+    }
+  }
+  flush();
+  return column;
+}
+
+}
+
+int AnsiParser::parseLine(QStringView line, QTextCharFormat& format, const QTextCharFormat& defaultTextCharFormat,
+                          const SegmentCallback& segment) {
+  return parse(line, format, defaultTextCharFormat, segment);
+}
+
+int AnsiParser::advance(QStringView line, QTextCharFormat& format, const QTextCharFormat& defaultTextCharFormat) {
+  if (!line.contains(u'\x1B') && !line.contains(u'\t')) {
+    // fast path for the common case of a line without any escape sequence
+    return line.size();
+  }
+  return parse(line, format, defaultTextCharFormat, nullptr);
+}
+
+QString AnsiParser::plainText(QStringView line) {
+  QString result;
+  QTextCharFormat format;
+  parse(line, format, format, [&result](const QString& text, const QTextCharFormat&) { result += text; });
+  return result;
+}
+
+void AnsiParser::applySelectGraphicRendition(QStringView parameters, QTextCharFormat& textCharFormat,
+                                             const QTextCharFormat& defaultTextCharFormat) {
+  const QStringList capturedTexts = parameters.toString().split(QLatin1Char(';'), Qt::SkipEmptyParts);
+  if (capturedTexts.isEmpty()) {
+    // Empty parameter list means reset (SGR 0)
+    textCharFormat = defaultTextCharFormat;
+    return;
+  }
+
+  // Iterate parameters (e.g. SGR attributes like 0,1,31, ...)
+  QListIterator<QString> it(capturedTexts);
+  while (it.hasNext()) {
+    bool ok = false;
+    const int attribute = it.next().toInt(&ok);
+    if (ok) {
+      parseEscapeSequence(attribute, it, textCharFormat, defaultTextCharFormat);
+    } else {
+      qWarning().nospace() << "Error in escape sequence \"" << parameters << "m\"; falling back to default formatting.";
+      textCharFormat = defaultTextCharFormat;
+    }
+  }
+}
+
+QColor AnsiParser::getLightColor(int colorindex) {
+  switch (colorindex) {
+    case 0 : return Qt::darkGray;
+    case 1 : return Qt::red;
+    case 2 : return Qt::green;
+    case 3 : return Qt::yellow;
+    case 4 : return Qt::blue;
+    case 5 : return Qt::magenta;
+    case 6 : return Qt::cyan;
+    case 7 : return Qt::white;
+    default : Q_ASSERT(false); return QColor();
+  }
+}
+
+QColor AnsiParser::getDarkColor(int colorindex) {
+  switch (colorindex) {
+    case 0 : return Qt::black;
+    case 1 : return Qt::darkRed;
+    case 2 : return Qt::darkGreen;
+    case 3 : return Qt::darkYellow;
+    case 4 : return Qt::darkBlue;
+    case 5 : return Qt::darkMagenta;
+    case 6 : return Qt::darkCyan;
+    case 7 : return Qt::lightGray;
+    default : Q_ASSERT(false); return QColor();
+  }
+}
+
+QColor AnsiParser::getRGBColor(QListIterator< QString > & i) {
+  bool ok;
+  if (!i.hasNext()) return QColor();
+  int red = i.next().toInt(&ok);
+  if (!ok || !i.hasNext()) return QColor();
+  int green = i.next().toInt(&ok);
+  if (!ok || !i.hasNext()) return QColor();
+  int blue = i.next().toInt(&ok);
+  return QColor(red, green, blue);
+}
+
+QColor AnsiParser::getCubeColor(int index) {
+  index -= 0x10;
+  int red = index % 6;
+  index /= 6;
+  int green = index % 6;
+  index /= 6;
+  int blue = index % 6;
+  index /= 6;
+  Q_ASSERT(index == 0);
+  return QColor(red, green, blue);
+}
+
+// based on https://stackoverflow.com/questions/26500429/qtextedit-and-colored-bash-like-output-emulation
+// based on information: http://en.m.wikipedia.org/wiki/ANSI_escape_code http://misc.flogisoft.com/bash/tip_colors_and_formatting http://invisible-island.net/xterm/ctlseqs/ctlseqs.html
+void AnsiParser::parseEscapeSequence(int attribute, QListIterator< QString > & i, QTextCharFormat & textCharFormat, QTextCharFormat const & defaultTextCharFormat) {
+  switch (attribute) {
+    case 0 : { // Normal/Default (reset all attributes)
+      textCharFormat = defaultTextCharFormat;
+      break;
+    }
+    case 1 : { // Bold/Bright (bold or increased intensity)
+      if (i.hasNext()) {
+        while (i.hasNext()) {
+          bool ok;
+          int attributestack = i.next().toInt(&ok);
+          parseEscapeSequence(attributestack, i, textCharFormat, defaultTextCharFormat);
+        }
+      } else {
+        textCharFormat.setFontWeight(QFont::Bold);
+      }
+      break;
+    }
+    case 2 : { // Dim/Faint (decreased intensity)
+      textCharFormat.setFontWeight(QFont::Light);
+      break;
+    }
+    case 3 : { // Italicized (italic on)
+      textCharFormat.setFontItalic(true);
+      break;
+    }
+    case 4 : { // Underscore (single underlined)
+      textCharFormat.setUnderlineStyle(QTextCharFormat::SingleUnderline);
+      textCharFormat.setFontUnderline(true);
+      break;
+    }
+    case 5 : { // Blink (slow, appears as Bold)
+      textCharFormat.setFontWeight(QFont::Bold);
+      break;
+    }
+    case 6 : { // Blink (rapid, appears as very Bold)
+      textCharFormat.setFontWeight(QFont::Black);
+      break;
+    }
+    case 7 : { // Reverse/Inverse (swap foreground and background)
+      QBrush foregroundBrush = textCharFormat.foreground();
+      textCharFormat.setForeground(textCharFormat.background());
+      textCharFormat.setBackground(foregroundBrush);
+      break;
+    }
+    case 8 : { // Concealed/Hidden/Invisible (usefull for passwords)
+      textCharFormat.setForeground(textCharFormat.background());
+      break;
+    }
+    case 9 : { // Crossed-out characters
+      textCharFormat.setFontStrikeOut(true);
+      break;
+    }
+    case 10 : { // Primary (default) font
+      textCharFormat.setFont(defaultTextCharFormat.font());
+      break;
+    }
+    case 11 ... 19 : {
+      const QStringList families = textCharFormat.fontFamilies().toStringList();
+      if (families.isEmpty())
+        break;
+      const QString& fontFamily = families.first();
+
+      const QStringList fontStyles = QFontDatabase::styles(fontFamily);
+
+      const int fontStyleIndex = attribute - 11;
+      if (fontStyleIndex >= 0 && fontStyleIndex < fontStyles.size()) {
+        const QFont cur = textCharFormat.font();
+        const int pt = cur.pointSize() > 0 ? cur.pointSize() : qRound(cur.pointSizeF());
+
+        textCharFormat.setFont(
+            QFontDatabase::font(fontFamily,fontStyles.at(fontStyleIndex), pt)
+        );
+      }
+      break;
+    }
+    case 20 : { // Fraktur (unsupported)
+      break;
+    }
+    case 21 : { // Set Bold off
+      textCharFormat.setFontWeight(QFont::Normal);
+      break;
+    }
+    case 22 : { // Set Dim off
+      textCharFormat.setFontWeight(QFont::Normal);
+      break;
+    }
+    case 23 : { // Unset italic and unset fraktur
+      textCharFormat.setFontItalic(false);
+      break;
+    }
+    case 24 : { // Unset underlining
+      textCharFormat.setUnderlineStyle(QTextCharFormat::NoUnderline);
+      textCharFormat.setFontUnderline(false);
+      break;
+    }
+    case 25 : { // Unset Blink/Bold
+      textCharFormat.setFontWeight(QFont::Normal);
+      break;
+    }
+    case 26 : { // Reserved
+      break;
+    }
+    case 27 : { // Positive (non-inverted)
+      QBrush backgroundBrush = textCharFormat.background();
+      textCharFormat.setBackground(textCharFormat.foreground());
+      textCharFormat.setForeground(backgroundBrush);
+      break;
+    }
+    case 28 : {
+      textCharFormat.setForeground(defaultTextCharFormat.foreground());
+      textCharFormat.setBackground(defaultTextCharFormat.background());
+      break;
+    }
+    case 29 : {
+      textCharFormat.setUnderlineStyle(QTextCharFormat::NoUnderline);
+      textCharFormat.setFontUnderline(false);
+      break;
+    }
+    case 30 ... 37 : {
+      int colorIndex = attribute - 30;
+      QColor color;
+      if (QFont::Normal < textCharFormat.fontWeight()) {
+        color = getLightColor(colorIndex);
+      } else {
+        color = getDarkColor(colorIndex);
+      }
+      textCharFormat.setForeground(color);
+      break;
+    }
+    case 38 : {
+      if (i.hasNext()) {
+        bool ok = false;
+        int selector = i.next().toInt(&ok);
+        Q_ASSERT(ok);
+        QColor color;
+        switch (selector) {
+          case 2 : {
+            textCharFormat.setForeground(getRGBColor(i));
+            break;
+          }
+          case 5 : {
+            if (!i.hasNext()) break;
+            int index = i.next().toInt(&ok);
+            Q_ASSERT(ok);
+            switch (index) {
+              case 0x00 ... 0x07 : { // 0x00-0x07:  standard colors (as in ESC [ 30..37 m)
+                return parseEscapeSequence(index - 0x00 + 30, i, textCharFormat, defaultTextCharFormat);
+              }
+              case 0x08 ... 0x0F : { // 0x08-0x0F:  high intensity colors (as in ESC [ 90..97 m)
+                return parseEscapeSequence(index - 0x08 + 90, i, textCharFormat, defaultTextCharFormat);
+              }
+              case 0x10 ... 0xE7 : { // 0x10-0xE7:  6*6*6=216 colors: 16 + 36*r + 6*g + b (0≤r,g,b≤5)
+                color = getCubeColor(index);
+                break;
+              }
+              case 0xE8 ... 0xFF : { // 0xE8-0xFF:  grayscale from black to white in 24 steps
+                qreal intensity = qreal(index - 0xE8) / (0xFF - 0xE8);
+                color.setRgbF(intensity, intensity, intensity);
+                break;
+              }
+            }
+            textCharFormat.setForeground(color);
+            break;
+          }
+          default : {
+            break;
+          }
+        }
+      }
+      break;
+    }
+    case 39 : {
+      textCharFormat.setForeground(defaultTextCharFormat.foreground());
+      break;
+    }
+    case 40 ... 47 : {
+      int colorIndex = attribute - 40;
+      QColor color = getLightColor(colorIndex);
+      textCharFormat.setBackground(color);
+      break;
+    }
+    case 48 : {
+      if (i.hasNext()) {
+        bool ok = false;
+        int selector = i.next().toInt(&ok);
+        Q_ASSERT(ok);
+        QColor color;
+        switch (selector) {
+          case 2 : {
+            textCharFormat.setBackground(getRGBColor(i));
+            break;
+          }
+          case 5 : {
+            if (!i.hasNext()) break;
+            int index = i.next().toInt(&ok);
+            Q_ASSERT(ok);
+            switch (index) {
+              case 0x00 ... 0x07 : { // 0x00-0x07:  standard colors (as in ESC [ 40..47 m)
+                return parseEscapeSequence(index - 0x00 + 40, i, textCharFormat, defaultTextCharFormat);
+              }
+              case 0x08 ... 0x0F : { // 0x08-0x0F:  high intensity colors (as in ESC [ 100..107 m)
+                return parseEscapeSequence(index - 0x08 + 100, i, textCharFormat, defaultTextCharFormat);
+              }
+              case 0x10 ... 0xE7 : { // 0x10-0xE7:  6*6*6=216 colors: 16 + 36*r + 6*g + b (0≤r,g,b≤5)
+                color = getCubeColor(index);
+                break;
+              }
+              case 0xE8 ... 0xFF : { // 0xE8-0xFF:  grayscale from black to white in 24 steps
+                qreal intensity = qreal(index - 0xE8) / (0xFF - 0xE8);
+                color.setRgbF(intensity, intensity, intensity);
+                break;
+              }
+            }
+            textCharFormat.setBackground(color);
+            break;
+          }
+          default : {
+            break;
+          }
+        }
+      }
+      break;
+    }
+    case 49 : {
+      textCharFormat.setBackground(defaultTextCharFormat.background());
+      break;
+    }
+    case 90 ... 97 : {
+      int colorIndex = attribute - 90;
+      QColor color = getLightColor(colorIndex);
+      color.setRedF(color.redF() * 0.8);
+      color.setGreenF(color.greenF() * 0.8);
+      color.setBlueF(color.blueF() * 0.8);
+      textCharFormat.setForeground(color);
+      break;
+    }
+    case 100 ... 107 : {
+      int colorIndex = attribute - 100;
+      QColor color = getLightColor(colorIndex);
+      color.setRedF(color.redF() * 0.8);
+      color.setGreenF(color.greenF() * 0.8);
+      color.setBlueF(color.blueF() * 0.8);
+      textCharFormat.setBackground(color);
+      break;
+    }
+    default : {
+      break;
+    }
+  }
+}
@@ -0,0 +1,71 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <functional>
+
+#include <QColor>
+#include <QList>
+#include <QString>
+#include <QStringView>
+#include <QTextCharFormat>
+
+#include <cpputils/dllapi.hpp>
+
+/**
+ * @brief      Interprets ANSI escape sequences of terminal output line by line.
+ *             Select graphic rendition sequences change the current format,
+ *             which carries over to the following lines. All other control
+ *             sequences and characters are dropped, tabs are expanded.
+ * @ingroup    enhanced
+ */
+class DLLAPI AnsiParser {
+
+public:
+  using SegmentCallback = std::function<void(const QString& text, const QTextCharFormat& format)>;
+
+  /**
+   * @brief      Splits a line into runs of visible text with the same format.
+   * @return     The number of visible columns of the line.
+   */
+  static int parseLine(QStringView line, QTextCharFormat& format, const QTextCharFormat& defaultTextCharFormat,
+                       const SegmentCallback& segment);
+
+  /**
+   * @brief      Like parseLine, but only follows the format.
+   */
+  static int advance(QStringView line, QTextCharFormat& format, const QTextCharFormat& defaultTextCharFormat);
+
+  /**
+   * @brief      The visible text of a line without any escape sequences.
+   */
+  static QString plainText(QStringView line);
+
+  /**
+   * @brief      Applies the parameters of an "ESC [ <parameters> m" sequence.
+   */
+  static void applySelectGraphicRendition(QStringView parameters, QTextCharFormat& textCharFormat,
+                                          const QTextCharFormat& defaultTextCharFormat);
+
+  const static int TAB_WIDTH = 8;
+
+private:
+  static QColor getLightColor(int colorindex);
+  static QColor getDarkColor(int colorindex);
+  static QColor getRGBColor(QListIterator<QString>& i);
+  static QColor getCubeColor(int index);
+
+  static void parseEscapeSequence(int attribute, QListIterator<QString>& i, QTextCharFormat& textCharFormat, QTextCharFormat const& defaultTextCharFormat);
+};
@@ -14,24 +14,50 @@
 
 #pragma once
 
-#include <QTextEdit>
-class QPushButton;
+#include <deque>
+
+#include <QColor>
+
+#include "terminalview.h"
 
 #include <cpputils/dllapi.hpp>
 
 /**
- * @brief      A terminal-like QTextEdit which supports ANSI color codes
+ * @brief      A terminal-like text widget which supports ANSI color codes.
+ *             Output is appended to an in-memory line buffer, only the visible
+ *             lines are laid out (see TerminalView). The buffer keeps the
+ *             newest getMaximumLineCount() lines, older ones are dropped.
  * @ingroup    enhanced
  */
-class DLLAPI ColoredTerminalWidget : public QTextEdit {
+class DLLAPI ColoredTerminalWidget : public TerminalView {
   Q_OBJECT
 
 public:
   explicit ColoredTerminalWidget(QWidget* parent = nullptr);
 
-  void setTextTermFormatting(QString const& text, const QTextCharFormat& defaultTextCharFormat = QTextCharFormat());
+  /**
+   * @brief      Appends terminal output, which may contain escape sequences
+   *             and may end in the middle of a line.
+   */
+  void setTextTermFormatting(QString const& text);
+
+  /**
+   * @brief      Appends the text as a new line in the current text color, like
+   *             QTextEdit::append().
+   */
+  void append(const QString& text);
+  void setTextColor(const QColor& color);
+  void clear();
+
+  /**
+   * @brief      Limits the number of lines kept, like
+   *             QPlainTextEdit::setMaximumBlockCount().
+   */
+  void setMaximumLineCount(int count);
+  int getMaximumLineCount() const;
+
+  const static int DEFAULT_MAXIMUM_LINE_COUNT = 100000;
 
-  void resizeEvent(QResizeEvent *event) Q_DECL_OVERRIDE;
   QSize sizeHint() const Q_DECL_OVERRIDE;
 
   int getRows() {
@@ -41,24 +67,34 @@ public:
     return columns;
   }
 
-private Q_SLOTS:
-  void scrollToBottom(void);
-  void scrolledTo(int val);
-
 private:
-  QColor getLightColor(int colorindex);
-  QColor getDarkColor(int colorindex);
-  QColor getRGBColor(QListIterator<QString>& i);
-  QColor getCubeColor(int index);
+  class Buffer : public TerminalLineSource {
+    public:
+      int lineCount() const override;
+      QString lineText(int line_number) const override;
 
-  void parseEscapeSequence(int attribute, QListIterator<QString>& i, QTextCharFormat& textCharFormat, QTextCharFormat const& defaultTextCharFormat);
+      /**
+       * @return     The number of lines dropped from the front.
+       */
+      int append(QStringView text);
+      bool isEmpty() const;
+      void clear();
 
-  int rows = 40;
-  int columns = 80;
+      int setMaximumLineCount(int count);
+      int getMaximumLineCount() const;
+
+    private:
+      int trim();
 
-  void posNewContentButton();
+      std::deque<QString> lines;
+      std::size_t maximum_lines = DEFAULT_MAXIMUM_LINE_COUNT;
+  };
 
-  QPushButton *button;
-  bool atbottom;
+  void flash();
 
+  Buffer buffer;
+  QColor text_color;
+
+  int rows = 40;
+  int columns = 80;
 };
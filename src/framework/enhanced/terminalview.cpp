@@ -0,0 +1,444 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <algorithm>
+#include <climits>
+
+#include <QApplication>
+#include <QClipboard>
+#include <QContextMenuEvent>
+#include <QKeyEvent>
+#include <QMenu>
+#include <QMouseEvent>
+#include <QPainter>
+#include <QPushButton>
+#include <QScrollBar>
+#include <QStyle>
+
+#include "ansiparser.h"
+#include "terminalview.h"
+
+namespace {
+
+// space between the margin and the text
+const int TEXT_PADDING = 4;
+
+}
+
+TerminalView::TerminalView(QWidget* parent)
+    : QAbstractScrollArea(parent), source(nullptr), dropped_lines(0), first_checkpoint(0), scanned_line(0),
+      max_columns(0), following(true), selecting(false) {
+  setFont(QFont("monospace", 12));
+  viewport()->setCursor(Qt::IBeamCursor);
+
+  new_content_button = new QPushButton(this);
+  new_content_button->setIcon(style()->standardIcon(QStyle::SP_ArrowDown));
+  new_content_button->setText(tr("New Content"));
+  new_content_button->setStyleSheet("font: bold; outline:10px black; color: rgba(255,255,255,155); background-color: rgba(10,10,255,100)");
+  new_content_button->show(); // do recalculation of size hints
+  new_content_button->hide();
+  connect(new_content_button, &QPushButton::pressed, this, &TerminalView::scrollToBottom);
+
+  connect(verticalScrollBar(), &QScrollBar::valueChanged, this, &TerminalView::scrolledTo);
+}
+
+void TerminalView::setSource(const TerminalLineSource* source) {
+  this->source = source;
+  reset();
+}
+
+const TerminalLineSource* TerminalView::getSource() const {
+  return source;
+}
+
+void TerminalView::setDefaultFormat(const QTextCharFormat& format) {
+  default_format = format;
+  reset();
+}
+
+void TerminalView::reset() {
+  rescan();
+  selecting = false;
+  anchor = cursor = {};
+  following = true;
+  linesChanged();
+}
+
+void TerminalView::linesChanged() {
+  scanLines();
+  updateScrollBars();
+  if (following) {
+    scrollToBottom();
+  } else {
+    new_content_button->show();
+  }
+  viewport()->update();
+}
+
+void TerminalView::linesDropped(int count) {
+  if (count > 0) {
+    dropCheckpoints(count);
+    if (!following) {
+      verticalScrollBar()->setValue(verticalScrollBar()->value() - count);
+    }
+    anchor.line -= count;
+    cursor.line -= count;
+    if (std::max(anchor, cursor).line < 0) {
+      anchor = cursor = {};
+    } else {
+      anchor.line = std::max(anchor.line, 0);
+      cursor.line = std::max(cursor.line, 0);
+    }
+  }
+  linesChanged();
+}
+
+void TerminalView::dropCheckpoints(int count) {
+  dropped_lines += count;
+  scanned_line -= count;
+
+  // keep the checkpoint of the interval the new first line is in
+  const int first_needed = dropped_lines / CHECKPOINT_INTERVAL;
+  const int obsolete = std::min<int>(first_needed - first_checkpoint, checkpoints.size());
+  checkpoints.erase(checkpoints.begin(), checkpoints.begin() + obsolete);
+  first_checkpoint += obsolete;
+
+  if (scanned_line < 0 || checkpoints.empty() || first_checkpoint != first_needed) {
+    // more lines were dropped than scanned, start over
+    rescan();
+  }
+}
+
+void TerminalView::rescan() {
+  checkpoints.clear();
+  dropped_lines = 0;
+  first_checkpoint = 0;
+  scanned_line = 0;
+  scan_format = default_format;
+  max_columns = 0;
+}
+
+void TerminalView::scanLines() {
+  const int count = source ? source->lineCount() : 0;
+  if (count < scanned_line) {
+    // the source shrank without a reset, start over
+    rescan();
+  }
+
+  QTextCharFormat format = scan_format;
+  for (int line_number = scanned_line; line_number < count; ++line_number) {
+    const int line = dropped_lines + line_number;
+    if (line % CHECKPOINT_INTERVAL == 0 && first_checkpoint + int(checkpoints.size()) == line / CHECKPOINT_INTERVAL) {
+      checkpoints.push_back(format);
+    }
+    if (line_number == count - 1) {
+      scanned_line = line_number;
+      scan_format = format;
+    }
+    max_columns = std::max(max_columns, AnsiParser::advance(source->lineText(line_number), format, default_format));
+  }
+}
+
+QTextCharFormat TerminalView::formatAt(int line_number) const {
+  if (checkpoints.empty()) return default_format;
+
+  const int line = dropped_lines + line_number;
+  const int checkpoint = std::min<int>(line / CHECKPOINT_INTERVAL - first_checkpoint, checkpoints.size() - 1);
+  QTextCharFormat format = checkpoints[checkpoint];
+  // the dropped lines of the first interval are skipped
+  const int first = std::max(0, (first_checkpoint + checkpoint) * CHECKPOINT_INTERVAL - dropped_lines);
+  for (int scanned = first; scanned < line_number; ++scanned) {
+    AnsiParser::advance(source->lineText(scanned), format, default_format);
+  }
+  return format;
+}
+
+int TerminalView::lineHeight() const {
+  return fontMetrics().lineSpacing();
+}
+
+int TerminalView::charWidth() const {
+  return std::max(1, fontMetrics().horizontalAdvance(QLatin1Char('M')));
+}
+
+int TerminalView::textLeft() const {
+  return marginWidth() + TEXT_PADDING - horizontalScrollBar()->value();
+}
+
+int TerminalView::firstVisibleLine() const {
+  return verticalScrollBar()->value();
+}
+
+int TerminalView::visibleLineCount() const {
+  return std::max(1, viewport()->height() / lineHeight());
+}
+
+void TerminalView::updateScrollBars() {
+  const int count = source ? source->lineCount() : 0;
+  const int visible = visibleLineCount();
+  verticalScrollBar()->setPageStep(visible);
+  verticalScrollBar()->setSingleStep(1);
+  verticalScrollBar()->setRange(0, std::max(0, count - visible));
+
+  const int available = viewport()->width() - marginWidth();
+  const int content = max_columns * charWidth() + 2 * TEXT_PADDING;
+  horizontalScrollBar()->setPageStep(available);
+  horizontalScrollBar()->setSingleStep(charWidth());
+  horizontalScrollBar()->setRange(0, std::max(0, content - available));
+}
+
+void TerminalView::scrollToBottom() {
+  following = true;
+  verticalScrollBar()->setValue(verticalScrollBar()->maximum());
+  new_content_button->hide();
+}
+
+void TerminalView::scrolledTo(int value) {
+  following = (value == verticalScrollBar()->maximum());
+  if (following) {
+    new_content_button->hide();
+  }
+}
+
+bool TerminalView::isFollowing() const {
+  return following;
+}
+
+std::size_t TerminalView::indexMemory() const {
+  return checkpoints.capacity() * sizeof(QTextCharFormat);
+}
+
+int TerminalView::marginWidth() const {
+  return 0;
+}
+
+void TerminalView::paintMargin(QPainter& /*painter*/, int /*line_number*/, const QRect& /*rect*/) {
+}
+
+void TerminalView::paintEvent(QPaintEvent* event) {
+  QPainter painter(viewport());
+  painter.fillRect(event->rect(), palette().base());
+  if (!source) return;
+
+  const int count = source->lineCount();
+  const int first = firstVisibleLine();
+  const int last = std::min(count, first + visibleLineCount() + 1);
+  const int line_height = lineHeight();
+  const int char_width = charWidth();
+  const int margin = marginWidth();
+  const int left = textLeft();
+
+  const Position selection_begin = std::min(anchor, cursor);
+  const Position selection_end = std::max(anchor, cursor);
+  const bool has_selection = hasSelection();
+
+  QTextCharFormat format = formatAt(first);
+  painter.setClipRect(margin, 0, viewport()->width() - margin, viewport()->height());
+  for (int line_number = first; line_number < last; ++line_number) {
+    const int y = (line_number - first) * line_height;
+
+    // selected columns of this line
+    int selected_from = INT_MAX, selected_to = INT_MAX;
+    if (has_selection && selection_begin.line <= line_number && line_number <= selection_end.line) {
+      selected_from = line_number == selection_begin.line ? selection_begin.column : 0;
+      selected_to = line_number == selection_end.line ? selection_end.column : INT_MAX;
+    }
+
+    int column = 0;
+    AnsiParser::parseLine(source->lineText(line_number), format, default_format,
+                          [&](const QString& text, const QTextCharFormat& segment_format) {
+      const int end = column + text.size();
+      // split the segment at the selection boundaries
+      const int boundaries[] = {column, std::clamp(selected_from, column, end), std::clamp(selected_to, column, end), end};
+      for (int part = 0; part < 3; ++part) {
+        if (boundaries[part] == boundaries[part + 1]) continue;
+        drawSegment(painter, left + boundaries[part] * char_width, y,
+                    text.mid(boundaries[part] - column, boundaries[part + 1] - boundaries[part]), segment_format,
+                    part == 1);
+      }
+      column = end;
+    });
+  }
+
+  if (margin > 0) {
+    painter.setClipping(false);
+    for (int line_number = first; line_number < last; ++line_number) {
+      paintMargin(painter, line_number, QRect(0, (line_number - first) * line_height, margin, line_height));
+    }
+  }
+}
+
+void TerminalView::drawSegment(QPainter& painter, int x, int y, const QString& text, const QTextCharFormat& format,
+                               bool selected) const {
+  QFont segment_font = font();
+  if (format.hasProperty(QTextFormat::FontWeight)) segment_font.setWeight(QFont::Weight(format.fontWeight()));
+  if (format.hasProperty(QTextFormat::FontItalic)) segment_font.setItalic(format.fontItalic());
+  if (format.hasProperty(QTextFormat::FontUnderline)) segment_font.setUnderline(format.fontUnderline());
+  if (format.hasProperty(QTextFormat::FontStrikeOut)) segment_font.setStrikeOut(format.fontStrikeOut());
+
+  QColor foreground = palette().color(QPalette::Text);
+  if (selected) {
+    foreground = palette().color(QPalette::HighlightedText);
+    painter.fillRect(x, y, text.size() * charWidth(), lineHeight(), palette().highlight());
+  } else {
+    if (format.background().style() != Qt::NoBrush) {
+      painter.fillRect(x, y, text.size() * charWidth(), lineHeight(), format.background());
+    }
+    if (format.foreground().style() != Qt::NoBrush) {
+      foreground = format.foreground().color();
+    }
+  }
+
+  painter.setFont(segment_font);
+  painter.setPen(foreground);
+  painter.drawText(x, y + fontMetrics().ascent(), text);
+}
+
+void TerminalView::resizeEvent(QResizeEvent* event) {
+  QAbstractScrollArea::resizeEvent(event);
+  updateScrollBars();
+  if (following) {
+    scrollToBottom();
+  }
+  positionNewContentButton();
+}
+
+void TerminalView::positionNewContentButton() {
+  const int margin = 20;  // arbitrary margin
+  QSize btnSize = new_content_button->frameSize();
+  QSize containerSize = size();
+  QSize scrollbarSize = verticalScrollBar()->frameSize();
+  int newX = containerSize.width()  - (btnSize.width()  + scrollbarSize.width() + margin);
+  int newY = containerSize.height() - (btnSize.height() + margin);
+  new_content_button->move(newX, newY);
+}
+
+void TerminalView::scrollContentsBy(int /*dx*/, int /*dy*/) {
+  viewport()->update();
+}
+
+TerminalView::Position TerminalView::positionAt(const QPoint& point) const {
+  const int count = source ? source->lineCount() : 0;
+  Position position;
+  position.line = std::clamp(firstVisibleLine() + point.y() / lineHeight(), 0, std::max(0, count - 1));
+  position.column = std::max(0, (point.x() - textLeft() + charWidth() / 2) / charWidth());
+  return position;
+}
+
+void TerminalView::mousePressEvent(QMouseEvent* event) {
+  if (event->button() != Qt::LeftButton) {
+    QAbstractScrollArea::mousePressEvent(event);
+    return;
+  }
+  anchor = cursor = positionAt(event->position().toPoint());
+  selecting = true;
+  viewport()->update();
+}
+
+void TerminalView::mouseMoveEvent(QMouseEvent* event) {
+  if (!selecting) return;
+
+  // scroll while dragging the selection outside of the viewport
+  const int y = event->position().toPoint().y();
+  if (y < 0) {
+    verticalScrollBar()->triggerAction(QAbstractSlider::SliderSingleStepSub);
+  } else if (y > viewport()->height()) {
+    verticalScrollBar()->triggerAction(QAbstractSlider::SliderSingleStepAdd);
+  }
+  cursor = positionAt(event->position().toPoint());
+  viewport()->update();
+}
+
+void TerminalView::mouseReleaseEvent(QMouseEvent* event) {
+  if (event->button() == Qt::LeftButton && selecting) {
+    selecting = false;
+    if (hasSelection() && QApplication::clipboard()->supportsSelection()) {
+      QApplication::clipboard()->setText(selectedText(), QClipboard::Selection);
+    }
+  }
+  QAbstractScrollArea::mouseReleaseEvent(event);
+}
+
+void TerminalView::keyPressEvent(QKeyEvent* event) {
+  if (event->matches(QKeySequence::Copy)) {
+    copy();
+  } else if (event->matches(QKeySequence::SelectAll)) {
+    selectAll();
+  } else if (event->matches(QKeySequence::MoveToStartOfDocument)) {
+    verticalScrollBar()->setValue(0);
+  } else if (event->matches(QKeySequence::MoveToEndOfDocument)) {
+    scrollToBottom();
+  } else {
+    QAbstractScrollArea::keyPressEvent(event);
+  }
+}
+
+void TerminalView::contextMenuEvent(QContextMenuEvent* event) {
+  QMenu menu(this);
+  QAction *copy_action = menu.addAction(tr("Copy"));
+  copy_action->setShortcut(QKeySequence::Copy);
+  copy_action->setEnabled(hasSelection());
+  connect(copy_action, &QAction::triggered, this, &TerminalView::copy);
+  QAction *select_all_action = menu.addAction(tr("Select All"));
+  select_all_action->setShortcut(QKeySequence::SelectAll);
+  connect(select_all_action, &QAction::triggered, this, &TerminalView::selectAll);
+  menu.exec(event->globalPos());
+}
+
+bool TerminalView::hasSelection() const {
+  return source && !(anchor == cursor);
+}
+
+void TerminalView::copy() {
+  if (hasSelection()) {
+    QApplication::clipboard()->setText(selectedText());
+  }
+}
+
+void TerminalView::selectAll() {
+  const int count = source ? source->lineCount() : 0;
+  if (count == 0) return;
+  anchor = {0, 0};
+  cursor = {count - 1, INT_MAX};
+  viewport()->update();
+}
+
+void TerminalView::clearSelection() {
+  anchor = cursor = {};
+  viewport()->update();
+}
+
+QString TerminalView::selectedText() const {
+  if (!hasSelection()) return {};
+
+  const Position begin = std::min(anchor, cursor);
+  const Position end = std::max(anchor, cursor);
+  QStringList lines;
+  for (int line_number = begin.line; line_number <= end.line; ++line_number) {
+    const QString text = AnsiParser::plainText(source->lineText(line_number));
+    const int from = line_number == begin.line ? begin.column : 0;
+    const int to = line_number == end.line ? std::min<int>(end.column, text.size()) : text.size();
+    lines.append(text.mid(from, std::max(0, to - from)));
+  }
+  return lines.join('\n');
+}
+
+QString TerminalView::toPlainText() const {
+  QStringList lines;
+  const int count = source ? source->lineCount() : 0;
+  for (int line_number = 0; line_number < count; ++line_number) {
+    lines.append(AnsiParser::plainText(source->lineText(line_number)));
+  }
+  return lines.join('\n');
+}
@@ -0,0 +1,177 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <vector>
+
+#include <QAbstractScrollArea>
+#include <QTextCharFormat>
+
+#include <cpputils/dllapi.hpp>
+
+class QPushButton;
+
+/**
+ * @brief      The lines shown by a TerminalView. Lines may contain ANSI
+ *             escape sequences but no newline.
+ * @ingroup    enhanced
+ */
+class DLLAPI TerminalLineSource {
+
+public:
+  virtual ~TerminalLineSource() = default;
+  virtual int lineCount() const = 0;
+  virtual QString lineText(int line_number) const = 0;
+};
+
+/**
+ * @brief      A read-only terminal-like text view which only lays out and
+ *             paints the lines inside the viewport.
+ *
+ *             The lines are pulled from a TerminalLineSource when they are
+ *             painted, the view itself keeps only the ANSI format at the start
+ *             of every CHECKPOINT_INTERVAL-th line. Painting a frame therefore
+ *             costs the visible lines plus at most one interval, and the view
+ *             needs one format per CHECKPOINT_INTERVAL lines instead of the
+ *             text of every line. Lines are not wrapped.
+ *
+ *             Columns are counted in characters and all have the width of
+ *             'M', so the view assumes a monospace font.
+ *
+ *             While scrolled to the bottom the view follows new lines, otherwise
+ *             a button offers to jump to the new content.
+ * @ingroup    enhanced
+ */
+class DLLAPI TerminalView : public QAbstractScrollArea {
+  Q_OBJECT
+
+public:
+  explicit TerminalView(QWidget* parent = nullptr);
+
+  /**
+   * @brief      Shows the lines of the given source, which must outlive the
+   *             view or be replaced before it is destroyed.
+   */
+  void setSource(const TerminalLineSource* source);
+  const TerminalLineSource* getSource() const;
+
+  void setDefaultFormat(const QTextCharFormat& format);
+
+  bool hasSelection() const;
+  QString selectedText() const;
+  QString toPlainText() const;
+
+  bool isFollowing() const;
+  int firstVisibleLine() const;
+  int visibleLineCount() const;
+
+  /**
+   * @return     The memory used for the format checkpoints in bytes.
+   */
+  std::size_t indexMemory() const;
+
+  const static int CHECKPOINT_INTERVAL = 128;
+
+public Q_SLOTS:
+  /**
+   * @brief      To be called when lines were appended to the source or its last
+   *             line has grown.
+   */
+  void linesChanged();
+
+  /**
+   * @brief      To be called when count lines were dropped from the front of
+   *             the source, together with the lines appended since the last
+   *             change. Only the new lines are scanned, the checkpoints of the
+   *             dropped lines are discarded. The escape sequences of dropped
+   *             lines before the first remaining checkpoint are lost, as in a
+   *             terminal with a limited scrollback. A view scrolled up keeps
+   *             showing the same lines.
+   */
+  void linesDropped(int count);
+
+  /**
+   * @brief      To be called when the content of the source was replaced.
+   */
+  void reset();
+
+  void copy();
+  void selectAll();
+  void clearSelection();
+  void scrollToBottom();
+
+protected:
+  /**
+   * @brief      Width of an area left of the text, painted by paintMargin().
+   */
+  virtual int marginWidth() const;
+  virtual void paintMargin(QPainter& painter, int line_number, const QRect& rect);
+
+  void paintEvent(QPaintEvent* event) override;
+  void resizeEvent(QResizeEvent* event) override;
+  void scrollContentsBy(int dx, int dy) override;
+  void mousePressEvent(QMouseEvent* event) override;
+  void mouseMoveEvent(QMouseEvent* event) override;
+  void mouseReleaseEvent(QMouseEvent* event) override;
+  void keyPressEvent(QKeyEvent* event) override;
+  void contextMenuEvent(QContextMenuEvent* event) override;
+
+private:
+  struct Position {
+    int line = 0;
+    int column = 0;
+
+    bool operator<(const Position& other) const {
+      return line < other.line || (line == other.line && column < other.column);
+    }
+    bool operator==(const Position& other) const = default;
+  };
+
+  void scanLines();
+  void rescan();
+  void dropCheckpoints(int count);
+  QTextCharFormat formatAt(int line_number) const;
+  void updateScrollBars();
+  void positionNewContentButton();
+  void scrolledTo(int value);
+  Position positionAt(const QPoint& point) const;
+  int lineHeight() const;
+  int charWidth() const;
+  int textLeft() const;
+  void drawSegment(QPainter& painter, int x, int y, const QString& text, const QTextCharFormat& format,
+                   bool selected) const;
+
+  const TerminalLineSource *source;
+  QTextCharFormat default_format;
+
+  // lines dropped from the front since the last rescan, the checkpoints count
+  // lines including them
+  int dropped_lines;
+  // format at the start of every CHECKPOINT_INTERVAL-th line, beginning with
+  // the interval of the first line of the source
+  std::vector<QTextCharFormat> checkpoints;
+  int first_checkpoint;
+  // the last line is scanned again on every change, since it may still grow
+  int scanned_line;
+  QTextCharFormat scan_format;
+  int max_columns;
+
+  bool following;
+  bool selecting;
+  Position anchor;
+  Position cursor;
+
+  QPushButton *new_content_button;
+};
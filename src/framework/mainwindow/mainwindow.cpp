@@ -31,6 +31,7 @@
 #include <pluginframework/pluginchooser/pluginchooser.h>
 #include <pluginframework/plugininfo/plugininfo.h>
 #include <pluginframework/pluginmanager.h>
+#include <tracing/tracer.h>
 
 #include "aboutdialog.h"
 #include "helpdialog.h"
@@ -180,6 +181,7 @@ void MainWindow::startPlugin(const QString& namespacepath) {
 }
 
 void MainWindow::readSettings() {
+  TRACE_SCOPE("startup", "MainWindow::readSettings");
   QSettings settings(qApp->applicationName(), "main");
 
   settings.beginGroup(sGeometry);
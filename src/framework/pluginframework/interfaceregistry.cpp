@@ -0,0 +1,72 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include "interfaceregistry.h"
+
+namespace LibFramework {
+
+InterfaceRegistry::InterfaceRegistry(Resolver resolver)
+    : resolver(std::move(resolver)), generation(1), nextlistener(1) {
+}
+
+InterfaceSlot* InterfaceRegistry::getSlot(const std::string& namespacepath, std::type_index type) {
+  const std::pair<std::string, std::type_index> key(namespacepath, type);
+  {
+    std::shared_lock<std::shared_mutex> lock(slotmutex);
+    auto it = interfaceslots.find(key);
+    if (it != interfaceslots.end()) {
+      return it->second.get();
+    }
+  }
+
+  std::unique_lock<std::shared_mutex> lock(slotmutex);
+  std::unique_ptr<InterfaceSlot> &slot = interfaceslots[key];
+  if (!slot) {
+    slot = std::make_unique<InterfaceSlot>(namespacepath, &generation);
+  }
+  return slot.get();
+}
+
+InterfaceRegistry::Resolved InterfaceRegistry::resolve(const std::string& namespacepath) const {
+  return resolver(namespacepath);
+}
+
+void InterfaceRegistry::notify(const std::string& namespacepath, Change change) {
+  generation.fetch_add(1, std::memory_order_acq_rel);
+
+  std::map<int, Listener> currentlisteners;
+  {
+    std::lock_guard<std::mutex> lock(listenermutex);
+    currentlisteners = listeners;
+  }
+  // without holding the lock, listeners may look up interfaces or unsubscribe
+  for (const std::map<int, Listener>::value_type &pair : currentlisteners) {
+    pair.second(namespacepath, change);
+  }
+}
+
+int InterfaceRegistry::subscribe(Listener listener) {
+  std::lock_guard<std::mutex> lock(listenermutex);
+  const int handle = nextlistener++;
+  listeners[handle] = std::move(listener);
+  return handle;
+}
+
+void InterfaceRegistry::unsubscribe(int handle) {
+  std::lock_guard<std::mutex> lock(listenermutex);
+  listeners.erase(handle);
+}
+
+}
@@ -0,0 +1,191 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <type_traits>
+#include <typeindex>
+#include <utility>
+
+#include <cpputils/dllapi.hpp>
+
+#include "interfacecontainer.h"
+
+namespace LibFramework {
+
+/**
+ * @brief      Cached result of looking up one interface type in the
+ *             plugin of one namespace.
+ *
+ *             The cached pointer is valid as long as the generation of
+ *             the slot matches the generation of its registry. Slots
+ *             are never moved or freed while the registry exists.
+ * @ingroup    libframework
+ */
+struct InterfaceSlot {
+  InterfaceSlot(const std::string& namespacepath, const std::atomic<std::uint64_t>* registrygeneration)
+      : namespacepath(namespacepath), registrygeneration(registrygeneration) {
+  }
+
+  const std::string namespacepath;
+  const std::atomic<std::uint64_t> *const registrygeneration;
+  std::atomic<std::uint64_t> generation {0};
+  std::atomic<void*> pointer {nullptr};
+  std::mutex mutex;
+};
+
+/**
+ * @brief      Keeps the typed interface lookups of all plugins.
+ *
+ *             Every change of a plugin, i.e. adding, loading or
+ *             unloading it, increases the generation of the registry,
+ *             which invalidates all cached lookups at once. Listeners
+ *             subscribed to the registry are notified of each change in
+ *             the thread causing it.
+ * @ingroup    libframework
+ */
+class DLLAPI InterfaceRegistry {
+
+  public:
+
+    struct Resolved {
+      const InterfaceContainer *interfacecontainer;
+      bool cacheable;       ///< false if the plugin creates new interfaces on each lookup
+    };
+
+    enum Change {
+      added,
+      loaded,
+      unloaded
+    };
+
+    typedef std::function<Resolved (const std::string& namespacepath)> Resolver;
+    typedef std::function<void (const std::string& namespacepath, Change change)> Listener;
+
+    explicit InterfaceRegistry(Resolver resolver);
+
+    InterfaceRegistry(const InterfaceRegistry&) = delete;
+    InterfaceRegistry& operator=(const InterfaceRegistry&) = delete;
+
+    /**
+     * @brief      Returns the slot of the given namespace and interface
+     *             type, creating it on first use. Thread safe.
+     */
+    InterfaceSlot* getSlot(const std::string& namespacepath, std::type_index type);
+
+    Resolved resolve(const std::string& namespacepath) const;
+
+    /**
+     * @brief      Invalidates all cached lookups and notifies the
+     *             listeners.
+     */
+    void notify(const std::string& namespacepath, Change change);
+
+    int subscribe(Listener listener);
+    void unsubscribe(int handle);
+
+    std::uint64_t getGeneration() const {
+      return generation.load(std::memory_order_acquire);
+    }
+
+  private:
+
+    Resolver resolver;
+    std::atomic<std::uint64_t> generation;
+
+    std::shared_mutex slotmutex;
+    std::map<std::pair<std::string, std::type_index>, std::unique_ptr<InterfaceSlot>> interfaceslots;
+
+    std::mutex listenermutex;
+    std::map<int, Listener> listeners;
+    int nextlistener;
+
+};
+
+/**
+ * @brief      Handle to an interface of a plugin. As long as no plugin
+ *             changed since the last call, get() only reads the cached
+ *             pointer. Handles are cheap to copy and stay valid as long
+ *             as the plugin manager exists.
+ * @ingroup    libframework
+ */
+template<typename T>
+class InterfaceHandle {
+
+  static_assert(std::is_pointer<T>::value, "InterfaceHandle requires a pointer type");
+
+  public:
+
+    InterfaceHandle() : registry(nullptr), slot(nullptr) {
+    }
+
+    InterfaceHandle(InterfaceRegistry* registry, InterfaceSlot* slot) : registry(registry), slot(slot) {
+    }
+
+    /**
+     * @brief      Gets the interface, loading the plugin if required.
+     *
+     * @return     The interface or nullptr if there is no plugin in the
+     *             namespace or the plugin does not provide the interface.
+     */
+    T get() const {
+      if (!slot) {
+        return nullptr;
+      }
+      if (slot->generation.load(std::memory_order_acquire) == slot->registrygeneration->load(std::memory_order_acquire)) {
+        return static_cast<T>(slot->pointer.load(std::memory_order_relaxed));
+      }
+      return resolve();
+    }
+
+    T operator->() const {
+      return get();
+    }
+
+    explicit operator bool() const {
+      return get() != nullptr;
+    }
+
+  private:
+
+    T resolve() const {
+      // read before resolving, loading the plugin changes the generation again
+      const std::uint64_t generation = registry->getGeneration();
+      const InterfaceRegistry::Resolved resolved = registry->resolve(slot->namespacepath);
+      const T iface = resolved.interfacecontainer ? resolved.interfacecontainer->getInterface<T>() : nullptr;
+      if (resolved.cacheable) {
+        std::lock_guard<std::mutex> lock(slot->mutex);
+        if (generation > slot->generation.load(std::memory_order_relaxed)) {
+          slot->pointer.store(const_cast<void*>(static_cast<const void*>(iface)), std::memory_order_relaxed);
+          slot->generation.store(generation, std::memory_order_release);
+        }
+      }
+      return iface;
+    }
+
+    InterfaceRegistry *registry;
+    InterfaceSlot *slot;
+
+};
+
+}
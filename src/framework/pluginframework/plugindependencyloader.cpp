@@ -14,18 +14,23 @@
 
 #include <iostream>
 #include <algorithm>
+#include <functional>
+#include <map>
 #include <string>
 #include <set>
+#include <utility>
 
 #include "plugininfo/plugin.h"
 #include "plugininfo/pluginstatus.h"
 #include "plugininfo/plugininfo.h"
+#include "../tracing/tracer.h"
 
 #include "plugindependencyloader.h"
 
 namespace LibFramework {
 
-PluginDependencyLoader::PluginDependencyLoader(Plugins& plugins) : plugins(plugins) {
+PluginDependencyLoader::PluginDependencyLoader(Plugins& plugins, ChangedCallback changed)
+    : plugins(plugins), changed(std::move(changed)) {
 }
 
 PluginDependencyLoader::~PluginDependencyLoader() {
@@ -35,21 +40,57 @@ bool PluginDependencyLoader::load(Plugin* const plugin) {
   if (!isLoadable(plugin)) {
     return false;
   }
-  loadPluginRecursivly(plugin);
+
+  TRACE_SCOPE("dependencies", plugin->getPluginInfo()->getNamespace());
+  // the libraries are loaded on the calling thread as well, their static
+  // initializers may create Qt objects or use thread local state
+  for (const std::vector<Plugin*> &level : getLoadLevels(plugin)) {
+    for (Plugin *const levelplugin : level) {
+      PluginStatus *const pluginstatus = levelplugin->getPluginStatus();
+      const bool wasloaded = pluginstatus->isLoaded();
+      pluginstatus->load();
+      if (!wasloaded && pluginstatus->isLoaded() && changed) {
+        changed(levelplugin);
+      }
+    }
+  }
   return true;
 }
 
-void PluginDependencyLoader::loadPluginRecursivly(Plugin* const loadplugin) {
-  const PluginInfo *const loadplugininfo = loadplugin->getPluginInfo();
-  const std::set<std::string> requiredplugins = loadplugininfo->getRequiredNamespaces();
+std::vector<std::vector<Plugin*>> PluginDependencyLoader::getLoadLevels(Plugin* const loadplugin) {
+  std::map<Plugin*, std::size_t> pluginlevels;
 
-  for (const std::string &requiredplugin : requiredplugins) {
-    Plugin *const plugin = plugins.find(requiredplugin);
-    loadPluginRecursivly(plugin);
-  }
+  std::function<std::size_t(Plugin*)> getLevel = [&] (Plugin *const plugin) -> std::size_t {
+    std::map<Plugin*, std::size_t>::const_iterator it = pluginlevels.find(plugin);
+    if (it != pluginlevels.cend()) {
+      return it->second;
+    }
+    // guards against cyclic dependencies
+    pluginlevels[plugin] = 0;
+
+    std::size_t level = 0;
+    for (const std::string &requiredplugin : plugin->getPluginInfo()->getRequiredNamespaces()) {
+      Plugin *const required = plugins.find(requiredplugin);
+      // missing plugins are reported by isLoadable()
+      if (required == nullptr || required->getPluginStatus()->isLoaded() || required->getPluginInfo()->isLoadedOnDemand()) {
+        continue;
+      }
+      level = std::max(level, getLevel(required) + 1);
+    }
+    pluginlevels[plugin] = level;
+    return level;
+  };
 
-  PluginStatus *const loadpluginstatus = loadplugin->getPluginStatus();
-  loadpluginstatus->load();
+  std::vector<std::vector<Plugin*>> levels(getLevel(loadplugin) + 1);
+  for (const std::map<Plugin*, std::size_t>::value_type &pair : pluginlevels) {
+    levels[pair.second].push_back(pair.first);
+  }
+  for (std::vector<Plugin*> &level : levels) {
+    std::sort(level.begin(), level.end(), [] (const Plugin *a, const Plugin *b) {
+      return a->getPluginInfo()->getNamespace() < b->getPluginInfo()->getNamespace();
+    });
+  }
+  return levels;
 }
 
 void PluginDependencyLoader::unload(Plugin* const plugin) {
@@ -61,7 +102,14 @@ void PluginDependencyLoader::unload(Plugin* const plugin) {
 
 void PluginDependencyLoader::unloadPluginRecursivly(Plugin* const unloadplugin) {
   PluginStatus *const unloadpluginstatus = unloadplugin->getPluginStatus();
+  // reached again through a cyclic dependency
+  if (!unloadpluginstatus->isLoaded()) {
+    return;
+  }
   unloadpluginstatus->unload();
+  if (changed) {
+    changed(unloadplugin);
+  }
 
   const PluginInfo *const unloadplugininfo = unloadplugin->getPluginInfo();
   const std::set<std::string> unloadpluginnamespaces = unloadplugininfo->getRequiredNamespaces();
@@ -91,6 +139,16 @@ bool PluginDependencyLoader::isRequiredByLoadedPlugins(const std::string& namesp
 }
 
 bool PluginDependencyLoader::isLoadable(const Plugin* const plugin) const {
+  std::set<const Plugin*> visited;
+  return isLoadable(plugin, visited);
+}
+
+bool PluginDependencyLoader::isLoadable(const Plugin* const plugin, std::set<const Plugin*>& visited) const {
+  // a plugin seen before is checked already or further up in a cyclic dependency
+  if (!visited.insert(plugin).second) {
+    return true;
+  }
+
   const PluginInfo *const plugininfo = plugin->getPluginInfo();
   const std::set<std::string> requiredpluginnamespaces = plugininfo->getRequiredNamespaces();
 
@@ -104,7 +162,7 @@ bool PluginDependencyLoader::isLoadable(const Plugin* const plugin) const {
 
   for (const std::string &requiredpluginnamespace : requiredpluginnamespaces) {
     const Plugin *const requiredplugin = plugins.find(requiredpluginnamespace);
-    if (!isLoadable(requiredplugin)) {
+    if (!isLoadable(requiredplugin, visited)) {
       return false;
     }
   }
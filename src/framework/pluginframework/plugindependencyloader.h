@@ -14,6 +14,10 @@
 
 #pragma once
 
+#include <functional>
+#include <set>
+#include <vector>
+
 #include "plugins.h"
 
 namespace LibFramework {
@@ -23,13 +27,24 @@ class Plugin;
 /**
  * @brief      Loads, unloads or start each plugin with its dependent
  *             plugins.
+ *
+ *             Plugins are loaded in levels of their dependency depth, the
+ *             plugins without unloaded dependencies first. Libraries and
+ *             plugins are loaded on the calling thread, only reading the
+ *             metadata in PluginManager::addPlugins() is done in parallel.
+ *             Dependencies that are loaded on demand are skipped.
+ *
+ *             The optional callback is invoked for every plugin that was
+ *             actually loaded or unloaded.
  * @ingroup    framework
  */
 class PluginDependencyLoader {
 
   public:
 
-    PluginDependencyLoader(Plugins& plugins);
+    typedef std::function<void (const Plugin* plugin)> ChangedCallback;
+
+    PluginDependencyLoader(Plugins& plugins, ChangedCallback changed = nullptr);
     virtual ~PluginDependencyLoader();
 
     bool load(Plugin* plugin);
@@ -38,11 +53,13 @@ class PluginDependencyLoader {
 
   private:
 
-    void loadPluginRecursivly(Plugin* loadplugin);
+    std::vector<std::vector<Plugin*>> getLoadLevels(Plugin* loadplugin);
     void unloadPluginRecursivly(Plugin* unloadplugin);
     bool isRequiredByLoadedPlugins(const std::string& namespacepath) const;
+    bool isLoadable(const Plugin* plugin, std::set<const Plugin*>& visited) const;
 
     Plugins &plugins;
+    ChangedCallback changed;
 
 };
 
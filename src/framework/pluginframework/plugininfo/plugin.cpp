@@ -21,7 +21,7 @@ namespace LibFramework {
 
 Plugin::Plugin(PluginInfo* const plugininfo, PluginManagerInterface* pluginmanager) {
   this->plugininfo = plugininfo;
-  pluginstatus = new PluginStatus(plugininfo, pluginmanager);
+  pluginstatus = new PluginStatus(plugininfo, pluginmanager, &timings);
 }
 
 Plugin::~Plugin() {
@@ -45,4 +45,8 @@ const InterfaceContainer* Plugin::getInterfaceContainer() const {
   return pluginstatus->getInterfaceContainer();
 }
 
+const PluginTimings& Plugin::getTimings() const {
+  return timings;
+}
+
 }
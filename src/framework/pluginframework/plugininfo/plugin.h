@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <chrono>
+
 namespace LibFramework {
 
 class PluginInfo;
@@ -21,6 +23,16 @@ class PluginStatus;
 class PluginManagerInterface;
 class InterfaceContainer;
 
+/**
+ * @brief      Time spent on the different steps of loading a plugin.
+ * @ingroup    framework
+ */
+struct PluginTimings {
+  std::chrono::microseconds metadata {0};   ///< reading the metadata from the library
+  std::chrono::microseconds library {0};    ///< loading the shared library
+  std::chrono::microseconds load {0};       ///< creating the instance and PluginInterface::load()
+};
+
 
 /**
  * @brief      Represens a plugin on the side of the pluginframework.
@@ -39,12 +51,14 @@ class Plugin {
     const PluginStatus* getPluginStatus() const;
     const PluginInfo* getPluginInfo() const;
     const InterfaceContainer* getInterfaceContainer() const;
+    const PluginTimings& getTimings() const;
 
   private:
     PluginStatus* getPluginStatus();
 
     PluginInfo   *plugininfo;
     PluginStatus *pluginstatus;
+    PluginTimings timings;
 
 };
 
@@ -51,6 +51,10 @@ const std::set<std::string>& PluginInfo::getRequiredNamespaces() const {
   return requirednamespaces;
 }
 
+bool PluginInfo::isLoadedOnDemand() const {
+  return loadondemand;
+}
+
 const std::string& PluginInfo::getFilePath() const {
   return filepath;
 }
@@ -94,6 +98,7 @@ void PluginInfo::readInfos(const std::string& filename) {
   help = reader.getHelp();
   namespacepath = reader.getNamespace();
   requirednamespaces = reader.getRequiredNamespaces();
+  loadondemand = reader.isLoadedOnDemand();
   version = reader.getVersion();
 }
 
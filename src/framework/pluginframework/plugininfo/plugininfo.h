@@ -42,6 +42,7 @@ class DLLAPI PluginInfo {
     long getVersion() const;
     const std::string& getNamespace() const;
     const std::set<std::string>& getRequiredNamespaces() const;
+    bool isLoadedOnDemand() const;
     const std::string& getFilePath() const;
     const std::string& getFileName() const;
     const std::string& getClassName() const;
@@ -86,6 +87,7 @@ class DLLAPI PluginInfo {
     std::string name;
     std::string description;
     std::set<std::string> requirednamespaces;
+    bool loadondemand;
 
 };
 
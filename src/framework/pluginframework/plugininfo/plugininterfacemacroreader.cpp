@@ -12,54 +12,145 @@
  * See the License for the specific language governing permissions and
  * limitations under the License. */
 
+#include <algorithm>
+#include <bit>
+#include <cstring>
 #include <functional>
+#include <iostream>
+#include <vector>
+
+#if defined(__ELF__)
+#include <elf.h>
+#endif
 
 #include "../plugininterfacemacros.h"
-#include "pluginloader.h"
 #include "stringtokenizer.h"
 #include "plugininterfacemacroreader.h"
 
 namespace LibFramework {
 
-PluginInterfaceMacroReader::PluginInterfaceMacroReader(const std::string& filename) : libraryFile(filename, std::ios::binary), filename(filename) {
+namespace {
+
+constexpr std::string_view MAGIC(METADATA_MAGIC);
+
+#if defined(__ELF__)
+template<typename Header, typename SectionHeader>
+bool readElfSection(std::ifstream& file, const char *name, std::string& content) {
+  Header header;
+  file.seekg(0);
+  if (!file.read(reinterpret_cast<char*>(&header), sizeof(header))) return false;
+  if (header.e_shoff == 0 || header.e_shentsize != sizeof(SectionHeader) || header.e_shstrndx == SHN_UNDEF ||
+      header.e_shstrndx >= header.e_shnum) {
+    return false;
+  }
+
+  std::vector<SectionHeader> sections(header.e_shnum);
+  file.seekg(header.e_shoff);
+  if (!file.read(reinterpret_cast<char*>(sections.data()), sections.size() * sizeof(SectionHeader))) return false;
+
+  const SectionHeader& names = sections[header.e_shstrndx];
+  std::string nameTable(names.sh_size, '\0');
+  file.seekg(names.sh_offset);
+  if (!file.read(nameTable.data(), nameTable.size())) return false;
+
+  for (const SectionHeader& section : sections) {
+    if (section.sh_name >= nameTable.size() || std::strcmp(nameTable.c_str() + section.sh_name, name) != 0) {
+      continue;
+    }
+    if (section.sh_type == SHT_NOBITS) return false;
+    content.resize(section.sh_size);
+    file.seekg(section.sh_offset);
+    return static_cast<bool>(file.read(content.data(), content.size()));
+  }
+  return false;
+}
+#endif
+
+}
+
+PluginInterfaceMacroReader::PluginInterfaceMacroReader(const std::string& filename, Lookup lookup)
+    : libraryFile(filename, std::ios::binary), filename(filename), fromSection(false) {
   if (!libraryFile.is_open()) {
     std::cerr << "Could not read library \'" << filename << "\'." << std::endl;
     return;
   }
   std::cerr << "Loading library \'" << filename << "\'." << std::endl;
-  readEntries();
+  fromSection = lookup == SECTION_OR_SCAN && readSection();
+  if (!fromSection) {
+    libraryFile.clear();
+    readEntries();
+  }
   libraryFile.close();
 }
 
 PluginInterfaceMacroReader::~PluginInterfaceMacroReader() {
 }
 
+bool PluginInterfaceMacroReader::readSection() {
+#if defined(__ELF__)
+  unsigned char ident[EI_NIDENT];
+  if (!libraryFile.read(reinterpret_cast<char*>(ident), EI_NIDENT) || std::memcmp(ident, ELFMAG, SELFMAG) != 0) {
+    return false;
+  }
+  // sections of foreign byte order are left to the scan
+  const unsigned char hostByteOrder = std::endian::native == std::endian::little ? ELFDATA2LSB : ELFDATA2MSB;
+  if (ident[EI_DATA] != hostByteOrder) return false;
+
+  std::string section;
+  bool found = false;
+  if (ident[EI_CLASS] == ELFCLASS64) {
+    found = readElfSection<Elf64_Ehdr, Elf64_Shdr>(libraryFile, METADATA_SECTION, section);
+  } else if (ident[EI_CLASS] == ELFCLASS32) {
+    found = readElfSection<Elf32_Ehdr, Elf32_Shdr>(libraryFile, METADATA_SECTION, section);
+  }
+  if (!found) return false;
+
+  parseEntries(section);
+  return !metadataEntries.empty();
+#else
+  return false;
+#endif
+}
+
 void PluginInterfaceMacroReader::readEntries() {
-  while (libraryFile) {
-    //search for METADATA_MAGIC
-    libraryFile.ignore(std::numeric_limits<std::streamsize>::max(), METADATA_MAGIC[0]);
-    if (!libraryFile) {
-      return;
+  // an entry may span two blocks, whatever follows the last complete entry is moved to the front
+  std::vector<char> buffer(MAX_ENTRY_LENGTH + SCAN_BLOCK_SIZE);
+  std::size_t kept = 0;
+  libraryFile.seekg(0);
+  while (libraryFile.read(buffer.data() + kept, SCAN_BLOCK_SIZE) || libraryFile.gcount() > 0) {
+    const std::size_t size = kept + libraryFile.gcount();
+    const std::size_t consumed = parseEntries(std::string_view(buffer.data(), size));
+    kept = size - consumed;
+    std::memmove(buffer.data(), buffer.data() + consumed, kept);
+  }
+}
+
+std::size_t PluginInterfaceMacroReader::parseEntries(std::string_view data) {
+  std::size_t position = 0;
+  while (true) {
+    const std::size_t magic = data.find(MAGIC, position);
+    if (magic == std::string_view::npos) {
+      // the end may still be the beginning of the magic
+      return data.size() < MAGIC.size() ? position : std::max(position, data.size() - MAGIC.size() + 1);
     }
-    std::fstream::pos_type position = libraryFile.tellg();
-    bool found = true;
-    for (const char *it = &METADATA_MAGIC[1]; it <= &METADATA_MAGIC[sizeof(METADATA_MAGIC) - 2]; ++it) {
-      const char m = *it;
-      if (m != libraryFile.get()) {
-        found = false;
-        break;
+
+    const std::size_t begin = magic + MAGIC.size();
+    const std::size_t end = data.find('\0', begin);
+    if (end == std::string_view::npos) {
+      if (data.size() - magic <= MAX_ENTRY_LENGTH) {
+        return magic;
       }
-    }
-    if (!found) {
-      libraryFile.seekg(position + std::fstream::pos_type{1});
+      // not a real entry, just the magic followed by a lot of data
+      position = magic + 1;
       continue;
     }
 
     //insert found entry into entries
-    std::string buffer;
-    std::getline(libraryFile, buffer, '\0');
-    std::string::size_type delimiter = buffer.find(" ");
-    metadataEntries[buffer.substr(0, delimiter)] = buffer.substr(delimiter + 1);
+    const std::string_view entry = data.substr(begin, end - begin);
+    const std::string_view::size_type delimiter = entry.find(" ");
+    metadataEntries[std::string(entry.substr(0, delimiter))] =
+        delimiter == std::string_view::npos ? std::string() : std::string(entry.substr(delimiter + 1));
+    position = end + 1;
   }
 }
 
@@ -78,6 +169,14 @@ const std::string PluginInterfaceMacroReader::getMetadataEntry(const std::string
   return i->second;
 }
 
+bool PluginInterfaceMacroReader::isLoadedOnDemand() const {
+  return getMetadataEntry("load-on-demand", false) == "true";
+}
+
+bool PluginInterfaceMacroReader::isFromSection() const {
+  return fromSection;
+}
+
 long PluginInterfaceMacroReader::getVersion() const {
   // long version = stol(getMetadataEntry("version"));
   long version = 1; // temporary workaround
@@ -17,8 +17,11 @@
 #include <fstream>
 #include <map>
 #include <string>
+#include <string_view>
 #include <set>
 
+#include <cpputils/dllapi.hpp>
+
 namespace LibFramework {
 
 class PluginInterface;
@@ -27,13 +30,23 @@ class PluginMetadataLoader;
 
 /**
  * @brief      Reads information from the macros of the plugin interface.
+ *
+ *             The metadata strings of ELF plugins live in their own section,
+ *             so only the headers and that section have to be read. For
+ *             other libraries and plugins built without the section, the
+ *             whole file is scanned for METADATA_MAGIC.
  * @ingroup    framework
  */
-class PluginInterfaceMacroReader {
+class DLLAPI PluginInterfaceMacroReader {
 
   public:
 
-    PluginInterfaceMacroReader(const std::string& filename);
+    enum Lookup {
+      SECTION_OR_SCAN,
+      SCAN
+    };
+
+    PluginInterfaceMacroReader(const std::string& filename, Lookup lookup = SECTION_OR_SCAN);
     ~PluginInterfaceMacroReader();
 
     long getVersion() const;
@@ -45,14 +58,26 @@ class PluginInterfaceMacroReader {
     std::string getHelp() const;
     std::string getNamespace() const;
     std::set<std::string> getRequiredNamespaces() const;
+    bool isLoadedOnDemand() const;
+
+    /**
+     * @return     True if the entries were read from the metadata section.
+     */
+    bool isFromSection() const;
+
+    const static std::streamsize SCAN_BLOCK_SIZE = 1 << 20;
+    const static std::size_t MAX_ENTRY_LENGTH = 1 << 16;
 
   private:
     const std::string getMetadataEntry(const std::string& key, bool required = true) const;
 
+    bool readSection();
     void readEntries();
+    std::size_t parseEntries(std::string_view data);
     std::ifstream libraryFile;
     std::map<std::string, std::string> metadataEntries;
     const std::string filename;
+    bool fromSection;
 
 };
 
@@ -18,8 +18,10 @@
 #include "../pluginmanagerinterface.h"
 #include "../interfacecontainer.h"
 #include "../plugininterface.h"
+#include "../../tracing/tracer.h"
 
 #include "pluginthread.h"
+#include "plugin.h"
 #include "plugininfo.h"
 #include "pluginloader.h"
 #include "pluginstatus.h"
@@ -27,9 +29,10 @@
 
 namespace LibFramework {
 
-PluginStatus::PluginStatus(PluginInfo* const plugininfo, PluginManagerInterface* pluginmanager) {
+PluginStatus::PluginStatus(PluginInfo* const plugininfo, PluginManagerInterface* pluginmanager, PluginTimings* timings) {
   this->plugininfo = plugininfo;
   this->pluginmanager = pluginmanager;
+  this->timings = timings;
   const std::string filepath = plugininfo->getFilePath();
   pluginloader = new PluginLoader(filepath);
   pluginstate = PluginState::unloaded;
@@ -58,11 +61,24 @@ bool PluginStatus::isCompatible() {
   return pluginversion == requiredversion;
 }
 
+bool PluginStatus::loadLibrary() {
+  std::lock_guard<std::mutex> lock(librarymutex);
+  if (pluginloader->isLoaded()) {
+    return true;
+  }
+  TRACE_SCOPE("library", plugininfo->getNamespace());
+  const auto start = std::chrono::steady_clock::now();
+  const bool loaded = pluginloader->load();
+  timings->library = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+  return loaded;
+}
+
 void PluginStatus::load() {
   if (!isLoaded()) {
+    if (not loadLibrary()) return;
+    TRACE_SCOPE("load", plugininfo->getNamespace());
+    const auto start = std::chrono::steady_clock::now();
     if (!plugininterface) {
-      if (not pluginloader->load()) return;
-
       std::function<PluginInterface* ()> plugininstancefunction = pluginloader->getFunctionPointer<PluginInterface* ()>("createInstance");
       if (plugininstancefunction) plugininterface = plugininstancefunction();
       if (plugininstancefunction == nullptr || plugininterface == nullptr) {
@@ -74,12 +90,18 @@ void PluginStatus::load() {
     }
     plugininterface->load();
     pluginstate = PluginState::loaded;
+    timings->load = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
   }
 }
 
 void PluginStatus::unload() {
   if (isLoaded()) {
     plugininterface->unload();
+    {
+      std::lock_guard<std::mutex> lock(interfacemutex);
+      delete interfacecontainer;
+      interfacecontainer = nullptr;
+    }
     delete pluginthread;
     pluginthread = nullptr;
     pluginstate = PluginState::unloaded;
@@ -92,7 +114,7 @@ void PluginStatus::run() {
   }
 
   if (!pluginthread) {
-    pluginthread = new PluginThread(plugininterface);
+    pluginthread = new PluginThread(plugininterface, plugininfo->getNamespace());
   }
   pluginthread->start();
 
@@ -108,9 +130,18 @@ const InterfaceContainer* PluginStatus::getInterfaceContainer() {
     throw std::runtime_error("pluginstatus: plugin instance was null!");
   }
 
+  std::lock_guard<std::mutex> lock(interfacemutex);
+  if (interfacecontainer && plugininterface->hasStableInterfaces()) {
+    return interfacecontainer;
+  }
+  TRACE_SCOPE("interfaces", plugininfo->getNamespace());
   delete interfacecontainer;
   interfacecontainer = plugininterface->createInterfaces();
   return interfacecontainer;
 }
 
+bool PluginStatus::hasStableInterfaces() const {
+  return plugininterface == nullptr || plugininterface->hasStableInterfaces();
+}
+
 }
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <mutex>
+
 namespace LibFramework {
 
 class PluginInfo;
@@ -22,6 +24,7 @@ class InterfaceContainer;
 class PluginManagerInterface;
 class PluginThread;
 class PluginInterface;
+struct PluginTimings;
 
 
 /**
@@ -32,11 +35,18 @@ class PluginStatus {
 
   public:
 
-    PluginStatus(PluginInfo* plugininfo, PluginManagerInterface* pluginmanager);
+    PluginStatus(PluginInfo* plugininfo, PluginManagerInterface* pluginmanager, PluginTimings* timings);
     ~PluginStatus();
 
     bool isCompatible();
 
+    /**
+     * @brief      Loads the shared library without creating the plugin
+     *             instance. May be called from any thread, but the static
+     *             initializers of the library run in that thread.
+     */
+    bool loadLibrary();
+
     void load();
     void unload();
 
@@ -54,8 +64,15 @@ class PluginStatus {
       return (pluginstate == PluginState::running);
     }
 
+    /**
+     * @brief      Returns the interfaces of the plugin, loading it if
+     *             required. The container stays valid until the plugin
+     *             is unloaded, unless the plugin has no stable interfaces.
+     */
     const InterfaceContainer* getInterfaceContainer();
 
+    bool hasStableInterfaces() const;
+
   private:
 
     enum PluginState {
@@ -72,6 +89,9 @@ class PluginStatus {
     PluginThread *pluginthread;
     PluginInterface *plugininterface;
     mutable InterfaceContainer *interfacecontainer;
+    PluginTimings *timings;
+    std::mutex librarymutex;
+    std::mutex interfacemutex;
 
 };
 
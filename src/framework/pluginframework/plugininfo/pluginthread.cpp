@@ -16,14 +16,16 @@
 
 #include "pluginthread.h"
 #include "../plugininterface.h"
+#include "../../tracing/tracer.h"
 
 namespace LibFramework {
 
-PluginThread::PluginThread(PluginInterface* const plugininterface)
+PluginThread::PluginThread(PluginInterface* const plugininterface, const std::string& namespacepath)
     : threadstarted(false),
       exit(false),
       startplugin(false),
-      processloop(false) {
+      processloop(false),
+      namespacepath(namespacepath) {
   this->plugininterface = plugininterface;
   thread = std::thread {&PluginThread::run, this};
   std::unique_lock<std::mutex> lock(mtx_started);
@@ -52,6 +54,9 @@ void PluginThread::start() {
 }
 
 void PluginThread::run() {
+  if (Tracer::isEnabled()) {
+    Tracer::setThreadName(namespacepath);
+  }
   std::unique_lock<std::mutex> lock(mtx);
   mtx_started.lock();
   threadstarted = true;
@@ -74,6 +79,7 @@ void PluginThread::run() {
 
 void PluginThread::changeState() {
   if (startplugin) {
+    TRACE_SCOPE("run", namespacepath);
     plugininterface->run();
     startplugin = false;
   }
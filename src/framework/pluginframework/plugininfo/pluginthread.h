@@ -16,6 +16,7 @@
 
 #include <mutex>
 #include <condition_variable>
+#include <string>
 #include <thread>
 
 namespace LibFramework {
@@ -30,7 +31,7 @@ class PluginThread {
 
   public:
 
-    PluginThread(PluginInterface* plugininterface);
+    PluginThread(PluginInterface* plugininterface, const std::string& namespacepath);
     PluginThread(const PluginThread& src) = delete;
     PluginThread& operator=(const PluginThread& rhs) = delete;
     ~PluginThread();
@@ -52,6 +53,7 @@ class PluginThread {
     bool startplugin;
     bool processloop;
     PluginInterface *plugininterface;
+    const std::string namespacepath;
 
 };
 
@@ -44,6 +44,15 @@ class PluginInterface {
       return nullptr;
     }
 
+    /**
+     * @brief      Whether the container returned by createInterfaces()
+     *             may be kept until the plugin is unloaded. Plugins that
+     *             hand out a new instance on each call return false.
+     */
+    virtual bool hasStableInterfaces() const {
+      return true;
+    }
+
     void setPluginManager(PluginManagerInterface *pluginmanager) {
       this->pluginmanager = pluginmanager;
     }
@@ -25,6 +25,16 @@ namespace LibFramework {
 #endif
 
 #define METADATA_MAGIC "studio-metadata "
+
+// on ELF platforms all metadata strings are collected in one section, which
+// PluginInterfaceMacroReader reads without scanning the whole library
+#if defined(__ELF__)
+#define METADATA_SECTION "studio_metadata"
+#define METADATA_ATTRIBUTES __attribute__((section(METADATA_SECTION), used))
+#else
+#define METADATA_ATTRIBUTES
+#endif
+
 #define PLUGIN_VERSION 1
 #define PLUGIN_VERSION_TO_STRING_a(version) #version
 #define PLUGIN_VERSION_TO_STRING_b(version) PLUGIN_VERSION_TO_STRING_a(version)
@@ -34,7 +44,7 @@ namespace LibFramework {
 #define PLUGIN_METADATA_STRING(varname, key, string) \
   const char *varname; \
   { \
-    const char *metadata = METADATA_MAGIC #key " " string; \
+    static const char metadata[] METADATA_ATTRIBUTES = METADATA_MAGIC #key " " string; \
     const int offset = sizeof(METADATA_MAGIC #key " ") - 1; \
     varname = metadata + offset; \
   } \
@@ -103,6 +113,16 @@ namespace LibFramework {
   } \
   }
 
+// the plugin is not loaded with the plugins requiring it, only once its
+// interfaces are requested or it is loaded or run explicitly
+#define PLUGIN_LOAD_ON_DEMAND() \
+  extern "C" { \
+  PLUGIN_EXPORT const char* getLoadOnDemand() { \
+    PLUGIN_METADATA_STRING(loadOnDemand, load-on-demand, "true") \
+    return loadOnDemand; \
+  } \
+  }
+
 #define PLUGIN_REQUIRED_NAMESPACES(args ...) \
   extern "C" { \
   PLUGIN_EXPORT const char* getRequiredNamespaces() { \
@@ -12,36 +12,88 @@
  * See the License for the specific language governing permissions and
  * limitations under the License. */
 
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
 #include <iostream>
+#include <thread>
 
 #include "pluginmanager.h"
 #include "plugindependencyloader.h"
 #include "plugininfo/plugin.h"
+#include "plugininfo/plugininfo.h"
 #include "plugininfo/pluginstatus.h"
+#include "../tracing/tracer.h"
 
 template LibFramework::PluginManager* Singleton<LibFramework::PluginManager>::getInstance();
 
 namespace LibFramework {
 
-PluginManager::PluginManager() {
+PluginManager::PluginManager()
+    : interfaceregistry([this] (const std::string& namespacepath) { return resolveInterfaces(namespacepath); }) {
 }
 
 PluginManager::~PluginManager() {
 }
 
 bool PluginManager::addPlugin(const std::string& filename) {
-  const Plugin *const existingplugin = plugins.find([&] (const Plugin *plugin) {
-    const PluginInfo *const existingplugininfo = plugin->getPluginInfo();
-    return filename == existingplugininfo->getFilePath();
-  });
-
-  if (existingplugin) {
+  if (plugins.findByFilePath(filename)) {
     return true;
   }
 
+  TRACE_SCOPE("metadata", filename);
+  const auto start = std::chrono::steady_clock::now();
   LibFramework::PluginInfo *plugininfo = new LibFramework::PluginInfo(filename);
+  return insertPlugin(plugininfo, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start));
+}
+
+bool PluginManager::addPlugins(const std::vector<std::string>& filenames) {
+  TRACE_SCOPE("startup", "PluginManager::addPlugins");
+  std::vector<std::string> newfilenames;
+  for (const std::string &filename : filenames) {
+    if (!plugins.findByFilePath(filename)) {
+      newfilenames.push_back(filename);
+    }
+  }
+
+  std::vector<PluginInfo*> plugininfos(newfilenames.size());
+  std::vector<std::chrono::microseconds> metadatatimes(newfilenames.size());
+  std::atomic<std::size_t> next {0};
+  auto readPluginInfos = [&] () {
+    for (std::size_t i = next++; i < newfilenames.size(); i = next++) {
+      TRACE_SCOPE("metadata", newfilenames[i]);
+      const auto start = std::chrono::steady_clock::now();
+      plugininfos[i] = new PluginInfo(newfilenames[i]);
+      metadatatimes[i] = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    }
+  };
 
+  const std::size_t threadcount = std::min<std::size_t>(std::max(1u, std::thread::hardware_concurrency()), newfilenames.size());
+  std::vector<std::thread> threads;
+  for (std::size_t i = 1; i < threadcount; ++i) {
+    threads.emplace_back([&] () {
+      if (Tracer::isEnabled()) {
+        Tracer::setThreadName("metadata reader");
+      }
+      readPluginInfos();
+    });
+  }
+  readPluginInfos();
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  bool added = true;
+  for (std::size_t i = 0; i < plugininfos.size(); ++i) {
+    added = insertPlugin(plugininfos[i], metadatatimes[i]) && added;
+  }
+  return added;
+}
+
+bool PluginManager::insertPlugin(PluginInfo* plugininfo, std::chrono::microseconds metadatatime) {
+  const std::string filename = plugininfo->getFilePath();
   Plugin *plugin = new Plugin(plugininfo, this);
+  plugin->timings.metadata = metadatatime;
   PluginStatus *const pluginstatus = plugin->getPluginStatus();
 
   if (not pluginstatus->isCompatible()) {
@@ -63,6 +115,7 @@ bool PluginManager::addPlugin(const std::string& filename) {
   }
 
   plugins.insert(namespacepath, plugin);
+  interfaceregistry.notify(namespacepath, InterfaceRegistry::added);
   return true;
 }
 
@@ -72,8 +125,7 @@ bool PluginManager::load(const std::string& namespacepath) {
   if (plugin == nullptr) {
     return false;
   }
-  PluginDependencyLoader loader(plugins);
-  return loader.load(plugin);
+  return createDependencyLoader().load(plugin);
 }
 
 void PluginManager::unload(const std::string& namespacepath) {
@@ -81,8 +133,7 @@ void PluginManager::unload(const std::string& namespacepath) {
   if (plugin == nullptr) {
     return;
   }
-  PluginDependencyLoader loader(plugins);
-  loader.unload(plugin);
+  createDependencyLoader().unload(plugin);
 }
 
 bool PluginManager::isLoaded(const std::string& namespacepath) const {
@@ -119,8 +170,7 @@ bool PluginManager::run(const std::string& namespacepath) {
   }
   PluginStatus *const pluginstatus = plugin->getPluginStatus();
   if (pluginstatus->isUnloaded()) {
-    PluginDependencyLoader loader(plugins);
-    if (loader.load(plugin) == false) {
+    if (createDependencyLoader().load(plugin) == false) {
       return false;
     }
   }
@@ -151,6 +201,28 @@ Interfaces PluginManager::getInterfaces(const std::string& namespacepath) const
   return interfaces;
 }
 
+InterfaceRegistry* PluginManager::getInterfaceRegistry() const {
+  return &interfaceregistry;
+}
+
+InterfaceRegistry::Resolved PluginManager::resolveInterfaces(const std::string& namespacepath) {
+  Plugin *const plugin = plugins.find(namespacepath);
+  if (plugin == nullptr) {
+    // cacheable, adding the plugin later on invalidates the lookup
+    return {nullptr, true};
+  }
+  const InterfaceContainer *const interfacecontainer = plugin->getInterfaceContainer();
+  return {interfacecontainer, plugin->getPluginStatus()->hasStableInterfaces()};
+}
+
+PluginDependencyLoader PluginManager::createDependencyLoader() {
+  return PluginDependencyLoader(plugins, [this] (const Plugin *plugin) {
+    const PluginStatus *const pluginstatus = plugin->getPluginStatus();
+    const std::string namespacepath = plugin->getPluginInfo()->getNamespace();
+    interfaceregistry.notify(namespacepath, pluginstatus->isLoaded() ? InterfaceRegistry::loaded : InterfaceRegistry::unloaded);
+  });
+}
+
 std::vector<std::string> PluginManager::getRunningNamespaces() const {
   std::vector<std::string> pluginnamespacevector;
   for (const Plugin *plugin : getPlugins()) {
@@ -163,6 +235,27 @@ std::vector<std::string> PluginManager::getRunningNamespaces() const {
   return pluginnamespacevector;
 }
 
+void PluginManager::printLoadTimings(std::ostream& stream) const {
+  std::vector<const Plugin*> sortedplugins = getPlugins();
+  auto total = [] (const Plugin *plugin) {
+    const PluginTimings &timings = plugin->getTimings();
+    return timings.metadata + timings.library + timings.load;
+  };
+  std::sort(sortedplugins.begin(), sortedplugins.end(), [&] (const Plugin *a, const Plugin *b) {
+    return total(a) > total(b);
+  });
+
+  stream << "Plugin load timings in ms (metadata, library, load):" << std::endl;
+  for (const Plugin *plugin : sortedplugins) {
+    const PluginTimings &timings = plugin->getTimings();
+    stream << std::fixed << std::setprecision(2)
+           << std::setw(9) << timings.metadata.count() / 1000.0
+           << std::setw(9) << timings.library.count() / 1000.0
+           << std::setw(9) << timings.load.count() / 1000.0
+           << "  " << plugin->getPluginInfo()->getNamespace() << std::endl;
+  }
+}
+
 std::vector<const PluginInfo*> PluginManager::getPluginInfos(const std::string& namespacepath) const {
   std::vector<const PluginInfo*> plugininfos;
   for (const Plugin *plugin : getPlugins(namespacepath)) {
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <chrono>
+
 #include <cpputils/singleton.hpp>
 #include "pluginmanagerinterface.h"
 #include "plugins.h"
@@ -22,6 +24,7 @@ namespace LibFramework {
 
 class PluginInfo;
 class Plugin;
+class PluginDependencyLoader;
 
 
 /**
@@ -37,6 +40,15 @@ class DLLAPI PluginManager : public PluginManagerInterface, public Singleton<Plu
     virtual ~PluginManager();
 
     bool addPlugin(const std::string& filename);
+
+    /**
+     * @brief      Adds all given plugins, reading their metadata in
+     *             parallel. Namespace conflicts are resolved in the order
+     *             of the file names.
+     * @return     True if all plugins could be added.
+     */
+    bool addPlugins(const std::vector<std::string>& filenames);
+
     bool load(const std::string& namespacepath);
     void unload(const std::string& namespacepath);
     bool isLoaded(const std::string& namespacepath) const;
@@ -50,12 +62,25 @@ class DLLAPI PluginManager : public PluginManagerInterface, public Singleton<Plu
 
     Interfaces getInterfaces(const std::string& namespacepath) const;
 
+    InterfaceRegistry* getInterfaceRegistry() const;
+
     std::vector<std::string> getRunningNamespaces() const;
 
+    /**
+     * @brief      Prints the recorded PluginTimings of all plugins, the
+     *             slowest first.
+     */
+    void printLoadTimings(std::ostream& stream) const;
+
   private:
     PluginManager();
 
+    bool insertPlugin(PluginInfo* plugininfo, std::chrono::microseconds metadatatime);
+    PluginDependencyLoader createDependencyLoader();
+    InterfaceRegistry::Resolved resolveInterfaces(const std::string& namespacepath);
+
     Plugins plugins;
+    mutable InterfaceRegistry interfaceregistry;
 
 };
 
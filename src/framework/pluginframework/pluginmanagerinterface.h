@@ -14,11 +14,14 @@
 
 #pragma once
 
+#include <ostream>
 #include <string>
+#include <typeinfo>
 #include <vector>
 #include <map>
 
 #include "interfacecontainer.h"
+#include "interfaceregistry.h"
 #include "plugininfo/plugin.h"
 #include "plugininfo/plugininfo.h"
 
@@ -51,19 +54,34 @@ class PluginManagerInterface {
     virtual std::vector<std::string> getRunningNamespaces() const = 0;
 
     virtual bool addPlugin(const std::string& filename) = 0;
+    virtual bool addPlugins(const std::vector<std::string>& filenames) = 0;
+
+    virtual void printLoadTimings(std::ostream& stream) const = 0;
 
     /** Returns a map with the namespaces and the InterfaceContainers found in the given namespace.
       */
     virtual Interfaces getInterfaces(const std::string& namespacepath) const = 0;
 
+    /**
+     * @brief      Registry of the typed interface lookups, which can also
+     *             be used to get notified when plugins change.
+     */
+    virtual InterfaceRegistry* getInterfaceRegistry() const = 0;
+
+    /**
+     * @brief      Returns a handle to the interface of the plugin in
+     *             exactly the given namespace. Keeping the handle avoids
+     *             even the lookup of the cache entry.
+     */
+    template<typename T>
+    InterfaceHandle<T> getInterfaceHandle(const std::string& namespacepath) const {
+      InterfaceRegistry *const registry = getInterfaceRegistry();
+      return InterfaceHandle<T>(registry, registry->getSlot(namespacepath, typeid(T)));
+    }
+
     template<typename T>
     T getInterface(const std::string& namespacepath) const {
-      Interfaces interfaces = getInterfaces(namespacepath);
-      const InterfaceContainer *const interfacecontainer = interfaces[namespacepath];
-      if (interfacecontainer) {
-        return interfacecontainer->getInterface<T>();
-      }
-      return nullptr;
+      return getInterfaceHandle<T>(namespacepath).get();
     }
 
 };
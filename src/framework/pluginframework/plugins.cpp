@@ -16,6 +16,7 @@
 
 #include "plugins.h"
 #include "plugininfo/plugin.h"
+#include "plugininfo/plugininfo.h"
 
 namespace LibFramework {
 
@@ -31,6 +32,7 @@ Plugins::~Plugins() {
 
 void Plugins::insert(const std::string& namespacepath, Plugin* plugin) {
   plugins[namespacepath] = plugin;
+  pluginsbyfilepath[plugin->getPluginInfo()->getFilePath()] = plugin;
 }
 
 Plugin* Plugins::find(const std::string& namespacepath) {
@@ -49,4 +51,12 @@ const Plugin* Plugins::find(const std::string& namespacepath) const {
   return (*it).second;
 }
 
+const Plugin* Plugins::findByFilePath(const std::string& filepath) const {
+  std::map<std::string, Plugin*>::const_iterator it = pluginsbyfilepath.find(filepath);
+  if (it == pluginsbyfilepath.cend()) {
+    return nullptr;
+  }
+  return (*it).second;
+}
+
 }
@@ -39,6 +39,7 @@ class Plugins {
 
     Plugin* find(const std::string& namespacepath);
     const Plugin* find(const std::string& namespacepath) const;
+    const Plugin* findByFilePath(const std::string& filepath) const;
 
     template<class UnaryPredicate>
     Plugin* find(UnaryPredicate pred) {
@@ -77,6 +78,7 @@ class Plugins {
   private:
 
     std::map<std::string, Plugin*> plugins;
+    std::map<std::string, Plugin*> pluginsbyfilepath;
 
 };
 
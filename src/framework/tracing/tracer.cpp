@@ -0,0 +1,173 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+#include "tracer.h"
+
+namespace LibFramework {
+
+namespace {
+
+struct TraceEvent {
+  char phase;
+  const char *category;
+  std::string name;
+  std::int64_t timestamp;
+  std::int64_t duration;
+  unsigned int threadid;
+};
+
+std::mutex eventmutex;
+std::vector<TraceEvent> events;
+std::map<unsigned int, std::string> threadnames;
+std::size_t droppedevents = 0;
+
+std::atomic<std::int64_t> origin {0};
+std::atomic<unsigned int> nextthreadid {1};
+
+unsigned int currentThreadId() {
+  // small ids keep the threads in the order they were first seen
+  thread_local const unsigned int threadid = nextthreadid++;
+  return threadid;
+}
+
+std::int64_t steadyMicroseconds() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void record(TraceEvent&& event) {
+  std::lock_guard<std::mutex> lock(eventmutex);
+  if (events.size() >= Tracer::MAX_EVENTS) {
+    droppedevents++;
+    return;
+  }
+  events.push_back(std::move(event));
+}
+
+void writeString(std::ostream& stream, const std::string& string) {
+  stream << '"';
+  for (const char c : string) {
+    switch (c) {
+      case '"':  stream << "\\\""; break;
+      case '\\': stream << "\\\\"; break;
+      case '\n': stream << "\\n"; break;
+      case '\t': stream << "\\t"; break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char escaped[8];
+          std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+          stream << escaped;
+        } else {
+          stream << c;
+        }
+    }
+  }
+  stream << '"';
+}
+
+}
+
+std::atomic<bool> Tracer::enabled {false};
+
+void Tracer::start() {
+  {
+    std::lock_guard<std::mutex> lock(eventmutex);
+    events.clear();
+    droppedevents = 0;
+  }
+  origin = steadyMicroseconds();
+  enabled.store(true, std::memory_order_release);
+}
+
+void Tracer::stop() {
+  enabled.store(false, std::memory_order_release);
+}
+
+std::int64_t Tracer::now() {
+  return steadyMicroseconds() - origin.load(std::memory_order_relaxed);
+}
+
+void Tracer::complete(const char* category, const std::string& name, std::int64_t start, std::int64_t duration) {
+  record({'X', category, name, start, duration, currentThreadId()});
+}
+
+void Tracer::instant(const char* category, const std::string& name) {
+  record({'i', category, name, now(), 0, currentThreadId()});
+}
+
+void Tracer::setThreadName(const std::string& name) {
+  const unsigned int threadid = currentThreadId();
+  std::lock_guard<std::mutex> lock(eventmutex);
+  threadnames[threadid] = name;
+}
+
+std::size_t Tracer::getEventCount() {
+  std::lock_guard<std::mutex> lock(eventmutex);
+  return events.size();
+}
+
+void Tracer::write(std::ostream& stream) {
+  const long pid = getpid();
+
+  std::lock_guard<std::mutex> lock(eventmutex);
+  stream << "{\"displayTimeUnit\":\"ms\",\"otherData\":{\"droppedEvents\":" << droppedevents << "},\"traceEvents\":[";
+
+  bool first = true;
+  for (const std::map<unsigned int, std::string>::value_type &pair : threadnames) {
+    stream << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid
+           << ",\"tid\":" << pair.first << ",\"args\":{\"name\":";
+    writeString(stream, pair.second);
+    stream << "}}";
+    first = false;
+  }
+
+  for (const TraceEvent &event : events) {
+    stream << (first ? "" : ",") << "\n{\"name\":";
+    writeString(stream, event.name);
+    stream << ",\"cat\":\"" << event.category << "\",\"ph\":\"" << event.phase << "\",\"ts\":" << event.timestamp;
+    if (event.phase == 'X') {
+      stream << ",\"dur\":" << event.duration;
+    } else {
+      // instant events are drawn across the thread only
+      stream << ",\"s\":\"t\"";
+    }
+    stream << ",\"pid\":" << pid << ",\"tid\":" << event.threadid << "}";
+    first = false;
+  }
+  stream << "\n]}\n";
+}
+
+bool Tracer::write(const std::string& filename) {
+  std::ofstream file(filename, std::ios::out | std::ios::trunc);
+  if (!file) {
+    return false;
+  }
+  write(file);
+  return static_cast<bool>(file);
+}
+
+}
@@ -0,0 +1,130 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+#include <cpputils/dllapi.hpp>
+
+namespace LibFramework {
+
+/**
+ * @brief      Records spans of work per thread and exports them in the
+ *             Chrome trace event format, to be opened with
+ *             chrome://tracing or https://ui.perfetto.dev.
+ *
+ *             Recording is off by default. While it is off, a span costs
+ *             a single relaxed load; defining KADISTUDIO_NO_TRACING
+ *             removes the TRACE_* macros altogether.
+ * @ingroup    framework
+ */
+class DLLAPI Tracer {
+
+  public:
+
+    static bool isEnabled() {
+      return enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief      Starts recording, discarding previously recorded events.
+     *             Timestamps are relative to this call.
+     */
+    static void start();
+    static void stop();
+
+    /**
+     * @brief      Microseconds since start().
+     */
+    static std::int64_t now();
+
+    static void complete(const char* category, const std::string& name, std::int64_t start, std::int64_t duration);
+    static void instant(const char* category, const std::string& name);
+
+    /**
+     * @brief      Names the calling thread in the exported trace.
+     */
+    static void setThreadName(const std::string& name);
+
+    static std::size_t getEventCount();
+
+    static void write(std::ostream& stream);
+    static bool write(const std::string& filename);
+
+    const static std::size_t MAX_EVENTS = 1 << 20;
+
+  private:
+
+    static std::atomic<bool> enabled;
+
+};
+
+/**
+ * @brief      Records the lifetime of the span as one complete event.
+ * @ingroup    framework
+ */
+class DLLAPI TraceSpan {
+
+  public:
+
+    TraceSpan(const char* category, const char* name) : category(category), start(-1) {
+      if (Tracer::isEnabled()) {
+        this->name = name;
+        start = Tracer::now();
+      }
+    }
+
+    TraceSpan(const char* category, const std::string& name) : category(category), start(-1) {
+      if (Tracer::isEnabled()) {
+        this->name = name;
+        start = Tracer::now();
+      }
+    }
+
+    ~TraceSpan() {
+      if (start >= 0) {
+        Tracer::complete(category, name, start, Tracer::now() - start);
+      }
+    }
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+  private:
+
+    const char *category;
+    std::string name;
+    std::int64_t start;
+
+};
+
+}
+
+#define TRACE_CONCAT_IMPL(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_IMPL(a, b)
+
+#ifndef KADISTUDIO_NO_TRACING
+#define TRACE_SCOPE(category, name) LibFramework::TraceSpan TRACE_CONCAT(tracespan, __LINE__)(category, name)
+#define TRACE_INSTANT(category, name) \
+  do { if (LibFramework::Tracer::isEnabled()) LibFramework::Tracer::instant(category, name); } while (false)
+#else
+#define TRACE_SCOPE(category, name) do {} while (false)
+#define TRACE_INSTANT(category, name) do {} while (false)
+#endif
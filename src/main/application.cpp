@@ -12,7 +12,9 @@
  * See the License for the specific language governing permissions and
  * limitations under the License. */
 
+#include <algorithm>
 #include <cstdio>
+#include <iostream>
 
 #include <QMessageBox>
 #include <QIcon>
@@ -24,6 +26,7 @@
 #include <framework/mainwindow/mainwindow.h>
 #include <framework/workspace/workspace.h>
 #include <framework/dock/dockwindow.h>
+#include <framework/tracing/tracer.h>
 
 #include "application.h"
 
@@ -50,6 +53,13 @@ void myMessageOutput(QtMsgType type, const QMessageLogContext &context, const QS
 
 Application::Application(const QString& appname, int& argc, char** argv) :
     QApplication(argc, argv) {
+  tracefilename = qEnvironmentVariable("KADISTUDIO_TRACE_FILE");
+  if (!tracefilename.isEmpty()) {
+    LibFramework::Tracer::start();
+    LibFramework::Tracer::setThreadName("main");
+  }
+  TRACE_SCOPE("startup", "Application");
+
   qInstallMessageHandler(myMessageOutput);
 
   QApplication::setOrganizationName("KIT");
@@ -63,6 +73,13 @@ Application::Application(const QString& appname, int& argc, char** argv) :
 }
 
 Application::~Application() {
+  if (LibFramework::Tracer::isEnabled()) {
+    writeTrace();
+    LibFramework::Tracer::stop();
+  }
+  if (qEnvironmentVariableIsSet("KADISTUDIO_PLUGIN_TIMINGS")) {
+    pluginmanager->printLoadTimings(std::cerr);
+  }
 }
 
 int Application::evaluateHelp(int argc, char** argv) {
@@ -77,6 +94,7 @@ int Application::evaluateHelp(int argc, char** argv) {
 }
 
 void Application::loadLocalPlugins() {
+  TRACE_SCOPE("startup", "Application::loadLocalPlugins");
   QDir librarydir(Application::applicationDirPath());
 #ifdef Q_OS_WIN
   librarydir.cd("../");
@@ -95,14 +113,21 @@ void Application::loadLocalPlugins() {
 #endif
                         QDir::Files,
                         QDirIterator::Subdirectories);
+  std::vector<std::string> filenames;
   while (iterator.hasNext()) {
     iterator.next();
-    QString filename = iterator.filePath();
-    pluginmanager->addPlugin(filename.toStdString());
+    filenames.push_back(iterator.filePath().toStdString());
   }
+  // the directory order differs between file systems, keep the namespace conflicts reproducible
+  std::sort(filenames.begin(), filenames.end());
+  pluginmanager->addPlugins(filenames);
 }
 
 void Application::showMainWindow() {
+  TRACE_SCOPE("startup", "Application::showMainWindow");
+  if (LibFramework::Tracer::isEnabled()) {
+    installEventFilter(this);
+  }
   MainWindow *mainwindow = MainWindow::getInstance();
   mainwindow->show();
   // show pluginchooser after launch
@@ -116,6 +141,22 @@ void Application::showMainWindow() {
   }
 }
 
+bool Application::eventFilter(QObject* watched, QEvent* event) {
+  if (event->type() == QEvent::Paint) {
+    removeEventFilter(this);
+    TRACE_INSTANT("paint", "first paint");
+    LibFramework::Tracer::complete("startup", "time to first paint", 0, LibFramework::Tracer::now());
+    writeTrace();
+  }
+  return QApplication::eventFilter(watched, event);
+}
+
+void Application::writeTrace() {
+  if (!LibFramework::Tracer::write(tracefilename.toStdString())) {
+    std::cerr << "Could not write the trace to " << tracefilename.toStdString() << std::endl;
+  }
+}
+
 void Application::addTab(const QString& callernamespace, QWidget* widget, const QString& name) {
   Workspace *workspace = MainWindow::getInstance()->getWorkspace();
   workspace->addTab(callernamespace, widget, name);
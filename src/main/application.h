@@ -32,6 +32,10 @@ class Application : public QApplication {
 
   public:
     /**
+      * Setting KADISTUDIO_TRACE_FILE records a trace of the startup and
+      * of the plugins, written to that file on the first paint of the
+      * main window and again on exit.
+      *
       * @param argc must be a reference
       */
     Application(const QString& appname, int& argc, char** argv);
@@ -53,9 +57,13 @@ class Application : public QApplication {
     void clearMessage();
 
   private:
+    bool eventFilter(QObject* watched, QEvent* event) override;
+
     void loadLocalPlugins();
+    void writeTrace();
 
     LibFramework::PluginManagerInterface *pluginmanager;
     bool autostart;
+    QString tracefilename;
 
 };
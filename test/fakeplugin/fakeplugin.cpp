@@ -0,0 +1,70 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+/**
+ * A plugin that is never run, only its metadata is read and it is loaded.
+ * The payload makes it about as large as the bigger plugins, so that
+ * scanning it for the metadata costs what it costs there.
+ *
+ * The namespace, the required namespaces, the payload size in MB and
+ * whether the plugin is loaded on demand can be set at compile time, to
+ * build several plugins depending on each other from this file.
+ */
+
+#include <thread>
+
+#include <framework/pluginframework/plugininterface.h>
+
+#ifndef FAKE_PLUGIN_NAMESPACE
+#define FAKE_PLUGIN_NAMESPACE /plugins/test/fakeplugin
+#endif
+#ifndef FAKE_PLUGIN_REQUIRED
+#define FAKE_PLUGIN_REQUIRED /plugins/infrastructure/logger /plugins/infrastructure/settings
+#endif
+#ifndef FAKE_PLUGIN_PAYLOAD_MB
+#define FAKE_PLUGIN_PAYLOAD_MB 32
+#endif
+
+// the metadata macros stringify their argument, these expand it first
+#define FAKE_NAMESPACE(NAMESPACE) PLUGIN_NAMESPACE(NAMESPACE)
+#define FAKE_REQUIRED_NAMESPACES(NAMESPACES) PLUGIN_REQUIRED_NAMESPACES(NAMESPACES)
+
+class FakePlugin : public LibFramework::PluginInterface {
+
+  public:
+    void run() override {}
+    void load() override {}
+    void unload() override {}
+
+};
+
+extern "C" {
+PLUGIN_EXPORT extern const char fakePluginPayload[FAKE_PLUGIN_PAYLOAD_MB * 1024 * 1024];
+const char fakePluginPayload[FAKE_PLUGIN_PAYLOAD_MB * 1024 * 1024] = {1};
+
+// set by the static initialization when the library is loaded
+PLUGIN_EXPORT extern std::thread::id fakePluginLoadingThread;
+std::thread::id fakePluginLoadingThread = std::this_thread::get_id();
+}
+
+PLUGIN_INSTANCE(FakePlugin)
+PLUGIN_AUTHORS(Jane Doe, John Doe)
+PLUGIN_NAME(Fake plugin)
+PLUGIN_DESCRIPTION(Plugin for testing the metadata lookup)
+PLUGIN_ICON(:/studio/framework/application/pixmaps/noicon.png)
+FAKE_NAMESPACE(FAKE_PLUGIN_NAMESPACE)
+FAKE_REQUIRED_NAMESPACES(FAKE_PLUGIN_REQUIRED)
+#ifdef FAKE_PLUGIN_ON_DEMAND
+PLUGIN_LOAD_ON_DEMAND()
+#endif
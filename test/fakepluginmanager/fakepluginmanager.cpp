@@ -0,0 +1,99 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "fakepluginmanager.h"
+
+using LibFramework::InterfaceContainer;
+using LibFramework::InterfaceRegistry;
+
+FakePluginManager::FakePluginManager()
+    : registry(std::make_unique<InterfaceRegistry>([this](const std::string& namespacepath) {
+        auto it = containers.find(namespacepath);
+        return InterfaceRegistry::Resolved {it == containers.end() ? nullptr : it->second.get(), true};
+      })) {
+}
+
+FakePluginManager::~FakePluginManager() = default;
+
+void FakePluginManager::addInterfaces(const std::string& namespacepath, InterfaceContainer *interfacecontainer) {
+  containers[namespacepath].reset(interfacecontainer);
+  registry->notify(namespacepath, InterfaceRegistry::added);
+}
+
+std::vector<const LibFramework::Plugin*> FakePluginManager::getPlugins(const std::string&) const {
+  return {};
+}
+
+std::vector<const LibFramework::PluginInfo*> FakePluginManager::getPluginInfos(const std::string&) const {
+  return {};
+}
+
+bool FakePluginManager::load(const std::string& namespacepath) {
+  return isLoaded(namespacepath);
+}
+
+void FakePluginManager::unload(const std::string&) {
+}
+
+bool FakePluginManager::isLoaded(const std::string& namespacepath) const {
+  return containers.count(namespacepath) > 0;
+}
+
+bool FakePluginManager::isUnloaded(const std::string& namespacepath) const {
+  return !isLoaded(namespacepath);
+}
+
+bool FakePluginManager::isRunning(const std::string& namespacepath) const {
+  return isLoaded(namespacepath);
+}
+
+bool FakePluginManager::run(const std::string& namespacepath) {
+  return isLoaded(namespacepath);
+}
+
+void FakePluginManager::toggle(const std::string&) {
+}
+
+std::vector<std::string> FakePluginManager::getRunningNamespaces() const {
+  std::vector<std::string> namespaces;
+  for (const auto& [namespacepath, interfacecontainer] : containers) {
+    namespaces.push_back(namespacepath);
+  }
+  return namespaces;
+}
+
+bool FakePluginManager::addPlugin(const std::string&) {
+  return false;
+}
+
+bool FakePluginManager::addPlugins(const std::vector<std::string>&) {
+  return false;
+}
+
+void FakePluginManager::printLoadTimings(std::ostream&) const {
+}
+
+LibFramework::Interfaces FakePluginManager::getInterfaces(const std::string& namespacepath) const {
+  LibFramework::Interfaces interfaces;
+  for (const auto& [pluginnamespace, interfacecontainer] : containers) {
+    if (pluginnamespace.compare(0, namespacepath.length(), namespacepath) == 0) {
+      interfaces[pluginnamespace] = interfacecontainer.get();
+    }
+  }
+  return interfaces;
+}
+
+InterfaceRegistry* FakePluginManager::getInterfaceRegistry() const {
+  return registry.get();
+}
@@ -0,0 +1,66 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include <framework/pluginframework/pluginmanagerinterface.h>
+
+/**
+ * Plugin manager without plugin libraries, it hands out the interfaces
+ * the test created itself. Plugins needing others through the plugin
+ * manager, like the Kadi dialogs needing the Kadi configuration, can so be
+ * tested together without loading them. Every namespace with interfaces
+ * counts as loaded and running.
+ */
+class FakePluginManager : public LibFramework::PluginManagerInterface {
+
+  public:
+    FakePluginManager();
+    ~FakePluginManager() override;
+
+    /**
+     * @brief      Provides the interfaces in the namespace, the plugin
+     *             manager owns the container but not the interfaces.
+     */
+    void addInterfaces(const std::string& namespacepath, LibFramework::InterfaceContainer *interfacecontainer);
+
+    std::vector<const LibFramework::Plugin*> getPlugins(const std::string& namespacepath = "") const override;
+    std::vector<const LibFramework::PluginInfo*> getPluginInfos(const std::string& namespacepath = "") const override;
+
+    bool load(const std::string& namespacepath) override;
+    void unload(const std::string& namespacepath) override;
+    bool isLoaded(const std::string& namespacepath) const override;
+    bool isUnloaded(const std::string& namespacepath) const override;
+    bool isRunning(const std::string& namespacepath) const override;
+    bool run(const std::string& namespacepath) override;
+    void toggle(const std::string& namespacepath) override;
+
+    std::vector<std::string> getRunningNamespaces() const override;
+
+    bool addPlugin(const std::string& filename) override;
+    bool addPlugins(const std::vector<std::string>& filenames) override;
+
+    void printLoadTimings(std::ostream& stream) const override;
+
+    LibFramework::Interfaces getInterfaces(const std::string& namespacepath) const override;
+    LibFramework::InterfaceRegistry* getInterfaceRegistry() const override;
+
+  private:
+    std::map<std::string, std::unique_ptr<LibFramework::InterfaceContainer>> containers;
+    std::unique_ptr<LibFramework::InterfaceRegistry> registry;
+};
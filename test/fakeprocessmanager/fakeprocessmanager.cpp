@@ -0,0 +1,253 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+/**
+ * A stand-in for the process-manager binary, so that the process
+ * manager plugin can be tested without a real workflow engine.
+ *
+ * Usage:
+ *   fakeprocessmanager <command> [args...]   one command per process
+ *   fakeprocessmanager session               line based JSON session
+ *
+ * Setting FAKE_PROCESS_MANAGER_NO_SESSION makes the session command
+ * fail like a process manager without session support.
+ * FAKE_PROCESS_MANAGER_WORKFLOWS=<n> starts with n running workflows,
+ * FAKE_PROCESS_MANAGER_STATE=<state> with n workflows in that state.
+ * FAKE_PROCESS_MANAGER_LOG_DIR=<dir> places the log of workflow <id> at
+ * <dir>/<id>.log.
+ * FAKE_PROCESS_MANAGER_PROTOCOL=<n> greets with protocol n instead of 1
+ * when the session starts, "none" starts it without a greeting.
+ *
+ * In session mode, "subscribe" enables pushing workflow events and
+ * "advance <id> <state>" moves a workflow to another state.
+ */
+
+#include <cstdio>
+#include <iostream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QStringList>
+
+struct FakeResult {
+  int exit_code = 0;
+  QString stdout_result;
+  QString stderr_result;
+};
+
+class FakeProcessManager {
+
+  public:
+    FakeProcessManager() {
+      int initial_workflows = qEnvironmentVariableIntValue("FAKE_PROCESS_MANAGER_WORKFLOWS");
+      const QString initial_state = qEnvironmentVariable("FAKE_PROCESS_MANAGER_STATE", "Running");
+      for (int i = 0; i < initial_workflows; ++i) {
+        createWorkflow(QString("workflow%1.flow").arg(i))["state"] = initial_state;
+      }
+    }
+
+    FakeResult handle(const QStringList& arguments) {
+      const QString command = arguments.value(0);
+
+      if (command == "subscribe" || command == "unsubscribe") {
+        if (!session) {
+          return {1, {}, "subscribing requires a session"};
+        }
+        subscribed = command == "subscribe";
+        return {};
+      }
+
+      if (command == "pid") {
+        return {0, QString::number(QCoreApplication::applicationPid()), {}};
+      }
+      if (command == "start") {
+        QJsonObject workflow = createWorkflow(arguments.last());
+        pushWorkflow(workflow);
+        return {0, toString(workflow), {}};
+      }
+      if (command == "list" && arguments.value(1) == "workflows") {
+        QJsonArray list;
+        for (const auto& [id, workflow] : workflows) {
+          list.append(workflow);
+        }
+        return {0, QJsonDocument(list).toJson(QJsonDocument::Compact), {}};
+      }
+
+      bool ok = false;
+      unsigned int id = arguments.value(1).toUInt(&ok);
+      if (!ok || !workflows.contains(id)) {
+        return {1, {}, QString("unknown command or workflow: %1").arg(arguments.join(' '))};
+      }
+      QJsonObject& workflow = workflows[id];
+
+      if (command == "status") {
+        return {0, toString(workflow), {}};
+      } else if (command == "continue") {
+        setState(workflow, "Running");
+        return {};
+      } else if (command == "cancel") {
+        setState(workflow, "Cancelled");
+        return {};
+      } else if (command == "input") {
+        return {};
+      } else if (command == "advance") {
+        setState(workflow, arguments.value(2));
+        return {};
+      } else if (command == "shortcuts") {
+        QJsonObject shortcut {{"name", "Output"}, {"path", "/tmp/fakeprocessmanager"}};
+        return {0, toString(QJsonObject {{"shortcuts", QJsonArray {shortcut}}}), {}};
+      } else if (command == "interactions") {
+        QJsonObject interaction {
+          {"id", "0"}, {"type", "string"}, {"direction", "input"},
+          {"pageNumber", 0}, {"order", 0}, {"description", "Value"}
+        };
+        return {0, toString(QJsonObject {{"interactions", QJsonArray {interaction}}}), {}};
+      } else if (command == "log") {
+        return {0, QString("log of workflow %1\n").arg(id), {}};
+      } else if (command == "log_path") {
+        const QString log_dir = qEnvironmentVariable("FAKE_PROCESS_MANAGER_LOG_DIR");
+        if (!log_dir.isEmpty()) {
+          return {0, QString("%1/%2.log\n").arg(log_dir).arg(id), {}};
+        }
+        return {0, QString("/tmp/fakeprocessmanager/%1/log.txt\n").arg(id), {}};
+      } else if (command == "tree_path") {
+        return {0, QString("/tmp/fakeprocessmanager/%1/tree.json\n").arg(id), {}};
+      } else if (command == "tree") {
+        return {0, toString(QJsonObject {{"id", static_cast<int>(id)}, {"children", QJsonArray()}}), {}};
+      }
+      return {1, {}, QString("unknown command: %1").arg(command)};
+    }
+
+    /**
+     * Events queued since the last call, to be written after the response.
+     */
+    std::vector<QJsonObject> takeEvents() {
+      return std::exchange(events, {});
+    }
+
+    bool session = false;
+
+  private:
+    void setState(QJsonObject& workflow, const QString& state) {
+      workflow["state"] = state;
+      if (state == "Finished") {
+        workflow["nodesProcessed"] = workflow["nodesTotal"];
+      }
+      pushWorkflow(workflow);
+
+      unsigned int id = workflow["id"].toInt();
+      if (state == "Needs_interaction") {
+        push({{"event", "interactions"}, {"workflowId", static_cast<int>(id)}});
+      }
+      log_sizes[id] += 128;
+      push({{"event", "log"}, {"workflowId", static_cast<int>(id)}, {"size", log_sizes[id]}});
+    }
+
+    void pushWorkflow(const QJsonObject& workflow) {
+      push({{"event", "workflow"}, {"workflow", workflow}});
+    }
+
+    void push(const QJsonObject& event) {
+      if (subscribed) {
+        events.push_back(event);
+      }
+    }
+
+    QJsonObject& createWorkflow(const QString& file_name) {
+      unsigned int id = next_id++;
+      QJsonObject workflow {
+        {"id", static_cast<int>(id)},
+        {"fileName", file_name},
+        {"state", "Running"},
+        {"nodesProcessed", 0},
+        {"nodesProcessedInLoops", 0},
+        {"nodesTotal", 4},
+        {"processEngine", "fake"},
+        {"startDateTime", "12:00:00 01.01.2025"},
+        {"endDateTime", ""}
+      };
+      workflows[id] = workflow;
+      return workflows[id];
+    }
+
+    static QString toString(const QJsonObject& object) {
+      return QJsonDocument(object).toJson(QJsonDocument::Compact);
+    }
+
+    std::map<unsigned int, QJsonObject> workflows;
+    std::map<unsigned int, qint64> log_sizes;
+    std::vector<QJsonObject> events;
+    bool subscribed = false;
+    unsigned int next_id = 1;
+};
+
+static int runSession(FakeProcessManager& process_manager) {
+  process_manager.session = true;
+
+  const QString protocol = qEnvironmentVariable("FAKE_PROCESS_MANAGER_PROTOCOL", "1");
+  if (protocol != "none") {
+    QJsonObject hello {{"hello", "process-manager"}, {"protocol", protocol.toInt()}};
+    std::cout << QJsonDocument(hello).toJson(QJsonDocument::Compact).toStdString() << std::endl;
+  }
+
+  std::string line;
+  while (std::getline(std::cin, line)) {
+    QJsonObject request = QJsonDocument::fromJson(QByteArray::fromStdString(line)).object();
+    QStringList arguments;
+    for (const auto& argument : request["args"].toArray()) {
+      arguments.append(argument.toString());
+    }
+
+    FakeResult result = process_manager.handle(arguments);
+    QJsonObject response {
+      {"id", request["id"]},
+      {"exitCode", result.exit_code},
+      {"stdout", result.stdout_result},
+      {"stderr", result.stderr_result}
+    };
+    std::cout << QJsonDocument(response).toJson(QJsonDocument::Compact).toStdString() << std::endl;
+
+    for (const QJsonObject& event : process_manager.takeEvents()) {
+      std::cout << QJsonDocument(event).toJson(QJsonDocument::Compact).toStdString() << std::endl;
+    }
+  }
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  QCoreApplication app(argc, argv);
+  QStringList arguments = app.arguments().mid(1);
+  arguments.removeAll("--no-color");
+
+  FakeProcessManager process_manager;
+
+  if (arguments.value(0) == "session") {
+    if (qEnvironmentVariableIsSet("FAKE_PROCESS_MANAGER_NO_SESSION")) {
+      std::cerr << "unknown command: session" << std::endl;
+      return 1;
+    }
+    return runSession(process_manager);
+  }
+
+  FakeResult result = process_manager.handle(arguments);
+  std::cout << result.stdout_result.toStdString();
+  std::cerr << result.stderr_result.toStdString();
+  return result.exit_code;
+}
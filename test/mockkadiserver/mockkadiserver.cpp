@@ -0,0 +1,602 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <algorithm>
+
+#include <QCryptographicHash>
+#include <QHostAddress>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QPointer>
+#include <QTcpSocket>
+#include <QTimer>
+#include <QUrl>
+#include <QUuid>
+
+#include "mockkadiserver.h"
+
+namespace {
+
+const QByteArray TOKEN = "mocktoken";
+
+QByteArray reason(int status) {
+  switch (status) {
+    case 200: return "OK";
+    case 201: return "Created";
+    case 204: return "No Content";
+    case 206: return "Partial Content";
+    case 304: return "Not Modified";
+    case 400: return "Bad Request";
+    case 401: return "Unauthorized";
+    case 404: return "Not Found";
+    case 409: return "Conflict";
+    case 429: return "Too Many Requests";
+    case 503: return "Service Unavailable";
+    default:  return "Error";
+  }
+}
+
+QByteArray md5(const QByteArray& content) {
+  return QCryptographicHash::hash(content, QCryptographicHash::Md5).toHex();
+}
+
+}
+
+MockKadiServer::MockKadiServer(QObject *parent)
+    : QObject(parent), nextRecord(1), chunkSize(1 << 20), corruptDownloads(false), checksumsReported(true),
+      rangeRequests(true), interruptedDownloads(0), interruptAfter(0), maximumPageSize(100), descriptionSize(0),
+      latency(0), waiting(0), maximumWaiting(0),
+      clock(QDateTime(QDate(2025, 1, 1), QTime(0, 0), Qt::UTC)) {
+  connect(&server, &QTcpServer::newConnection, this, [this]() {
+    while (QTcpSocket *socket = server.nextPendingConnection()) {
+      connect(socket, &QTcpSocket::readyRead, this, [this, socket]() { readRequests(socket); });
+      connect(socket, &QTcpSocket::disconnected, this, [this, socket]() {
+        buffers.remove(socket);
+        socket->deleteLater();
+      });
+    }
+  });
+}
+
+bool MockKadiServer::listen() {
+  return server.listen(QHostAddress::LocalHost);
+}
+
+QString MockKadiServer::host() const {
+  return QString("http://127.0.0.1:%1").arg(server.serverPort());
+}
+
+QString MockKadiServer::token() const {
+  return QString::fromLatin1(TOKEN);
+}
+
+int MockKadiServer::addRecord(const QString& identifier, const QString& title) {
+  clock = clock.addSecs(1);
+  records.insert(nextRecord, {identifier, title.isEmpty() ? identifier : title, clock});
+  return nextRecord++;
+}
+
+void MockKadiServer::removeRecord(int record) {
+  records.remove(record);
+  for (auto it = files.begin(); it != files.end();) {
+    it = (it->record == record) ? files.erase(it) : std::next(it);
+  }
+}
+
+void MockKadiServer::touchRecord(int record) {
+  clock = clock.addSecs(1);
+  records[record].lastModified = clock;
+}
+
+QString MockKadiServer::addFile(int record, const QString& name, const QByteArray& content, const QString& mimetype) {
+  QString id = QUuid::createUuid().toString(QUuid::WithoutBraces);
+  files.insert(id, {id, name, record, content, mimetype});
+  if (records.contains(record)) {
+    touchRecord(record);
+  }
+  return id;
+}
+
+void MockKadiServer::setFileContent(const QString& fileid, const QByteArray& content) {
+  files[fileid].content = content;
+  if (records.contains(files[fileid].record)) {
+    touchRecord(files[fileid].record);
+  }
+}
+
+QString MockKadiServer::fileId(int record, const QString& name) const {
+  for (const File& file : files) {
+    if (file.record == record && file.name == name) {
+      return file.id;
+    }
+  }
+  return QString();
+}
+
+QByteArray MockKadiServer::fileContent(const QString& fileid) const {
+  return files.value(fileid).content;
+}
+
+void MockKadiServer::setChunkSize(qint64 bytes) {
+  chunkSize = bytes;
+}
+
+int MockKadiServer::pendingUploads() const {
+  return static_cast<int>(uploads.size());
+}
+
+void MockKadiServer::setCorruptDownloads(bool corrupt) {
+  corruptDownloads = corrupt;
+}
+
+void MockKadiServer::setChecksumsReported(bool reported) {
+  checksumsReported = reported;
+}
+
+void MockKadiServer::setRangeRequestsSupported(bool supported) {
+  rangeRequests = supported;
+}
+
+void MockKadiServer::interruptDownloads(int count, qint64 afterbytes) {
+  interruptedDownloads = count;
+  interruptAfter = afterbytes;
+}
+
+void MockKadiServer::failRequests(const QString& pathpart, int count, int status, int skip) {
+  failures.append({pathpart, count, status, skip});
+}
+
+void MockKadiServer::setMaximumPageSize(int items) {
+  maximumPageSize = std::max(1, items);
+}
+
+void MockKadiServer::setDescriptionSize(int bytes) {
+  descriptionSize = bytes;
+}
+
+void MockKadiServer::setLatency(int msecs) {
+  latency = msecs;
+}
+
+int MockKadiServer::maximumConcurrentRequests() const {
+  return maximumWaiting;
+}
+
+int MockKadiServer::requests(const QString& pathpart, int status) const {
+  int count = 0;
+  for (const LoggedRequest& request : log) {
+    if (request.path.contains(pathpart) && (status == 0 || request.status == status)) {
+      count++;
+    }
+  }
+  return count;
+}
+
+void MockKadiServer::clearRequests() {
+  log.clear();
+}
+
+void MockKadiServer::readRequests(QTcpSocket *socket) {
+  QByteArray& buffer = buffers[socket];
+  buffer += socket->readAll();
+
+  // connections are kept alive, a buffer may hold several requests
+  while (true) {
+    qsizetype headerend = buffer.indexOf("\r\n\r\n");
+    if (headerend < 0) return;
+
+    QList<QByteArray> lines = buffer.left(headerend).split('\n');
+    QList<QByteArray> requestline = lines.takeFirst().trimmed().split(' ');
+    if (requestline.size() < 2) {
+      socket->disconnectFromHost();
+      return;
+    }
+
+    Request request;
+    request.method = requestline[0];
+    request.path = QUrl::fromPercentEncoding(requestline[1]);
+    request.query = QUrlQuery(QUrl::fromEncoded(requestline[1]));
+    for (const QByteArray& line : lines) {
+      qsizetype colon = line.indexOf(':');
+      if (colon > 0) {
+        request.headers.insert(line.left(colon).trimmed().toLower(), line.mid(colon + 1).trimmed());
+      }
+    }
+
+    qsizetype length = request.headers.value("content-length", "0").toLongLong();
+    if (buffer.size() < headerend + 4 + length) return;
+    request.body = buffer.mid(headerend + 4, length);
+    buffer.remove(0, headerend + 4 + length);
+
+    if (latency > 0) {
+      waiting++;
+      maximumWaiting = std::max(maximumWaiting, waiting);
+      QTimer::singleShot(latency, this, [this, socket = QPointer<QTcpSocket>(socket), request]() {
+        waiting--;
+        if (socket && socket->state() == QAbstractSocket::ConnectedState) {
+          respond(socket, request);
+        }
+      });
+      continue;
+    }
+
+    respond(socket, request);
+    if (socket->state() != QAbstractSocket::ConnectedState) return;
+  }
+}
+
+void MockKadiServer::respond(QTcpSocket *socket, const Request& request) {
+  if (request.headers.value("authorization") != "Bearer " + TOKEN) {
+    sendError(socket, request, 401, "No valid access token was supplied.");
+    return;
+  }
+  if (injectFailure(socket, request)) return;
+
+  QStringList parts = request.path.section('?', 0, 0).split('/', Qt::SkipEmptyParts);
+  if (parts.size() >= 2 && parts[0] == "api" && parts[1] == "records") {
+    respondRecords(socket, request, parts.mid(2));
+  } else if (parts.size() == 3 && parts[0] == "api" && parts[1] == "uploads") {
+    respondUploads(socket, request, parts[2]);
+  } else {
+    sendError(socket, request, 404);
+  }
+}
+
+void MockKadiServer::respondRecords(QTcpSocket *socket, const Request& request, const QStringList& parts) {
+  int record = parts.value(0).toInt();
+
+  // GET records, the newest first and optionally the ones matching a query
+  if (request.method == "GET" && parts.isEmpty()) {
+    QString query = request.query.queryItemValue("query", QUrl::FullyDecoded);
+    QJsonArray items;
+    for (auto it = records.end(); it != records.begin();) {
+      --it;
+      if (it->identifier.contains(query, Qt::CaseInsensitive) || it->title.contains(query, Qt::CaseInsensitive)) {
+        items.append(recordObject(it.key()));
+      }
+    }
+    sendJson(socket, request, page(request, items));
+    return;
+  }
+
+  // GET records/identifier/<identifier>
+  if (request.method == "GET" && parts.size() == 2 && parts[0] == "identifier") {
+    for (auto it = records.begin(); it != records.end(); ++it) {
+      if (it->identifier == parts[1]) {
+        sendJson(socket, request, recordObject(it.key()));
+        return;
+      }
+    }
+  }
+
+  // GET records/<id>/files
+  if (request.method == "GET" && parts.size() == 2 && parts[1] == "files" && records.contains(record)) {
+    QJsonArray items;
+    for (const File& file : files) {
+      if (file.record == record) {
+        items.append(fileObject(file));
+      }
+    }
+    sendJson(socket, request, page(request, items));
+    return;
+  }
+
+  // GET records/<id>/files/name/<name>
+  if (request.method == "GET" && parts.size() == 4 && parts[1] == "files" && parts[2] == "name") {
+    QString id = fileId(record, parts[3]);
+    if (!id.isEmpty()) {
+      sendJson(socket, request, fileObject(files[id]));
+      return;
+    }
+  }
+
+  // GET records/<id>/files/<file id>/download
+  if (request.method == "GET" && parts.size() == 4 && parts[1] == "files" && parts[3] == "download" && files.contains(parts[2])) {
+    sendFile(socket, request, files[parts[2]]);
+    return;
+  }
+
+  // POST records/<id>/uploads creates an upload, PUT records/<id>/files/<file id> one replacing the file
+  QJsonObject body = QJsonDocument::fromJson(request.body).object();
+  if (request.method == "POST" && parts.size() == 2 && parts[1] == "uploads" && records.contains(record)) {
+    QString existing = fileId(record, body["name"].toString());
+    if (!existing.isEmpty()) {
+      QJsonObject conflict {{"code", 409}, {"description", "A file with that name already exists."}, {"file", fileObject(files[existing])}};
+      sendJson(socket, request, conflict, 409);
+      return;
+    }
+    Upload upload {QUuid::createUuid().toString(QUuid::WithoutBraces), body["name"].toString(), record,
+                   body["size"].toInteger(), QString(), {}};
+    uploads.insert(upload.id, upload);
+    sendJson(socket, request, uploadObject(upload), 201);
+    return;
+  }
+  if (request.method == "PUT" && parts.size() == 3 && parts[1] == "files" && files.contains(parts[2])) {
+    const File& file = files[parts[2]];
+    Upload upload {QUuid::createUuid().toString(QUuid::WithoutBraces), file.name, file.record,
+                   body["size"].toInteger(), file.id, {}};
+    uploads.insert(upload.id, upload);
+    sendJson(socket, request, uploadObject(upload), 201);
+    return;
+  }
+
+  sendError(socket, request, 404);
+}
+
+void MockKadiServer::respondUploads(QTcpSocket *socket, const Request& request, const QString& uploadid) {
+  auto it = uploads.find(uploadid);
+  if (it == uploads.end()) {
+    sendError(socket, request, 404);
+    return;
+  }
+  Upload& upload = it.value();
+
+  if (request.method == "GET") {
+    sendJson(socket, request, uploadObject(upload));
+  } else if (request.method == "DELETE") {
+    uploads.erase(it);
+    send(socket, request, 204, QByteArray());
+  } else if (request.method == "PUT") {
+    // a chunk, sent as form data
+    QMap<QByteArray, QByteArray> form = formData(request);
+    QByteArray blob = form.value("blob");
+    int index = form.value("index").toInt();
+    if (blob.size() != form.value("size").toLongLong() || md5(blob) != form.value("checksum")) {
+      sendError(socket, request, 400, "Chunk does not match its size or checksum.");
+      return;
+    }
+    upload.chunks.insert(index, blob);
+    sendJson(socket, request, uploadObject(upload));
+  } else if (request.method == "POST") {
+    // finishing the upload
+    QByteArray content;
+    int chunkcount = uploadObject(upload)["chunk_count"].toInt();
+    for (int index = 0; index < chunkcount; ++index) {
+      content += upload.chunks.value(index);
+    }
+    if (content.size() != upload.size) {
+      sendError(socket, request, 400, "Upload is incomplete.");
+      return;
+    }
+
+    QString id = upload.replaces;
+    if (id.isEmpty()) {
+      id = addFile(upload.record, upload.name, content);
+    } else {
+      setFileContent(id, content);
+    }
+    uploads.erase(it);
+    sendJson(socket, request, fileObject(files[id]), 201);
+  } else {
+    sendError(socket, request, 404);
+  }
+}
+
+void MockKadiServer::sendFile(QTcpSocket *socket, const Request& request, const File& file) {
+  if (request.headers.value("if-none-match") == etag(file)) {
+    send(socket, request, 304, QByteArray(), {{"ETag", etag(file)}});
+    return;
+  }
+
+  QByteArray content = file.content;
+  if (corruptDownloads && !content.isEmpty()) {
+    content[0] = static_cast<char>(content[0] ^ 0xff);
+  }
+
+  int status = 200;
+  QList<QPair<QByteArray, QByteArray>> headers {{"Content-Type", "application/octet-stream"}, {"ETag", etag(file)}};
+  QByteArray range = request.headers.value("range");
+  if (rangeRequests && range.startsWith("bytes=") && range.endsWith("-")) {
+    qint64 start = range.mid(6, range.size() - 7).toLongLong();
+    if (start < content.size()) {
+      status = 206;
+      headers.append({"Content-Range", "bytes " + QByteArray::number(start) + "-" + QByteArray::number(content.size() - 1) +
+                                       "/" + QByteArray::number(content.size())});
+      content = content.mid(start);
+    }
+  }
+
+  if (interruptedDownloads > 0) {
+    // announce everything, send only a part and hang up
+    interruptedDownloads--;
+    log.append({request.method, request.path, status});
+    QByteArray response = "HTTP/1.1 " + QByteArray::number(status) + " " + reason(status) + "\r\n";
+    response += "Content-Length: " + QByteArray::number(content.size()) + "\r\n";
+    for (const auto& header : headers) {
+      response += header.first + ": " + header.second + "\r\n";
+    }
+    socket->write(response + "\r\n");
+    socket->write(content.left(interruptAfter));
+    socket->disconnectFromHost();
+    return;
+  }
+
+  send(socket, request, status, content, headers);
+}
+
+bool MockKadiServer::injectFailure(QTcpSocket *socket, const Request& request) {
+  for (auto it = failures.begin(); it != failures.end(); ++it) {
+    if (!request.path.contains(it->pathpart)) continue;
+
+    if (it->skip > 0) {
+      it->skip--;
+      return false;
+    }
+    int status = it->status;
+    if (--it->count <= 0) {
+      failures.erase(it);
+    }
+    if (status == 0) {
+      log.append({request.method, request.path, status});
+      socket->disconnectFromHost();
+      return true;
+    }
+    sendJson(socket, request, {{"code", status}, {"description", "Injected failure."}}, status);
+    return true;
+  }
+  return false;
+}
+
+void MockKadiServer::send(QTcpSocket *socket, const Request& request, int status, const QByteArray& body,
+                          const QList<QPair<QByteArray, QByteArray>>& headers) {
+  log.append({request.method, request.path, status});
+
+  QByteArray response = "HTTP/1.1 " + QByteArray::number(status) + " " + reason(status) + "\r\n";
+  response += "Content-Length: " + QByteArray::number(body.size()) + "\r\n";
+  if (status == 429 || status == 503) {
+    response += "Retry-After: 0\r\n";
+  }
+  for (const auto& header : headers) {
+    response += header.first + ": " + header.second + "\r\n";
+  }
+  response += "\r\n";
+  socket->write(response);
+  socket->write(body);
+}
+
+void MockKadiServer::sendJson(QTcpSocket *socket, const Request& request, const QJsonObject& object, int status) {
+  send(socket, request, status, QJsonDocument(object).toJson(QJsonDocument::Compact), {{"Content-Type", "application/json"}});
+}
+
+void MockKadiServer::sendError(QTcpSocket *socket, const Request& request, int status, const QString& description) {
+  QJsonObject error {{"code", status}};
+  if (!description.isEmpty()) {
+    error["description"] = description;
+  }
+  sendJson(socket, request, error, status);
+}
+
+QJsonObject MockKadiServer::recordObject(int record) const {
+  Record stored = records.value(record);
+  QString base = host() + QString("/api/records/%1").arg(record);
+
+  QJsonObject object;
+  object["id"] = record;
+  object["identifier"] = stored.identifier;
+  object["title"] = stored.title;
+  QString description = QString("Record %1 of the mock server.").arg(record);
+  if (description.size() < descriptionSize) {
+    description.append(QString(descriptionSize - description.size(), '.'));
+  }
+  object["description"] = description;
+  object["creator"] = QJsonObject {{"displayname", "Mock User"}};
+  object["last_modified"] = stored.lastModified.toString(Qt::ISODateWithMs);
+  object["tags"] = QJsonArray {"mock"};
+  object["_links"] = QJsonObject {{"self", base}, {"files", base + "/files"}};
+  return object;
+}
+
+QJsonObject MockKadiServer::fileObject(const File& file) const {
+  QString base = host() + QString("/api/records/%1/files/%2").arg(file.record).arg(file.id);
+
+  QJsonObject object;
+  object["id"] = file.id;
+  object["name"] = file.name;
+  object["size"] = file.content.size();
+  object["record_id"] = file.record;
+  object["mimetype"] = file.mimetype;
+  object["magic_mimetype"] = file.mimetype;
+  if (checksumsReported) {
+    object["checksum"] = QString::fromLatin1(md5(file.content));
+  }
+  object["_links"] = QJsonObject {{"self", base}, {"download", base + "/download"},
+                                  {"record", host() + QString("/api/records/%1").arg(file.record)}};
+  return object;
+}
+
+QJsonObject MockKadiServer::page(const Request& request, const QJsonArray& items) const {
+  int perpage = std::clamp(request.query.queryItemValue("per_page").toInt(), 1, maximumPageSize);
+  if (!request.query.hasQueryItem("per_page")) {
+    perpage = std::min(10, maximumPageSize);
+  }
+  int total = static_cast<int>(items.size());
+  int pages = std::max(1, (total + perpage - 1) / perpage);
+  int number = std::max(1, request.query.queryItemValue("page").toInt());
+
+  QJsonArray slice;
+  for (int i = (number - 1) * perpage; i < std::min(total, number * perpage); ++i) {
+    slice.append(items[i]);
+  }
+
+  QUrlQuery query = request.query;
+  auto link = [this, &request, &query](int target) {
+    query.removeAllQueryItems("page");
+    query.addQueryItem("page", QString::number(target));
+    return host() + request.path.section('?', 0, 0) + "?" + query.toString(QUrl::FullyEncoded);
+  };
+
+  QJsonObject links {{"self", link(number)}};
+  if (number < pages) {
+    links["next"] = link(number + 1);
+  }
+  if (number > 1) {
+    links["prev"] = link(number - 1);
+  }
+
+  QJsonObject pagination {{"page", number}, {"per_page", perpage}, {"total_pages", pages}, {"total_items", total},
+                          {"_links", links}};
+  return {{"items", slice}, {"_pagination", pagination}};
+}
+
+QJsonObject MockKadiServer::uploadObject(const Upload& upload) const {
+  QString base = host() + "/api/uploads/" + upload.id;
+
+  QJsonArray chunks;
+  for (auto it = upload.chunks.begin(); it != upload.chunks.end(); ++it) {
+    chunks.append(QJsonObject {{"index", it.key()}, {"size", it.value().size()}});
+  }
+
+  QJsonObject object;
+  object["id"] = upload.id;
+  object["name"] = upload.name;
+  object["size"] = upload.size;
+  object["chunk_count"] = static_cast<int>(std::max<qint64>(1, (upload.size + chunkSize - 1) / chunkSize));
+  object["chunks"] = chunks;
+  object["_meta"] = QJsonObject {{"chunk_size", chunkSize}};
+  object["_actions"] = QJsonObject {{"upload_chunk", base}, {"finish_upload", base}, {"delete", base}};
+  object["_links"] = QJsonObject {{"self", base}};
+  return object;
+}
+
+QMap<QByteArray, QByteArray> MockKadiServer::formData(const Request& request) {
+  QMap<QByteArray, QByteArray> fields;
+  QByteArray contenttype = request.headers.value("content-type");
+  qsizetype boundaryat = contenttype.indexOf("boundary=");
+  if (boundaryat < 0) return fields;
+
+  QByteArray boundary = "--" + contenttype.mid(boundaryat + 9).replace("\"", "");
+  qsizetype position = request.body.indexOf(boundary);
+  while (position >= 0) {
+    qsizetype start = position + boundary.size() + 2;
+    qsizetype next = request.body.indexOf("\r\n" + boundary, start);
+    if (next < 0) break;
+
+    QByteArray part = request.body.mid(start, next - start);
+    qsizetype headerend = part.indexOf("\r\n\r\n");
+    if (headerend >= 0) {
+      QByteArray headers = part.left(headerend);
+      qsizetype nameat = headers.indexOf("name=\"");
+      if (nameat >= 0) {
+        qsizetype nameend = headers.indexOf('"', nameat + 6);
+        fields.insert(headers.mid(nameat + 6, nameend - nameat - 6), part.mid(headerend + 4));
+      }
+    }
+    position = next + 2;
+  }
+  return fields;
+}
+
+QByteArray MockKadiServer::etag(const File& file) {
+  return "\"" + md5(file.content) + "\"";
+}
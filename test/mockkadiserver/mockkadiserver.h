@@ -0,0 +1,228 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QByteArray>
+#include <QDateTime>
+#include <QHash>
+#include <QJsonObject>
+#include <QMap>
+#include <QObject>
+#include <QStringList>
+#include <QTcpServer>
+#include <QUrlQuery>
+
+class QJsonArray;
+class QTcpSocket;
+
+/**
+ * Minimal HTTP server on localhost answering the parts of the Kadi4Mat
+ * API the Kadi plugins use, so that they can be tested without an
+ * instance. It runs in the thread of the test and serves requests while
+ * an event loop runs, also the local ones of blocking calls.
+ *
+ * Requests must carry the token of token() and are logged with the
+ * status of their response. Records and files are listed in pages like
+ * Kadi does, newest records first. Files are uploaded through the chunked
+ * upload API, downloads support range requests. Broken connections,
+ * failing requests and latency can be injected to test how clients
+ * recover and how they cope with a slow server, smaller page sizes and
+ * larger records to test how they cope with large listings.
+ */
+class MockKadiServer : public QObject {
+
+    Q_OBJECT;
+
+  public:
+    struct LoggedRequest {
+      QByteArray method;
+      QString path;
+      int status;
+    };
+
+    explicit MockKadiServer(QObject *parent = nullptr);
+
+    /**
+     * @brief      Listens on a free port of localhost.
+     */
+    bool listen();
+
+    /**
+     * @return     Base URL of the server, the host of a Kadi instance.
+     */
+    QString host() const;
+    QString token() const;
+
+    int addRecord(const QString& identifier, const QString& title = QString());
+    void removeRecord(int record);
+
+    /**
+     * @brief      Changes the modification date of the record, as editing
+     *             it or its files does.
+     */
+    void touchRecord(int record);
+
+    QString addFile(int record, const QString& name, const QByteArray& content,
+                    const QString& mimetype = "application/octet-stream");
+    void setFileContent(const QString& fileid, const QByteArray& content);
+    QString fileId(int record, const QString& name) const;
+    QByteArray fileContent(const QString& fileid) const;
+
+    /**
+     * @brief      Size of the chunks of new uploads.
+     */
+    void setChunkSize(qint64 bytes);
+
+    /**
+     * @return     Number of uploads which were neither finished nor deleted.
+     */
+    int pendingUploads() const;
+
+    /**
+     * @brief      Downloads send content not matching the checksum.
+     */
+    void setCorruptDownloads(bool corrupt);
+
+    /**
+     * @brief      Leaves the checksum out of the file metadata, downloads
+     *             can still be revalidated with the ETag.
+     */
+    void setChecksumsReported(bool reported);
+
+    void setRangeRequestsSupported(bool supported);
+
+    /**
+     * @brief      The next downloads close the connection after sending the
+     *             given number of bytes of the content.
+     */
+    void interruptDownloads(int count, qint64 afterbytes);
+
+    /**
+     * @brief      Answers requests with the part in their path with the
+     *             status, once the first skip of them went through. A
+     *             status of 0 closes the connection without an answer.
+     */
+    void failRequests(const QString& pathpart, int count, int status = 503, int skip = 0);
+
+    /**
+     * @brief      Largest number of items in a page, clients asking for
+     *             more get fewer like from Kadi.
+     */
+    void setMaximumPageSize(int items);
+
+    /**
+     * @brief      Pads the description of every record to the given size.
+     */
+    void setDescriptionSize(int bytes);
+
+    /**
+     * @brief      Answers every request only after the given time, while
+     *             other requests are served.
+     */
+    void setLatency(int msecs);
+
+    /**
+     * @return     Largest number of requests that were waiting for their
+     *             answer at the same time, counted while there is latency.
+     */
+    int maximumConcurrentRequests() const;
+
+    /**
+     * @return     Number of requests with the part in their path and, if
+     *             given, answered with the status.
+     */
+    int requests(const QString& pathpart = QString(), int status = 0) const;
+    void clearRequests();
+
+  private:
+    struct Request {
+      QByteArray method;
+      QString path;
+      QUrlQuery query;
+      QHash<QByteArray, QByteArray> headers;
+      QByteArray body;
+    };
+
+    struct Record {
+      QString identifier;
+      QString title;
+      QDateTime lastModified;
+    };
+
+    struct File {
+      QString id;
+      QString name;
+      int record;
+      QByteArray content;
+      QString mimetype;
+    };
+
+    struct Upload {
+      QString id;
+      QString name;
+      int record;
+      qint64 size;
+      QString replaces;
+      QMap<int, QByteArray> chunks;
+    };
+
+    struct Failure {
+      QString pathpart;
+      int count;
+      int status;
+      int skip;
+    };
+
+    void readRequests(QTcpSocket *socket);
+    void respond(QTcpSocket *socket, const Request& request);
+    void respondRecords(QTcpSocket *socket, const Request& request, const QStringList& parts);
+    void respondUploads(QTcpSocket *socket, const Request& request, const QString& uploadid);
+    void sendFile(QTcpSocket *socket, const Request& request, const File& file);
+    bool injectFailure(QTcpSocket *socket, const Request& request);
+    void send(QTcpSocket *socket, const Request& request, int status, const QByteArray& body,
+              const QList<QPair<QByteArray, QByteArray>>& headers = {});
+    void sendJson(QTcpSocket *socket, const Request& request, const QJsonObject& object, int status = 200);
+    void sendError(QTcpSocket *socket, const Request& request, int status, const QString& description = QString());
+
+    QJsonObject recordObject(int record) const;
+    QJsonObject fileObject(const File& file) const;
+    QJsonObject page(const Request& request, const QJsonArray& items) const;
+    QJsonObject uploadObject(const Upload& upload) const;
+    static QMap<QByteArray, QByteArray> formData(const Request& request);
+    static QByteArray etag(const File& file);
+
+    QTcpServer server;
+    QHash<QTcpSocket *, QByteArray> buffers;
+
+    QMap<int, Record> records;
+    QMap<QString, File> files;
+    QMap<QString, Upload> uploads;
+    int nextRecord;
+    qint64 chunkSize;
+    bool corruptDownloads;
+    bool checksumsReported;
+    bool rangeRequests;
+    int interruptedDownloads;
+    qint64 interruptAfter;
+    QList<Failure> failures;
+    int maximumPageSize;
+    int descriptionSize;
+    int latency;
+    int waiting;
+    int maximumWaiting;
+    QDateTime clock;
+
+    QList<LoggedRequest> log;
+};
@@ -0,0 +1,136 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include <QtTest/QTest>
+
+#include <plugins/application/workfloweditor/connectionindex.h>
+
+#include "test_connectionindex.h"
+
+/**
+ * Compares the adjacency index of the workflow editor against the scan over
+ * all connections it replaced, on a synthetic workflow of 5000 nodes and
+ * 20000 connections. Run with -tickcounter or -iterations n for more
+ * stable numbers.
+ */
+
+namespace {
+
+const NodeId NODES = 5000;
+const int CONNECTIONS = 20000;
+const PortIndex PORTS = 4;
+
+std::vector<ConnectionId> connection_ids;
+ConnectionIndex graph;
+
+// the implementation of WorkFlowGraphModel::connections() before the index
+std::unordered_set<ConnectionId> scan(const std::unordered_set<ConnectionId>& connectivity, NodeId nodeId,
+                                      PortType portType, PortIndex portIndex) {
+  std::unordered_set<ConnectionId> result;
+  std::copy_if(connectivity.begin(), connectivity.end(), std::inserter(result, std::end(result)),
+               [&](ConnectionId const& cid) {
+                 return portType == PortType::In ? cid.inNodeId == nodeId && cid.inPortIndex == portIndex
+                                                 : cid.outNodeId == nodeId && cid.outPortIndex == portIndex;
+               });
+  return result;
+}
+
+std::unordered_set<ConnectionId> scan(const std::unordered_set<ConnectionId>& connectivity, NodeId nodeId) {
+  std::unordered_set<ConnectionId> result;
+  std::copy_if(connectivity.begin(), connectivity.end(), std::inserter(result, std::end(result)),
+               [&](ConnectionId const& cid) { return cid.inNodeId == nodeId || cid.outNodeId == nodeId; });
+  return result;
+}
+
+}
+
+void TestConnectionIndex::initTestCase() {
+  // a layered, mostly forward directed graph like a large workflow
+  std::mt19937 random(42);
+  std::uniform_int_distribution<NodeId> node(0, NODES - 1);
+  std::uniform_int_distribution<PortIndex> port(0, PORTS - 1);
+
+  while (graph.size() < CONNECTIONS) {
+    NodeId from = node(random);
+    NodeId to = std::min<NodeId>(NODES - 1, from + 1 + node(random) % 50);
+    ConnectionId cid {from, port(random), to, port(random)};
+    if (graph.insert(cid)) {
+      connection_ids.push_back(cid);
+    }
+  }
+}
+
+void TestConnectionIndex::matchesScan() {
+  const auto& connectivity = graph.all();
+  for (NodeId nodeId = 0; nodeId < NODES; nodeId += 97) {
+    QCOMPARE(graph.all(nodeId), scan(connectivity, nodeId));
+    for (PortIndex portIndex = 0; portIndex < PORTS; ++portIndex) {
+      QCOMPARE(graph.connections(nodeId, PortType::In, portIndex),
+               scan(connectivity, nodeId, PortType::In, portIndex));
+      QCOMPARE(graph.connections(nodeId, PortType::Out, portIndex),
+               scan(connectivity, nodeId, PortType::Out, portIndex));
+    }
+  }
+}
+
+void TestConnectionIndex::eraseDropsNode() {
+  ConnectionIndex local;
+  ConnectionId first {1, 0, 2, 0};
+  ConnectionId second {1, 1, 3, 0};
+  QVERIFY(local.insert(first));
+  QVERIFY(!local.insert(first));
+  QVERIFY(local.insert(second));
+  QCOMPARE(local.connections(1, PortType::Out).size(), size_t(2));
+
+  QVERIFY(local.erase(first));
+  QVERIFY(!local.erase(first));
+  QVERIFY(!local.contains(first));
+  QVERIFY(local.connections(2, PortType::In).empty());
+  QCOMPARE(local.all(1), std::unordered_set<ConnectionId>({second}));
+
+  QVERIFY(local.erase(second));
+  QVERIFY(local.all(1).empty());
+  QCOMPARE(local.size(), size_t(0));
+}
+
+void TestConnectionIndex::benchmarkScan() {
+  // what AutoLayout and the validation do: visit the ports of every node once
+  const auto& connectivity = graph.all();
+  std::size_t visited = 0;
+  QBENCHMARK_ONCE {
+    for (NodeId nodeId = 0; nodeId < NODES; ++nodeId) {
+      visited += scan(connectivity, nodeId, PortType::Out, 0).size();
+      visited += scan(connectivity, nodeId).size();
+    }
+  }
+  QVERIFY(visited > 0);
+}
+
+void TestConnectionIndex::benchmarkIndex() {
+  std::size_t visited = 0;
+  QBENCHMARK {
+    for (NodeId nodeId = 0; nodeId < NODES; ++nodeId) {
+      visited += graph.connections(nodeId, PortType::Out, 0).size();
+      visited += graph.all(nodeId).size();
+    }
+  }
+  QVERIFY(visited > 0);
+}
+
+QTEST_GUILESS_MAIN(TestConnectionIndex)
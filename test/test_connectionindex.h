@@ -12,17 +12,20 @@
  * See the License for the specific language governing permissions and
  * limitations under the License. */
 
-#include "logcontextarea.h"
-#include "logtextwidget.h"
+#pragma once
 
-LogContextArea::LogContextArea(LogTextWidget* logTextWidget)
-    : QWidget(logTextWidget), logTextWidget(logTextWidget) {
-}
+#include <QObject>
 
-QSize LogContextArea::sizeHint() const {
-  return QSize(logTextWidget->getLogContextAreaWidth(), 0);
-}
+class TestConnectionIndex : public QObject {
 
-void LogContextArea::paintEvent(QPaintEvent* event) {
-  logTextWidget->logContextAreaPaintEvent(event);
-}
+    Q_OBJECT;
+
+    // executed tests
+  private slots:
+    void initTestCase();
+    void matchesScan();
+    void eraseDropsNode();
+    void benchmarkScan();
+    void benchmarkIndex();
+
+};
@@ -0,0 +1,248 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <QtTest/QTest>
+
+#include <framework/pluginframework/interfaceregistry.h>
+#include <framework/pluginframework/pluginclientinterface.h>
+
+#include "test_interfaceregistry.h"
+
+/**
+ * Looks up interfaces of simulated plugins through the InterfaceRegistry,
+ * the benchmark compares it to copying the interface map on each lookup
+ * like PluginManager::getInterfaces() does.
+ */
+
+using LibFramework::InterfaceContainer;
+using LibFramework::InterfaceHandle;
+using LibFramework::InterfaceRegistry;
+using LibFramework::PluginClientInterface;
+
+namespace {
+
+class FirstInterface : public PluginClientInterface {
+};
+
+class SecondInterface : public PluginClientInterface {
+};
+
+class ThirdInterface : public PluginClientInterface {
+};
+
+struct FakePlugin {
+  FakePlugin() : container(&first, &second, &third) {
+  }
+
+  FirstInterface first;
+  SecondInterface second;
+  ThirdInterface third;
+  InterfaceContainer container;
+};
+
+const int PLUGIN_COUNT = 64;
+
+std::string pluginNamespace(int i) {
+  return "/plugins/test/plugin" + std::to_string(i);
+}
+
+struct FakePlugins {
+  FakePlugins() {
+    for (int i = 0; i < PLUGIN_COUNT; ++i) {
+      plugins[pluginNamespace(i)] = std::make_unique<FakePlugin>();
+    }
+  }
+
+  InterfaceRegistry::Resolved resolve(const std::string& namespacepath) {
+    resolved++;
+    auto it = plugins.find(namespacepath);
+    if (it == plugins.end()) {
+      return {nullptr, true};
+    }
+    return {&it->second->container, stable.count(namespacepath) == 0};
+  }
+
+  // the former PluginManager::getInterface(), a prefix scan building a new map
+  template<typename T>
+  T getInterfaceByMap(const std::string& namespacepath) {
+    std::map<std::string, const InterfaceContainer*> interfaces;
+    std::vector<std::unique_ptr<InterfaceContainer>> containers;
+    for (const auto& [pluginnamespace, plugin] : plugins) {
+      if (pluginnamespace.compare(0, namespacepath.length(), namespacepath) == 0) {
+        containers.push_back(std::make_unique<InterfaceContainer>(&plugin->first, &plugin->second, &plugin->third));
+        interfaces[pluginnamespace] = containers.back().get();
+      }
+    }
+    const InterfaceContainer *const interfacecontainer = interfaces[namespacepath];
+    return interfacecontainer ? interfacecontainer->getInterface<T>() : nullptr;
+  }
+
+  std::map<std::string, std::unique_ptr<FakePlugin>> plugins;
+  std::set<std::string> stable;
+  std::atomic<int> resolved {0};
+};
+
+std::unique_ptr<FakePlugins> fakeplugins;
+std::unique_ptr<InterfaceRegistry> registry;
+
+template<typename T>
+InterfaceHandle<T> getHandle(const std::string& namespacepath) {
+  return InterfaceHandle<T>(registry.get(), registry->getSlot(namespacepath, typeid(T)));
+}
+
+}
+
+void TestInterfaceRegistry::init() {
+  fakeplugins = std::make_unique<FakePlugins>();
+  registry = std::make_unique<InterfaceRegistry>([] (const std::string& namespacepath) {
+    return fakeplugins->resolve(namespacepath);
+  });
+}
+
+void TestInterfaceRegistry::cachesLookups() {
+  const std::string namespacepath = pluginNamespace(3);
+  QCOMPARE(getHandle<SecondInterface*>(namespacepath).get(), &fakeplugins->plugins[namespacepath]->second);
+  QCOMPARE(fakeplugins->resolved.load(), 1);
+
+  QCOMPARE(getHandle<SecondInterface*>(namespacepath).get(), &fakeplugins->plugins[namespacepath]->second);
+  QCOMPARE(getHandle<ThirdInterface*>(namespacepath).get(), &fakeplugins->plugins[namespacepath]->third);
+  QCOMPARE(getHandle<SecondInterface*>(namespacepath).get(), &fakeplugins->plugins[namespacepath]->second);
+  QCOMPARE(fakeplugins->resolved.load(), 2);
+
+  QCOMPARE(registry->getSlot(namespacepath, typeid(SecondInterface*)),
+           registry->getSlot(namespacepath, typeid(SecondInterface*)));
+}
+
+void TestInterfaceRegistry::invalidatesOnChange() {
+  const std::string namespacepath = pluginNamespace(5);
+  InterfaceHandle<FirstInterface*> handle = getHandle<FirstInterface*>(namespacepath);
+  QCOMPARE(handle.get(), &fakeplugins->plugins[namespacepath]->first);
+
+  // the interfaces of a reloaded plugin may live somewhere else
+  fakeplugins->plugins[namespacepath] = std::make_unique<FakePlugin>();
+  registry->notify(namespacepath, InterfaceRegistry::loaded);
+  QCOMPARE(handle.get(), &fakeplugins->plugins[namespacepath]->first);
+  QCOMPARE(fakeplugins->resolved.load(), 2);
+}
+
+void TestInterfaceRegistry::resolvesUnstableInterfacesEachTime() {
+  const std::string namespacepath = pluginNamespace(7);
+  fakeplugins->stable.insert(namespacepath);
+  InterfaceHandle<FirstInterface*> handle = getHandle<FirstInterface*>(namespacepath);
+  QVERIFY(handle.get());
+  QVERIFY(handle.get());
+  QCOMPARE(fakeplugins->resolved.load(), 2);
+}
+
+void TestInterfaceRegistry::resolvesAddedPlugins() {
+  const std::string namespacepath = "/plugins/test/added";
+  InterfaceHandle<FirstInterface*> handle = getHandle<FirstInterface*>(namespacepath);
+  QVERIFY(!handle);
+  QVERIFY(!handle);
+  QCOMPARE(fakeplugins->resolved.load(), 1);
+
+  fakeplugins->plugins[namespacepath] = std::make_unique<FakePlugin>();
+  registry->notify(namespacepath, InterfaceRegistry::added);
+  QCOMPARE(handle.get(), &fakeplugins->plugins[namespacepath]->first);
+}
+
+void TestInterfaceRegistry::notifiesListeners() {
+  std::vector<std::pair<std::string, InterfaceRegistry::Change>> changes;
+  const int listener = registry->subscribe([&] (const std::string& namespacepath, InterfaceRegistry::Change change) {
+    changes.emplace_back(namespacepath, change);
+  });
+
+  registry->notify(pluginNamespace(1), InterfaceRegistry::loaded);
+  registry->notify(pluginNamespace(1), InterfaceRegistry::unloaded);
+  registry->unsubscribe(listener);
+  registry->notify(pluginNamespace(2), InterfaceRegistry::loaded);
+
+  QCOMPARE(changes.size(), std::size_t(2));
+  QCOMPARE(changes[0].first, pluginNamespace(1));
+  QCOMPARE(changes[0].second, InterfaceRegistry::loaded);
+  QCOMPARE(changes[1].second, InterfaceRegistry::unloaded);
+}
+
+void TestInterfaceRegistry::concurrentLookups() {
+  std::atomic<bool> stop {false};
+  std::atomic<int> failures {0};
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&, t] () {
+      std::vector<InterfaceHandle<ThirdInterface*>> handles;
+      for (int i = 0; i < PLUGIN_COUNT; ++i) {
+        handles.push_back(getHandle<ThirdInterface*>(pluginNamespace((i + t) % PLUGIN_COUNT)));
+      }
+      while (!stop) {
+        for (int i = 0; i < PLUGIN_COUNT; ++i) {
+          if (handles[i].get() != &fakeplugins->plugins[pluginNamespace((i + t) % PLUGIN_COUNT)]->third) {
+            failures++;
+          }
+        }
+      }
+    });
+  }
+  for (int i = 0; i < 1000; ++i) {
+    registry->notify(pluginNamespace(i % PLUGIN_COUNT), InterfaceRegistry::loaded);
+  }
+  stop = true;
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+  QCOMPARE(failures.load(), 0);
+}
+
+void TestInterfaceRegistry::benchmarkLookup_data() {
+  QTest::addColumn<QString>("lookup");
+  QTest::newRow("interface map") << "map";
+  QTest::newRow("cached") << "cached";
+  QTest::newRow("handle") << "handle";
+}
+
+void TestInterfaceRegistry::benchmarkLookup() {
+  QFETCH(QString, lookup);
+
+  std::vector<std::string> namespaces;
+  std::vector<InterfaceHandle<ThirdInterface*>> handles;
+  for (int i = 0; i < PLUGIN_COUNT; ++i) {
+    namespaces.push_back(pluginNamespace(i));
+    handles.push_back(getHandle<ThirdInterface*>(namespaces.back()));
+  }
+
+  const ThirdInterface *found = nullptr;
+  QBENCHMARK {
+    for (int i = 0; i < PLUGIN_COUNT; ++i) {
+      if (lookup == "map") {
+        found = fakeplugins->getInterfaceByMap<ThirdInterface*>(namespaces[i]);
+      } else if (lookup == "cached") {
+        found = getHandle<ThirdInterface*>(namespaces[i]).get();
+      } else {
+        found = handles[i].get();
+      }
+    }
+  }
+  QCOMPARE(found, &fakeplugins->plugins[namespaces.back()]->third);
+}
+
+QTEST_GUILESS_MAIN(TestInterfaceRegistry)
@@ -12,28 +12,25 @@
  * See the License for the specific language governing permissions and
  * limitations under the License. */
 
-#include "logline.h"
-#include "logcontent.h"
 
-std::string LogLineString::toString() const {
-  return log_content;
-}
+#pragma once
 
-void LogLineString::append(const std::string& string) {
-  log_content += string;
-}
+#include <QObject>
 
-char LogLineString::getLastChar() const {
-  if (!log_content.empty()) {
-    return log_content.back();
-  }
-  return (char) 0;
-}
+class TestInterfaceRegistry : public QObject {
 
-bool LogLineString::isEmpty() const {
-  return log_content.empty();
-}
+    Q_OBJECT;
 
-const std::string& LogLineString::getContext() const {
-  return parent.getContext();
-}
+    // executed tests
+  private slots:
+    void init();
+    void cachesLookups();
+    void invalidatesOnChange();
+    void resolvesUnstableInterfacesEachTime();
+    void resolvesAddedPlugins();
+    void notifiesListeners();
+    void concurrentLookups();
+    void benchmarkLookup_data();
+    void benchmarkLookup();
+
+};
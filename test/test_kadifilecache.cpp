@@ -0,0 +1,281 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <QtTest/QTest>
+#include <QDir>
+#include <QFile>
+#include <QTemporaryFile>
+
+#include <plugins/infrastructure/dialogs/fileopen/kadifiledialog/src/kadifilecache.h>
+#include <plugins/infrastructure/dialogs/fileopen/kadifiledialog/src/kadifilefetcher.h>
+#include <plugins/infrastructure/kadiintegration/src/transfer/kaditransfer.h>
+
+#include "test_kadifilecache.h"
+
+/**
+ * Fetches files of Kadi records through the local file cache from a mock
+ * Kadi server. The benchmarks compare downloading a 32 MB file, what every
+ * open cost before, with reopening it from the cache, which only asks the
+ * server for the checksum.
+ */
+
+namespace {
+
+const qint64 BENCHMARK_SIZE = 32 << 20;
+
+QByteArray content(char fill, qint64 size = 1000) {
+  return QByteArray(size, fill);
+}
+
+KadiTransferInterface* createTransfer(const KadiInstance& instance) {
+  return new KadiTransfer(instance);
+}
+
+QByteArray readAll(const QString& path) {
+  QFile file(path);
+  if (!file.open(QIODevice::ReadOnly)) return QByteArray();
+  return file.readAll();
+}
+
+}
+
+void TestKadiFileCache::init() {
+  dir = std::make_unique<QTemporaryDir>();
+  server = std::make_unique<MockKadiServer>();
+  QVERIFY(server->listen());
+
+  instance = {"mock", server->host(), server->token(), true};
+  record = server->addRecord("result-record");
+}
+
+QString TestKadiFileCache::cacheDirectory() const {
+  return dir->filePath("cache");
+}
+
+void TestKadiFileCache::downloadsOnce() {
+  server->addFile(record, "result.vtk", content('a'));
+
+  KadiFileCache cache(cacheDirectory());
+  KadiFileFetcher fetcher(&cache, createTransfer);
+  QString first = fetcher.fetch(instance, "result-record", "result.vtk");
+  QString second = fetcher.fetch(instance, "result-record", "result.vtk");
+
+  QVERIFY2(!first.isEmpty(), qPrintable(fetcher.errorString()));
+  QCOMPARE(second, first);
+  QCOMPARE(readAll(first), content('a'));
+  QCOMPARE(server->requests("/download"), 1);
+  QCOMPARE(server->requests("/identifier/"), 1);
+  QCOMPARE(cache.statistics().hits, 1);
+  QCOMPARE(cache.size(), qint64(1000));
+}
+
+void TestKadiFileCache::changedFileIsDownloadedAgain() {
+  QString fileid = server->addFile(record, "result.vtk", content('a'));
+
+  KadiFileCache cache(cacheDirectory());
+  KadiFileFetcher fetcher(&cache, createTransfer);
+  QString first = fetcher.fetch(instance, "result-record", "result.vtk");
+  server->setFileContent(fileid, content('b', 500));
+  QString second = fetcher.fetch(instance, "result-record", "result.vtk");
+
+  QVERIFY(second != first);
+  QCOMPARE(readAll(second), content('b', 500));
+  QCOMPARE(server->requests("/download"), 2);
+  // the outdated content is gone
+  QVERIFY(!QFile::exists(first));
+  QCOMPARE(cache.count(), 1);
+  QCOMPARE(cache.size(), qint64(500));
+}
+
+void TestKadiFileCache::identicalContentIsStoredOnce() {
+  int copy = server->addRecord("copied-record");
+  server->addFile(record, "result.vtk", content('a'));
+  server->addFile(copy, "copy.vtk", content('a'));
+
+  KadiFileCache cache(cacheDirectory());
+  KadiFileFetcher fetcher(&cache, createTransfer);
+  QString original = fetcher.fetch(instance, "result-record", "result.vtk");
+  QString copied = fetcher.fetch(instance, "copied-record", "copy.vtk");
+
+  QCOMPARE(copied, original);
+  QCOMPARE(cache.count(), 2);
+  QCOMPARE(cache.size(), qint64(1000));
+}
+
+void TestKadiFileCache::revalidatesWithEtag() {
+  QString fileid = server->addFile(record, "result.vtk", content('a'));
+  server->setChecksumsReported(false);
+
+  KadiFileCache cache(cacheDirectory());
+  KadiFileFetcher fetcher(&cache, createTransfer);
+  QString first = fetcher.fetch(instance, "result-record", "result.vtk");
+  QString second = fetcher.fetch(instance, "result-record", "result.vtk");
+
+  QCOMPARE(second, first);
+  QCOMPARE(server->requests("/download", 200), 1);
+  QCOMPARE(server->requests("/download", 304), 1);
+
+  server->setFileContent(fileid, content('b'));
+  QString third = fetcher.fetch(instance, "result-record", "result.vtk");
+  QCOMPARE(readAll(third), content('b'));
+  QCOMPARE(server->requests("/download", 200), 2);
+}
+
+void TestKadiFileCache::evictsLeastRecentlyUsed() {
+  server->addFile(record, "a.vtk", content('a'));
+  server->addFile(record, "b.vtk", content('b'));
+  server->addFile(record, "c.vtk", content('c'));
+
+  KadiFileCache cache(cacheDirectory(), 2500);
+  KadiFileFetcher fetcher(&cache, createTransfer);
+  fetcher.fetch(instance, "result-record", "a.vtk");
+  fetcher.fetch(instance, "result-record", "b.vtk");
+  fetcher.fetch(instance, "result-record", "a.vtk");
+  fetcher.fetch(instance, "result-record", "c.vtk");
+
+  QCOMPARE(cache.statistics().evictions, 1);
+  QCOMPARE(cache.count(), 2);
+  QCOMPARE(cache.size(), qint64(2000));
+
+  server->clearRequests();
+  fetcher.fetch(instance, "result-record", "a.vtk");
+  fetcher.fetch(instance, "result-record", "c.vtk");
+  QCOMPARE(server->requests("/download"), 0);
+  fetcher.fetch(instance, "result-record", "b.vtk");
+  QCOMPARE(server->requests("/download"), 1);
+}
+
+void TestKadiFileCache::corruptDownloadIsNotPublished() {
+  server->addFile(record, "result.vtk", content('a'));
+  server->setCorruptDownloads(true);
+
+  KadiFileCache cache(cacheDirectory());
+  KadiFileFetcher fetcher(&cache, createTransfer);
+  QVERIFY(fetcher.fetch(instance, "result-record", "result.vtk").isEmpty());
+  QVERIFY(!fetcher.errorString().isEmpty());
+  QCOMPARE(cache.count(), 0);
+  QCOMPARE(cache.size(), qint64(0));
+  QVERIFY(QDir(cacheDirectory() + "/blobs").isEmpty());
+  QVERIFY(QDir(cacheDirectory() + "/incoming").isEmpty());
+
+  server->setCorruptDownloads(false);
+  QCOMPARE(readAll(fetcher.fetch(instance, "result-record", "result.vtk")), content('a'));
+}
+
+void TestKadiFileCache::cacheSurvivesRestart() {
+  server->addFile(record, "result.vtk", content('a'));
+  QString first;
+  {
+    KadiFileCache cache(cacheDirectory());
+    KadiFileFetcher fetcher(&cache, createTransfer);
+    first = fetcher.fetch(instance, "result-record", "result.vtk");
+  }
+
+  // a download interrupted by a crash is published nowhere
+  QFile orphan(cacheDirectory() + "/blobs/0123456789abcdef0123456789abcdef");
+  QVERIFY(orphan.open(QIODevice::WriteOnly));
+  orphan.write("incomplete");
+  orphan.close();
+
+  KadiFileCache cache(cacheDirectory());
+  KadiFileFetcher fetcher(&cache, createTransfer);
+  QCOMPARE(fetcher.fetch(instance, "result-record", "result.vtk"), first);
+  QCOMPARE(server->requests("/download"), 1);
+  QCOMPARE(cache.size(), qint64(1000));
+  QVERIFY(!orphan.exists());
+}
+
+void TestKadiFileCache::changedContentIsNotServed() {
+  server->addFile(record, "result.vtk", content('a'));
+
+  KadiFileCache cache(cacheDirectory());
+  KadiFileFetcher fetcher(&cache, createTransfer);
+  QString cached = fetcher.fetch(instance, "result-record", "result.vtk");
+  QVERIFY(!(QFile::permissions(cached) & QFileDevice::WriteOwner));
+
+  // written anyway, by a user allowed to write read-only files
+  QFile::setPermissions(cached, QFile::permissions(cached) | QFileDevice::WriteOwner);
+  QFile file(cached);
+  QVERIFY(file.open(QIODevice::Append));
+  file.write("changed");
+  file.close();
+
+  QCOMPARE(readAll(fetcher.fetch(instance, "result-record", "result.vtk")), content('a'));
+  QCOMPARE(server->requests("/download"), 2);
+  QCOMPARE(cache.size(), qint64(1000));
+}
+
+void TestKadiFileCache::instancesShareTheIndex() {
+  server->addFile(record, "a.vtk", content('a'));
+  server->addFile(record, "b.vtk", content('b'));
+
+  // both instances read the index before the other one publishes
+  KadiFileCache first(cacheDirectory());
+  KadiFileCache second(cacheDirectory());
+  QCOMPARE(first.count(), 0);
+  QCOMPARE(second.count(), 0);
+  KadiFileFetcher firstfetcher(&first, createTransfer);
+  KadiFileFetcher secondfetcher(&second, createTransfer);
+  QVERIFY(!firstfetcher.fetch(instance, "result-record", "a.vtk").isEmpty());
+  QVERIFY(!secondfetcher.fetch(instance, "result-record", "b.vtk").isEmpty());
+  QVERIFY(!firstfetcher.fetch(instance, "result-record", "a.vtk").isEmpty());
+
+  KadiFileCache restarted(cacheDirectory());
+  KadiFileFetcher fetcher(&restarted, createTransfer);
+  QCOMPARE(restarted.count(), 2);
+  QCOMPARE(restarted.size(), qint64(2000));
+  server->clearRequests();
+  fetcher.fetch(instance, "result-record", "b.vtk");
+  QCOMPARE(server->requests("/download"), 0);
+}
+
+void TestKadiFileCache::unauthorizedRequestsFail() {
+  server->addFile(record, "result.vtk", content('a'));
+  instance.token = "wrong";
+
+  KadiFileCache cache(cacheDirectory());
+  KadiFileFetcher fetcher(&cache, createTransfer);
+  QVERIFY(fetcher.fetch(instance, "result-record", "result.vtk").isEmpty());
+  QVERIFY(!fetcher.errorString().isEmpty());
+  QCOMPARE(server->requests(QString(), 401), 1);
+}
+
+void TestKadiFileCache::benchmarkDownload() {
+  QString fileid = server->addFile(record, "result.vtk", content('a', BENCHMARK_SIZE));
+
+  KadiFileCache cache(cacheDirectory());
+  KadiFileFetcher fetcher(&cache, createTransfer);
+  QByteArray changing = content('a', BENCHMARK_SIZE);
+  char fill = 0;
+  QBENCHMARK {
+    // a new checksum every time, so that every open downloads
+    changing[0] = fill++;
+    server->setFileContent(fileid, changing);
+    QVERIFY(!fetcher.fetch(instance, "result-record", "result.vtk").isEmpty());
+  }
+}
+
+void TestKadiFileCache::benchmarkCachedOpen() {
+  server->addFile(record, "result.vtk", content('a', BENCHMARK_SIZE));
+
+  KadiFileCache cache(cacheDirectory());
+  KadiFileFetcher fetcher(&cache, createTransfer);
+  QVERIFY(!fetcher.fetch(instance, "result-record", "result.vtk").isEmpty());
+  QBENCHMARK {
+    QVERIFY(!fetcher.fetch(instance, "result-record", "result.vtk").isEmpty());
+  }
+  QCOMPARE(server->requests("/download"), 1);
+}
+
+QTEST_GUILESS_MAIN(TestKadiFileCache)
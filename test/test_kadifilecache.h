@@ -0,0 +1,53 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <memory>
+
+#include <QObject>
+#include <QTemporaryDir>
+
+#include <plugins/infrastructure/kadiconfig/kadiinstance.h>
+
+#include "mockkadiserver/mockkadiserver.h"
+
+class TestKadiFileCache : public QObject {
+
+    Q_OBJECT;
+
+    // executed tests
+  private slots:
+    void init();
+    void downloadsOnce();
+    void changedFileIsDownloadedAgain();
+    void identicalContentIsStoredOnce();
+    void revalidatesWithEtag();
+    void evictsLeastRecentlyUsed();
+    void corruptDownloadIsNotPublished();
+    void cacheSurvivesRestart();
+    void changedContentIsNotServed();
+    void instancesShareTheIndex();
+    void unauthorizedRequestsFail();
+    void benchmarkDownload();
+    void benchmarkCachedOpen();
+
+  private:
+    QString cacheDirectory() const;
+
+    std::unique_ptr<QTemporaryDir> dir;
+    std::unique_ptr<MockKadiServer> server;
+    KadiInstance instance;
+    int record;
+};
@@ -0,0 +1,305 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <functional>
+
+#include <QtTest/QTest>
+#include <QApplication>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QLineEdit>
+#include <QMessageBox>
+#include <QPushButton>
+#include <QTreeWidget>
+
+#include <plugins/infrastructure/dialogs/fileopen/kadifiledialog/src/kadifiledialog.h>
+
+#include "test_kadiintegration.h"
+
+/**
+ * Runs the Kadi dialogs against a mock Kadi server, with the Kadi
+ * configuration reading the instance of the server from a .kadiconfig
+ * in a temporary home directory. The dialogs are driven through their
+ * widgets while they are shown, message boxes are accepted as they pop
+ * up. Nothing needs a Kadi instance or kadi-apy.
+ */
+
+using LibFramework::InterfaceContainer;
+
+namespace {
+
+const QString WORKFLOW_MIMETYPE = "application/x-flow+json";
+
+// the interaction runs once the dialog is shown, a dialog still open afterwards is rejected
+void whenShown(const std::function<void(QDialog *)>& interaction) {
+  QTimer::singleShot(0, [interaction]() {
+    auto *dialog = qobject_cast<QDialog *>(QApplication::activeModalWidget());
+    if (!dialog) return;
+    interaction(dialog);
+    if (dialog->isVisible()) {
+      dialog->reject();
+    }
+  });
+}
+
+QPushButton *findButton(QWidget *dialog, const QString& text) {
+  for (QPushButton *button : dialog->findChildren<QPushButton *>()) {
+    if (button->text() == text) return button;
+  }
+  return nullptr;
+}
+
+QLineEdit *findFilterField(QWidget *dialog) {
+  for (QLineEdit *field : dialog->findChildren<QLineEdit *>()) {
+    if (field->placeholderText() == "Enter filter string") return field;
+  }
+  return nullptr;
+}
+
+QTreeWidgetItem *findItem(QTreeWidget *tree, const QString& text) {
+  QList<QTreeWidgetItem *> items = tree->findItems(text, Qt::MatchExactly | Qt::MatchRecursive, 0);
+  return items.isEmpty() ? nullptr : items.first();
+}
+
+int visibleRecords(QTreeWidget *tree) {
+  int count = 0;
+  for (int i = 0; i < tree->topLevelItemCount(); ++i) {
+    if (!tree->topLevelItem(i)->isHidden()) {
+      count++;
+    }
+  }
+  return count;
+}
+
+void click(QTreeWidget *tree, QTreeWidgetItem *item) {
+  tree->scrollToItem(item);
+  QTest::mouseClick(tree->viewport(), Qt::LeftButton, Qt::NoModifier, tree->visualItemRect(item).center());
+}
+
+QByteArray readAll(const QString& path) {
+  QFile file(path);
+  if (!file.open(QIODevice::ReadOnly)) return QByteArray();
+  return file.readAll();
+}
+
+}
+
+void TestKadiIntegration::initTestCase() {
+  originalHome = qgetenv("HOME");
+
+  // accepts the message boxes of the dialogs, or the first button which accepts if none is the default
+  messageBoxCloser.setInterval(50);
+  connect(&messageBoxCloser, &QTimer::timeout, this, [this]() {
+    auto *box = qobject_cast<QMessageBox *>(QApplication::activeModalWidget());
+    if (!box) return;
+
+    messages.append(box->text());
+    QAbstractButton *button = box->defaultButton();
+    for (QAbstractButton *candidate : box->buttons()) {
+      if (!button && box->buttonRole(candidate) == QMessageBox::AcceptRole) {
+        button = candidate;
+      }
+    }
+    if (button) {
+      button->click();
+    } else {
+      box->reject();
+    }
+  });
+}
+
+void TestKadiIntegration::init() {
+  // the Kadi configuration, the record catalog and the file cache live in the home directory
+  home = std::make_unique<QTemporaryDir>();
+  QVERIFY(home->isValid());
+  qputenv("HOME", QFile::encodeName(home->path()));
+
+  server = std::make_unique<MockKadiServer>();
+  QVERIFY(server->listen());
+
+  QFile config(home->filePath(".kadiconfig"));
+  QVERIFY(config.open(QIODevice::WriteOnly));
+  config.write("[global]\ndefault=mock\n\n[mock]\nhost=" + server->host().toUtf8() + "\npat=" + server->token().toUtf8() + "\n");
+  config.close();
+
+  pluginmanager = std::make_unique<FakePluginManager>();
+  kadiconfig = std::make_unique<KadiConfig>(pluginmanager.get());
+  kadiintegration = std::make_unique<KadiIntegration>(pluginmanager.get());
+  pluginmanager->addInterfaces("/plugins/infrastructure/kadiconfig", new InterfaceContainer(kadiconfig.get()));
+  pluginmanager->addInterfaces("/plugins/infrastructure/kadiintegration", new InterfaceContainer(kadiintegration.get()));
+
+  messages.clear();
+  messageBoxCloser.start();
+}
+
+void TestKadiIntegration::cleanup() {
+  messageBoxCloser.stop();
+  kadiintegration.reset();
+  kadiconfig.reset();
+  pluginmanager.reset();
+  server.reset();
+  home.reset();
+}
+
+void TestKadiIntegration::cleanupTestCase() {
+  qputenv("HOME", originalHome);
+}
+
+void TestKadiIntegration::addRecords(int count) {
+  for (int i = 0; i < count; ++i) {
+    server->addRecord(QString("record-%1").arg(i), QString("Simulation run %1").arg(i));
+  }
+}
+
+void TestKadiIntegration::testsInstance() {
+  addRecords(50);
+
+  QCOMPARE(KadiConfig::testKadiInstance(server->host(), server->token()), QString());
+  QVERIFY(!KadiConfig::testKadiInstance(server->host(), "invalid").isEmpty());
+
+  // a single record is listed, however many the instance has
+  QCOMPARE(server->requests("per_page=1", 200), 1);
+  QCOMPARE(server->requests("/api/records", 401), 1);
+}
+
+void TestKadiIntegration::testingSlowInstanceTimesOut() {
+  server->setLatency(3000);
+
+  QElapsedTimer timer;
+  timer.start();
+  QVERIFY(!KadiConfig::testKadiInstance(server->host(), server->token(), 200).isEmpty());
+  QVERIFY(timer.elapsed() < 3000);
+}
+
+void TestKadiIntegration::testingReportsClosedConnections() {
+  // more often than the network access manager sends a request again on its own
+  server->failRequests("/api/records", 10, 0);
+
+  QVERIFY(!KadiConfig::testKadiInstance(server->host(), server->token()).isEmpty());
+  QVERIFY(server->requests("/api/records") > 0);
+}
+
+void TestKadiIntegration::selectsRecordIdentifier() {
+  addRecords(150);
+  server->setMaximumPageSize(25);
+  server->setLatency(5);
+
+  std::unique_ptr<DownloadFromKadiDialogInterface> dialog(kadiintegration->createDownloadFromKadiDialog());
+  whenShown([](QDialog *shown) {
+    auto *tree = shown->findChild<QTreeWidget *>();
+    QTRY_COMPARE_WITH_TIMEOUT(tree->topLevelItemCount(), 150, 10000);
+
+    findFilterField(shown)->setText("record-42");
+    QCOMPARE(visibleRecords(tree), 1);
+
+    click(tree, findItem(tree, "record-42"));
+    findButton(shown, "Select Record")->click();
+  });
+  QVERIFY(dialog->showDialog(DLD_IDENTIFIER_MODE));
+
+  QCOMPARE(dialog->getLoadedFileName(), QString("kadi://mock/record-42/"));
+  QCOMPARE(dialog->getAllRecords().size(), qsizetype(150));
+  QCOMPARE(server->requests("/api/records?"), 6);
+}
+
+void TestKadiIntegration::showsStoredRecordsAtOnce() {
+  addRecords(150);
+
+  std::unique_ptr<DownloadFromKadiDialogInterface> dialog(kadiintegration->createDownloadFromKadiDialog());
+  whenShown([](QDialog *shown) {
+    QTRY_COMPARE_WITH_TIMEOUT(shown->findChild<QTreeWidget *>()->topLevelItemCount(), 150, 10000);
+  });
+  QVERIFY(!dialog->showDialog(DLD_IDENTIFIER_MODE));
+  if (QTest::currentTestFailed()) return;
+  dialog.reset();
+
+  // the records stored by the first dialog are listed while the server is still busy
+  server->setLatency(5000);
+  dialog.reset(kadiintegration->createDownloadFromKadiDialog());
+  whenShown([](QDialog *shown) {
+    QCOMPARE(shown->findChild<QTreeWidget *>()->topLevelItemCount(), 150);
+  });
+  QVERIFY(!dialog->showDialog(DLD_IDENTIFIER_MODE));
+}
+
+void TestKadiIntegration::listsLargeRecords() {
+  server->setDescriptionSize(128 << 10);
+  server->setMaximumPageSize(20);
+  addRecords(100);
+
+  std::unique_ptr<DownloadFromKadiDialogInterface> dialog(kadiintegration->createDownloadFromKadiDialog());
+  whenShown([](QDialog *shown) {
+    auto *tree = shown->findChild<QTreeWidget *>();
+    QTRY_COMPARE_WITH_TIMEOUT(tree->topLevelItemCount(), 100, 20000);
+    QVERIFY(tree->topLevelItem(0)->toolTip(0).size() > (128 << 10));
+  });
+  QVERIFY(!dialog->showDialog(DLD_IDENTIFIER_MODE));
+
+  QCOMPARE(server->requests("/api/records?"), 5);
+}
+
+void TestKadiIntegration::loadsFileThroughFileDialog() {
+  addRecords(30);
+  int record = server->addRecord("simulation");
+  server->addFile(record, "notes.txt", "notes", "text/plain");
+  QByteArray workflow = R"({"nodes": [], "connections": []})";
+  server->addFile(record, "solver.flow", workflow, WORKFLOW_MIMETYPE);
+
+  KadiFileDialog filedialog(pluginmanager.get());
+  filedialog.setFileMode(FileOpenDialogInterface::ExistingFile);
+  filedialog.applyFilter("Workflow Files (*.flow)");
+  whenShown([](QDialog *shown) {
+    auto *tree = shown->findChild<QTreeWidget *>();
+
+    // the records without a workflow are hidden once their files are known
+    QTRY_COMPARE_WITH_TIMEOUT(visibleRecords(tree), 1, 10000);
+    QTreeWidgetItem *record = findItem(tree, "simulation");
+    QVERIFY(record && !record->isHidden());
+
+    record->setExpanded(true);
+    QTRY_VERIFY(findItem(tree, "solver.flow"));
+    QVERIFY(findItem(tree, "notes.txt")->isHidden());
+
+    click(tree, findItem(tree, "solver.flow"));
+    findButton(shown, "Load Selected File")->click();
+  });
+  QVERIFY(filedialog.showFileOpenDialog());
+
+  QCOMPARE(filedialog.getFilePath(), QString("kadi://mock/simulation/solver.flow"));
+  QVERIFY(filedialog.validateAndLoadFilePath(filedialog.getFilePath()));
+  QCOMPARE(readAll(filedialog.getCachedFilePath()), workflow);
+}
+
+void TestKadiIntegration::uploadsThroughUploadDialog() {
+  int record = server->addRecord("simulation");
+  server->setChunkSize(1 << 20);
+  QByteArray workflow(3 << 20, 'w');
+
+  // the connection breaks on the second request to the upload, the transfer sends it again
+  server->failRequests("/api/uploads/", 1, 0, 1);
+
+  std::unique_ptr<UploadToKadiDialogInterface> dialog(kadiintegration->createUploadToKadiDialog());
+  whenShown([](QDialog *shown) {
+    findButton(shown, "Upload")->click();
+  });
+  QVERIFY(dialog->showDialog(workflow, ".flow", "solver", "simulation", "mock"));
+
+  QCOMPARE(dialog->getFileName(), QString("solver.flow"));
+  QCOMPARE(dialog->getRecordIdentifier(), QString("simulation"));
+  QCOMPARE(server->fileContent(server->fileId(record, "solver.flow")), workflow);
+  QCOMPARE(server->pendingUploads(), 0);
+  QVERIFY(messages.contains("Upload successful."));
+}
+
+QTEST_MAIN(TestKadiIntegration)
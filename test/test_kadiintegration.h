@@ -0,0 +1,61 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <memory>
+
+#include <QObject>
+#include <QStringList>
+#include <QTemporaryDir>
+#include <QTimer>
+
+#include <plugins/infrastructure/kadiconfig/src/kadiconfig.h>
+#include <plugins/infrastructure/kadiintegration/src/kadiintegration.h>
+
+#include "fakepluginmanager/fakepluginmanager.h"
+#include "mockkadiserver/mockkadiserver.h"
+
+class TestKadiIntegration : public QObject {
+
+    Q_OBJECT;
+
+    // executed tests
+  private slots:
+    void initTestCase();
+    void init();
+    void cleanup();
+    void cleanupTestCase();
+    void testsInstance();
+    void testingSlowInstanceTimesOut();
+    void testingReportsClosedConnections();
+    void selectsRecordIdentifier();
+    void showsStoredRecordsAtOnce();
+    void listsLargeRecords();
+    void loadsFileThroughFileDialog();
+    void uploadsThroughUploadDialog();
+
+  private:
+    void addRecords(int count);
+
+    QByteArray originalHome;
+    std::unique_ptr<QTemporaryDir> home;
+    std::unique_ptr<MockKadiServer> server;
+    std::unique_ptr<FakePluginManager> pluginmanager;
+    std::unique_ptr<KadiConfig> kadiconfig;
+    std::unique_ptr<KadiIntegration> kadiintegration;
+
+    QTimer messageBoxCloser;
+    QStringList messages;
+};
@@ -0,0 +1,275 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <QtTest/QSignalSpy>
+#include <QtTest/QTest>
+#include <QBuffer>
+#include <QCryptographicHash>
+#include <QFile>
+
+#include <plugins/infrastructure/kadiintegration/src/transfer/kaditransfer.h>
+
+#include "test_kaditransfer.h"
+
+/**
+ * Transfers files between a mock Kadi server and the file system. The
+ * benchmarks move 64 MB in each direction over the loopback device, with
+ * the 1 MB chunks of the mock server for uploads. Run with -iterations n
+ * for more stable numbers.
+ */
+
+namespace {
+
+const qint64 BENCHMARK_SIZE = 64 << 20;
+
+QByteArray content(qint64 size) {
+  // not repeating within a chunk, so that misplaced chunks are noticed
+  QByteArray data(size, Qt::Uninitialized);
+  quint32 state = 12345;
+  for (qint64 i = 0; i < size; ++i) {
+    state = state * 1103515245 + 12345;
+    data[i] = static_cast<char>(state >> 24);
+  }
+  return data;
+}
+
+QString checksum(const QByteArray& data) {
+  return QString::fromLatin1(QCryptographicHash::hash(data, QCryptographicHash::Md5).toHex());
+}
+
+QByteArray readAll(QFile& file) {
+  file.seek(0);
+  return file.readAll();
+}
+
+}
+
+void TestKadiTransfer::init() {
+  dir = std::make_unique<QTemporaryDir>();
+  server = std::make_unique<MockKadiServer>();
+  QVERIFY(server->listen());
+
+  instance = {"mock", server->host(), server->token(), true};
+  record = server->addRecord("transfer-record");
+}
+
+QString TestKadiTransfer::downloadUrl(const QString& fileid) const {
+  return server->host() + QString("/api/records/%1/files/%2/download").arg(record).arg(fileid);
+}
+
+void TestKadiTransfer::downloadStreamsToFile() {
+  QByteArray data = content(5 * KadiTransfer::BUFFER_SIZE + 17);
+  QString fileid = server->addFile(record, "result.vtk", data);
+
+  QFile target(dir->filePath("result.vtk"));
+  QVERIFY(target.open(QIODevice::ReadWrite));
+  KadiTransfer transfer(instance);
+  QSignalSpy progress(&transfer, &KadiTransfer::progress);
+
+  QVERIFY2(transfer.download(downloadUrl(fileid), &target, checksum(data)), qPrintable(transfer.errorString()));
+  QCOMPARE(readAll(target), data);
+  QCOMPARE(QString::fromLatin1(transfer.md5().toHex()), checksum(data));
+  QVERIFY(!transfer.etag().isEmpty());
+
+  QVERIFY(!progress.isEmpty());
+  QCOMPARE(progress.last().at(0).toLongLong(), data.size());
+  QCOMPARE(progress.last().at(1).toLongLong(), data.size());
+}
+
+void TestKadiTransfer::downloadResumesAfterInterruption() {
+  QByteArray data = content(3 << 20);
+  QString fileid = server->addFile(record, "result.vtk", data);
+  server->interruptDownloads(2, 1 << 20);
+
+  QFile target(dir->filePath("result.vtk"));
+  QVERIFY(target.open(QIODevice::ReadWrite));
+  KadiTransfer transfer(instance);
+
+  QVERIFY2(transfer.download(downloadUrl(fileid), &target, checksum(data)), qPrintable(transfer.errorString()));
+  QCOMPARE(readAll(target), data);
+  // the retries only asked for what was missing
+  QCOMPARE(server->requests("/download", 200), 1);
+  QCOMPARE(server->requests("/download", 206), 2);
+}
+
+void TestKadiTransfer::downloadContinuesPartialFile() {
+  QByteArray data = content(2 << 20);
+  QString fileid = server->addFile(record, "result.vtk", data);
+
+  QFile target(dir->filePath("result.vtk"));
+  QVERIFY(target.open(QIODevice::ReadWrite));
+  target.write(data.left(1 << 20));
+
+  KadiTransfer transfer(instance);
+  QVERIFY(transfer.download(downloadUrl(fileid), &target, checksum(data)));
+  QCOMPARE(readAll(target), data);
+  QCOMPARE(server->requests("/download", 206), 1);
+  QCOMPARE(QString::fromLatin1(transfer.md5().toHex()), checksum(data));
+}
+
+void TestKadiTransfer::downloadWithoutRangeSupport() {
+  QByteArray data = content(2 << 20);
+  QString fileid = server->addFile(record, "result.vtk", data);
+  server->setRangeRequestsSupported(false);
+  server->interruptDownloads(1, 1 << 20);
+
+  QFile target(dir->filePath("result.vtk"));
+  QVERIFY(target.open(QIODevice::ReadWrite));
+  KadiTransfer transfer(instance);
+  QVERIFY(transfer.download(downloadUrl(fileid), &target, checksum(data)));
+  QCOMPARE(readAll(target), data);
+  QCOMPARE(server->requests("/download", 200), 2);
+}
+
+void TestKadiTransfer::downloadChecksumMismatchStartsOver() {
+  QByteArray data = content(1000);
+  QString fileid = server->addFile(record, "result.vtk", data);
+  server->setCorruptDownloads(true);
+
+  QFile target(dir->filePath("result.vtk"));
+  QVERIFY(target.open(QIODevice::ReadWrite));
+  KadiTransfer transfer(instance);
+  QVERIFY(!transfer.download(downloadUrl(fileid), &target, checksum(data)));
+  QCOMPARE(transfer.state(), KadiTransfer::Failed);
+  QVERIFY(!transfer.errorString().isEmpty());
+
+  // resuming starts over instead of asking for a range after the corrupt bytes
+  server->setCorruptDownloads(false);
+  server->clearRequests();
+  transfer.resume();
+  transfer.wait();
+  QCOMPARE(transfer.state(), KadiTransfer::Finished);
+  QCOMPARE(readAll(target), data);
+  QCOMPARE(server->requests("/download", 200), 1);
+  QCOMPARE(server->requests("/download", 206), 0);
+}
+
+void TestKadiTransfer::uploadInChunks() {
+  server->setChunkSize(1 << 20);
+  QByteArray data = content((5 << 20) + 1234);
+  QBuffer source(&data);
+  QVERIFY(source.open(QIODevice::ReadOnly));
+
+  KadiTransfer transfer(instance);
+  QSignalSpy progress(&transfer, &KadiTransfer::progress);
+  QVERIFY2(transfer.upload("transfer-record", "upload.vtk", &source), qPrintable(transfer.errorString()));
+
+  QString fileid = server->fileId(record, "upload.vtk");
+  QVERIFY(!fileid.isEmpty());
+  QCOMPARE(server->fileContent(fileid), data);
+  QCOMPARE(server->requests("/api/uploads/", 200), 6);
+  QCOMPARE(server->pendingUploads(), 0);
+  QCOMPARE(progress.last().at(0).toLongLong(), data.size());
+}
+
+void TestKadiTransfer::uploadRetriesFailedChunks() {
+  server->setChunkSize(1 << 20);
+  server->failRequests("/api/uploads/", 2, 503, 1);
+  server->failRequests("/uploads", 1, 429);
+  QByteArray data = content(3 << 20);
+  QBuffer source(&data);
+  QVERIFY(source.open(QIODevice::ReadOnly));
+
+  KadiTransfer transfer(instance);
+  QVERIFY2(transfer.upload("transfer-record", "upload.vtk", &source), qPrintable(transfer.errorString()));
+  QCOMPARE(server->fileContent(server->fileId(record, "upload.vtk")), data);
+  QCOMPARE(server->requests(QString(), 503), 2);
+  QCOMPARE(server->requests(QString(), 429), 1);
+}
+
+void TestKadiTransfer::uploadResumesWithMissingChunks() {
+  server->setChunkSize(1 << 20);
+  QByteArray data = content(4 << 20);
+  QBuffer source(&data);
+  QVERIFY(source.open(QIODevice::ReadOnly));
+
+  // the third chunk fails more often than the transfer retries
+  KadiTransfer transfer(instance);
+  transfer.setMaximumRetries(1);
+  server->failRequests("/api/uploads/", 2, 503, 2);
+  QVERIFY(!transfer.upload("transfer-record", "upload.vtk", &source));
+  QCOMPARE(transfer.state(), KadiTransfer::Failed);
+  QCOMPARE(server->pendingUploads(), 1);
+
+  server->clearRequests();
+  transfer.resume();
+  transfer.wait();
+  QCOMPARE(transfer.state(), KadiTransfer::Finished);
+  QCOMPARE(server->fileContent(server->fileId(record, "upload.vtk")), data);
+  // status, the two missing chunks and finishing
+  QCOMPARE(server->requests("/api/uploads/"), 4);
+}
+
+void TestKadiTransfer::uploadConflictAndReplace() {
+  QString fileid = server->addFile(record, "upload.vtk", content(10));
+  QByteArray data = content(3000);
+  QBuffer source(&data);
+  QVERIFY(source.open(QIODevice::ReadOnly));
+
+  KadiTransfer transfer(instance);
+  QVERIFY(!transfer.upload("transfer-record", "upload.vtk", &source));
+  QCOMPARE(transfer.httpStatus(), 409);
+  QCOMPARE(server->fileContent(fileid), content(10));
+
+  QVERIFY(transfer.upload("transfer-record", "upload.vtk", &source, true));
+  QCOMPARE(server->fileId(record, "upload.vtk"), fileid);
+  QCOMPARE(server->fileContent(fileid), data);
+}
+
+void TestKadiTransfer::cancelDeletesUpload() {
+  server->setChunkSize(1 << 20);
+  QByteArray data = content(8 << 20);
+  QBuffer source(&data);
+  QVERIFY(source.open(QIODevice::ReadOnly));
+
+  KadiTransfer transfer(instance);
+  connect(&transfer, &KadiTransfer::progress, &transfer, [&transfer](qint64 done, qint64) {
+    if (done >= (2 << 20)) {
+      transfer.cancel();
+    }
+  });
+  QVERIFY(!transfer.upload("transfer-record", "upload.vtk", &source));
+  QCOMPARE(transfer.state(), KadiTransfer::Canceled);
+
+  // the upload is deleted before the transfer goes out of scope
+  transfer.wait();
+  QCOMPARE(server->requests("/api/uploads/", 204), 1);
+  QCOMPARE(server->pendingUploads(), 0);
+  QVERIFY(server->fileId(record, "upload.vtk").isEmpty());
+}
+
+void TestKadiTransfer::benchmarkDownload() {
+  QByteArray data = content(BENCHMARK_SIZE);
+  QString fileid = server->addFile(record, "result.vtk", data);
+
+  QBENCHMARK {
+    QFile target(dir->filePath("result.vtk"));
+    QVERIFY(target.open(QIODevice::ReadWrite | QIODevice::Truncate));
+    KadiTransfer transfer(instance);
+    QVERIFY(transfer.download(downloadUrl(fileid), &target, checksum(data)));
+  }
+}
+
+void TestKadiTransfer::benchmarkUpload() {
+  QByteArray data = content(BENCHMARK_SIZE);
+  QBuffer source(&data);
+  QVERIFY(source.open(QIODevice::ReadOnly));
+
+  QBENCHMARK {
+    KadiTransfer transfer(instance);
+    QVERIFY(transfer.upload("transfer-record", "upload.vtk", &source, true));
+  }
+}
+
+QTEST_GUILESS_MAIN(TestKadiTransfer)
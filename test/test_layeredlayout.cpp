@@ -0,0 +1,153 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <algorithm>
+#include <map>
+
+#include <QtTest/QTest>
+
+#include <plugins/application/workfloweditor/layeredlayout.h>
+
+#include "test_layeredlayout.h"
+
+/**
+ * Checks the layered layout of the workflow editor and measures it on
+ * generated graphs: long chains, wide fan-outs and diamond lattices. The
+ * benchmark sizes go up to 40000 nodes, which the former recursive auto
+ * layout could not finish for lattices.
+ */
+
+namespace {
+
+const QSizeF NODE_SIZE = {120, 60};
+const QPointF SPACING = {50, 5};
+
+enum Shape { CHAIN, FAN_OUT, LATTICE };
+
+void generate(LayeredLayout& layout, Shape shape, int size) {
+  switch (shape) {
+  case CHAIN:
+    for (int i = 0; i < size; ++i) {
+      layout.addNode(i, NODE_SIZE);
+      if (i > 0) layout.addEdge(i - 1, i);
+    }
+    break;
+  case FAN_OUT:
+    // one node feeding size nodes, which are all joined again
+    layout.addNode(0, NODE_SIZE);
+    layout.addNode(size + 1, NODE_SIZE);
+    for (int i = 1; i <= size; ++i) {
+      layout.addNode(i, NODE_SIZE);
+      layout.addEdge(0, i);
+      layout.addEdge(i, size + 1);
+    }
+    break;
+  case LATTICE:
+    // size x size grid, every node feeds its right and lower neighbour
+    for (int i = 0; i < size * size; ++i) {
+      layout.addNode(i, NODE_SIZE);
+    }
+    for (int row = 0; row < size; ++row) {
+      for (int column = 0; column < size; ++column) {
+        int node = row * size + column;
+        if (column + 1 < size) layout.addEdge(node, node + 1);
+        if (row + 1 < size) layout.addEdge(node, node + size);
+      }
+    }
+    break;
+  }
+}
+
+}
+
+void TestLayeredLayout::edgesPointForward() {
+  LayeredLayout layout;
+  generate(layout, LATTICE, 20);
+  auto positions = layout.compute(SPACING);
+
+  QCOMPARE(positions.size(), size_t(400));
+  QCOMPARE(layout.ranks().front(), 0);
+  QCOMPARE(layout.ranks().back(), 38);
+  for (int node = 0; node + 1 < 400; ++node) {
+    if ((node + 1) % 20 != 0) {
+      QVERIFY(positions[node].x() < positions[node + 1].x());
+    }
+  }
+}
+
+void TestLayeredLayout::sourcesPrecedeTheirUsers() {
+  LayeredLayout layout;
+  generate(layout, CHAIN, 5);
+  layout.addNode(10, NODE_SIZE, true);
+  layout.addEdge(10, 3);
+  layout.compute(SPACING);
+
+  QCOMPARE(layout.ranks()[5], 2);
+  QCOMPARE(layout.ranks()[3], 3);
+}
+
+void TestLayeredLayout::cyclesAreBroken() {
+  LayeredLayout layout;
+  generate(layout, CHAIN, 100);
+  layout.addEdge(99, 0);
+  auto positions = layout.compute(SPACING);
+
+  QCOMPARE(positions.size(), size_t(100));
+  QCOMPARE(layout.ranks()[99], 99);
+}
+
+void TestLayeredLayout::layersDoNotOverlap() {
+  LayeredLayout layout;
+  generate(layout, FAN_OUT, 50);
+  auto positions = layout.compute(SPACING);
+  QCOMPARE(layout.crossings(), 0LL);
+
+  std::map<qreal, std::vector<qreal>> columns;
+  for (const auto& [nodeId, position] : positions) {
+    QVERIFY(position.y() >= 0);
+    columns[position.x()].push_back(position.y());
+  }
+  QCOMPARE(columns.size(), size_t(3));
+  for (auto& [x, tops] : columns) {
+    std::sort(tops.begin(), tops.end());
+    for (std::size_t i = 1; i < tops.size(); ++i) {
+      QVERIFY(tops[i] - tops[i - 1] >= NODE_SIZE.height() + SPACING.y());
+    }
+  }
+}
+
+void TestLayeredLayout::benchmark_data() {
+  QTest::addColumn<int>("shape");
+  QTest::addColumn<int>("size");
+
+  QTest::newRow("chain 1000") << int(CHAIN) << 1000;
+  QTest::newRow("chain 40000") << int(CHAIN) << 40000;
+  QTest::newRow("fan-out 1000") << int(FAN_OUT) << 1000;
+  QTest::newRow("fan-out 40000") << int(FAN_OUT) << 40000;
+  QTest::newRow("lattice 30x30") << int(LATTICE) << 30;
+  QTest::newRow("lattice 200x200") << int(LATTICE) << 200;
+}
+
+void TestLayeredLayout::benchmark() {
+  QFETCH(int, shape);
+  QFETCH(int, size);
+
+  QBENCHMARK {
+    LayeredLayout layout;
+    generate(layout, static_cast<Shape>(shape), size);
+    layout.compute(SPACING);
+  }
+}
+
+QTEST_GUILESS_MAIN(TestLayeredLayout)
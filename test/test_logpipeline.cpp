@@ -0,0 +1,230 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <QtTest/QSignalSpy>
+#include <QtTest/QTest>
+#include <QtCore/QDir>
+#include <QtCore/QTemporaryDir>
+
+#include <plugins/application/logger/src/logfile.h>
+#include <plugins/application/logger/src/logpipeline.h>
+#include <plugins/application/logger/src/logqueue.h>
+#include <plugins/application/logger/src/logring.h>
+
+#include "test_logpipeline.h"
+
+/**
+ * Checks the logging pipeline of the logger plugin under heavy traffic from
+ * many threads and measures the throughput of the queue for different
+ * numbers of producers.
+ */
+
+namespace {
+
+/**
+ * Runs the producer on the given number of threads while the calling thread
+ * drains the queue.
+ * @return     The number of popped records.
+ */
+template<typename Producer>
+qint64 produceAndDrain(LogQueue& queue, int threads, Producer producer) {
+  std::atomic<int> running(threads);
+  std::vector<std::thread> producers;
+  for (int thread = 0; thread < threads; ++thread) {
+    producers.emplace_back([&, thread] {
+      producer(thread);
+      running--;
+    });
+  }
+
+  qint64 popped = 0;
+  LogRecord record;
+  while (running > 0 || queue.size() > 0) {
+    while (queue.pop(record)) {
+      popped++;
+    }
+  }
+  for (std::thread& thread : producers) {
+    thread.join();
+  }
+  return popped;
+}
+
+}
+
+void TestLogPipeline::queueKeepsProducerOrder() {
+  const int threads = 8;
+  const int records = 20000;
+  LogQueue queue(1024);
+
+  std::vector<int> last(threads, -1);
+  std::atomic<int> running(threads);
+  std::vector<std::thread> producers;
+  for (int thread = 0; thread < threads; ++thread) {
+    producers.emplace_back([&, thread] {
+      for (int i = 0; i < records; ++i) {
+        queue.push({QtDebugMsg, QString::number(thread), i});
+      }
+      running--;
+    });
+  }
+
+  bool ordered = true;
+  qint64 popped = 0;
+  LogRecord record;
+  while (running > 0 || queue.size() > 0) {
+    while (queue.pop(record)) {
+      int& previous = last[record.message.toInt()];
+      ordered = ordered && previous < record.time;
+      previous = record.time;
+      popped++;
+    }
+  }
+  for (std::thread& thread : producers) {
+    thread.join();
+  }
+
+  QVERIFY(ordered);
+  QCOMPARE(popped + qint64(queue.takeDropped()), qint64(threads) * records);
+}
+
+void TestLogPipeline::queueIsBounded() {
+  LogQueue queue(100);
+  int accepted = 0;
+  for (int i = 0; i < 150; ++i) {
+    accepted += queue.push({QtDebugMsg, "message", i});
+  }
+  QCOMPARE(accepted, 100);
+  QCOMPARE(queue.size(), std::size_t(100));
+  QCOMPARE(queue.takeDropped(), std::size_t(50));
+  QCOMPARE(queue.takeDropped(), std::size_t(0));
+
+  LogRecord record;
+  QVERIFY(queue.pop(record));
+  QCOMPARE(record.time, qint64(0));
+  QVERIFY(queue.push({QtDebugMsg, "message", 150}));
+}
+
+void TestLogPipeline::ringKeepsNewestLines() {
+  LogRing ring(3);
+  QVERIFY(!ring.append("1"));
+  QVERIFY(!ring.append("2"));
+  QVERIFY(!ring.append("3"));
+  QVERIFY(ring.append("4"));
+  QVERIFY(ring.append("5"));
+
+  QCOMPARE(ring.lineCount(), 3);
+  QCOMPARE(ring.lineText(0), QString("3"));
+  QCOMPARE(ring.lineText(2), QString("5"));
+
+  ring.clear();
+  QCOMPARE(ring.lineCount(), 0);
+}
+
+void TestLogPipeline::fileRotates() {
+  QTemporaryDir dir;
+  const QString file_name = dir.filePath("studio.log");
+  {
+    LogFile file(file_name, 100, 2);
+    QVERIFY(file.isOpen());
+    for (int i = 0; i < 20; ++i) {
+      file.write(QByteArray(40, char('a' + i)) + '\n');
+    }
+  }
+
+  QCOMPARE(QDir(dir.path()).entryList(QDir::Files).size(), 3);
+  QFile current(file_name);
+  QVERIFY(current.open(QIODevice::ReadOnly));
+  QVERIFY(current.size() <= 100);
+  QVERIFY(current.readAll().endsWith(QByteArray(40, char('a' + 19)) + '\n'));
+}
+
+void TestLogPipeline::multiLineMessages() {
+  LogPipeline pipeline(100, 100);
+  QSignalSpy flushed(&pipeline, &LogPipeline::flushed);
+
+  pipeline.post(QtWarningMsg, "first\nsecond");
+  pipeline.flush();
+
+  QCOMPARE(pipeline.lines().lineCount(), 2);
+  QVERIFY(pipeline.lines().lineText(0).contains("(WW)"));
+  QVERIFY(pipeline.lines().lineText(1).contains("second"));
+  QCOMPARE(flushed.size(), 1);
+}
+
+void TestLogPipeline::concurrentMessages() {
+  const int threads = 8;
+  const int messages = 20000;
+  QTemporaryDir dir;
+
+  LogPipeline pipeline(1000, 4096);
+  pipeline.setLogFile(std::make_unique<LogFile>(dir.filePath("studio.log")));
+  int flushes = 0;
+  connect(&pipeline, &LogPipeline::flushed, this, [&flushes] { flushes++; });
+  pipeline.install();
+
+  std::atomic<int> running(threads);
+  std::vector<std::thread> producers;
+  for (int thread = 0; thread < threads; ++thread) {
+    producers.emplace_back([&, thread] {
+      for (int i = 0; i < messages; ++i) {
+        qDebug() << "worker" << thread << "message" << i;
+      }
+      running--;
+    });
+  }
+  // the GUI thread keeps handling events while the workers log
+  QTRY_COMPARE_WITH_TIMEOUT(running.load(), 0, 60000);
+  for (std::thread& thread : producers) {
+    thread.join();
+  }
+  pipeline.flush();
+  pipeline.uninstall();
+
+  QCOMPARE(pipeline.received(), qint64(threads) * messages);
+  QCOMPARE(pipeline.lines().lineCount(), 1000);
+  QVERIFY(flushes > 0);
+  // flushes are coalesced, not one per message
+  QVERIFY(flushes < threads * messages / 10);
+}
+
+void TestLogPipeline::benchmarkThroughput_data() {
+  QTest::addColumn<int>("threads");
+
+  QTest::newRow("1 producer") << 1;
+  QTest::newRow("4 producers") << 4;
+  QTest::newRow("8 producers") << 8;
+}
+
+void TestLogPipeline::benchmarkThroughput() {
+  QFETCH(int, threads);
+  const int records = 100000;
+  const QString message("processed item of the current batch");
+
+  LogQueue queue(LogPipeline::QUEUE_CAPACITY);
+  qint64 popped = 0;
+  QBENCHMARK {
+    popped += produceAndDrain(queue, threads, [&](int) {
+      for (int i = 0; i < records; ++i) {
+        queue.push({QtDebugMsg, message, i});
+      }
+    });
+  }
+  QVERIFY(popped > 0);
+}
+
+QTEST_GUILESS_MAIN(TestLogPipeline)
@@ -0,0 +1,187 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <QtTest/QTest>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QTemporaryDir>
+
+#include <plugins/infrastructure/dialogs/logdialog/src/logstore.h>
+
+#include "test_logstore.h"
+
+/**
+ * Checks the line index of the log dialog and measures ingestion speed and
+ * index memory on a generated workflow log. The size of the log defaults to
+ * 8 MB to keep the regular test run short, KADISTUDIO_LOGSTORE_BENCHMARK_MB
+ * sets it for an actual measurement, e.g. 4096 for a multi-GB log.
+ */
+
+namespace {
+
+const std::string DEFAULT_CONTEXT = "Process Engine";
+
+void write(const QString& path, const QByteArray& data, QIODevice::OpenMode mode = QIODevice::Append) {
+  QFile file(path);
+  QVERIFY(file.open(QIODevice::WriteOnly | mode));
+  file.write(data);
+}
+
+QByteArray generateLines(int count, int offset = 0) {
+  QByteArray result;
+  for (int i = offset; i < offset + count; ++i) {
+    result += "node-" + QByteArray::number(i % 32) + ";[INFO] processed item " + QByteArray::number(i)
+              + " of the current batch, nothing to report\n";
+  }
+  return result;
+}
+
+}
+
+void TestLogStore::contextsAndMessages() {
+  QTemporaryDir dir;
+  const QString log = dir.filePath("log.txt");
+  write(log, "a;hello\nplain\n b ;x;y\n");
+
+  LogStore store(DEFAULT_CONTEXT);
+  QVERIFY(store.open(log));
+  auto [first, last] = store.update();
+  QCOMPARE(first, 0u);
+  QCOMPARE(last, 3u);
+
+  QCOMPARE(store.context(0), std::string("a"));
+  QCOMPARE(store.message(0), QString("hello\n"));
+  QCOMPARE(store.context(1), DEFAULT_CONTEXT);
+  QCOMPARE(store.message(1), QString("plain\n"));
+  QCOMPARE(store.context(2), std::string("b"));
+  QCOMPARE(store.message(2), QString("x;y\n"));
+  QVERIFY(store.isComplete(2));
+}
+
+void TestLogStore::incompleteLineGrows() {
+  QTemporaryDir dir;
+  const QString log = dir.filePath("log.txt");
+  write(log, {});
+
+  LogStore store(DEFAULT_CONTEXT);
+  QVERIFY(store.open(log));
+  QCOMPARE(store.update(), std::make_pair(0u, 0u));
+
+  write(log, "a;par");
+  QCOMPARE(store.update(), std::make_pair(0u, 1u));
+  QVERIFY(!store.isComplete(0));
+  QCOMPARE(store.message(0), QString("par"));
+
+  write(log, "tial\nb;next\n");
+  QCOMPARE(store.update(), std::make_pair(0u, 2u));
+  QVERIFY(store.isComplete(0));
+  QCOMPARE(store.message(0), QString("partial\n"));
+  QCOMPARE(store.context(1), std::string("b"));
+
+  // nothing new
+  bool reset = true;
+  QCOMPARE(store.update(&reset), std::make_pair(2u, 2u));
+  QVERIFY(!reset);
+}
+
+void TestLogStore::truncatedFileStartsOver() {
+  QTemporaryDir dir;
+  const QString log = dir.filePath("log.txt");
+  write(log, generateLines(100));
+
+  LogStore store(DEFAULT_CONTEXT);
+  QVERIFY(store.open(log));
+  QCOMPARE(store.update().second, 100u);
+
+  write(log, "a;restarted\n", QIODevice::Truncate);
+  // the mapping still covers the old size, but must not be read beyond the file anymore
+  QVERIFY(store.message(99).isEmpty());
+  bool reset = false;
+  QCOMPARE(store.update(&reset), std::make_pair(0u, 1u));
+  QVERIFY(reset);
+  QCOMPARE(store.message(0), QString("restarted\n"));
+}
+
+void TestLogStore::rewrittenFileStartsOver() {
+  QTemporaryDir dir;
+  const QString log = dir.filePath("log.txt");
+  write(log, generateLines(100));
+
+  LogStore store(DEFAULT_CONTEXT);
+  QVERIFY(store.open(log));
+  QCOMPARE(store.update().second, 100u);
+
+  // truncated and grown beyond the previous size before the next update
+  write(log, generateLines(200, 1000), QIODevice::Truncate);
+  QCOMPARE(store.update(), std::make_pair(0u, 200u));
+  QVERIFY(store.message(0).contains("item 1000 "));
+
+  // rotated, the old file is kept under another name
+  QVERIFY(QFile::rename(log, log + ".1"));
+  write(log, "a;rotated\n");
+  QCOMPARE(store.update(), std::make_pair(0u, 1u));
+  QCOMPARE(store.message(0), QString("rotated\n"));
+  write(log, "a;appended\n");
+  QCOMPARE(store.update(), std::make_pair(1u, 2u));
+}
+
+void TestLogStore::benchmarkIngestion() {
+  const qint64 size_mb = qEnvironmentVariableIsSet("KADISTUDIO_LOGSTORE_BENCHMARK_MB")
+                         ? qEnvironmentVariableIntValue("KADISTUDIO_LOGSTORE_BENCHMARK_MB") : 8;
+
+  QTemporaryDir dir;
+  const QString log = dir.filePath("log.txt");
+  {
+    QFile file(log);
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    const QByteArray block = generateLines(10000);
+    while (file.size() < size_mb * 1024 * 1024) {
+      file.write(block);
+    }
+  }
+
+  LogStore store(DEFAULT_CONTEXT);
+  QVERIFY(store.open(log));
+  QBENCHMARK_ONCE {
+    store.update();
+  }
+
+  const double bytes_per_line = double(store.indexMemory()) / store.lineCount();
+  qInfo("%u lines in %lld MB, index uses %.1f MB (%.1f bytes per line)", store.lineCount(), size_mb,
+        store.indexMemory() / (1024. * 1024.), bytes_per_line);
+
+  // 16 bytes per line plus the growth of the vector
+  QVERIFY(bytes_per_line <= 40);
+  QCOMPARE(store.context(store.lineCount() - 1), std::string("node-31"));
+  QVERIFY(store.message(store.lineCount() / 2).startsWith("[INFO] processed item"));
+}
+
+void TestLogStore::benchmarkAppend() {
+  QTemporaryDir dir;
+  const QString log = dir.filePath("log.txt");
+  write(log, generateLines(100000));
+
+  LogStore store(DEFAULT_CONTEXT);
+  QVERIFY(store.open(log));
+  store.update();
+
+  // appending to a large log costs only the appended part
+  int offset = 100000;
+  QBENCHMARK {
+    write(log, generateLines(100, offset));
+    offset += 100;
+    QCOMPARE(store.update().second, quint32(offset));
+  }
+}
+
+QTEST_GUILESS_MAIN(TestLogStore)
@@ -0,0 +1,126 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+#include <sstream>
+#include <thread>
+
+#include <QtCore/QLibrary>
+#include <QtTest/QTest>
+
+#include <framework/pluginframework/pluginmanager.h>
+
+#include "test_pluginloading.h"
+
+/**
+ * Loads a small graph of fake plugins through the plugin manager:
+ *
+ *   app -> base, tool, dialog (on demand)
+ *   tool -> base
+ *   dialog -> base
+ *
+ * and two plugins which require each other.
+ */
+
+using LibFramework::PluginManager;
+
+namespace {
+
+const std::vector<std::string> FAKE_PLUGINS {
+  FAKE_PLUGIN_APP, FAKE_PLUGIN_BASE, FAKE_PLUGIN_DIALOG, FAKE_PLUGIN_TOOL
+};
+
+}
+
+void TestPluginLoading::initTestCase() {
+  QVERIFY(PluginManager::getInstance()->addPlugins(FAKE_PLUGINS));
+}
+
+void TestPluginLoading::skipsKnownFiles() {
+  PluginManager *pluginmanager = PluginManager::getInstance();
+  QCOMPARE(pluginmanager->getPlugins("/plugins/test/").size(), std::size_t(4));
+  QVERIFY(pluginmanager->addPlugins(FAKE_PLUGINS));
+  QVERIFY(pluginmanager->addPlugin(FAKE_PLUGIN_APP));
+  QCOMPARE(pluginmanager->getPlugins("/plugins/test/").size(), std::size_t(4));
+}
+
+void TestPluginLoading::loadsDependenciesFirst() {
+  PluginManager *pluginmanager = PluginManager::getInstance();
+  QVERIFY(pluginmanager->load("/plugins/test/app"));
+
+  QVERIFY(pluginmanager->isLoaded("/plugins/test/app"));
+  QVERIFY(pluginmanager->isLoaded("/plugins/test/base"));
+  QVERIFY(pluginmanager->isLoaded("/plugins/test/tool"));
+  QVERIFY(!pluginmanager->isLoaded("/plugins/test/dialog"));
+
+  // static initializers of plugins run on the thread loading them
+  for (const char *file : {FAKE_PLUGIN_APP, FAKE_PLUGIN_BASE, FAKE_PLUGIN_TOOL}) {
+    QLibrary library(file);
+    auto *thread = reinterpret_cast<std::thread::id*>(library.resolve("fakePluginLoadingThread"));
+    QVERIFY(thread);
+    QVERIFY(*thread == std::this_thread::get_id());
+  }
+}
+
+void TestPluginLoading::loadsOnDemandWhenRequested() {
+  PluginManager *pluginmanager = PluginManager::getInstance();
+  pluginmanager->getInterfaces("/plugins/test/dialog");
+  QVERIFY(pluginmanager->isLoaded("/plugins/test/dialog"));
+}
+
+void TestPluginLoading::recordsTimings() {
+  PluginManager *pluginmanager = PluginManager::getInstance();
+  for (const LibFramework::Plugin *plugin : pluginmanager->getPlugins("/plugins/test/")) {
+    QVERIFY(plugin->getTimings().metadata.count() > 0);
+    QVERIFY(plugin->getTimings().library.count() > 0);
+  }
+
+  std::ostringstream timings;
+  pluginmanager->printLoadTimings(timings);
+  QVERIFY(timings.str().find("/plugins/test/dialog") != std::string::npos);
+}
+
+void TestPluginLoading::notifiesInterfaceChanges() {
+  PluginManager *pluginmanager = PluginManager::getInstance();
+  LibFramework::InterfaceRegistry *registry = pluginmanager->getInterfaceRegistry();
+
+  std::vector<std::pair<std::string, LibFramework::InterfaceRegistry::Change>> changes;
+  const int listener = registry->subscribe([&] (const std::string& namespacepath, LibFramework::InterfaceRegistry::Change change) {
+    changes.emplace_back(namespacepath, change);
+  });
+
+  pluginmanager->unload("/plugins/test/dialog");
+  // a lookup loads the plugin again
+  QVERIFY(!pluginmanager->getInterface<LibFramework::PluginClientInterface*>("/plugins/test/dialog"));
+  QVERIFY(pluginmanager->isLoaded("/plugins/test/dialog"));
+  registry->unsubscribe(listener);
+
+  QCOMPARE(changes.size(), std::size_t(2));
+  QCOMPARE(changes[0].first, std::string("/plugins/test/dialog"));
+  QCOMPARE(changes[0].second, LibFramework::InterfaceRegistry::unloaded);
+  QCOMPARE(changes[1].second, LibFramework::InterfaceRegistry::loaded);
+}
+
+void TestPluginLoading::loadsCyclicDependencies() {
+  PluginManager *pluginmanager = PluginManager::getInstance();
+  QVERIFY(pluginmanager->addPlugins({FAKE_PLUGIN_CYCLE_FIRST, FAKE_PLUGIN_CYCLE_SECOND}));
+
+  QVERIFY(pluginmanager->load("/plugins/cycle/first"));
+  QVERIFY(pluginmanager->isLoaded("/plugins/cycle/first"));
+  QVERIFY(pluginmanager->isLoaded("/plugins/cycle/second"));
+
+  pluginmanager->unload("/plugins/cycle/first");
+  QVERIFY(!pluginmanager->isLoaded("/plugins/cycle/first"));
+  QVERIFY(!pluginmanager->isLoaded("/plugins/cycle/second"));
+}
+
+QTEST_GUILESS_MAIN(TestPluginLoading)
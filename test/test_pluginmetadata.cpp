@@ -0,0 +1,101 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+#include <QtTest/QTest>
+
+#ifdef Q_OS_LINUX
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <framework/pluginframework/plugininfo/plugininterfacemacroreader.h>
+
+#include "test_pluginmetadata.h"
+
+/**
+ * Checks that the metadata section of a plugin holds the same entries as the
+ * scan finds and measures both lookups with a cold and a warm page cache, as
+ * on the first and on later launches.
+ */
+
+using LibFramework::PluginInterfaceMacroReader;
+
+namespace {
+
+/**
+ * Asks the kernel to drop the cached pages of the file, which is the closest
+ * to a cold launch without root privileges.
+ */
+void evictFromPageCache(const char *filename) {
+#ifdef Q_OS_LINUX
+  int file = open(filename, O_RDONLY);
+  if (file >= 0) {
+    fdatasync(file);
+    posix_fadvise(file, 0, 0, POSIX_FADV_DONTNEED);
+    close(file);
+  }
+#else
+  Q_UNUSED(filename);
+#endif
+}
+
+}
+
+void TestPluginMetadata::sectionMatchesScan() {
+  const PluginInterfaceMacroReader section(FAKE_PLUGIN);
+  const PluginInterfaceMacroReader scan(FAKE_PLUGIN, PluginInterfaceMacroReader::SCAN);
+
+#if defined(__ELF__)
+  QVERIFY(section.isFromSection());
+#endif
+  QVERIFY(!scan.isFromSection());
+
+  QCOMPARE(section.getClassName(), std::string("FakePlugin"));
+  QCOMPARE(section.getNamespace(), std::string("/plugins/test/fakeplugin"));
+  QCOMPARE(section.getRequiredNamespaces().size(), std::size_t(2));
+
+  QCOMPARE(section.getClassName(), scan.getClassName());
+  QCOMPARE(section.getAuthors(), scan.getAuthors());
+  QCOMPARE(section.getName(), scan.getName());
+  QCOMPARE(section.getDescription(), scan.getDescription());
+  QCOMPARE(section.getIcon(), scan.getIcon());
+  QCOMPARE(section.getNamespace(), scan.getNamespace());
+  QCOMPARE(section.getRequiredNamespaces(), scan.getRequiredNamespaces());
+}
+
+void TestPluginMetadata::benchmarkLookup_data() {
+  QTest::addColumn<bool>("scan");
+  QTest::addColumn<bool>("cold");
+
+  QTest::newRow("section, cold") << false << true;
+  QTest::newRow("section, warm") << false << false;
+  QTest::newRow("scan, cold") << true << true;
+  QTest::newRow("scan, warm") << true << false;
+}
+
+void TestPluginMetadata::benchmarkLookup() {
+  QFETCH(bool, scan);
+  QFETCH(bool, cold);
+
+  const auto lookup = scan ? PluginInterfaceMacroReader::SCAN : PluginInterfaceMacroReader::SECTION_OR_SCAN;
+  std::string name;
+  QBENCHMARK {
+    if (cold) {
+      evictFromPageCache(FAKE_PLUGIN);
+    }
+    name = PluginInterfaceMacroReader(FAKE_PLUGIN, lookup).getName();
+  }
+  QCOMPARE(name, std::string("Fake plugin"));
+}
+
+QTEST_GUILESS_MAIN(TestPluginMetadata)
@@ -0,0 +1,96 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <QtTest/QTest>
+#include <QtConcurrent/QtConcurrentMap>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+
+#include <plugins/infrastructure/workflows/processmanager/src/processmanagerclient.h>
+
+#include "test_processmanagerclient.h"
+
+void TestProcessManagerClient::init() {
+  qunsetenv("FAKE_PROCESS_MANAGER_NO_SESSION");
+  qunsetenv("FAKE_PROCESS_MANAGER_PROTOCOL");
+}
+
+void TestProcessManagerClient::sessionIsReused() {
+  ProcessManagerClient client(FAKE_PROCESS_MANAGER);
+
+  ShellResult first = client.execute({"pid"});
+  QCOMPARE(first.exit_code, 0);
+  QVERIFY(client.isSessionActive());
+
+  ShellResult started = client.execute({"start", "--no-color", "example.flow"});
+  QCOMPARE(started.exit_code, 0);
+  QCOMPARE(QJsonDocument::fromJson(started.stdout_result.toUtf8()).object()["id"].toInt(), 1);
+
+  // the workflow started above is only known to the same process
+  ShellResult status = client.execute({"status", "1"});
+  QCOMPARE(status.exit_code, 0);
+
+  ShellResult second = client.execute({"pid"});
+  QCOMPARE(second.stdout_result, first.stdout_result);
+}
+
+void TestProcessManagerClient::concurrentRequests() {
+  ProcessManagerClient client(FAKE_PROCESS_MANAGER);
+  client.execute({"start", "--no-color", "example.flow"});
+
+  QList<int> requests(200);
+  std::atomic<int> failures = 0;
+  QtConcurrent::blockingMap(requests, [&](int&) {
+    ShellResult result = client.execute({"list", "workflows"});
+    if (result.exit_code != 0 || QJsonDocument::fromJson(result.stdout_result.toUtf8()).array().size() != 1) {
+      failures++;
+    }
+  });
+  QCOMPARE(failures.load(), 0);
+}
+
+void TestProcessManagerClient::errorsArePropagated() {
+  ProcessManagerClient client(FAKE_PROCESS_MANAGER);
+
+  ShellResult result = client.execute({"status", "42"});
+  QVERIFY(result.exit_code != 0);
+  QVERIFY(!result.stderr_result.isEmpty());
+}
+
+void TestProcessManagerClient::fallbackWithoutSession() {
+  qputenv("FAKE_PROCESS_MANAGER_NO_SESSION", "1");
+  ProcessManagerClient client(FAKE_PROCESS_MANAGER);
+
+  ShellResult first = client.execute({"pid"});
+  QCOMPARE(first.exit_code, 0);
+  QVERIFY(!client.isSessionActive());
+
+  ShellResult second = client.execute({"pid"});
+  QVERIFY(second.stdout_result != first.stdout_result);
+}
+
+void TestProcessManagerClient::fallbackWithoutHandshake() {
+  // a process manager which keeps running without speaking the protocol
+  qputenv("FAKE_PROCESS_MANAGER_PROTOCOL", "none");
+  ProcessManagerClient silent(FAKE_PROCESS_MANAGER);
+  QCOMPARE(silent.execute({"pid"}).exit_code, 0);
+  QVERIFY(!silent.isSessionActive());
+
+  qputenv("FAKE_PROCESS_MANAGER_PROTOCOL", "2");
+  ProcessManagerClient newer(FAKE_PROCESS_MANAGER);
+  QCOMPARE(newer.execute({"pid"}).exit_code, 0);
+  QVERIFY(!newer.isSessionActive());
+}
+
+QTEST_GUILESS_MAIN(TestProcessManagerClient)
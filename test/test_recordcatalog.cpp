@@ -0,0 +1,276 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+#include <QtTest/QSignalSpy>
+#include <QtTest/QTest>
+
+#include <plugins/infrastructure/kadiintegration/src/catalog/recordcatalog.h>
+
+#include "test_recordcatalog.h"
+
+/**
+ * Fetches the records of a mock Kadi server into a catalog. The refresh
+ * benchmark lists 2000 records in pages of 20 from a server answering
+ * after 10 ms, one page at a time and side by side. The search benchmark
+ * looks through a catalog of 5000 records, the way the download dialog
+ * does on every key stroke.
+ */
+
+namespace {
+
+void addRecords(MockKadiServer& server, int count) {
+  for (int i = 0; i < count; ++i) {
+    server.addRecord(QString("record-%1").arg(i), QString("Simulation run %1").arg(i));
+  }
+}
+
+}
+
+void TestRecordCatalog::init() {
+  dir = std::make_unique<QTemporaryDir>();
+  server = std::make_unique<MockKadiServer>();
+  QVERIFY(server->listen());
+
+  instance = {"mock", server->host(), server->token(), true};
+}
+
+bool TestRecordCatalog::refresh(RecordCatalog& catalog) {
+  QSignalSpy finished(&catalog, &RecordCatalog::finished);
+  catalog.refresh();
+  if (!finished.wait(30000)) return false;
+  return finished.first().first().toBool();
+}
+
+void TestRecordCatalog::fetchesAllPages() {
+  addRecords(*server, 250);
+
+  RecordCatalog catalog(instance, dir->path());
+  QSignalSpy added(&catalog, &RecordCatalog::recordsAdded);
+  QVERIFY2(refresh(catalog), qPrintable(catalog.errorString()));
+
+  QCOMPARE(catalog.records().size(), qsizetype(250));
+  QCOMPARE(server->requests("/api/records?"), 3);
+  QCOMPARE(added.size(), qsizetype(3));
+
+  // every record once, with what the listing says about it
+  for (int i = 0; i < 250; ++i) {
+    int record = catalog.indexOf(QString("record-%1").arg(i));
+    QVERIFY(record >= 0);
+    QCOMPARE(catalog.records()[record].title, QString("Simulation run %1").arg(i));
+    QCOMPARE(catalog.records()[record].authorDisplayName, QString("Mock User"));
+    QVERIFY(catalog.records()[record].lastModified.isValid());
+  }
+}
+
+void TestRecordCatalog::limitsConcurrentRequests() {
+  addRecords(*server, 30);
+  server->setLatency(50);
+
+  RecordCatalog catalog(instance, dir->path());
+  catalog.setPageSize(1);
+  catalog.setMaximumConcurrentRequests(3);
+  QVERIFY(refresh(catalog));
+
+  QCOMPARE(catalog.records().size(), qsizetype(30));
+  QVERIFY(server->maximumConcurrentRequests() <= 3);
+  QVERIFY(server->maximumConcurrentRequests() >= 2);
+}
+
+void TestRecordCatalog::retriesThrottledPages() {
+  addRecords(*server, 50);
+  server->failRequests("/api/records?", 2, 429, 1);
+
+  RecordCatalog catalog(instance, dir->path());
+  catalog.setPageSize(10);
+  QVERIFY2(refresh(catalog), qPrintable(catalog.errorString()));
+
+  QCOMPARE(catalog.records().size(), qsizetype(50));
+  QCOMPARE(server->requests("/api/records?", 429), 2);
+  QCOMPARE(server->requests("/api/records?", 200), 5);
+}
+
+void TestRecordCatalog::prefetchesFiles() {
+  for (int i = 0; i < 5; ++i) {
+    int record = server->addRecord(QString("record-%1").arg(i));
+    server->addFile(record, "input.txt", "input", "text/plain");
+    server->addFile(record, "result.vtk", "result");
+  }
+
+  RecordCatalog catalog(instance, dir->path());
+  catalog.setFilesPrefetched(true);
+  QSignalSpy fetched(&catalog, &RecordCatalog::filesFetched);
+  QVERIFY(refresh(catalog));
+
+  QCOMPARE(fetched.size(), qsizetype(5));
+  for (const RecordInfo& record : catalog.records()) {
+    QVERIFY(record.filesAlreadyFetched);
+    QCOMPARE(record.files.size(), qsizetype(2));
+  }
+
+  // file names and mime types are searched as well
+  QCOMPARE(catalog.search("result.vtk").size(), qsizetype(5));
+  QCOMPARE(catalog.search(QString(), "text/plain").size(), qsizetype(5));
+  QCOMPARE(catalog.search(QString(), "image/png").size(), qsizetype(0));
+}
+
+void TestRecordCatalog::keepsFilesOfUnchangedRecords() {
+  QList<int> records;
+  for (int i = 0; i < 5; ++i) {
+    records.append(server->addRecord(QString("record-%1").arg(i)));
+    server->addFile(records.last(), "result.vtk", "result");
+  }
+
+  RecordCatalog catalog(instance, dir->path());
+  catalog.setFilesPrefetched(true);
+  QVERIFY(refresh(catalog));
+  QCOMPARE(server->requests("/files?"), 5);
+
+  server->clearRequests();
+  server->addFile(records[2], "changed.vtk", "changed");
+  QSignalSpy updated(&catalog, &RecordCatalog::recordUpdated);
+  QVERIFY(refresh(catalog));
+
+  QCOMPARE(server->requests("/files?"), 1);
+  QCOMPARE(updated.size(), qsizetype(1));
+  QCOMPARE(catalog.records()[catalog.indexOf("record-2")].files.size(), qsizetype(2));
+}
+
+void TestRecordCatalog::removesDeletedRecords() {
+  addRecords(*server, 20);
+  RecordCatalog catalog(instance, dir->path());
+  catalog.setPageSize(5);
+  QVERIFY(refresh(catalog));
+
+  server->removeRecord(server->addRecord("short-lived"));
+  server->removeRecord(1);
+  QSignalSpy reset(&catalog, &RecordCatalog::recordsReset);
+  QVERIFY(refresh(catalog));
+
+  QCOMPARE(reset.size(), qsizetype(1));
+  QCOMPARE(catalog.records().size(), qsizetype(19));
+  QCOMPARE(catalog.indexOf("record-0"), -1);
+  for (int record = 0; record < catalog.records().size(); ++record) {
+    QCOMPARE(catalog.indexOf(catalog.records()[record].identifier), record);
+  }
+
+  // nothing is removed while pages are missing
+  server->removeRecord(2);
+  server->failRequests("/api/records?", 1, 404, 1);
+  QVERIFY(!refresh(catalog));
+  QCOMPARE(reset.size(), qsizetype(1));
+  QVERIFY(catalog.indexOf("record-1") >= 0);
+}
+
+void TestRecordCatalog::catalogSurvivesRestart() {
+  int record = server->addRecord("stored-record", "Stored simulation");
+  server->addFile(record, "result.vtk", "result");
+
+  {
+    RecordCatalog catalog(instance, dir->path());
+    catalog.setFilesPrefetched(true);
+    QVERIFY(refresh(catalog));
+  }
+
+  server->clearRequests();
+  RecordCatalog restarted(instance, dir->path());
+  QCOMPARE(server->requests(), 0);
+  QCOMPARE(restarted.records().size(), qsizetype(1));
+
+  const RecordInfo& stored = restarted.records().first();
+  QCOMPARE(stored.identifier, QString("stored-record"));
+  QCOMPARE(stored.title, QString("Stored simulation"));
+  QVERIFY(stored.filesAlreadyFetched);
+  QCOMPARE(stored.files.size(), qsizetype(1));
+  QCOMPARE(stored.files.first().fileName, QString("result.vtk"));
+  QCOMPARE(restarted.search("stored simulation").size(), qsizetype(1));
+
+  // the files of an unchanged record are not listed again
+  restarted.setFilesPrefetched(true);
+  QVERIFY(refresh(restarted));
+  QCOMPARE(server->requests("/files?"), 0);
+
+  // other users of the instance have a catalog of their own
+  KadiInstance other = instance;
+  other.token = "othertoken";
+  RecordCatalog foreign(other, dir->path());
+  QVERIFY(foreign.records().isEmpty());
+}
+
+void TestRecordCatalog::searchesLocally() {
+  server->addRecord("mesh-2d", "Coarse mesh of the plate");
+  server->addRecord("mesh-3d", "Fine mesh of the plate");
+  server->addRecord("run-17", "Simulation of the fine plate");
+
+  RecordCatalog catalog(instance, dir->path());
+  QVERIFY(refresh(catalog));
+  server->clearRequests();
+
+  QCOMPARE(catalog.search(QString()).size(), qsizetype(3));
+  QCOMPARE(catalog.search("MESH").size(), qsizetype(2));
+  QCOMPARE(catalog.search("fine plate").size(), qsizetype(2));
+  QCOMPARE(catalog.search("\"fine plate\"").size(), qsizetype(1));
+  QCOMPARE(catalog.search("mesh 3d").size(), qsizetype(1));
+  QCOMPARE(catalog.search("mock user").size(), qsizetype(3));
+  QCOMPARE(catalog.search("nothing").size(), qsizetype(0));
+
+  // newest first, in the order of the listing
+  QVector<int> matches = catalog.search("mesh");
+  QCOMPARE(catalog.records()[matches.first()].identifier, QString("mesh-3d"));
+  QCOMPARE(server->requests(), 0);
+}
+
+void TestRecordCatalog::unauthorizedRequestsFail() {
+  addRecords(*server, 5);
+  instance.token = "wrongtoken";
+
+  RecordCatalog catalog(instance, dir->path());
+  QVERIFY(!refresh(catalog));
+  QVERIFY(!catalog.errorString().isEmpty());
+  QVERIFY(catalog.records().isEmpty());
+  QCOMPARE(server->requests("/api/records?", 401), 1);
+}
+
+void TestRecordCatalog::benchmarkRefresh_data() {
+  QTest::addColumn<int>("concurrency");
+  QTest::newRow("sequential") << 1;
+  QTest::newRow("concurrent") << RecordCatalog::DEFAULT_CONCURRENT_REQUESTS;
+}
+
+void TestRecordCatalog::benchmarkRefresh() {
+  QFETCH(int, concurrency);
+  addRecords(*server, 2000);
+  server->setLatency(10);
+
+  QBENCHMARK {
+    QTemporaryDir empty;
+    RecordCatalog catalog(instance, empty.path());
+    catalog.setPageSize(20);
+    catalog.setMaximumConcurrentRequests(concurrency);
+    QVERIFY(refresh(catalog));
+    QCOMPARE(catalog.records().size(), qsizetype(2000));
+  }
+}
+
+void TestRecordCatalog::benchmarkSearch() {
+  addRecords(*server, 5000);
+  RecordCatalog catalog(instance, dir->path());
+  QVERIFY(refresh(catalog));
+
+  QVector<int> matches;
+  QBENCHMARK {
+    matches = catalog.search("\"run 4711\"");
+  }
+  QCOMPARE(matches.size(), qsizetype(1));
+}
+
+QTEST_GUILESS_MAIN(TestRecordCatalog)
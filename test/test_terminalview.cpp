@@ -0,0 +1,279 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <algorithm>
+
+#include <QtTest/QTest>
+#include <QtWidgets/QScrollBar>
+
+#include <framework/enhanced/ansiparser.h>
+#include <framework/enhanced/coloredterminalwidget.h>
+#include <framework/enhanced/terminalview.h>
+
+#include "test_terminalview.h"
+
+/**
+ * Checks the virtualized terminal view and measures painting a frame and
+ * appending output for logs of different lengths. Both should stay flat
+ * with a growing number of lines.
+ */
+
+namespace {
+
+/**
+ * Lines computed from their number, so that even huge logs need no memory.
+ */
+class GeneratedLines : public TerminalLineSource {
+  public:
+    explicit GeneratedLines(int count) : count(count) {}
+
+    int lineCount() const override {
+      return count;
+    }
+    QString lineText(int line_number) const override {
+      return QString("\x1B[3%1mnode-%2\x1B[0m;[INFO] processed item %3 of the current batch")
+          .arg(line_number % 8).arg(line_number % 32).arg(line_number);
+    }
+
+  private:
+    int count;
+};
+
+/**
+ * The newest lines of an endless output, like the ring of the logger.
+ */
+class RotatingLines : public TerminalLineSource {
+  public:
+    explicit RotatingLines(int capacity) : reads(0), capacity(capacity), total(0) {}
+
+    int append(int lines) {
+      total += lines;
+      return std::max(0, std::min(lines, total - capacity));
+    }
+    int lineCount() const override {
+      return std::min(total, capacity);
+    }
+    QString lineText(int line_number) const override {
+      ++reads;
+      const int line = total - lineCount() + line_number;
+      // every line is wider than the ones before
+      return QString("line %1").arg(line) + QString(line, QLatin1Char('.'));
+    }
+
+    // number of lines read by the view
+    mutable int reads;
+
+  private:
+    int capacity;
+    int total;
+};
+
+QByteArray generateOutput(int lines) {
+  QByteArray result;
+  for (int i = 0; i < lines; ++i) {
+    result += "\x1B[32mok\x1B[0m step " + QByteArray::number(i) + " finished\n";
+  }
+  return result;
+}
+
+void showOffscreen(QWidget& widget) {
+  widget.setAttribute(Qt::WA_DontShowOnScreen);
+  widget.resize(800, 600);
+  widget.show();
+}
+
+}
+
+void TestTerminalView::parserSegments() {
+  QTextCharFormat format;
+  QStringList texts;
+  QList<QColor> colors;
+  int columns = AnsiParser::parseLine(u"\x1B[31mred\x1B[0m plain\tx\x1B[2K", format, {},
+                                      [&](const QString& text, const QTextCharFormat& segment_format) {
+    texts.append(text);
+    colors.append(segment_format.foreground().color());
+  });
+
+  QCOMPARE(texts, QStringList({"red", " plain       x"}));
+  QCOMPARE(colors.first(), QColor(Qt::darkRed));
+  QCOMPARE(columns, 17);
+  QCOMPARE(AnsiParser::plainText(u"\x1B[1;34mbold\x1B[m text\r"), QString("bold text"));
+}
+
+void TestTerminalView::formatCarriesOverLines() {
+  QTextCharFormat format;
+  AnsiParser::advance(u"\x1B[32mgreen starts here", format, {});
+  QCOMPARE(format.foreground().color(), QColor(Qt::darkGreen));
+  AnsiParser::advance(u"still green", format, {});
+  QCOMPARE(format.foreground().color(), QColor(Qt::darkGreen));
+  AnsiParser::advance(u"\x1B[0m", format, {});
+  QVERIFY(!format.hasProperty(QTextFormat::ForegroundBrush));
+}
+
+void TestTerminalView::selectionAndCopy() {
+  ColoredTerminalWidget widget;
+  widget.setTextTermFormatting("\x1B[31mfirst\x1B[0m line\nsecond ");
+  widget.setTextTermFormatting("line\r\nthird");
+  widget.setTextColor(Qt::blue);
+  widget.append("appended");
+
+  QCOMPARE(widget.getSource()->lineCount(), 4);
+  QCOMPARE(widget.toPlainText(), QString("first line\nsecond line\nthird\nappended"));
+
+  QVERIFY(!widget.hasSelection());
+  widget.selectAll();
+  QCOMPARE(widget.selectedText(), widget.toPlainText());
+  widget.clearSelection();
+  QVERIFY(widget.selectedText().isEmpty());
+
+  widget.clear();
+  QCOMPARE(widget.getSource()->lineCount(), 0);
+}
+
+void TestTerminalView::followsAppendedLines() {
+  ColoredTerminalWidget widget;
+  showOffscreen(widget);
+
+  widget.setTextTermFormatting(generateOutput(1000));
+  QVERIFY(widget.isFollowing());
+  QCOMPARE(widget.firstVisibleLine() + widget.visibleLineCount(), widget.getSource()->lineCount());
+
+  // scrolled up, new output must not move the view
+  widget.verticalScrollBar()->setValue(10);
+  QVERIFY(!widget.isFollowing());
+  widget.setTextTermFormatting(generateOutput(100));
+  QCOMPARE(widget.firstVisibleLine(), 10);
+
+  widget.scrollToBottom();
+  widget.setTextTermFormatting(generateOutput(100));
+  QVERIFY(widget.isFollowing());
+  QCOMPARE(widget.firstVisibleLine() + widget.visibleLineCount(), widget.getSource()->lineCount());
+}
+
+void TestTerminalView::bufferKeepsNewestLines() {
+  ColoredTerminalWidget widget;
+  showOffscreen(widget);
+  QCOMPARE(widget.getMaximumLineCount(), int(ColoredTerminalWidget::DEFAULT_MAXIMUM_LINE_COUNT));
+  widget.setMaximumLineCount(100);
+
+  // 250 lines and the empty one after the last newline
+  widget.setTextTermFormatting(generateOutput(250));
+  QCOMPARE(widget.getSource()->lineCount(), 100);
+  QVERIFY(widget.toPlainText().startsWith("ok step 151 finished\n"));
+  QVERIFY(widget.isFollowing());
+  QCOMPARE(widget.firstVisibleLine() + widget.visibleLineCount(), 100);
+
+  widget.setTextTermFormatting(generateOutput(10));
+  QCOMPARE(widget.getSource()->lineCount(), 100);
+  QVERIFY(widget.toPlainText().startsWith("ok step 161 finished\n"));
+
+  // lowering the limit drops the oldest lines right away
+  widget.setMaximumLineCount(10);
+  QCOMPARE(widget.getSource()->lineCount(), 10);
+  QVERIFY(widget.toPlainText().startsWith("ok step 1 finished\n"));
+}
+
+void TestTerminalView::followsRotatingSource() {
+  RotatingLines lines(200);
+  TerminalView view;
+  showOffscreen(view);
+  view.setSource(&lines);
+  lines.append(200);
+  view.linesChanged();
+  const int width = view.horizontalScrollBar()->maximum();
+
+  // scrolled up, the shown lines stay in place while older ones are dropped
+  view.verticalScrollBar()->setValue(100);
+  view.selectAll();
+  QVERIFY(view.selectedText().startsWith("line 0\n"));
+  view.linesDropped(lines.append(50));
+  QCOMPARE(view.firstVisibleLine(), 50);
+  QVERIFY(view.selectedText().startsWith("line 50."));
+  // the new lines are wider and must widen the view
+  QVERIFY(view.horizontalScrollBar()->maximum() > width);
+
+  // the selection is dropped together with its lines
+  view.linesDropped(lines.append(200));
+  QVERIFY(!view.hasSelection());
+  QCOMPARE(view.getSource()->lineCount(), 200);
+}
+
+void TestTerminalView::scansOnlyNewLinesOfFullRing() {
+  RotatingLines lines(20000);
+  TerminalView view;
+  view.setSource(&lines);
+  lines.append(20000);
+  view.linesChanged();
+  const int width = view.horizontalScrollBar()->maximum();
+
+  // like the flushes of the logger, which drop as many lines as they append
+  for (int flush = 0; flush < 10; ++flush) {
+    lines.reads = 0;
+    view.linesDropped(lines.append(100));
+    // the new lines and the last one, which may have grown
+    QCOMPARE(lines.reads, 101);
+  }
+  QVERIFY(view.horizontalScrollBar()->maximum() >= width);
+}
+
+void TestTerminalView::benchmarkPaint_data() {
+  QTest::addColumn<int>("lines");
+
+  QTest::newRow("1k lines") << 1000;
+  QTest::newRow("100k lines") << 100000;
+  QTest::newRow("10M lines") << 10000000;
+}
+
+void TestTerminalView::benchmarkPaint() {
+  QFETCH(int, lines);
+
+  GeneratedLines source(lines);
+  TerminalView view;
+  showOffscreen(view);
+  view.setSource(&source);
+
+  // only one format per checkpoint interval is kept
+  QVERIFY(view.indexMemory() <= 2 * (lines / TerminalView::CHECKPOINT_INTERVAL + 1) * sizeof(QTextCharFormat));
+
+  // a frame in the middle, just after a checkpoint, is the most expensive case
+  view.verticalScrollBar()->setValue(lines / 2 - 1);
+  QPixmap frame(view.viewport()->size());
+  QBENCHMARK {
+    view.viewport()->render(&frame);
+  }
+}
+
+void TestTerminalView::benchmarkAppend_data() {
+  QTest::addColumn<int>("lines");
+
+  QTest::newRow("1k lines") << 1000;
+  QTest::newRow("200k lines") << 200000;
+}
+
+void TestTerminalView::benchmarkAppend() {
+  QFETCH(int, lines);
+
+  ColoredTerminalWidget widget;
+  showOffscreen(widget);
+  widget.setTextTermFormatting(generateOutput(lines));
+
+  const QString chunk = generateOutput(10);
+  QPixmap frame(widget.viewport()->size());
+  QBENCHMARK {
+    widget.setTextTermFormatting(chunk);
+    widget.viewport()->render(&frame);
+  }
+}
+
+QTEST_MAIN(TestTerminalView)
@@ -0,0 +1,37 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QObject>
+
+class TestTerminalView : public QObject {
+
+    Q_OBJECT;
+
+    // executed tests
+  private slots:
+    void parserSegments();
+    void formatCarriesOverLines();
+    void selectionAndCopy();
+    void followsAppendedLines();
+    void bufferKeepsNewestLines();
+    void followsRotatingSource();
+    void scansOnlyNewLinesOfFullRing();
+    void benchmarkPaint_data();
+    void benchmarkPaint();
+    void benchmarkAppend_data();
+    void benchmarkAppend();
+
+};
@@ -0,0 +1,157 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <QtTest/QTest>
+#include <QDateTime>
+#include <QFile>
+
+#include <plugins/infrastructure/toolchooser/src/tooldata/toolcache.h>
+#include <plugins/infrastructure/toolchooser/src/tooldata/toolxmldata.h>
+
+#include "test_toolcache.h"
+
+void TestToolCache::init() {
+  dir = std::make_unique<QTemporaryDir>();
+  tool = dir->filePath("faketool");
+  cachefile = dir->filePath("cache.json");
+  writeTool("1.0");
+}
+
+void TestToolCache::writeTool(const QString& version) {
+  // every --xmlhelp call leaves a line in probes.txt
+  QFile file(tool);
+  QVERIFY(file.open(QIODevice::WriteOnly));
+  file.write(QString("#!/bin/sh\n"
+                     "echo probe >> '%1'\n"
+                     "echo '<program name=\"faketool\" version=\"%2\" description=\"fake\">"
+                     "<param name=\"input\" char=\"i\" type=\"file\"/></program>'\n")
+             .arg(dir->filePath("probes.txt"), version).toUtf8());
+  file.close();
+  file.setPermissions(QFile::ReadOwner | QFile::WriteOwner | QFile::ExeOwner);
+}
+
+int TestToolCache::probeCount() const {
+  QFile file(dir->filePath("probes.txt"));
+  if (!file.open(QIODevice::ReadOnly)) return 0;
+  return file.readAll().count('\n');
+}
+
+void TestToolCache::memoryHit() {
+  ToolXMLData toolxml(cachefile);
+  QVERIFY(toolxml.createToolDescription(tool));
+  QVERIFY(toolxml.createToolDescription(tool));
+
+  QCOMPARE(toolxml.Description().version(), QString("1.0"));
+  QCOMPARE(toolxml.Description().parameterVector().size(), 1);
+  QCOMPARE(toolxml.cacheStatistics().misses, 1);
+  QCOMPARE(toolxml.cacheStatistics().memory_hits, 1);
+  QCOMPARE(probeCount(), 1);
+}
+
+void TestToolCache::survivesRestart() {
+  {
+    ToolXMLData toolxml(cachefile);
+    QVERIFY(toolxml.createToolDescription(tool));
+  }
+
+  ToolXMLData toolxml(cachefile);
+  QVERIFY(toolxml.createToolDescription(tool));
+  QCOMPARE(toolxml.cacheStatistics().disk_hits, 1);
+  QCOMPARE(toolxml.cacheStatistics().misses, 0);
+  QCOMPARE(toolxml.Description().name(), QString("faketool"));
+  QCOMPARE(probeCount(), 1);
+}
+
+void TestToolCache::touchedExecutableIsRevalidated() {
+  {
+    ToolXMLData toolxml(cachefile);
+    QVERIFY(toolxml.createToolDescription(tool));
+  }
+
+  QFile file(tool);
+  QVERIFY(file.open(QIODevice::ReadWrite));
+  QVERIFY(file.setFileTime(QDateTime::currentDateTime().addSecs(60), QFileDevice::FileModificationTime));
+  file.close();
+
+  ToolXMLData toolxml(cachefile);
+  QVERIFY(toolxml.createToolDescription(tool));
+  QCOMPARE(toolxml.cacheStatistics().disk_hits, 1);
+  QCOMPARE(probeCount(), 1);
+}
+
+void TestToolCache::changedExecutableIsProbedAgain() {
+  ToolXMLData toolxml(cachefile);
+  QVERIFY(toolxml.createToolDescription(tool));
+
+  writeTool("2.0");
+  QFile file(tool);
+  QVERIFY(file.open(QIODevice::ReadWrite));
+  QVERIFY(file.setFileTime(QDateTime::currentDateTime().addSecs(60), QFileDevice::FileModificationTime));
+  file.close();
+
+  QVERIFY(toolxml.createToolDescription(tool));
+  QCOMPARE(toolxml.Description().version(), QString("2.0"));
+  QCOMPARE(toolxml.cacheStatistics().misses, 2);
+  QCOMPARE(probeCount(), 2);
+}
+
+void TestToolCache::unsupportedVersionIsDiscarded() {
+  QFile file(cachefile);
+  QVERIFY(file.open(QIODevice::WriteOnly));
+  file.write(QString("{\"version\": %1, \"entries\": {}}").arg(ToolCache::FORMAT_VERSION + 1).toUtf8());
+  file.close();
+
+  ToolXMLData toolxml(cachefile);
+  QVERIFY(toolxml.createToolDescription(tool));
+  QCOMPARE(toolxml.cacheStatistics().misses, 1);
+}
+
+void TestToolCache::instancesAreMerged() {
+  QString othertool = dir->filePath("othertool");
+  QVERIFY(QFile::copy(tool, othertool));
+
+  ToolCache first(cachefile);
+  ToolCache second(cachefile);
+  first.storeXml(tool, "<program name=\"faketool\"/>");
+  second.storeXml(othertool, "<program name=\"othertool\"/>");
+  // stores are written together, not one by one
+  QVERIFY(!QFile::exists(cachefile));
+
+  first.flush();
+  second.flush();
+  ToolCache restarted(cachefile);
+  QCOMPARE(restarted.getXml(tool).value_or(QString()), QString("<program name=\"faketool\"/>"));
+  QCOMPARE(restarted.getXml(othertool).value_or(QString()), QString("<program name=\"othertool\"/>"));
+}
+
+void TestToolCache::cachedDescriptionDoesNotProbe() {
+  ToolXMLData toolxml(cachefile);
+  QVERIFY(!toolxml.cachedToolDescription(tool));
+  QCOMPARE(probeCount(), 0);
+
+  {
+    ToolXMLData stored(cachefile);
+    QVERIFY(stored.createToolDescription(tool));
+  }
+  ToolXMLData restarted(cachefile);
+  std::optional<ToolDescription> tooldescription = restarted.cachedToolDescription(tool);
+  QVERIFY(tooldescription);
+  QCOMPARE(tooldescription->description(), QString("fake"));
+  QCOMPARE(tooldescription->parameterVector().size(), 1);
+  // the selected description stays untouched
+  QVERIFY(restarted.Description().name().isEmpty());
+  QCOMPARE(probeCount(), 1);
+}
+
+QTEST_GUILESS_MAIN(TestToolCache)
@@ -14,26 +14,29 @@
 
 #pragma once
 
-#include <QWidget>
+#include <QObject>
+#include <QTemporaryDir>
 
-class LogTextWidget;
+class TestToolCache : public QObject {
 
-/**
- * @brief      A side bar which allows to draw additional things next to each text block of a text widget derived from QTextEdit.
- *             See https://stackoverflow.com/a/24596246/3997725
- *             and https://doc.qt.io/qt-5/qtwidgets-widgets-codeeditor-example.html
- * @ingroup    src
- */
-class LogContextArea : public QWidget {
-    Q_OBJECT
+    Q_OBJECT;
 
-  public:
-    explicit LogContextArea(LogTextWidget* logTextWidget);
-    QSize sizeHint() const override;
-
-  protected:
-    void paintEvent(QPaintEvent* event) override;
+    // executed tests
+  private slots:
+    void init();
+    void memoryHit();
+    void survivesRestart();
+    void touchedExecutableIsRevalidated();
+    void changedExecutableIsProbedAgain();
+    void unsupportedVersionIsDiscarded();
+    void instancesAreMerged();
+    void cachedDescriptionDoesNotProbe();
 
   private:
-    LogTextWidget *logTextWidget;
+    void writeTool(const QString& version);
+    int probeCount() const;
+
+    std::unique_ptr<QTemporaryDir> dir;
+    QString tool;
+    QString cachefile;
 };
@@ -0,0 +1,169 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <random>
+
+#include <QtTest/QTest>
+
+#include <plugins/infrastructure/toolchooser/src/tooldata/toolsearchindex.h>
+
+#include "test_toolsearchindex.h"
+
+/**
+ * Compares the search index of the tool chooser against the substring scan
+ * over all tool names it replaced, with 10000 registered tools and a query
+ * typed character by character. Run with -tickcounter or -iterations n
+ * for more stable numbers.
+ */
+
+namespace {
+
+const int TOOLS = 10000;
+const QString TYPED = "mesh_smooth";
+
+QStringList toolnames;
+ToolSearchIndex searchindex;
+
+QStringList names(const std::vector<ToolSearchIndex::Match>& matches) {
+  QStringList result;
+  for (const auto& match : matches) {
+    result.append(match.name);
+  }
+  return result;
+}
+
+// the implementation of ToolChooserWidget::filterTools() before the index
+QStringList scan(const QStringList& toolnames, const QString& text) {
+  QStringList result;
+  for (const QString& toolname : toolnames) {
+    if (toolname.contains(text, Qt::CaseInsensitive)) {
+      result.append(toolname);
+    }
+  }
+  return result;
+}
+
+}
+
+void TestToolSearchIndex::initTestCase() {
+  const QStringList words {"mesh", "grid", "smooth", "image", "filter", "convert", "solver", "flow",
+                           "heat", "particle", "volume", "surface", "reduce", "map", "statistics"};
+  std::mt19937 random(42);
+  std::uniform_int_distribution<int> word(0, words.size() - 1);
+
+  for (int i = 0; i < TOOLS; ++i) {
+    QString toolname = QString("%1_%2%3").arg(words[word(random)], words[word(random)]).arg(i);
+    toolnames.append(toolname);
+    searchindex.insert(toolname);
+  }
+}
+
+void TestToolSearchIndex::rankedMatches() {
+  ToolSearchIndex local;
+  local.insert("mesh_smooth");
+  local.insert("smooth");
+  local.insert("MeshConvert");
+  local.insert("presmooth");
+
+  QCOMPARE(names(local.search("smooth")), QStringList({"smooth", "mesh_smooth", "presmooth"}));
+  QCOMPARE(names(local.search("MESH")), QStringList({"MeshConvert", "mesh_smooth"}));
+  QCOMPARE(names(local.search("sh_s")), QStringList({"mesh_smooth"}));
+  QCOMPARE(local.search("smooth").front().score, ToolSearchIndex::SCORE_EXACT);
+  QCOMPARE(local.search("").size(), std::size_t(4));
+  QVERIFY(local.search("xyz").empty());
+}
+
+void TestToolSearchIndex::descriptionsAndParameters() {
+  ToolSearchIndex local;
+  local.insert("mesh_smooth", "Smooths a triangle mesh", {"input", "iterations"});
+  local.insert("triangulate", "Creates a mesh");
+
+  QCOMPARE(names(local.search("triangle")), QStringList({"mesh_smooth"}));
+  QCOMPARE(local.search("triangle").front().score, ToolSearchIndex::SCORE_DESCRIPTION);
+  QCOMPARE(names(local.search("iter")), QStringList({"mesh_smooth"}));
+  QCOMPARE(local.search("iter").front().score, ToolSearchIndex::SCORE_PARAMETER);
+  // the name counts more than the description
+  QCOMPARE(names(local.search("tri")), QStringList({"triangulate", "mesh_smooth"}));
+}
+
+void TestToolSearchIndex::misspelledQuery() {
+  ToolSearchIndex local;
+  local.insert("normalize_image");
+  local.insert("convert_image");
+
+  QCOMPARE(names(local.search("nrmalize")), QStringList({"normalize_image"}));
+  QCOMPARE(local.search("nrmalize").front().score, ToolSearchIndex::SCORE_FUZZY * 5 / 6);
+  // no fuzzy matches as long as something matches exactly
+  QCOMPARE(names(local.search("image")), QStringList({"convert_image", "normalize_image"}));
+}
+
+void TestToolSearchIndex::incrementalUpdates() {
+  ToolSearchIndex local;
+  local.insert("smooth");
+  QVERIFY(local.contains("smooth"));
+  QVERIFY(local.search("triangle").empty());
+
+  // a description known later replaces the indexed text
+  local.insert("smooth", "Smooths a triangle mesh");
+  QCOMPARE(local.size(), std::size_t(1));
+  QCOMPARE(names(local.search("triangle")), QStringList({"smooth"}));
+
+  QVERIFY(local.remove("smooth"));
+  QVERIFY(!local.remove("smooth"));
+  QVERIFY(local.search("smooth").empty());
+
+  // enough removals rebuild the index
+  for (int i = 0; i < 200; ++i) {
+    local.insert(QString("tool%1").arg(i));
+  }
+  for (int i = 0; i < 150; ++i) {
+    QVERIFY(local.remove(QString("tool%1").arg(i)));
+  }
+  QCOMPARE(local.size(), std::size_t(50));
+  QCOMPARE(local.search("tool").size(), std::size_t(50));
+  QCOMPARE(names(local.search("tool199")), QStringList({"tool199"}));
+}
+
+void TestToolSearchIndex::matchesScan() {
+  for (int length = 1; length <= TYPED.size(); ++length) {
+    QString text = TYPED.left(length);
+    QStringList indexed = names(searchindex.search(text));
+    QStringList scanned = scan(toolnames, text);
+    indexed.sort();
+    scanned.sort();
+    QCOMPARE(indexed, scanned);
+  }
+}
+
+void TestToolSearchIndex::benchmarkScan() {
+  std::size_t found = 0;
+  QBENCHMARK {
+    for (int length = 1; length <= TYPED.size(); ++length) {
+      found += scan(toolnames, TYPED.left(length)).size();
+    }
+  }
+  QVERIFY(found > 0);
+}
+
+void TestToolSearchIndex::benchmarkIndex() {
+  std::size_t found = 0;
+  QBENCHMARK {
+    for (int length = 1; length <= TYPED.size(); ++length) {
+      found += searchindex.search(TYPED.left(length)).size();
+    }
+  }
+  QVERIFY(found > 0);
+}
+
+QTEST_GUILESS_MAIN(TestToolSearchIndex)
@@ -0,0 +1,145 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include <sstream>
+#include <thread>
+
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtTest/QTest>
+
+#include <framework/tracing/tracer.h>
+
+#include "test_tracing.h"
+
+using LibFramework::Tracer;
+
+namespace {
+
+QJsonArray writeEvents() {
+  std::ostringstream stream;
+  Tracer::write(stream);
+  QJsonParseError error;
+  QJsonDocument document = QJsonDocument::fromJson(QByteArray::fromStdString(stream.str()), &error);
+  if (error.error != QJsonParseError::NoError) {
+    qWarning() << error.errorString();
+  }
+  return document.object()["traceEvents"].toArray();
+}
+
+QJsonObject findEvent(const QJsonArray& events, const QString& name) {
+  for (const auto& event : events) {
+    if (event.toObject()["name"].toString() == name) {
+      return event.toObject();
+    }
+  }
+  return {};
+}
+
+}
+
+void TestTracing::init() {
+  Tracer::start();
+}
+
+void TestTracing::cleanup() {
+  Tracer::stop();
+}
+
+void TestTracing::recordsNestedSpans() {
+  {
+    TRACE_SCOPE("test", "outer");
+    {
+      TRACE_SCOPE("test", std::string("inner"));
+      std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    TRACE_INSTANT("test", "marker");
+  }
+
+  const QJsonArray events = writeEvents();
+  const QJsonObject outer = findEvent(events, "outer");
+  const QJsonObject inner = findEvent(events, "inner");
+  QCOMPARE(outer["ph"].toString(), QString("X"));
+  QCOMPARE(outer["cat"].toString(), QString("test"));
+  QCOMPARE(inner["tid"], outer["tid"]);
+  QVERIFY(inner["dur"].toInteger() >= 2000);
+  QVERIFY(inner["ts"].toInteger() >= outer["ts"].toInteger());
+  QVERIFY(inner["ts"].toInteger() + inner["dur"].toInteger() <= outer["ts"].toInteger() + outer["dur"].toInteger());
+  QCOMPARE(findEvent(events, "marker")["ph"].toString(), QString("i"));
+}
+
+void TestTracing::namesThreads() {
+  Tracer::setThreadName("main");
+  {
+    TRACE_SCOPE("test", "in main");
+  }
+  std::thread thread([] () {
+    Tracer::setThreadName("worker");
+    TRACE_SCOPE("test", "in worker");
+  });
+  thread.join();
+
+  const QJsonArray events = writeEvents();
+  const QJsonValue maintid = findEvent(events, "in main")["tid"];
+  const QJsonValue workertid = findEvent(events, "in worker")["tid"];
+  QVERIFY(maintid != workertid);
+
+  QStringList threadnames;
+  for (const auto& event : events) {
+    const QJsonObject object = event.toObject();
+    if (object["ph"].toString() == "M" && object["tid"] == workertid) {
+      threadnames.append(object["args"].toObject()["name"].toString());
+    }
+  }
+  QCOMPARE(threadnames, QStringList("worker"));
+}
+
+void TestTracing::escapesNames() {
+  const std::string name = "\"quoted\" \\path\\\nnext line";
+  {
+    TRACE_SCOPE("test", name);
+  }
+  QCOMPARE(findEvent(writeEvents(), QString::fromStdString(name))["ph"].toString(), QString("X"));
+}
+
+void TestTracing::recordsNothingWhenDisabled() {
+  Tracer::stop();
+  {
+    TRACE_SCOPE("test", "disabled");
+    TRACE_INSTANT("test", "disabled marker");
+  }
+  QCOMPARE(Tracer::getEventCount(), std::size_t(0));
+}
+
+void TestTracing::benchmarkSpan_data() {
+  QTest::addColumn<bool>("enabled");
+  QTest::newRow("disabled") << false;
+  QTest::newRow("enabled") << true;
+}
+
+void TestTracing::benchmarkSpan() {
+  QFETCH(bool, enabled);
+  if (!enabled) {
+    Tracer::stop();
+  }
+
+  const std::string name = "/plugins/infrastructure/workflows/processmanager";
+  QBENCHMARK {
+    TRACE_SCOPE("benchmark", name);
+  }
+}
+
+QTEST_GUILESS_MAIN(TestTracing)
@@ -0,0 +1,101 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <memory>
+#include <vector>
+
+#include <QtTest/QTest>
+#include <QtWidgets/QLineEdit>
+
+#include <properties/data/properties/container/matrixproperty.h>
+#include <properties/data/properties/container/vectorproperty.h>
+#include <plugins/infrastructure/qpropertywidgetfactory/src/widgets/qvtiwidget_double.h>
+#include <plugins/infrastructure/qpropertywidgetfactory/src/widgets/qvtiwidget_matrix_lineedit.h>
+#include <plugins/infrastructure/qpropertywidgetfactory/src/widgets/qvtiwidget_vector_lineedit.h>
+
+#include "test_vectorlineedit.h"
+
+/**
+ * Types into the line edits of vector and matrix properties key by key.
+ * The text does not parse until it is complete, the property keeps its
+ * value until then instead of the parse error escaping the Qt slot.
+ * The widgets of single elements outlive the elements removed by
+ * shrinking the value.
+ */
+
+namespace {
+
+void retype(QLineEdit *lineedit, const QString& text) {
+  lineedit->selectAll();
+  QTest::keyClick(lineedit, Qt::Key_Delete);
+  QTest::keyClicks(lineedit, text);
+}
+
+}
+
+void TestVectorLineEdit::typesIncompleteVector() {
+  VectorProperty<double> property("vector", std::vector<double> {1, 2});
+  QVTIWidget_Vector_lineedit widget(&property);
+  widget.synchronizeVTI();
+  auto *lineedit = qobject_cast<QLineEdit *>(widget.getWidget());
+  QCOMPARE(lineedit->text(), QString("(1,2)"));
+
+  retype(lineedit, "(3,");
+  QCOMPARE(lineedit->text(), QString("(3,"));
+  QCOMPARE(property.getValue(), (std::vector<double> {1, 2}));
+
+  QTest::keyClicks(lineedit, "x)");
+  QCOMPARE(property.getValue(), (std::vector<double> {1, 2}));
+
+  retype(lineedit, "(3,4.5)");
+  QCOMPARE(property.getValue(), (std::vector<double> {3, 4.5}));
+}
+
+void TestVectorLineEdit::typesIncompleteMatrix() {
+  MatrixProperty<int> property("matrix", true, MatrixProperty<int>::matrix_t {{1, 2}});
+  QVTIWidget_Matrix_lineedit widget(&property);
+  widget.synchronizeVTI();
+  auto *lineedit = qobject_cast<QLineEdit *>(widget.getWidget());
+
+  retype(lineedit, "[(1,2),(3");
+  QCOMPARE(property.getValue(), (MatrixProperty<int>::matrix_t {{1, 2}}));
+
+  retype(lineedit, "[(1,2),(3,4)]");
+  QCOMPARE(property.getValue(), (MatrixProperty<int>::matrix_t {{1, 2}, {3, 4}}));
+}
+
+void TestVectorLineEdit::shrinkingDisablesElementWidgets() {
+  VectorProperty<double> property("vector", std::vector<double> {1, 2, 3});
+  // one widget per element, as the property widget factory builds a container panel
+  std::vector<std::unique_ptr<QVTIWidget_double>> widgets;
+  for (auto iter = property.begin(); iter != property.end(); iter++) {
+    widgets.push_back(std::make_unique<QVTIWidget_double>(*iter));
+    widgets.back()->synchronizeVTI();
+  }
+
+  property.setValue({4});
+  QVERIFY(widgets[0]->isEnabled());
+  QVERIFY(!widgets[2]->isEnabled());
+  QVERIFY(!widgets[2]->getValueTypeInterface());
+
+  // editing the widget of a removed element must not touch the value
+  widgets[2]->getWidget()->findChild<QLineEdit *>()->setText("5");
+  widgets[2]->resetDefault();
+  QCOMPARE(property.getValue(), (std::vector<double> {4}));
+
+  widgets[0]->getWidget()->findChild<QLineEdit *>()->setText("6");
+  QCOMPARE(property.getValue(), (std::vector<double> {6}));
+}
+
+QTEST_MAIN(TestVectorLineEdit)
@@ -0,0 +1,150 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <algorithm>
+
+#include <QtTest/QTest>
+#include <QtCore/QFile>
+#include <QtCore/QTemporaryDir>
+#include <QtWidgets/QWidget>
+
+#include <plugins/infrastructure/workflows/processmanager/src/processmanagerclient.h>
+#include <plugins/infrastructure/workflows/processmanager/src/workfloweventsource.h>
+
+#include "test_workflowevents.h"
+
+namespace {
+
+int count(const std::vector<WorkflowEvent>& events, WorkflowEvent::Type type) {
+  return std::count_if(events.begin(), events.end(), [type](const auto& event) { return event.type == type; });
+}
+
+}
+
+void TestWorkflowEvents::init() {
+  qunsetenv("FAKE_PROCESS_MANAGER_NO_SESSION");
+  qunsetenv("FAKE_PROCESS_MANAGER_WORKFLOWS");
+  qunsetenv("FAKE_PROCESS_MANAGER_STATE");
+  qunsetenv("FAKE_PROCESS_MANAGER_LOG_DIR");
+}
+
+void TestWorkflowEvents::replayRecordedTrace() {
+  WorkflowEventSource source(nullptr);
+  QObject receiver;
+  std::vector<WorkflowEvent> events;
+  source.subscribe(&receiver, [&events](const WorkflowEvent& event) { events.push_back(event); });
+
+  QFile trace(QFINDTESTDATA("data/workflowevents.trace"));
+  QVERIFY(trace.open(QIODevice::ReadOnly));
+  QCOMPARE(source.replay(&trace), 11);
+
+  QTRY_COMPARE(events.size(), size_t(8));
+  QCOMPARE(count(events, WorkflowEvent::STATE_CHANGED), 5);
+  QCOMPARE(count(events, WorkflowEvent::INTERACTIONS_CHANGED), 1);
+  QCOMPARE(count(events, WorkflowEvent::LOG_GROWN), 2);
+
+  // deltas arrive in the recorded order
+  QCOMPARE(events.back().type, WorkflowEvent::STATE_CHANGED);
+  QCOMPARE(events.back().workflow["state"].toString(), QString("Finished"));
+}
+
+void TestWorkflowEvents::pushedBySession() {
+  ProcessManagerClient client(FAKE_PROCESS_MANAGER);
+  WorkflowEventSource source(&client);
+  QObject receiver;
+  std::vector<WorkflowEvent> events;
+  source.subscribe(&receiver, [&events](const WorkflowEvent& event) { events.push_back(event); });
+
+  QTRY_VERIFY(source.isPushing());
+
+  QCOMPARE(client.execute({"start", "--no-color", "example.flow"}).exit_code, 0);
+  QTRY_COMPARE(count(events, WorkflowEvent::STATE_CHANGED), 1);
+
+  QCOMPARE(client.execute({"advance", "1", "Needs_interaction"}).exit_code, 0);
+  QTRY_COMPARE(count(events, WorkflowEvent::INTERACTIONS_CHANGED), 1);
+  QCOMPARE(count(events, WorkflowEvent::STATE_CHANGED), 2);
+  QCOMPARE(count(events, WorkflowEvent::LOG_GROWN), 1);
+}
+
+void TestWorkflowEvents::pollingFallback() {
+  qputenv("FAKE_PROCESS_MANAGER_NO_SESSION", "1");
+  qputenv("FAKE_PROCESS_MANAGER_WORKFLOWS", "3");
+
+  ProcessManagerClient client(FAKE_PROCESS_MANAGER);
+  WorkflowEventSource source(&client);
+  QObject receiver;
+  std::vector<WorkflowEvent> events;
+  source.subscribe(&receiver, [&events](const WorkflowEvent& event) { events.push_back(event); });
+
+  QTRY_COMPARE(events.size(), size_t(3));
+  QVERIFY(!source.isPushing());
+
+  // further polls see the same workflows and must not report them again
+  QTest::qWait(3 * WorkflowEventSource::POLL_INTERVAL);
+  QCOMPARE(events.size(), size_t(3));
+}
+
+void TestWorkflowEvents::pollingDetectsInteractionsAndLog() {
+  QTemporaryDir log_dir;
+  QVERIFY(log_dir.isValid());
+  QFile log(log_dir.filePath("1.log"));
+  QVERIFY(log.open(QIODevice::WriteOnly));
+  log.write("first line\n");
+  log.flush();
+
+  qputenv("FAKE_PROCESS_MANAGER_NO_SESSION", "1");
+  qputenv("FAKE_PROCESS_MANAGER_WORKFLOWS", "1");
+  qputenv("FAKE_PROCESS_MANAGER_STATE", "Needs_interaction");
+  qputenv("FAKE_PROCESS_MANAGER_LOG_DIR", log_dir.path().toUtf8());
+
+  ProcessManagerClient client(FAKE_PROCESS_MANAGER);
+  WorkflowEventSource source(&client);
+  QObject receiver;
+  std::vector<WorkflowEvent> events;
+  source.subscribe(&receiver, [&events](const WorkflowEvent& event) { events.push_back(event); });
+
+  // a workflow already waiting for input when the polling starts
+  QTRY_COMPARE(count(events, WorkflowEvent::INTERACTIONS_CHANGED), 1);
+  QTRY_COMPARE(count(events, WorkflowEvent::LOG_GROWN), 1);
+
+  log.write("second line\n");
+  log.flush();
+  QTRY_COMPARE(count(events, WorkflowEvent::LOG_GROWN), 2);
+  QCOMPARE(events.back().log_size, log.size());
+
+  // the same interactions are not reported again
+  QTest::qWait(3 * WorkflowEventSource::POLL_INTERVAL);
+  QCOMPARE(count(events, WorkflowEvent::INTERACTIONS_CHANGED), 1);
+  QCOMPARE(count(events, WorkflowEvent::STATE_CHANGED), 1);
+}
+
+void TestWorkflowEvents::hiddenReceiversAreNotPolledFor() {
+  qputenv("FAKE_PROCESS_MANAGER_NO_SESSION", "1");
+  qputenv("FAKE_PROCESS_MANAGER_WORKFLOWS", "3");
+
+  ProcessManagerClient client(FAKE_PROCESS_MANAGER);
+  WorkflowEventSource source(&client);
+  // like the widget of an inactive tab
+  QWidget receiver;
+  std::vector<WorkflowEvent> events;
+  source.subscribe(&receiver, [&events](const WorkflowEvent& event) { events.push_back(event); });
+
+  QTest::qWait(3 * WorkflowEventSource::POLL_INTERVAL);
+  QCOMPARE(events.size(), size_t(0));
+
+  receiver.show();
+  QTRY_COMPARE(events.size(), size_t(3));
+}
+
+QTEST_MAIN(TestWorkflowEvents)
@@ -0,0 +1,294 @@
+/* Copyright 2025 Karlsruhe Institute of Technology
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <QtTest/QSignalSpy>
+#include <QtTest/QTest>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QMap>
+#include <QThread>
+
+#include <plugins/infrastructure/dialogs/registertooldialog/src/executablescanner.h>
+#include <plugins/infrastructure/dialogs/registertooldialog/src/xmlhelpprober.h>
+
+#include "test_xmlhelpprober.h"
+
+/**
+ * Probes fake executables for --xmlhelp. The benchmarks run against a
+ * synthetic PATH of 10 directories with 50 fake executables each, a
+ * quarter of them supporting --xmlhelp. Run with -tickcounter or
+ * -iterations n for more stable numbers.
+ */
+
+namespace {
+
+const int SYNTHETIC_DIRECTORIES = 10;
+const int SYNTHETIC_EXECUTABLES = 50;
+
+const QString XMLHELP = "echo '<program name=\"faketool\" version=\"1.0\"><param name=\"input\" type=\"file\"/></program>'\n";
+const QString NO_XMLHELP = "echo 'unknown option --xmlhelp'\nexit 1\n";
+const QString READS_STDIN = "cat > /dev/null\n" + XMLHELP;
+const QString HANGS = "exec sleep 30\n";
+
+QMap<QString, XmlhelpProbeResult> scan(XmlhelpProber& prober, const QStringList& paths, int timeout = 10000) {
+  QMap<QString, XmlhelpProbeResult> results;
+  QObject::connect(&prober, &XmlhelpProber::probed, [&results](const XmlhelpProbeResult& result) {
+    results.insert(result.path, result);
+  });
+
+  QSignalSpy finished(&prober, &XmlhelpProber::finished);
+  prober.probe(paths);
+  if (!finished.wait(timeout)) {
+    qWarning() << "Probing did not finish in time";
+  }
+  prober.disconnect();
+  return results;
+}
+
+}
+
+void TestXmlhelpProber::init() {
+  dir = std::make_unique<QTemporaryDir>();
+  cachefile = dir->filePath("probes.json");
+  syntheticPath.clear();
+}
+
+QString TestXmlhelpProber::writeTool(const QString& name, const QString& body, const QString& directory) {
+  // every run leaves a line in probes.txt
+  QString path = (directory.isEmpty() ? dir->path() : directory) + QDir::separator() + name;
+  QFile file(path);
+  if (!file.open(QIODevice::WriteOnly)) return path;
+  file.write(QString("#!/bin/sh\necho probe >> '%1'\n%2").arg(dir->filePath("probes.txt"), body).toUtf8());
+  file.close();
+  file.setPermissions(QFile::ReadOwner | QFile::WriteOwner | QFile::ExeOwner);
+  return path;
+}
+
+int TestXmlhelpProber::probeCount() const {
+  QFile file(dir->filePath("probes.txt"));
+  if (!file.open(QIODevice::ReadOnly)) return 0;
+  return file.readAll().count('\n');
+}
+
+void TestXmlhelpProber::createSyntheticPath() {
+  for (int d = 0; d < SYNTHETIC_DIRECTORIES; ++d) {
+    QString directory = dir->filePath(QString("bin%1").arg(d));
+    QDir().mkpath(directory);
+    syntheticPath.append(directory);
+    for (int e = 0; e < SYNTHETIC_EXECUTABLES; ++e) {
+      writeTool(QString("tool%1").arg(e), e % 4 == 0 ? XMLHELP : NO_XMLHELP, directory);
+    }
+  }
+}
+
+void TestXmlhelpProber::probeResults() {
+  QString good = writeTool("good", XMLHELP);
+  QString bad = writeTool("bad", NO_XMLHELP);
+  QString reader = writeTool("reader", READS_STDIN);
+  QString hanging = writeTool("hanging", HANGS);
+  QString plain = dir->filePath("plain");
+  QFile file(plain);
+  QVERIFY(file.open(QIODevice::WriteOnly));
+  file.close();
+
+  XmlhelpProber prober(cachefile);
+  prober.setTimeout(500);
+  auto results = scan(prober, {good, bad, reader, hanging, plain});
+
+  QCOMPARE(results.size(), 5);
+  QVERIFY(results[good].xmlhelpPresent);
+  QVERIFY(!results[bad].xmlhelpPresent);
+  QVERIFY(results[bad].executable);
+  // stdin is closed, the reader does not run into the timeout
+  QVERIFY(results[reader].xmlhelpPresent);
+  QVERIFY(!results[reader].timedOut);
+  QVERIFY(results[hanging].timedOut);
+  QVERIFY(!results[hanging].xmlhelpPresent);
+  QVERIFY(!results[plain].executable);
+  QCOMPARE(prober.runningProcesses(), 0);
+
+  QVERIFY(XmlhelpProber::probeBlocking(good).xmlhelpPresent);
+  QVERIFY(XmlhelpProber::probeBlocking(hanging, 500).timedOut);
+}
+
+void TestXmlhelpProber::boundedConcurrency() {
+  QStringList paths;
+  for (int i = 0; i < 8; ++i) {
+    paths.append(writeTool(QString("slow%1").arg(i), "sleep 0.1\n" + XMLHELP));
+  }
+
+  XmlhelpProber prober(cachefile);
+  prober.setMaximumProcesses(2);
+  int mostRunning = 0;
+  connect(&prober, &XmlhelpProber::probed, this, [&] {
+    mostRunning = std::max(mostRunning, prober.runningProcesses());
+  });
+  auto results = scan(prober, paths);
+
+  QCOMPARE(results.size(), 8);
+  QVERIFY(mostRunning <= 2);
+  for (const auto& result : results) {
+    QVERIFY(result.xmlhelpPresent);
+  }
+}
+
+void TestXmlhelpProber::negativeResultsAreRemembered() {
+  QString good = writeTool("good", XMLHELP);
+  QString bad = writeTool("bad", NO_XMLHELP);
+  {
+    XmlhelpProber prober(cachefile);
+    scan(prober, {good, bad});
+  }
+  QCOMPARE(probeCount(), 2);
+
+  {
+    XmlhelpProber prober(cachefile);
+    auto results = scan(prober, {good, bad});
+    QVERIFY(results[bad].cached);
+    QVERIFY(!results[bad].xmlhelpPresent);
+    QVERIFY(!results[good].cached);
+  }
+  QCOMPARE(probeCount(), 3);
+
+  // a changed executable is run again
+  writeTool("bad", XMLHELP);
+  XmlhelpProber prober(cachefile);
+  auto results = scan(prober, {bad});
+  QVERIFY(!results[bad].cached);
+  QVERIFY(results[bad].xmlhelpPresent);
+  QCOMPARE(probeCount(), 4);
+}
+
+void TestXmlhelpProber::timeoutsAreNotRemembered() {
+  QString bad = writeTool("bad", NO_XMLHELP);
+  QString hanging = writeTool("hanging", HANGS);
+  for (int i = 0; i < 2; ++i) {
+    XmlhelpProber prober(cachefile);
+    prober.setTimeout(300);
+    auto results = scan(prober, {bad, hanging});
+    QVERIFY(results[hanging].timedOut);
+    QVERIFY(!results[hanging].cached);
+  }
+  QCOMPARE(probeCount(), 3);
+
+  // after clearing, the negative result is gone as well
+  XmlhelpProber::clearStoredResults(cachefile);
+  XmlhelpProber prober(cachefile);
+  auto results = scan(prober, {bad});
+  QVERIFY(!results[bad].cached);
+  QCOMPARE(probeCount(), 4);
+}
+
+void TestXmlhelpProber::cancelKillsProbes() {
+  QStringList paths;
+  for (int i = 0; i < 4; ++i) {
+    paths.append(writeTool(QString("hanging%1").arg(i), HANGS));
+  }
+
+  XmlhelpProber prober(cachefile);
+  prober.setMaximumProcesses(2);
+  int reported = 0;
+  connect(&prober, &XmlhelpProber::probed, this, [&reported] {
+    reported++;
+  });
+  QSignalSpy finished(&prober, &XmlhelpProber::finished);
+
+  QElapsedTimer timer;
+  timer.start();
+  prober.probe(paths);
+  QTRY_COMPARE(prober.runningProcesses(), 2);
+  prober.cancel();
+
+  QVERIFY(finished.wait(5000));
+  QVERIFY(timer.elapsed() < XmlhelpProber::DEFAULT_TIMEOUT);
+  QCOMPARE(reported, 0);
+  QCOMPARE(prober.runningProcesses(), 0);
+  QVERIFY(!QFile::exists(cachefile));
+}
+
+void TestXmlhelpProber::scannerReusesListings() {
+  createSyntheticPath();
+
+  ExecutableScanner scanner;
+  QCOMPARE(scanner.scan(syntheticPath).size(), SYNTHETIC_DIRECTORIES * SYNTHETIC_EXECUTABLES);
+  QCOMPARE(scanner.scan(syntheticPath).size(), SYNTHETIC_DIRECTORIES * SYNTHETIC_EXECUTABLES);
+  QCOMPARE(scanner.listedDirectories(), SYNTHETIC_DIRECTORIES);
+
+  // a new file changes the modification time of its directory
+  QThread::msleep(20);
+  writeTool("added", XMLHELP, syntheticPath.first());
+  QCOMPARE(scanner.scan(syntheticPath).size(), SYNTHETIC_DIRECTORIES * SYNTHETIC_EXECUTABLES + 1);
+  QCOMPARE(scanner.listedDirectories(), SYNTHETIC_DIRECTORIES + 1);
+
+  scanner.clear();
+  scanner.scan(syntheticPath);
+  QCOMPARE(scanner.listedDirectories(), 2 * SYNTHETIC_DIRECTORIES + 1);
+}
+
+void TestXmlhelpProber::benchmarkSequential() {
+  // one blocking probe after the other, like the worker threads did before
+  createSyntheticPath();
+  QStringList paths;
+  for (const auto& entry : ExecutableScanner().scan(syntheticPath)) {
+    paths.append(entry.directory + QDir::separator() + entry.name);
+  }
+
+  int present = 0;
+  QBENCHMARK_ONCE {
+    for (const auto& path : paths) {
+      present += XmlhelpProber::probeBlocking(path).xmlhelpPresent;
+    }
+  }
+  QCOMPARE(present, paths.size() / 4);
+}
+
+void TestXmlhelpProber::benchmarkProber() {
+  createSyntheticPath();
+  QStringList paths;
+  for (const auto& entry : ExecutableScanner().scan(syntheticPath)) {
+    paths.append(entry.directory + QDir::separator() + entry.name);
+  }
+
+  XmlhelpProber prober(cachefile);
+  QMap<QString, XmlhelpProbeResult> results;
+  QBENCHMARK_ONCE {
+    results = scan(prober, paths, 60000);
+  }
+  QCOMPARE(results.size(), paths.size());
+}
+
+void TestXmlhelpProber::benchmarkRememberedProber() {
+  // a second scan only runs the executables supporting --xmlhelp
+  createSyntheticPath();
+  QStringList paths;
+  for (const auto& entry : ExecutableScanner().scan(syntheticPath)) {
+    paths.append(entry.directory + QDir::separator() + entry.name);
+  }
+  {
+    XmlhelpProber prober(cachefile);
+    scan(prober, paths, 60000);
+  }
+  int probesBefore = probeCount();
+
+  XmlhelpProber prober(cachefile);
+  QMap<QString, XmlhelpProbeResult> results;
+  QBENCHMARK_ONCE {
+    results = scan(prober, paths, 60000);
+  }
+  QCOMPARE(results.size(), paths.size());
+  QCOMPARE(probeCount() - probesBefore, paths.size() / 4);
+}
+
+QTEST_GUILESS_MAIN(TestXmlhelpProber)